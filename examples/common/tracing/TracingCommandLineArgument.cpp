@@ -19,6 +19,8 @@
 
 #include <lib/support/StringSplitter.h>
 #include <lib/support/logging/CHIPLogging.h>
+#include <tracing/histogram/histogram_tracing.h>
+#include <tracing/json/async_json_tracing.h>
 #include <tracing/json/json_tracing.h>
 #include <tracing/registry.h>
 
@@ -74,6 +76,29 @@ void TracingSetup::EnableTracingFor(const char * cliArg)
             }
             chip::Tracing::Register(mJsonBackend);
         }
+        else if (StartsWith(value, "json-async:"))
+        {
+            std::string fileName(value.data() + 11, value.size() - 11);
+
+            if (fileName != "log")
+            {
+                CHIP_ERROR err = mAsyncJsonBackend.OpenFile(fileName.c_str());
+                if (err != CHIP_NO_ERROR)
+                {
+                    ChipLogError(AppServer, "Failed to open json trace output: %" CHIP_ERROR_FORMAT, err.Format());
+                }
+            }
+            else
+            {
+                mAsyncJsonBackend.CloseFile(); // just in case, ensure no file output
+            }
+            chip::Tracing::Register(mAsyncJsonBackend);
+        }
+        else if (value.data_equal("histogram"_span))
+        {
+            // Summaries are logged when tracing stops.
+            chip::Tracing::Register(mHistogramBackend);
+        }
 #if ENABLE_PERFETTO_TRACING
         else if (value.data_equal("perfetto"_span))
         {
@@ -113,6 +138,11 @@ void TracingSetup::StopTracing()
 #endif
 
     chip::Tracing::Unregister(mJsonBackend);
+    chip::Tracing::Unregister(mAsyncJsonBackend);
+
+    chip::Tracing::Unregister(mHistogramBackend);
+    mHistogramBackend.LogSummaries();
+    mHistogramBackend.Reset();
 }
 
 } // namespace CommandLineApp
@@ -75,20 +75,26 @@ void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & ev
     case TransferSession::OutputEventType::kNone:
         break;
     case TransferSession::OutputEventType::kMsgToSend: {
+        VerifyOrReturn(mExchangeCtx != nullptr);
+
         chip::Messaging::SendFlags sendFlags;
-        if (!event.msgTypeData.HasMessageType(chip::Protocols::SecureChannel::MsgType::StatusReport))
+        const bool isStatusReport = event.msgTypeData.HasMessageType(chip::Protocols::SecureChannel::MsgType::StatusReport);
+        // All messages sent from the Sender expect a response, except for a StatusReport which would indicate an error and the
+        // end of the transfer. In a windowed transfer, the response may already be expected for a previous block.
+        if (!isStatusReport && !mExchangeCtx->IsResponseExpected())
         {
-            // All messages sent from the Sender expect a response, except for a StatusReport which would indicate an error and the
-            // end of the transfer.
             sendFlags.Set(chip::Messaging::SendMessageFlags::kExpectResponse);
         }
-        VerifyOrReturn(mExchangeCtx != nullptr);
+        if (event.msgTypeData.NoAutoRequestAck)
+        {
+            sendFlags.Set(chip::Messaging::SendMessageFlags::kNoAutoRequestAck);
+        }
         err = mExchangeCtx->SendMessage(event.msgTypeData.ProtocolId, event.msgTypeData.MessageType, std::move(event.MsgData),
                                         sendFlags);
 
         if (err == CHIP_NO_ERROR)
         {
-            if (!sendFlags.Has(chip::Messaging::SendMessageFlags::kExpectResponse))
+            if (isStatusReport)
             {
                 // After sending the StatusReport, exchange context gets closed so, set mExchangeCtx to null
                 mExchangeCtx = nullptr;
@@ -111,6 +117,7 @@ void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & ev
         acceptData.MaxBlockSize = mTransfer.GetTransferBlockSize();
         acceptData.StartOffset  = mTransfer.GetStartOffset();
         acceptData.Length       = mTransfer.GetTransferLength();
+        acceptData.WindowSize   = mTransfer.GetTransferWindowSize();
         VerifyOrReturn(mTransfer.AcceptTransfer(acceptData) == CHIP_NO_ERROR,
                        ChipLogError(BDX, "AcceptTransfer failed: %" CHIP_ERROR_FORMAT, err.Format()));
 
@@ -225,6 +225,7 @@ CHIP_ERROR AccessControl::Init(AccessControl::Delegate * delegate, DeviceTypeRes
     {
         mDelegate           = delegate;
         mDeviceTypeResolver = &deviceTypeResolver;
+        InvalidateDecisions();
     }
 
     return retval;
@@ -236,6 +237,7 @@ void AccessControl::Finish()
     ChipLogProgress(DataManagement, "AccessControl: finishing");
     mDelegate->Finish();
     mDelegate = nullptr;
+    InvalidateDecisions();
 
     if (IsGroupAuxiliaryDelegateRegistered())
     {
@@ -362,12 +364,77 @@ CHIP_ERROR AccessControl::Check(const SubjectDescriptor & subjectDescriptor, con
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(IsValidPrivilege(requestPrivilege), CHIP_ERROR_INVALID_ARGUMENT);
 
-    CHIP_ERROR result = CheckACL(subjectDescriptor, requestPath, requestPrivilege);
+    bool clusterWide;
+    CHIP_ERROR result = CheckGrant(subjectDescriptor, requestPath, requestPrivilege, clusterWide);
+
+    // CheckARL runs last: it must apply to grants from ACL or the AuxiliaryACL fallback.
+#if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
+    if (result == CHIP_NO_ERROR)
+    {
+        result = CheckARL(subjectDescriptor, requestPath, requestPrivilege);
+    }
+#endif
+
+    return result;
+}
+
+CHIP_ERROR AccessControl::Check(CheckBatch & batch, const RequestPath & requestPath, Privilege requestPrivilege)
+{
+    VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(IsValidPrivilege(requestPrivilege), CHIP_ERROR_INVALID_ARGUMENT);
+
+    if (batch.mGeneration != mDecisionGeneration || batch.mEndpoint != requestPath.endpoint ||
+        batch.mCluster != requestPath.cluster)
+    {
+        batch.mGeneration = mDecisionGeneration;
+        batch.mEndpoint   = requestPath.endpoint;
+        batch.mCluster    = requestPath.cluster;
+        batch.mKnown      = 0;
+        batch.mAllowed    = 0;
+    }
+
+    const auto privilegeBit = to_underlying(requestPrivilege);
+    CHIP_ERROR result;
+    if (batch.mKnown & privilegeBit)
+    {
+        result = (batch.mAllowed & privilegeBit) ? CHIP_NO_ERROR : CHIP_ERROR_ACCESS_DENIED;
+    }
+    else
+    {
+        bool clusterWide;
+        result = CheckGrant(batch.mSubjectDescriptor, requestPath, requestPrivilege, clusterWide);
+        if (clusterWide && (result == CHIP_NO_ERROR || result == CHIP_ERROR_ACCESS_DENIED))
+        {
+            batch.mKnown = static_cast<decltype(batch.mKnown)>(batch.mKnown | privilegeBit);
+            if (result == CHIP_NO_ERROR)
+            {
+                batch.mAllowed = static_cast<decltype(batch.mAllowed)>(batch.mAllowed | privilegeBit);
+            }
+        }
+    }
+
+#if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
+    if (result == CHIP_NO_ERROR)
+    {
+        result = CheckARL(batch.mSubjectDescriptor, requestPath, requestPrivilege);
+    }
+#endif
+
+    return result;
+}
+
+CHIP_ERROR AccessControl::CheckGrant(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                     Privilege requestPrivilege, bool & clusterWide)
+{
+    CHIP_ERROR result = CheckACL(subjectDescriptor, requestPath, requestPrivilege, clusterWide);
 
     if ((CHIP_NO_ERROR != result) && (Access::AuthMode::kGroup == subjectDescriptor.authMode) &&
         (Access::RequestType::kCommandInvokeRequest == requestPath.requestType) &&
         (Access::Privilege::kOperate == requestPrivilege) && IsGroupId(subjectDescriptor.subject))
     {
+        // The fallback depends on the request type and on group data.
+        clusterWide = false;
+
         Credentials::GroupDataProvider * groups = Credentials::GetGroupDataProvider();
         VerifyOrReturnError(nullptr != groups, result);
         Credentials::GroupDataProvider::GroupInfo info;
@@ -379,20 +446,14 @@ CHIP_ERROR AccessControl::Check(const SubjectDescriptor & subjectDescriptor, con
         }
     }
 
-    // CheckARL runs last: it must apply to grants from ACL or the AuxiliaryACL fallback above.
-#if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
-    if (result == CHIP_NO_ERROR)
-    {
-        result = CheckARL(subjectDescriptor, requestPath, requestPrivilege);
-    }
-#endif
-
     return result;
 }
 
 CHIP_ERROR AccessControl::CheckACL(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
-                                   Privilege requestPrivilege)
+                                   Privilege requestPrivilege, bool & clusterWide)
 {
+    clusterWide = false;
+
 #if CHIP_PROGRESS_LOGGING && CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 1
     {
         constexpr size_t kMaxCatsToLog = 6;
@@ -428,6 +489,9 @@ CHIP_ERROR AccessControl::CheckACL(const SubjectDescriptor & subjectDescriptor,
         }
     }
 
+    // From here on, the decision only depends on the subject, the endpoint and the cluster.
+    clusterWide = true;
+
     // Operational PASE not supported for v1.0, so PASE implies commissioning, which has highest privilege.
     // Currently, subject descriptor is only PASE if this node is the responder (aka commissionee);
     // if this node is the initiator (aka commissioner) then the subject descriptor remains blank.
@@ -439,6 +503,28 @@ CHIP_ERROR AccessControl::CheckACL(const SubjectDescriptor & subjectDescriptor,
         return CHIP_NO_ERROR;
     }
 
+    {
+        CHIP_ERROR result;
+        if (mDecisionCache.Find(subjectDescriptor, requestPath, requestPrivilege, result))
+        {
+            if (result == CHIP_NO_ERROR)
+            {
+#if CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 0
+                ChipLogProgress(DataManagement, "AccessControl: allowed (cached)");
+#endif // CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 0
+            }
+            else
+            {
+                ChipLogProgress(DataManagement, "AccessControl: denied (cached)");
+            }
+            return result;
+        }
+    }
+
+    // Whether the decision only depends on the entries and the check arguments:
+    // device type targets also depend on what is currently on the endpoint.
+    bool cacheable = true;
+
     EntryIterator iterator;
     ReturnErrorOnFailure(Entries(iterator, &subjectDescriptor.fabricIndex));
 
@@ -526,10 +612,13 @@ CHIP_ERROR AccessControl::CheckACL(const SubjectDescriptor & subjectDescriptor,
                 {
                     continue;
                 }
-                if (target.flags & Entry::Target::kDeviceType &&
-                    !mDeviceTypeResolver->IsDeviceTypeOnEndpoint(target.deviceType, requestPath.endpoint))
+                if (target.flags & Entry::Target::kDeviceType)
                 {
-                    continue;
+                    cacheable = false;
+                    if (!mDeviceTypeResolver->IsDeviceTypeOnEndpoint(target.deviceType, requestPath.endpoint))
+                    {
+                        continue;
+                    }
                 }
                 targetMatched = true;
                 break;
@@ -545,11 +634,19 @@ CHIP_ERROR AccessControl::CheckACL(const SubjectDescriptor & subjectDescriptor,
         ChipLogProgress(DataManagement, "AccessControl: allowed");
 #endif // CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 0
 
+        if (cacheable)
+        {
+            mDecisionCache.Store(subjectDescriptor, requestPath, requestPrivilege, CHIP_NO_ERROR);
+        }
         return CHIP_NO_ERROR;
     }
 
     // No entry was found which passed all checks: access is denied.
     ChipLogProgress(DataManagement, "AccessControl: denied");
+    if (cacheable)
+    {
+        mDecisionCache.Store(subjectDescriptor, requestPath, requestPrivilege, CHIP_ERROR_ACCESS_DENIED);
+    }
     return CHIP_ERROR_ACCESS_DENIED;
 }
 
@@ -767,6 +864,8 @@ exit:
 void AccessControl::NotifyEntryChanged(const SubjectDescriptor * subjectDescriptor, FabricIndex fabric, size_t index,
                                        const Entry * entry, EntryListener::ChangeType changeType)
 {
+    InvalidateDecisions();
+
     for (EntryListener * listener = mEntryListener; listener != nullptr; listener = listener->mNext)
     {
         listener->OnEntryChanged(subjectDescriptor, fabric, index, entry, changeType);
@@ -25,6 +25,7 @@
 #endif
 
 #include "AuxiliaryType.h"
+#include "DecisionCache.h"
 #include "Privilege.h"
 #include "RequestPath.h"
 #include "SubjectDescriptor.h"
@@ -33,6 +34,8 @@
 #include <lib/core/Global.h>
 #include <lib/support/CodeUtils.h>
 
+#include <type_traits>
+
 // Dump function for use during development only (0 for disabled, non-zero for enabled).
 #define CHIP_ACCESS_CONTROL_DUMP_ENABLED 0
 
@@ -421,6 +424,40 @@ public:
         }
     };
 
+    /**
+     * Batches the checks of many attribute paths by a single subject, as done
+     * when expanding wildcard paths (see `Check(CheckBatch &, ...)`).
+     *
+     * Attributes of a cluster almost always share their required privilege, and
+     * the access control list grants access per endpoint and cluster. The batch
+     * remembers the decisions of the access control list for the endpoint and
+     * cluster being checked, one per privilege, so that the list is evaluated
+     * once per cluster rather than once per attribute.
+     *
+     * A batch holds no reference to access control state: it may outlive changes
+     * to the access control list, its decisions are then discarded.
+     */
+    class CheckBatch
+    {
+    public:
+        explicit CheckBatch(const SubjectDescriptor & subjectDescriptor) : mSubjectDescriptor(subjectDescriptor) {}
+
+        const SubjectDescriptor & GetSubjectDescriptor() const { return mSubjectDescriptor; }
+
+    private:
+        friend class AccessControl;
+
+        SubjectDescriptor mSubjectDescriptor;
+        uint32_t mGeneration = 0;
+        ClusterId mCluster   = kInvalidClusterId;
+        EndpointId mEndpoint = kInvalidEndpointId;
+
+        // Privilege values are distinct bits: these are sets of privileges
+        // for which a decision is known, and for which access is allowed.
+        std::underlying_type_t<Privilege> mKnown   = 0;
+        std::underlying_type_t<Privilege> mAllowed = 0;
+    };
+
     AccessControl() = default;
 
     AccessControl(const AccessControl &)             = delete;
@@ -525,6 +562,7 @@ public:
     {
         VerifyOrReturnError(entry.IsValid(), CHIP_ERROR_INVALID_ARGUMENT);
         VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+        InvalidateDecisions();
         return mDelegate->CreateEntry(index, entry, fabricIndex);
     }
 
@@ -575,6 +613,7 @@ public:
     {
         VerifyOrReturnError(entry.IsValid(), CHIP_ERROR_INVALID_ARGUMENT);
         VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+        InvalidateDecisions();
         return mDelegate->UpdateEntry(index, entry, fabricIndex);
     }
 
@@ -596,6 +635,7 @@ public:
     CHIP_ERROR DeleteEntry(size_t index, const FabricIndex * fabricIndex = nullptr)
     {
         VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+        InvalidateDecisions();
         return mDelegate->DeleteEntry(index, fabricIndex);
     }
 
@@ -731,6 +771,27 @@ public:
      */
     CHIP_ERROR Check(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege);
 
+    /**
+     * Check whether or not access (by the subject descriptor of a batch, to a
+     * request path, requiring a privilege) should be allowed or denied.
+     *
+     * Same as `Check` above, except that access control list decisions are
+     * reused from previous checks in the batch for the same endpoint, cluster
+     * and privilege. Access restrictions are still checked for every path.
+     * Decisions taken by a delegate are never reused, as a delegate may take
+     * the whole request path into account.
+     */
+    CHIP_ERROR Check(CheckBatch & batch, const RequestPath & requestPath, Privilege requestPrivilege);
+
+    /**
+     * Statistics of the cache of access control list decisions used by `Check`.
+     *
+     * Only checks evaluated against the access control list entries count:
+     * checks decided by the delegate, or implicitly allowed (PASE), do not.
+     */
+    const DecisionCache::Stats & GetDecisionCacheStats() const { return mDecisionCache.GetStats(); }
+    void ResetDecisionCacheStats() { mDecisionCache.ResetStats(); }
+
 #if CHIP_ACCESS_CONTROL_DUMP_ENABLED
     CHIP_ERROR Dump(const Entry & entry);
 #endif
@@ -741,11 +802,31 @@ private:
     void NotifyEntryChanged(const SubjectDescriptor * subjectDescriptor, FabricIndex fabric, size_t index, const Entry * entry,
                             EntryListener::ChangeType changeType);
 
+    // Forgets all decisions taken against the entries, as they may have changed.
+    void InvalidateDecisions()
+    {
+        mDecisionCache.Clear();
+        mDecisionGeneration++;
+    }
+
+    /**
+     * Check ACL, and the auxiliary ACL where applicable, for whether access (by a
+     * subject descriptor, to a request path, requiring a privilege) should be
+     * allowed or denied. Access restrictions are not checked.
+     *
+     * `clusterWide` is set to whether the decision holds for any request to the
+     * endpoint and cluster of the request path (i.e. whether it did not involve
+     * a delegate).
+     */
+    CHIP_ERROR CheckGrant(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege,
+                          bool & clusterWide);
+
     /**
      * Check ACL for whether access (by a subject descriptor, to a request path,
      * requiring a privilege) should be allowed or denied.
      */
-    CHIP_ERROR CheckACL(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege);
+    CHIP_ERROR CheckACL(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege,
+                        bool & clusterWide);
 
     /**
      * Check CommissioningARL or ARL (as appropriate) for whether access (by a
@@ -770,6 +851,14 @@ private:
 
     EntryListener * mEntryListener = nullptr;
 
+    // Decisions of CheckACL against the entries. Cleared on every change to
+    // the entries, including those made without notifying listeners.
+    DecisionCache mDecisionCache;
+
+    // Changes whenever the entries may have changed, so that batches can tell
+    // whether their decisions are still current.
+    uint32_t mDecisionGeneration = 0;
+
 #if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
     AccessRestrictionProvider * mAccessRestrictionProvider;
 #endif
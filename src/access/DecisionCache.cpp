@@ -0,0 +1,95 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "DecisionCache.h"
+
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+namespace Access {
+
+size_t DecisionCache::Hash(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege)
+{
+    // CATs are left out: they compare as a set, so their order must not matter.
+    uint64_t h = subjectDescriptor.subject;
+    h          = h * 31 + subjectDescriptor.fabricIndex;
+    h          = h * 31 + requestPath.endpoint;
+    h          = h * 31 + requestPath.cluster;
+    h          = h * 31 + static_cast<uint64_t>(requestPrivilege);
+
+    h ^= h >> 29;
+    h *= 0xbf58476d1ce4e5b9ull;
+    h ^= h >> 32;
+    return static_cast<size_t>(h);
+}
+
+bool DecisionCache::Matches(const Slot & slot, const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                            Privilege requestPrivilege)
+{
+    return slot.valid && slot.subject == subjectDescriptor.subject && slot.fabricIndex == subjectDescriptor.fabricIndex &&
+        slot.authMode == subjectDescriptor.authMode && slot.endpoint == requestPath.endpoint &&
+        slot.cluster == requestPath.cluster && slot.privilege == requestPrivilege && slot.cats == subjectDescriptor.cats;
+}
+
+bool DecisionCache::Find(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege,
+                         CHIP_ERROR & result)
+{
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+    const Slot & slot = mSlots[Hash(subjectDescriptor, requestPath, requestPrivilege) % kSlotCount];
+    if (Matches(slot, subjectDescriptor, requestPath, requestPrivilege))
+    {
+        mStats.hits++;
+        result = slot.allowed ? CHIP_NO_ERROR : CHIP_ERROR_ACCESS_DENIED;
+        return true;
+    }
+#endif
+    mStats.misses++;
+    return false;
+}
+
+void DecisionCache::Store(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege,
+                          CHIP_ERROR result)
+{
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+    VerifyOrReturn(result == CHIP_NO_ERROR || result == CHIP_ERROR_ACCESS_DENIED);
+
+    Slot & slot      = mSlots[Hash(subjectDescriptor, requestPath, requestPrivilege) % kSlotCount];
+    slot.subject     = subjectDescriptor.subject;
+    slot.cats        = subjectDescriptor.cats;
+    slot.cluster     = requestPath.cluster;
+    slot.endpoint    = requestPath.endpoint;
+    slot.fabricIndex = subjectDescriptor.fabricIndex;
+    slot.authMode    = subjectDescriptor.authMode;
+    slot.privilege   = requestPrivilege;
+    slot.valid       = true;
+    slot.allowed     = (result == CHIP_NO_ERROR);
+#endif
+}
+
+void DecisionCache::Clear()
+{
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+    for (auto & slot : mSlots)
+    {
+        slot.valid = false;
+    }
+#endif
+}
+
+} // namespace Access
+} // namespace chip
@@ -0,0 +1,107 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include "Privilege.h"
+#include "RequestPath.h"
+#include "SubjectDescriptor.h"
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace chip {
+namespace Access {
+
+/**
+ * Remembers recent access control list decisions, so that requests touching
+ * many paths of the same cluster (e.g. wildcard reads) do not evaluate every
+ * entry, subject and target again for each path.
+ *
+ * Decisions are keyed on everything the entry evaluation depends on: the
+ * subject descriptor (fabric, auth mode, subject, CATs), the endpoint and
+ * cluster of the request path, and the requested privilege. The cache is
+ * direct mapped: a new decision replaces whichever decision used its slot.
+ *
+ * The owner must clear the cache whenever the access control list may have
+ * changed.
+ */
+class DecisionCache
+{
+public:
+    struct Stats
+    {
+        uint32_t hits   = 0;
+        uint32_t misses = 0;
+    };
+
+    /**
+     * Looks up a decision.
+     *
+     * @retval true if a decision was found, in which case `result` is set to
+     *         CHIP_NO_ERROR (allowed) or CHIP_ERROR_ACCESS_DENIED (denied).
+     */
+    bool Find(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege,
+              CHIP_ERROR & result);
+
+    /**
+     * Stores a decision. Only CHIP_NO_ERROR and CHIP_ERROR_ACCESS_DENIED are
+     * decisions, other results are ignored.
+     */
+    void Store(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege,
+               CHIP_ERROR result);
+
+    /**
+     * Forgets all decisions. Does not reset the statistics.
+     */
+    void Clear();
+
+    const Stats & GetStats() const { return mStats; }
+    void ResetStats() { mStats = Stats(); }
+
+private:
+    struct Slot
+    {
+        NodeId subject;
+        CATValues cats;
+        ClusterId cluster;
+        EndpointId endpoint;
+        FabricIndex fabricIndex;
+        AuthMode authMode;
+        Privilege privilege;
+        bool valid;
+        bool allowed;
+    };
+
+    static size_t Hash(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege);
+    static bool Matches(const Slot & slot, const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                        Privilege requestPrivilege);
+
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+    static constexpr size_t kSlotCount = CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE;
+
+    Slot mSlots[kSlotCount] = {};
+#endif
+    Stats mStats;
+};
+
+} // namespace Access
+} // namespace chip
@@ -36,6 +36,7 @@
 #include <lib/support/CHIPMem.h>
 #include <lib/support/TestPersistentStorageDelegate.h>
 #include <lib/support/tests/ExtraPwTestMacros.h>
+#include <system/SystemClock.h>
 
 namespace {
 
@@ -448,7 +449,9 @@ constexpr DeviceTypeId invalidDeviceTypes[] = {
 class DeviceTypeResolver : public AccessControl::DeviceTypeResolver
 {
 public:
-    bool IsDeviceTypeOnEndpoint(DeviceTypeId deviceType, EndpointId endpoint) override { return false; }
+    bool IsDeviceTypeOnEndpoint(DeviceTypeId deviceType, EndpointId endpoint) override { return onEndpoint; }
+
+    bool onEndpoint = false;
 } testDeviceTypeResolver;
 
 // For testing, supports one subject and target, allows any value (valid or invalid)
@@ -2822,6 +2825,244 @@ TEST_F(TestAccessControl, TestCreateUpdateDeleteWithListener)
     EXPECT_FALSE(accessControl.IsAccessRestrictionListSupported());
 }
 
+namespace {
+
+// Prepares a view entry for kOperationalNodeId5 on fabric 1, with an optional target.
+CHIP_ERROR PrepareDecisionCacheEntry(Entry & entry, const Target * target)
+{
+    ReturnErrorOnFailure(accessControl.PrepareEntry(entry));
+    ReturnErrorOnFailure(entry.SetFabricIndex(1));
+    ReturnErrorOnFailure(entry.SetPrivilege(Privilege::kView));
+    ReturnErrorOnFailure(entry.SetAuthMode(AuthMode::kCase));
+    ReturnErrorOnFailure(entry.AddSubject(nullptr, kOperationalNodeId5));
+    if (target != nullptr)
+    {
+        ReturnErrorOnFailure(entry.AddTarget(nullptr, *target));
+    }
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+TEST_F(TestAccessControl, TestDecisionCache)
+{
+    EXPECT_SUCCESS(LoadAccessControl(accessControl, entryData1, entryData1Count));
+
+    // Cached decisions must match evaluated ones
+    accessControl.ResetDecisionCacheStats();
+    for (int pass = 0; pass < 2; pass++)
+    {
+        for (const auto & checkData : checkData1)
+        {
+            CHIP_ERROR expectedResult = checkData.allow ? CHIP_NO_ERROR : CHIP_ERROR_ACCESS_DENIED;
+            EXPECT_EQ(accessControl.Check(checkData.subjectDescriptor, checkData.requestPath, checkData.privilege), expectedResult);
+        }
+    }
+    const auto & stats = accessControl.GetDecisionCacheStats();
+    EXPECT_GT(stats.misses, 0u);
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+    EXPECT_GT(stats.hits, 0u);
+#else
+    EXPECT_EQ(stats.hits, 0u);
+#endif
+
+    SubjectDescriptor sd{ .fabricIndex = 1, .authMode = AuthMode::kCase, .subject = kOperationalNodeId5 };
+    RequestPath onOff{ .cluster = kOnOffCluster, .endpoint = 1 };
+    RequestPath levelControl{ .cluster = kLevelControlCluster, .endpoint = 1 };
+    size_t index = 0;
+
+    // Entries are scoped: the example delegate has a single entry delegate, which
+    // checks need in order to iterate the entries.
+
+    // Changes notified to listeners invalidate decisions
+    ASSERT_EQ(ClearAccessControl(accessControl), CHIP_NO_ERROR);
+    EXPECT_EQ(accessControl.Check(sd, onOff, Privilege::kView), CHIP_ERROR_ACCESS_DENIED);
+    {
+        Entry entry;
+        ASSERT_EQ(PrepareDecisionCacheEntry(entry, nullptr), CHIP_NO_ERROR);
+        ASSERT_EQ(accessControl.CreateEntry(&sd, 1, &index, entry), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(accessControl.Check(sd, onOff, Privilege::kView), CHIP_NO_ERROR);
+    EXPECT_EQ(accessControl.Check(sd, onOff, Privilege::kView), CHIP_NO_ERROR);
+    {
+        Entry entry;
+        Target target{ .flags = Target::kCluster, .cluster = kLevelControlCluster };
+        ASSERT_EQ(PrepareDecisionCacheEntry(entry, &target), CHIP_NO_ERROR);
+        ASSERT_EQ(accessControl.UpdateEntry(&sd, 1, index, entry), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(accessControl.Check(sd, onOff, Privilege::kView), CHIP_ERROR_ACCESS_DENIED);
+    EXPECT_EQ(accessControl.Check(sd, levelControl, Privilege::kView), CHIP_NO_ERROR);
+    ASSERT_EQ(accessControl.DeleteEntry(&sd, 1, index), CHIP_NO_ERROR);
+    EXPECT_EQ(accessControl.Check(sd, levelControl, Privilege::kView), CHIP_ERROR_ACCESS_DENIED);
+
+    // So do changes made directly through the delegate
+    {
+        Entry entry;
+        ASSERT_EQ(PrepareDecisionCacheEntry(entry, nullptr), CHIP_NO_ERROR);
+        ASSERT_EQ(accessControl.CreateEntry(&index, entry), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(accessControl.Check(sd, levelControl, Privilege::kView), CHIP_NO_ERROR);
+    ASSERT_EQ(accessControl.DeleteEntry(index), CHIP_NO_ERROR);
+    EXPECT_EQ(accessControl.Check(sd, levelControl, Privilege::kView), CHIP_ERROR_ACCESS_DENIED);
+
+    // Decisions depending on device types are never cached
+    {
+        Entry entry;
+        Target target{ .flags = Target::kDeviceType, .deviceType = 0x0100 };
+        ASSERT_EQ(PrepareDecisionCacheEntry(entry, &target), CHIP_NO_ERROR);
+        ASSERT_EQ(accessControl.CreateEntry(&sd, 1, &index, entry), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(accessControl.Check(sd, onOff, Privilege::kView), CHIP_ERROR_ACCESS_DENIED);
+    testDeviceTypeResolver.onEndpoint = true;
+    EXPECT_EQ(accessControl.Check(sd, onOff, Privilege::kView), CHIP_NO_ERROR);
+    testDeviceTypeResolver.onEndpoint = false;
+    EXPECT_EQ(accessControl.Check(sd, onOff, Privilege::kView), CHIP_ERROR_ACCESS_DENIED);
+}
+
+TEST_F(TestAccessControl, TestCheckBatch)
+{
+    EXPECT_SUCCESS(LoadAccessControl(accessControl, entryData1, entryData1Count));
+
+    // Batched decisions must match individual ones, whatever the order of the checks
+    for (const auto & checkData : checkData1)
+    {
+        AccessControl::CheckBatch batch(checkData.subjectDescriptor);
+        CHIP_ERROR expectedResult = checkData.allow ? CHIP_NO_ERROR : CHIP_ERROR_ACCESS_DENIED;
+        for (AttributeId attribute = 0; attribute < 3; attribute++)
+        {
+            RequestPath requestPath = checkData.requestPath;
+            requestPath.requestType = RequestType::kAttributeReadRequest;
+            requestPath.entityId    = attribute;
+            for (auto privilege : privileges)
+            {
+                EXPECT_EQ(accessControl.Check(batch, requestPath, privilege),
+                          accessControl.Check(checkData.subjectDescriptor, requestPath, privilege));
+            }
+            EXPECT_EQ(accessControl.Check(batch, requestPath, checkData.privilege), expectedResult);
+        }
+    }
+
+    // A batch may outlive changes to the entries
+    SubjectDescriptor sd{ .fabricIndex = 1, .authMode = AuthMode::kCase, .subject = kOperationalNodeId5 };
+    RequestPath onOff{ .cluster = kOnOffCluster, .endpoint = 1, .requestType = RequestType::kAttributeReadRequest };
+    size_t index = 0;
+
+    ASSERT_EQ(ClearAccessControl(accessControl), CHIP_NO_ERROR);
+    AccessControl::CheckBatch batch(sd);
+    EXPECT_EQ(accessControl.Check(batch, onOff, Privilege::kView), CHIP_ERROR_ACCESS_DENIED);
+    {
+        Entry entry;
+        ASSERT_EQ(PrepareDecisionCacheEntry(entry, nullptr), CHIP_NO_ERROR);
+        ASSERT_EQ(accessControl.CreateEntry(&index, entry), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(accessControl.Check(batch, onOff, Privilege::kView), CHIP_NO_ERROR);
+    ASSERT_EQ(accessControl.DeleteEntry(&sd, 1, index), CHIP_NO_ERROR);
+    EXPECT_EQ(accessControl.Check(batch, onOff, Privilege::kView), CHIP_ERROR_ACCESS_DENIED);
+
+    // PASE is implicitly allowed
+    AccessControl::CheckBatch paseBatch({ .fabricIndex = 1, .authMode = AuthMode::kPase, .subject = kPaseVerifier0 });
+    EXPECT_EQ(accessControl.Check(paseBatch, onOff, Privilege::kAdminister), CHIP_NO_ERROR);
+    EXPECT_EQ(accessControl.Check(paseBatch, onOff, Privilege::kAdminister), CHIP_NO_ERROR);
+}
+
+namespace {
+
+enum class WildcardCheckMode
+{
+    kUncached, // every check is evaluated against the entries
+    kCached,   // checks go through the decision cache
+    kBatched,  // checks go through a batch
+};
+
+// Checks access to every attribute of every cluster of every endpoint, the way
+// a wildcard read does, and returns the average time per check in nanoseconds.
+uint64_t CheckWildcardRead(const SubjectDescriptor & subjectDescriptor, EndpointId endpointCount, ClusterId clusterCount,
+                           uint32_t attributeCount, WildcardCheckMode mode)
+{
+    AccessControl::CheckBatch batch(subjectDescriptor);
+
+    const System::Clock::Microseconds64 start = System::SystemClock().GetMonotonicMicroseconds64();
+    uint64_t checks                           = 0;
+    ClusterId base                            = 0;
+    for (EndpointId endpoint = 0; endpoint < endpointCount; endpoint++)
+    {
+        for (ClusterId cluster = 0; cluster < clusterCount; cluster++)
+        {
+            for (uint32_t attribute = 0; attribute < attributeCount; attribute++)
+            {
+                // Uncached checks use distinct clusters: no two checks then share a cache key,
+                // so every check is evaluated against the entries as before decisions were cached.
+                RequestPath requestPath{ .cluster     = (mode == WildcardCheckMode::kUncached) ? base++ : cluster,
+                                         .endpoint    = endpoint,
+                                         .requestType = RequestType::kAttributeReadRequest,
+                                         .entityId    = attribute };
+                if (mode == WildcardCheckMode::kBatched)
+                {
+                    (void) accessControl.Check(batch, requestPath, Privilege::kView);
+                }
+                else
+                {
+                    (void) accessControl.Check(subjectDescriptor, requestPath, Privilege::kView);
+                }
+                checks++;
+            }
+        }
+    }
+    const System::Clock::Microseconds64 elapsed = System::SystemClock().GetMonotonicMicroseconds64() - start;
+    return (elapsed.count() * 1000) / checks;
+}
+
+} // namespace
+
+TEST_F(TestAccessControl, BenchmarkWildcardReadCheck)
+{
+    // Full entries naming the reader last, where only the last entry (which has
+    // no targets) grants access, so that evaluating a check walks everything.
+    const FabricIndex fabric = 1;
+    size_t maxEntries        = 0;
+    ASSERT_EQ(accessControl.GetMaxEntriesPerFabric(maxEntries), CHIP_NO_ERROR);
+    for (size_t i = 0; i < maxEntries; i++)
+    {
+        Entry entry;
+        ASSERT_EQ(accessControl.PrepareEntry(entry), CHIP_NO_ERROR);
+        ASSERT_EQ(entry.SetFabricIndex(fabric), CHIP_NO_ERROR);
+        ASSERT_EQ(entry.SetPrivilege(Privilege::kView), CHIP_NO_ERROR);
+        ASSERT_EQ(entry.SetAuthMode(AuthMode::kCase), CHIP_NO_ERROR);
+        ASSERT_EQ(entry.AddSubject(nullptr, kOperationalNodeId0), CHIP_NO_ERROR);
+        ASSERT_EQ(entry.AddSubject(nullptr, kOperationalNodeId1), CHIP_NO_ERROR);
+        ASSERT_EQ(entry.AddSubject(nullptr, kOperationalNodeId5), CHIP_NO_ERROR);
+        if (i + 1 < maxEntries)
+        {
+            ASSERT_EQ(entry.AddTarget(nullptr, { .flags = Target::kEndpoint, .endpoint = 100 }), CHIP_NO_ERROR);
+            ASSERT_EQ(entry.AddTarget(nullptr, { .flags = Target::kEndpoint, .endpoint = 101 }), CHIP_NO_ERROR);
+            ASSERT_EQ(entry.AddTarget(nullptr, { .flags = Target::kCluster, .cluster = 0xFFF1'FC00 }), CHIP_NO_ERROR);
+        }
+        ASSERT_EQ(accessControl.CreateEntry(nullptr, fabric, nullptr, entry), CHIP_NO_ERROR);
+    }
+
+    SubjectDescriptor reader{ .fabricIndex = fabric, .authMode = AuthMode::kCase, .subject = kOperationalNodeId5 };
+
+    constexpr EndpointId kEndpoints = 8;
+    constexpr ClusterId kClusters   = 20;
+    constexpr uint32_t kAttributes  = 12;
+
+    const uint64_t uncachedNs = CheckWildcardRead(reader, kEndpoints, kClusters, kAttributes, WildcardCheckMode::kUncached);
+
+    // Only count the cached pass, whose checks share one cache key per endpoint and cluster
+    accessControl.ResetDecisionCacheStats();
+    const uint64_t cachedNs = CheckWildcardRead(reader, kEndpoints, kClusters, kAttributes, WildcardCheckMode::kCached);
+    const auto & stats      = accessControl.GetDecisionCacheStats();
+    EXPECT_EQ(stats.hits + stats.misses, kEndpoints * kClusters * kAttributes);
+
+    ChipLogProgress(Test, "Wildcard read of %u paths: %u ns/check uncached, %u ns/check cached (%u hits, %u misses)",
+                    static_cast<unsigned>(kEndpoints * kClusters * kAttributes), static_cast<unsigned>(uncachedNs),
+                    static_cast<unsigned>(cachedNs), static_cast<unsigned>(stats.hits), static_cast<unsigned>(stats.misses));
+
+    const uint64_t batchedNs = CheckWildcardRead(reader, kEndpoints, kClusters, kAttributes, WildcardCheckMode::kBatched);
+    ChipLogProgress(Test, "Wildcard read of %u paths: %u ns/check batched",
+                    static_cast<unsigned>(kEndpoints * kClusters * kAttributes), static_cast<unsigned>(batchedNs));
+}
+
 TEST_F(TestAccessControl, TestBaseDelegateDefaultMethods)
 {
     AccessControl::Delegate d;
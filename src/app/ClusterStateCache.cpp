@@ -49,8 +49,8 @@ uint32_t SizeOfStatusIB(const StatusIB & aStatus)
 
 } // anonymous namespace
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetElementTLVSize(TLV::TLVReader * apData, uint32_t & aSize)
+template <bool CanEnableDataCaching, typename StorageT>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, StorageT>::GetElementTLVSize(TLV::TLVReader * apData, uint32_t & aSize)
 {
     Platform::ScopedMemoryBufferWithSize<uint8_t> backingBuffer;
     TLV::TLVReader reader;
@@ -65,22 +65,16 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetElementTLVSize(TLV::TLVR
     return CHIP_NO_ERROR;
 }
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
-                                                                 const StatusIB & aStatus)
+template <bool CanEnableDataCaching, typename StorageT>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, StorageT>::UpdateCache(const ConcreteDataAttributePath & aPath,
+                                                                           TLV::TLVReader * apData, const StatusIB & aStatus)
 {
-    AttributeState state;
-    bool endpointIsNew = false;
-
-    if (mCache.find(aPath.mEndpointId) == mCache.end())
-    {
-        //
-        // Since we might potentially be creating a new entry at mCache[aPath.mEndpointId][aPath.mClusterId] that
-        // wasn't there before, we need to check if an entry didn't exist there previously and remember that so that
-        // we can appropriately notify our clients of the addition of a new endpoint.
-        //
-        endpointIsNew = true;
-    }
+    //
+    // Since we might potentially be creating a new entry for aPath.mEndpointId that wasn't there before, we need
+    // to check if an entry didn't exist there previously and remember that so that we can appropriately notify our
+    // clients of the addition of a new endpoint.
+    //
+    const bool endpointIsNew = !mStorage.HasEndpoint(aPath.mEndpointId);
 
     if (apData)
     {
@@ -91,30 +85,23 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteD
         {
             if (mCacheData)
             {
-                Platform::ScopedMemoryBufferWithSize<uint8_t> backingBuffer;
-                backingBuffer.Calloc(elementSize);
-                VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
-                TLV::ScopedBufferTLVWriter writer(std::move(backingBuffer), elementSize);
-                ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), *apData));
-                ReturnErrorOnFailure(writer.Finalize(backingBuffer));
-
-                state.template Set<AttributeData>(std::move(backingBuffer));
+                ReturnErrorOnFailure(mStorage.SetAttributeData(aPath, *apData, elementSize));
             }
             else
             {
-                state.template Set<uint32_t>(elementSize);
+                mStorage.SetAttributeSize(aPath, elementSize);
             }
         }
         else
         {
-            state = elementSize;
+            mStorage.SetAttributeSize(aPath, elementSize);
         }
 
         //
         // Clear out the committed data version and only set it again once we have received all data for this cluster.
         // Otherwise, we may have incomplete data that looks like it's complete since it has a valid data version.
         //
-        mCache[aPath.mEndpointId][aPath.mClusterId].mCommittedDataVersion.ClearValue();
+        mStorage.GetOrCreateCluster(aPath).mCommittedDataVersion.ClearValue();
 
         // This commits a pending data version if the last report path is valid and it is different from the current path.
         if (mLastReportDataPath.IsValidConcreteClusterPath() && mLastReportDataPath != aPath)
@@ -135,7 +122,7 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteD
         // if this data item is encompassed by a wildcard path, let's go ahead and update its pending data version.
         if (foundEncompassingWildcardPath)
         {
-            mCache[aPath.mEndpointId][aPath.mClusterId].mPendingDataVersion = aPath.mDataVersion;
+            mStorage.GetOrCreateCluster(aPath).mPendingDataVersion = aPath.mDataVersion;
         }
 
         mLastReportDataPath = aPath;
@@ -146,16 +133,16 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteD
         {
             if (mCacheData)
             {
-                state.template Set<StatusIB>(aStatus);
+                mStorage.SetAttributeStatus(aPath, aStatus);
             }
             else
             {
-                state.template Set<uint32_t>(SizeOfStatusIB(aStatus));
+                mStorage.SetAttributeSize(aPath, SizeOfStatusIB(aStatus));
             }
         }
         else
         {
-            state = SizeOfStatusIB(aStatus);
+            mStorage.SetAttributeSize(aPath, SizeOfStatusIB(aStatus));
         }
     }
 
@@ -168,8 +155,6 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteD
         mAddedEndpoints.push_back(aPath.mEndpointId);
     }
 
-    mCache[aPath.mEndpointId][aPath.mClusterId].mAttributes[aPath.mAttributeId] = std::move(state);
-
     if (mCacheData)
     {
         mChangedAttributeSet.insert(aPath);
@@ -178,9 +163,9 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteD
     return CHIP_NO_ERROR;
 }
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateEventCache(const EventHeader & aEventHeader, TLV::TLVReader * apData,
-                                                                      const StatusIB * apStatus)
+template <bool CanEnableDataCaching, typename StorageT>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, StorageT>::UpdateEventCache(const EventHeader & aEventHeader,
+                                                                                TLV::TLVReader * apData, const StatusIB * apStatus)
 {
     if (apData)
     {
@@ -227,14 +212,14 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateEventCache(const Even
     return CHIP_NO_ERROR;
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::NotifySubscriptionStillActive(const ReadClient & aReadClient)
+template <bool CanEnableDataCaching, typename StorageT>
+void ClusterStateCacheT<CanEnableDataCaching, StorageT>::NotifySubscriptionStillActive(const ReadClient & aReadClient)
 {
     mCallback.NotifySubscriptionStillActive(aReadClient);
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::OnReportBegin()
+template <bool CanEnableDataCaching, typename StorageT>
+void ClusterStateCacheT<CanEnableDataCaching, StorageT>::OnReportBegin()
 {
     mLastReportDataPath = ConcreteClusterPath(kInvalidEndpointId, kInvalidClusterId);
     mChangedAttributeSet.clear();
@@ -242,15 +227,15 @@ void ClusterStateCacheT<CanEnableDataCaching>::OnReportBegin()
     mCallback.OnReportBegin();
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::CommitPendingDataVersion()
+template <bool CanEnableDataCaching, typename StorageT>
+void ClusterStateCacheT<CanEnableDataCaching, StorageT>::CommitPendingDataVersion()
 {
     if (!mLastReportDataPath.IsValidConcreteClusterPath())
     {
         return;
     }
 
-    auto & lastClusterInfo = mCache[mLastReportDataPath.mEndpointId][mLastReportDataPath.mClusterId];
+    auto & lastClusterInfo = mStorage.GetOrCreateCluster(mLastReportDataPath);
     if (lastClusterInfo.mPendingDataVersion.HasValue())
     {
         lastClusterInfo.mCommittedDataVersion = lastClusterInfo.mPendingDataVersion;
@@ -258,8 +243,8 @@ void ClusterStateCacheT<CanEnableDataCaching>::CommitPendingDataVersion()
     }
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::OnReportEnd()
+template <bool CanEnableDataCaching, typename StorageT>
+void ClusterStateCacheT<CanEnableDataCaching, StorageT>::OnReportEnd()
 {
     CommitPendingDataVersion();
     mLastReportDataPath = ConcreteClusterPath(kInvalidEndpointId, kInvalidClusterId);
@@ -288,35 +273,34 @@ void ClusterStateCacheT<CanEnableDataCaching>::OnReportEnd()
     mCallback.OnReportEnd();
 }
 
-template <>
-CHIP_ERROR ClusterStateCacheT<true>::Get(const ConcreteAttributePath & path, TLV::TLVReader & reader) const
+template <bool CanEnableDataCaching, typename StorageT>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, StorageT>::Get(const ConcreteAttributePath & path,
+                                                                   TLV::TLVReader & reader) const
 {
-    CHIP_ERROR err;
-    auto attributeState = GetAttributeState(path.mEndpointId, path.mClusterId, path.mAttributeId, err);
-    ReturnErrorOnFailure(err);
+    if constexpr (!CanEnableDataCaching)
+    {
+        return CHIP_ERROR_KEY_NOT_FOUND;
+    }
+
+    CachedAttributeState attributeState;
+    ReturnErrorOnFailure(mStorage.GetAttribute(path, attributeState));
 
-    if (attributeState->template Is<StatusIB>())
+    if (attributeState.Is<StatusIB>())
     {
         return CHIP_ERROR_IM_STATUS_CODE_RECEIVED;
     }
 
-    if (!attributeState->template Is<AttributeData>())
+    if (!attributeState.Is<ByteSpan>())
     {
         return CHIP_ERROR_KEY_NOT_FOUND;
     }
 
-    reader.Init(attributeState->template Get<AttributeData>().Get(), attributeState->template Get<AttributeData>().AllocatedSize());
+    reader.Init(attributeState.Get<ByteSpan>());
     return reader.Next();
 }
 
-template <>
-CHIP_ERROR ClusterStateCacheT<false>::Get(const ConcreteAttributePath & path, TLV::TLVReader & reader) const
-{
-    return CHIP_ERROR_KEY_NOT_FOUND;
-}
-
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::Get(EventNumber eventNumber, TLV::TLVReader & reader) const
+template <bool CanEnableDataCaching, typename StorageT>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, StorageT>::Get(EventNumber eventNumber, TLV::TLVReader & reader) const
 {
     CHIP_ERROR err;
 
@@ -332,67 +316,9 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::Get(EventNumber eventNumber
     return CHIP_NO_ERROR;
 }
 
-template <bool CanEnableDataCaching>
-const typename ClusterStateCacheT<CanEnableDataCaching>::EndpointState *
-ClusterStateCacheT<CanEnableDataCaching>::GetEndpointState(EndpointId endpointId, CHIP_ERROR & err) const
-{
-    auto endpointIter = mCache.find(endpointId);
-    if (endpointIter == mCache.end())
-    {
-        err = CHIP_ERROR_KEY_NOT_FOUND;
-        return nullptr;
-    }
-
-    err = CHIP_NO_ERROR;
-    return &endpointIter->second;
-}
-
-template <bool CanEnableDataCaching>
-const typename ClusterStateCacheT<CanEnableDataCaching>::ClusterState *
-ClusterStateCacheT<CanEnableDataCaching>::GetClusterState(EndpointId endpointId, ClusterId clusterId, CHIP_ERROR & err) const
-{
-    auto endpointState = GetEndpointState(endpointId, err);
-    if (err != CHIP_NO_ERROR)
-    {
-        return nullptr;
-    }
-
-    auto clusterState = endpointState->find(clusterId);
-    if (clusterState == endpointState->end())
-    {
-        err = CHIP_ERROR_KEY_NOT_FOUND;
-        return nullptr;
-    }
-
-    err = CHIP_NO_ERROR;
-    return &clusterState->second;
-}
-
-template <bool CanEnableDataCaching>
-const typename ClusterStateCacheT<CanEnableDataCaching>::AttributeState *
-ClusterStateCacheT<CanEnableDataCaching>::GetAttributeState(EndpointId endpointId, ClusterId clusterId, AttributeId attributeId,
-                                                            CHIP_ERROR & err) const
-{
-    auto clusterState = GetClusterState(endpointId, clusterId, err);
-    if (err != CHIP_NO_ERROR)
-    {
-        return nullptr;
-    }
-
-    auto attributeState = clusterState->mAttributes.find(attributeId);
-    if (attributeState == clusterState->mAttributes.end())
-    {
-        err = CHIP_ERROR_KEY_NOT_FOUND;
-        return nullptr;
-    }
-
-    err = CHIP_NO_ERROR;
-    return &attributeState->second;
-}
-
-template <bool CanEnableDataCaching>
-const typename ClusterStateCacheT<CanEnableDataCaching>::EventData *
-ClusterStateCacheT<CanEnableDataCaching>::GetEventData(EventNumber eventNumber, CHIP_ERROR & err) const
+template <bool CanEnableDataCaching, typename StorageT>
+const typename ClusterStateCacheT<CanEnableDataCaching, StorageT>::EventData *
+ClusterStateCacheT<CanEnableDataCaching, StorageT>::GetEventData(EventNumber eventNumber, CHIP_ERROR & err) const
 {
     EventData compareKey;
 
@@ -408,9 +334,9 @@ ClusterStateCacheT<CanEnableDataCaching>::GetEventData(EventNumber eventNumber,
     return &(*eventData);
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
-                                                               const StatusIB & aStatus)
+template <bool CanEnableDataCaching, typename StorageT>
+void ClusterStateCacheT<CanEnableDataCaching, StorageT>::OnAttributeData(const ConcreteDataAttributePath & aPath,
+                                                                         TLV::TLVReader * apData, const StatusIB & aStatus)
 {
     //
     // Since the cache itself is a ReadClient::Callback, it may be incorrectly passed in directly when registering with the
@@ -440,21 +366,20 @@ void ClusterStateCacheT<CanEnableDataCaching>::OnAttributeData(const ConcreteDat
     mCallback.OnAttributeData(aPath, apData ? &dataSnapshot : nullptr, aStatus);
 }
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetVersion(const ConcreteClusterPath & aPath,
-                                                                Optional<DataVersion> & aVersion) const
+template <bool CanEnableDataCaching, typename StorageT>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, StorageT>::GetVersion(const ConcreteClusterPath & aPath,
+                                                                          Optional<DataVersion> & aVersion) const
 {
     VerifyOrReturnError(aPath.IsValidConcreteClusterPath(), CHIP_ERROR_INVALID_ARGUMENT);
-    CHIP_ERROR err;
-    auto clusterState = GetClusterState(aPath.mEndpointId, aPath.mClusterId, err);
-    ReturnErrorOnFailure(err);
+    auto clusterState = mStorage.FindCluster(aPath);
+    VerifyOrReturnError(clusterState != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
     aVersion = clusterState->mCommittedDataVersion;
     return CHIP_NO_ERROR;
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::OnEventData(const EventHeader & aEventHeader, TLV::TLVReader * apData,
-                                                           const StatusIB * apStatus)
+template <bool CanEnableDataCaching, typename StorageT>
+void ClusterStateCacheT<CanEnableDataCaching, StorageT>::OnEventData(const EventHeader & aEventHeader, TLV::TLVReader * apData,
+                                                                     const StatusIB * apStatus)
 {
     VerifyOrDie(apData != nullptr || apStatus != nullptr);
 
@@ -468,31 +393,29 @@ void ClusterStateCacheT<CanEnableDataCaching>::OnEventData(const EventHeader & a
     mCallback.OnEventData(aEventHeader, apData ? &dataSnapshot : nullptr, apStatus);
 }
 
-template <>
-CHIP_ERROR ClusterStateCacheT<true>::GetStatus(const ConcreteAttributePath & path, StatusIB & status) const
+template <bool CanEnableDataCaching, typename StorageT>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, StorageT>::GetStatus(const ConcreteAttributePath & path,
+                                                                         StatusIB & status) const
 {
-    CHIP_ERROR err;
+    if constexpr (!CanEnableDataCaching)
+    {
+        return CHIP_ERROR_INVALID_ARGUMENT;
+    }
 
-    auto attributeState = GetAttributeState(path.mEndpointId, path.mClusterId, path.mAttributeId, err);
-    ReturnErrorOnFailure(err);
+    CachedAttributeState attributeState;
+    ReturnErrorOnFailure(mStorage.GetAttribute(path, attributeState));
 
-    if (!attributeState->template Is<StatusIB>())
+    if (!attributeState.Is<StatusIB>())
     {
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
 
-    status = attributeState->template Get<StatusIB>();
+    status = attributeState.Get<StatusIB>();
     return CHIP_NO_ERROR;
 }
 
-template <>
-CHIP_ERROR ClusterStateCacheT<false>::GetStatus(const ConcreteAttributePath & path, StatusIB & status) const
-{
-    return CHIP_ERROR_INVALID_ARGUMENT;
-}
-
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetStatus(const ConcreteEventPath & path, StatusIB & status) const
+template <bool CanEnableDataCaching, typename StorageT>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, StorageT>::GetStatus(const ConcreteEventPath & path, StatusIB & status) const
 {
     auto statusIter = mEventStatusCache.find(path);
     if (statusIter == mEventStatusCache.end())
@@ -504,66 +427,50 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetStatus(const ConcreteEve
     return CHIP_NO_ERROR;
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::GetSortedFilters(std::vector<std::pair<DataVersionFilter, size_t>> & aVector) const
+template <bool CanEnableDataCaching, typename StorageT>
+void ClusterStateCacheT<CanEnableDataCaching, StorageT>::GetSortedFilters(
+    std::vector<std::pair<DataVersionFilter, size_t>> & aVector) const
 {
-    for (auto const & endpointIter : mCache)
-    {
-        EndpointId endpointId = endpointIter.first;
-        for (auto const & clusterIter : endpointIter.second)
+    RETURN_SAFELY_IGNORED mStorage.ForEachCluster([this, &aVector](const ConcreteClusterPath & clusterPath,
+                                                                     const CachedClusterState & clusterState) {
+        if (!clusterState.mCommittedDataVersion.HasValue())
         {
-            if (!clusterIter.second.mCommittedDataVersion.HasValue())
-            {
-                continue;
-            }
-            DataVersion dataVersion = clusterIter.second.mCommittedDataVersion.Value();
-            size_t clusterSize      = 0;
-            ClusterId clusterId     = clusterIter.first;
+            return CHIP_NO_ERROR;
+        }
+        DataVersion dataVersion = clusterState.mCommittedDataVersion.Value();
+        size_t clusterSize      = 0;
 
-            for (auto const & attributeIter : clusterIter.second.mAttributes)
-            {
-                if constexpr (CanEnableDataCaching)
+        RETURN_SAFELY_IGNORED mStorage.ForEachAttribute(
+            clusterPath, [&clusterSize](const ConcreteAttributePath &, const CachedAttributeState & attributeState) {
+                if (attributeState.Is<StatusIB>())
                 {
-                    if (attributeIter.second.template Is<StatusIB>())
-                    {
-                        clusterSize += SizeOfStatusIB(attributeIter.second.template Get<StatusIB>());
-                    }
-                    else if (attributeIter.second.template Is<uint32_t>())
-                    {
-                        clusterSize += attributeIter.second.template Get<uint32_t>();
-                    }
-                    else
-                    {
-                        VerifyOrDie(attributeIter.second.template Is<AttributeData>());
-                        TLV::TLVReader bufReader;
-                        bufReader.Init(attributeIter.second.template Get<AttributeData>().Get(),
-                                       attributeIter.second.template Get<AttributeData>().AllocatedSize());
-                        ReturnOnFailure(bufReader.Next());
-                        // Skip to the end of the element.
-                        ReturnOnFailure(bufReader.Skip());
-
-                        // Compute the amount of value data
-                        clusterSize += bufReader.GetLengthRead();
-                    }
+                    clusterSize += SizeOfStatusIB(attributeState.Get<StatusIB>());
+                }
+                else if (attributeState.Is<uint32_t>())
+                {
+                    clusterSize += attributeState.Get<uint32_t>();
                 }
                 else
                 {
-                    clusterSize += attributeIter.second;
+                    VerifyOrDie(attributeState.Is<ByteSpan>());
+                    // The data is a single TLV element, so its size is the amount of value data.
+                    clusterSize += attributeState.Get<ByteSpan>().size();
                 }
-            }
+                return CHIP_NO_ERROR;
+            });
 
-            if (clusterSize == 0)
-            {
-                // No data in this cluster, so no point in sending a dataVersion
-                // along at all.
-                continue;
-            }
+        if (clusterSize == 0)
+        {
+            // No data in this cluster, so no point in sending a dataVersion
+            // along at all.
+            return CHIP_NO_ERROR;
+        }
 
-            DataVersionFilter filter(endpointId, clusterId, dataVersion);
+        DataVersionFilter filter(clusterPath.mEndpointId, clusterPath.mClusterId, dataVersion);
 
-            aVector.push_back(std::make_pair(filter, clusterSize));
-        }
-    }
+        aVector.push_back(std::make_pair(filter, clusterSize));
+        return CHIP_NO_ERROR;
+    });
 
     std::sort(aVector.begin(), aVector.end(),
               [](const std::pair<DataVersionFilter, size_t> & x, const std::pair<DataVersionFilter, size_t> & y) {
@@ -571,8 +478,8 @@ void ClusterStateCacheT<CanEnableDataCaching>::GetSortedFilters(std::vector<std:
               });
 }
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::OnUpdateDataVersionFilterList(
+template <bool CanEnableDataCaching, typename StorageT>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, StorageT>::OnUpdateDataVersionFilterList(
     DataVersionFilterIBs::Builder & aDataVersionFilterIBsBuilder, const Span<AttributePathParams> & aAttributePaths,
     bool & aEncodedDataVersionList)
 {
@@ -646,49 +553,26 @@ exit:
     return err;
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::ClearAttributes(EndpointId endpointId)
+template <bool CanEnableDataCaching, typename StorageT>
+void ClusterStateCacheT<CanEnableDataCaching, StorageT>::ClearAttributes(EndpointId endpointId)
 {
-    mCache.erase(endpointId);
+    mStorage.ClearEndpoint(endpointId);
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::ClearAttributes(const ConcreteClusterPath & cluster)
+template <bool CanEnableDataCaching, typename StorageT>
+void ClusterStateCacheT<CanEnableDataCaching, StorageT>::ClearAttributes(const ConcreteClusterPath & cluster)
 {
-    // Can't use GetEndpointState here, since that only handles const things.
-    auto endpointIter = mCache.find(cluster.mEndpointId);
-    if (endpointIter == mCache.end())
-    {
-        return;
-    }
-
-    auto & endpointState = endpointIter->second;
-    endpointState.erase(cluster.mClusterId);
+    mStorage.ClearCluster(cluster);
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::ClearAttribute(const ConcreteAttributePath & attribute)
+template <bool CanEnableDataCaching, typename StorageT>
+void ClusterStateCacheT<CanEnableDataCaching, StorageT>::ClearAttribute(const ConcreteAttributePath & attribute)
 {
-    // Can't use GetClusterState here, since that only handles const things.
-    auto endpointIter = mCache.find(attribute.mEndpointId);
-    if (endpointIter == mCache.end())
-    {
-        return;
-    }
-
-    auto & endpointState = endpointIter->second;
-    auto clusterIter     = endpointState.find(attribute.mClusterId);
-    if (clusterIter == endpointState.end())
-    {
-        return;
-    }
-
-    auto & clusterState = clusterIter->second;
-    clusterState.mAttributes.erase(attribute.mAttributeId);
+    mStorage.ClearAttribute(attribute);
 }
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetLastReportDataPath(ConcreteClusterPath & aPath)
+template <bool CanEnableDataCaching, typename StorageT>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, StorageT>::GetLastReportDataPath(ConcreteClusterPath & aPath)
 {
     if (mLastReportDataPath.IsValidConcreteClusterPath())
     {
@@ -701,6 +585,7 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetLastReportDataPath(Concr
 // Ensure that our out-of-line template methods actually get compiled.
 template class ClusterStateCacheT<true>;
 template class ClusterStateCacheT<false>;
+template class ClusterStateCacheT<true, ClusterStateCacheFlatStorage>;
 
 } // namespace app
 } // namespace chip
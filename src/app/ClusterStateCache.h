@@ -24,6 +24,7 @@
 #include <app/AppConfig.h>
 #include <app/AttributePathParams.h>
 #include <app/BufferedReadCallback.h>
+#include <app/ClusterStateCacheStorage.h>
 #include <app/ConcreteAttributePath.h>
 #include <app/ReadClient.h>
 #include <app/data-model/DecodableList.h>
@@ -58,6 +59,10 @@ namespace app {
  * The data is stored internally in the cache as TLV. This permits re-use of the existing cluster objects
  * to de-serialize the state on-demand.
  *
+ * How attribute state is laid out in memory is determined by the StorageT template parameter, see
+ * ClusterStateCacheStorage.h for the available backends.  ClusterStateCacheFlat is better suited to
+ * controllers caching the full state of many nodes.
+ *
  * The cache serves as a callback adapter as well in that it 'forwards' the ReadClient::Callback calls transparently
  * through to a registered callback. In addition, it provides its own enhancements to the base ReadClient::Callback
  * to make it easier to know what has changed in the cache.
@@ -67,7 +72,7 @@ namespace app {
  * 2. The same cache cannot be used by multiple subscribe/read interactions at the same time.
  *
  */
-template <bool CanEnableDataCaching>
+template <bool CanEnableDataCaching, typename StorageT = ClusterStateCacheMapStorage<CanEnableDataCaching>>
 class ClusterStateCacheT : protected ReadClient::Callback
 {
 public:
@@ -136,14 +141,19 @@ public:
      */
     ReadClient::Callback & GetBufferedCallback() { return mBufferedReader; }
 
+    /*
+     * Storage backend of the cache, e.g. to check the arena accounting of ClusterStateCacheFlat.
+     */
+    const StorageT & GetStorage() const { return mStorage; }
+
     /*
      * Retrieve the value of an attribute from the cache (if present) given a concrete path by decoding
      * it using DataModel::Decode into the in-out argument 'value'.
      *
      * For some types of attributes, the value for the attribute is directly backed by the underlying TLV buffer
      * and has pointers into that buffer. (e.g octet strings, char strings and lists).  This buffer only remains
-     * valid until the cached value for that path is updated, so it must not be held
-     * across any async call boundaries.
+     * valid until the cached value for that path is updated (or, with ClusterStateCacheFlatStorage, until any
+     * cached value is updated), so it must not be held across any async call boundaries.
      *
      * The template parameter AttributeObjectTypeT is generally expected to be a
      * ClusterName::Attributes::AttributeName::DecodableType, but any
@@ -214,8 +224,8 @@ public:
      *
      * For some types of attributes, the value for the attribute is directly backed by the underlying TLV buffer
      * and has pointers into that buffer. (e.g octet strings, char strings and lists).  This buffer only remains
-     * valid until the cached value for that path is updated, so it must not be held
-     * across any async call boundaries.
+     * valid until the cached value for that path is updated (or, with ClusterStateCacheFlatStorage, until any
+     * cached value is updated), so it must not be held across any async call boundaries.
      *
      * The template parameter ClusterObjectT is generally expected to be a
      * ClusterName::Attributes::DecodableType, but any
@@ -261,8 +271,9 @@ public:
      * Retrieve the value of an attribute by updating a in-out TLVReader to be positioned
      * right at the attribute value.
      *
-     * The underlying TLV buffer only remains valid until the cached value for that path is updated, so it must
-     * not be held across any async call boundaries.
+     * The underlying TLV buffer only remains valid until the cached value for that path is updated (or, with
+     * ClusterStateCacheFlatStorage, until any cached value is updated), so it must not be held across any
+     * async call boundaries.
      *
      * Notable return values:
      *      - If neither data nor status for the specified path exist in the cache, CHIP_ERROR_KEY_NOT_FOUND
@@ -373,18 +384,11 @@ public:
     template <typename IteratorFunc>
     CHIP_ERROR ForEachAttribute(EndpointId endpointId, ClusterId clusterId, IteratorFunc func) const
     {
-        CHIP_ERROR err;
+        const ConcreteClusterPath clusterPath(endpointId, clusterId);
+        VerifyOrReturnError(mStorage.FindCluster(clusterPath) != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
 
-        auto clusterState = GetClusterState(endpointId, clusterId, err);
-        ReturnErrorOnFailure(err);
-
-        for (auto & attributeIter : clusterState->mAttributes)
-        {
-            const ConcreteAttributePath path(endpointId, clusterId, attributeIter.first);
-            ReturnErrorOnFailure(func(path));
-        }
-
-        return CHIP_NO_ERROR;
+        return mStorage.ForEachAttribute(
+            clusterPath, [&func](const ConcreteAttributePath & path, const CachedAttributeState &) { return func(path); });
     }
 
     /*
@@ -403,21 +407,12 @@ public:
     template <typename IteratorFunc>
     CHIP_ERROR ForEachAttribute(ClusterId clusterId, IteratorFunc func) const
     {
-        for (auto & endpointIter : mCache)
-        {
-            for (auto & clusterIter : endpointIter.second)
-            {
-                if (clusterIter.first == clusterId)
-                {
-                    for (auto & attributeIter : clusterIter.second.mAttributes)
-                    {
-                        const ConcreteAttributePath path(endpointIter.first, clusterId, attributeIter.first);
-                        ReturnErrorOnFailure(func(path));
-                    }
-                }
-            }
-        }
-        return CHIP_NO_ERROR;
+        return mStorage.ForEachCluster([this, clusterId, &func](const ConcreteClusterPath & clusterPath,
+                                                                const CachedClusterState &) {
+            VerifyOrReturnError(clusterPath.mClusterId == clusterId, CHIP_NO_ERROR);
+            return mStorage.ForEachAttribute(
+                clusterPath, [&func](const ConcreteAttributePath & path, const CachedAttributeState &) { return func(path); });
+        });
     }
 
     /*
@@ -435,18 +430,10 @@ public:
     template <typename IteratorFunc>
     CHIP_ERROR ForEachAttribute(IteratorFunc func) const
     {
-        for (const auto & [endpointId, endpointState] : mCache)
-        {
-            for (const auto & [clusterId, clusterState] : endpointState)
-            {
-                for (const auto & attributeIter : clusterState.mAttributes)
-                {
-                    const ConcreteAttributePath path(endpointId, clusterId, attributeIter.first);
-                    ReturnErrorOnFailure(func(path));
-                }
-            }
-        }
-        return CHIP_NO_ERROR;
+        return mStorage.ForEachCluster([this, &func](const ConcreteClusterPath & clusterPath, const CachedClusterState &) {
+            return mStorage.ForEachAttribute(
+                clusterPath, [&func](const ConcreteAttributePath & path, const CachedAttributeState &) { return func(path); });
+        });
     }
 
     /*
@@ -465,15 +452,9 @@ public:
     template <typename IteratorFunc>
     CHIP_ERROR ForEachCluster(EndpointId endpointId, IteratorFunc func) const
     {
-        auto endpointIter = mCache.find(endpointId);
-        if (endpointIter->first == endpointId)
-        {
-            for (auto & clusterIter : endpointIter->second)
-            {
-                ReturnErrorOnFailure(func(clusterIter.first));
-            }
-        }
-        return CHIP_NO_ERROR;
+        return mStorage.ForEachCluster(endpointId, [&func](const ConcreteClusterPath & clusterPath, const CachedClusterState &) {
+            return func(clusterPath.mClusterId);
+        });
     }
 
     /*
@@ -578,34 +559,6 @@ public:
     CHIP_ERROR GetLastReportDataPath(ConcreteClusterPath & aPath);
 
 private:
-    // An attribute state can be one of three things:
-    // * If we got a path-specific error for the attribute, the corresponding
-    //   status.
-    // * If we got data for the attribute and we are storing data ourselves, the
-    //   data.
-    // * If we got data for the attribute and we are not storing data
-    //   oureselves, the size of the data, so we can still prioritize sending
-    //   DataVersions correctly.
-    //
-    // The data for a single attribute is not going to be gigabytes in size, so
-    // using uint32_t for the size is fine; on 64-bit systems this can save
-    // quite a bit of space.
-    using AttributeData  = Platform::ScopedMemoryBufferWithSize<uint8_t>;
-    using AttributeState = std::conditional_t<CanEnableDataCaching, Variant<StatusIB, AttributeData, uint32_t>, uint32_t>;
-    // mPendingDataVersion represents a tentative data version for a cluster that we have gotten some reports for.
-    //
-    // mCurrentDataVersion represents a known data version for a cluster.  In order for this to have a
-    // value the cluster must be included in a path in mRequestPathSet that has a wildcard attribute
-    // and we must not be in the middle of receiving reports for that cluster.
-    struct ClusterState
-    {
-        std::map<AttributeId, AttributeState> mAttributes;
-        Optional<DataVersion> mPendingDataVersion;
-        Optional<DataVersion> mCommittedDataVersion;
-    };
-    using EndpointState = std::map<ClusterId, ClusterState>;
-    using NodeState     = std::map<EndpointId, EndpointState>;
-
     struct Comparator
     {
         bool operator()(const AttributePathParams & x, const AttributePathParams & y) const
@@ -628,23 +581,6 @@ private:
         }
     };
 
-    /*
-     * These functions provide a way to index into the cached state with different sub-sets of a path, returning
-     * appropriate slices of the data as requested.
-     *
-     * In all variants, the respective slice is returned if a valid path is provided. 'err' is updated to reflect
-     * the status of the operation.
-     *
-     * Notable status values:
-     *      - If a cluster instance corresponding to endpointId and clusterId doesn't exist in the cache,
-     *        CHIP_ERROR_KEY_NOT_FOUND shall be returned.
-     *
-     */
-    const EndpointState * GetEndpointState(EndpointId endpointId, CHIP_ERROR & err) const;
-    const ClusterState * GetClusterState(EndpointId endpointId, ClusterId clusterId, CHIP_ERROR & err) const;
-    const AttributeState * GetAttributeState(EndpointId endpointId, ClusterId clusterId, AttributeId attributeId,
-                                             CHIP_ERROR & err) const;
-
     const EventData * GetEventData(EventNumber number, CHIP_ERROR & err) const;
 
     /*
@@ -719,7 +655,7 @@ private:
     CHIP_ERROR GetElementTLVSize(TLV::TLVReader * apData, uint32_t & aSize);
 
     Callback & mCallback;
-    NodeState mCache;
+    StorageT mStorage;
     std::set<ConcreteAttributePath> mChangedAttributeSet;
     std::set<AttributePathParams, Comparator> mRequestPathSet; // wildcard attribute request path only
     std::vector<EndpointId> mAddedEndpoints;
@@ -734,6 +670,7 @@ private:
 
 using ClusterStateCache       = ClusterStateCacheT<true>;
 using ClusterStateCacheNoData = ClusterStateCacheT<false>;
+using ClusterStateCacheFlat   = ClusterStateCacheT<true, ClusterStateCacheFlatStorage>;
 
 };     // namespace app
 };     // namespace chip
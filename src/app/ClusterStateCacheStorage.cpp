@@ -0,0 +1,262 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/ClusterStateCacheStorage.h>
+
+#include <lib/support/SafeInt.h>
+
+#include <algorithm>
+
+namespace chip {
+namespace app {
+
+namespace {
+
+// Below this, reclaiming unused arena space is not worth copying the live data around.
+constexpr size_t kMinUnusedArenaSizeToCompact = 1024;
+
+} // anonymous namespace
+
+std::vector<ClusterStateCacheFlatStorage::ClusterEntry>::const_iterator
+ClusterStateCacheFlatStorage::LowerBoundCluster(uint64_t key) const
+{
+    return std::lower_bound(mClusters.begin(), mClusters.end(), key,
+                            [](const ClusterEntry & entry, uint64_t value) { return entry.mKey < value; });
+}
+
+std::vector<ClusterStateCacheFlatStorage::AttributeEntry>::const_iterator
+ClusterStateCacheFlatStorage::LowerBoundAttribute(uint64_t clusterKey, AttributeId attributeId) const
+{
+    return std::lower_bound(mAttributes.begin(), mAttributes.end(), std::make_pair(clusterKey, attributeId),
+                            [](const AttributeEntry & entry, const std::pair<uint64_t, AttributeId> & value) {
+                                return std::make_pair(entry.mClusterKey, entry.mAttributeId) < value;
+                            });
+}
+
+bool ClusterStateCacheFlatStorage::HasEndpoint(EndpointId endpointId) const
+{
+    auto iter = LowerBoundCluster(PackClusterPath(endpointId, 0));
+    return iter != mClusters.end() && UnpackClusterPath(iter->mKey).mEndpointId == endpointId;
+}
+
+CachedClusterState & ClusterStateCacheFlatStorage::GetOrCreateCluster(const ConcreteClusterPath & path)
+{
+    const uint64_t key = PackClusterPath(path.mEndpointId, path.mClusterId);
+    auto iter          = LowerBoundCluster(key);
+    if (iter == mClusters.end() || iter->mKey != key)
+    {
+        iter = mClusters.insert(iter, ClusterEntry{ key, CachedClusterState() });
+    }
+
+    return mClusters[static_cast<size_t>(iter - mClusters.begin())].mState;
+}
+
+const CachedClusterState * ClusterStateCacheFlatStorage::FindCluster(const ConcreteClusterPath & path) const
+{
+    const uint64_t key = PackClusterPath(path.mEndpointId, path.mClusterId);
+    auto iter          = LowerBoundCluster(key);
+    VerifyOrReturnValue(iter != mClusters.end() && iter->mKey == key, nullptr);
+    return &iter->mState;
+}
+
+ClusterStateCacheFlatStorage::AttributeEntry &
+ClusterStateCacheFlatStorage::GetOrCreateAttribute(const ConcreteAttributePath & path)
+{
+    GetOrCreateCluster(path);
+
+    const uint64_t clusterKey = PackClusterPath(path.mEndpointId, path.mClusterId);
+    auto iter                 = LowerBoundAttribute(clusterKey, path.mAttributeId);
+    if (iter == mAttributes.end() || iter->mClusterKey != clusterKey || iter->mAttributeId != path.mAttributeId)
+    {
+        iter = mAttributes.insert(iter,
+                                  AttributeEntry{ clusterKey, path.mAttributeId, 0, 0, StatusIB(), AttributeStateType::kSize });
+    }
+
+    AttributeEntry & entry = mAttributes[static_cast<size_t>(iter - mAttributes.begin())];
+    ReleaseData(entry);
+    return entry;
+}
+
+CHIP_ERROR ClusterStateCacheFlatStorage::SetAttributeData(const ConcreteAttributePath & path, TLV::TLVReader & reader,
+                                                          uint32_t size)
+{
+    const size_t offset = mArena.size();
+    VerifyOrReturnError(CanCastTo<uint32_t>(offset + size), CHIP_ERROR_NO_MEMORY);
+
+    // Copy the data first, so that a failure leaves any previous state of the attribute untouched.
+    mArena.resize(offset + size);
+
+    TLV::TLVWriter writer;
+    writer.Init(mArena.data() + offset, size);
+
+    CHIP_ERROR err = writer.CopyElement(TLV::AnonymousTag(), reader);
+    if (err == CHIP_NO_ERROR)
+    {
+        err = writer.Finalize();
+    }
+
+    if (err != CHIP_NO_ERROR)
+    {
+        mArena.resize(offset);
+        return err;
+    }
+
+    AttributeEntry & entry = GetOrCreateAttribute(path);
+    entry.mType            = AttributeStateType::kData;
+    entry.mOffset          = static_cast<uint32_t>(offset);
+    entry.mSize            = size;
+
+    CompactIfNeeded();
+    return CHIP_NO_ERROR;
+}
+
+void ClusterStateCacheFlatStorage::SetAttributeStatus(const ConcreteAttributePath & path, const StatusIB & status)
+{
+    AttributeEntry & entry = GetOrCreateAttribute(path);
+    entry.mType            = AttributeStateType::kStatus;
+    entry.mStatus          = status;
+
+    CompactIfNeeded();
+}
+
+void ClusterStateCacheFlatStorage::SetAttributeSize(const ConcreteAttributePath & path, uint32_t size)
+{
+    AttributeEntry & entry = GetOrCreateAttribute(path);
+    entry.mType            = AttributeStateType::kSize;
+    entry.mSize            = size;
+
+    CompactIfNeeded();
+}
+
+CHIP_ERROR ClusterStateCacheFlatStorage::GetAttribute(const ConcreteAttributePath & path, CachedAttributeState & state) const
+{
+    const uint64_t clusterKey = PackClusterPath(path.mEndpointId, path.mClusterId);
+    auto iter                 = LowerBoundAttribute(clusterKey, path.mAttributeId);
+    VerifyOrReturnError(iter != mAttributes.end() && iter->mClusterKey == clusterKey && iter->mAttributeId == path.mAttributeId,
+                        CHIP_ERROR_KEY_NOT_FOUND);
+
+    state = ToCachedAttributeState(*iter);
+    return CHIP_NO_ERROR;
+}
+
+CachedAttributeState ClusterStateCacheFlatStorage::ToCachedAttributeState(const AttributeEntry & entry) const
+{
+    CachedAttributeState state;
+    switch (entry.mType)
+    {
+    case AttributeStateType::kStatus:
+        state.Set<StatusIB>(entry.mStatus);
+        break;
+    case AttributeStateType::kData:
+        state.Set<ByteSpan>(mArena.data() + entry.mOffset, entry.mSize);
+        break;
+    case AttributeStateType::kSize:
+        state.Set<uint32_t>(entry.mSize);
+        break;
+    }
+    return state;
+}
+
+void ClusterStateCacheFlatStorage::ClearEndpoint(EndpointId endpointId)
+{
+    const uint64_t firstKey = PackClusterPath(endpointId, 0);
+    const uint64_t lastKey  = PackClusterPath(endpointId, kInvalidClusterId);
+
+    auto clustersEnd = std::upper_bound(mClusters.cbegin(), mClusters.cend(), lastKey,
+                                        [](uint64_t value, const ClusterEntry & entry) { return value < entry.mKey; });
+    mClusters.erase(LowerBoundCluster(firstKey), clustersEnd);
+
+    auto attributesEnd = std::upper_bound(mAttributes.cbegin(), mAttributes.cend(), lastKey,
+                                          [](uint64_t value, const AttributeEntry & entry) { return value < entry.mClusterKey; });
+    EraseAttributes(LowerBoundAttribute(firstKey, 0), attributesEnd);
+}
+
+void ClusterStateCacheFlatStorage::ClearCluster(const ConcreteClusterPath & path)
+{
+    const uint64_t key = PackClusterPath(path.mEndpointId, path.mClusterId);
+
+    auto clusterIter = LowerBoundCluster(key);
+    VerifyOrReturn(clusterIter != mClusters.end() && clusterIter->mKey == key);
+    mClusters.erase(clusterIter);
+
+    auto begin = LowerBoundAttribute(key, 0);
+    auto end   = begin;
+    while (end != mAttributes.end() && end->mClusterKey == key)
+    {
+        ++end;
+    }
+    EraseAttributes(begin, end);
+}
+
+void ClusterStateCacheFlatStorage::ClearAttribute(const ConcreteAttributePath & path)
+{
+    const uint64_t clusterKey = PackClusterPath(path.mEndpointId, path.mClusterId);
+    auto iter                 = LowerBoundAttribute(clusterKey, path.mAttributeId);
+    VerifyOrReturn(iter != mAttributes.end() && iter->mClusterKey == clusterKey && iter->mAttributeId == path.mAttributeId);
+    EraseAttributes(iter, iter + 1);
+}
+
+void ClusterStateCacheFlatStorage::EraseAttributes(std::vector<AttributeEntry>::const_iterator begin,
+                                                   std::vector<AttributeEntry>::const_iterator end)
+{
+    for (auto iter = begin; iter != end; ++iter)
+    {
+        ReleaseData(*iter);
+    }
+    mAttributes.erase(begin, end);
+
+    CompactIfNeeded();
+}
+
+void ClusterStateCacheFlatStorage::ReleaseData(const AttributeEntry & entry)
+{
+    if (entry.mType == AttributeStateType::kData)
+    {
+        mUnusedArenaSize += entry.mSize;
+    }
+}
+
+void ClusterStateCacheFlatStorage::CompactIfNeeded()
+{
+    if (mUnusedArenaSize >= kMinUnusedArenaSizeToCompact && mUnusedArenaSize > mArena.size() / 2)
+    {
+        Compact();
+    }
+}
+
+void ClusterStateCacheFlatStorage::Compact()
+{
+    std::vector<uint8_t> arena;
+    arena.reserve(mArena.size() - mUnusedArenaSize);
+
+    for (auto & entry : mAttributes)
+    {
+        if (entry.mType == AttributeStateType::kData)
+        {
+            const auto * data = mArena.data() + entry.mOffset;
+            entry.mOffset     = static_cast<uint32_t>(arena.size());
+            arena.insert(arena.end(), data, data + entry.mSize);
+        }
+    }
+
+    mArena           = std::move(arena);
+    mUnusedArenaSize = 0;
+}
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,411 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/ConcreteAttributePath.h>
+#include <app/MessageDef/StatusIB.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/core/Optional.h>
+#include <lib/core/TLV.h>
+#include <lib/support/ScopedMemoryBuffer.h>
+#include <lib/support/Span.h>
+#include <lib/support/Variant.h>
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace chip {
+namespace app {
+
+/*
+ * Data versions tracked by the ClusterStateCache for a cluster instance.
+ *
+ * mPendingDataVersion represents a tentative data version for a cluster that we have gotten some reports for.
+ *
+ * mCommittedDataVersion represents a known data version for a cluster.  In order for this to have a
+ * value the cluster must be included in a path with a wildcard attribute and we must not be in the
+ * middle of receiving reports for that cluster.
+ */
+struct CachedClusterState
+{
+    Optional<DataVersion> mPendingDataVersion;
+    Optional<DataVersion> mCommittedDataVersion;
+};
+
+/*
+ * The state of a cached attribute, as provided by a storage backend.  It can be one of three things:
+ * * If we got a path-specific error for the attribute, the corresponding status.
+ * * If we got data for the attribute and we are storing data ourselves, the TLV encoded data.
+ * * If we got data for the attribute and we are not storing data ourselves, the size of the data,
+ *   so we can still prioritize sending DataVersions correctly.
+ *
+ * Data spans point into the storage and are only valid until the storage is next modified.
+ */
+using CachedAttributeState = Variant<StatusIB, ByteSpan, uint32_t>;
+
+/*
+ * Attribute storage backends for ClusterStateCacheT.
+ *
+ * A backend keeps the attribute state and cluster data versions of a single node and provides:
+ *
+ *      bool HasEndpoint(EndpointId endpointId) const;
+ *      CachedClusterState & GetOrCreateCluster(const ConcreteClusterPath & path);
+ *      const CachedClusterState * FindCluster(const ConcreteClusterPath & path) const;
+ *
+ *      CHIP_ERROR SetAttributeData(const ConcreteAttributePath & path, TLV::TLVReader & reader, uint32_t size);
+ *      void SetAttributeStatus(const ConcreteAttributePath & path, const StatusIB & status);
+ *      void SetAttributeSize(const ConcreteAttributePath & path, uint32_t size);
+ *      CHIP_ERROR GetAttribute(const ConcreteAttributePath & path, CachedAttributeState & state) const;
+ *
+ *      // func(const ConcreteClusterPath &, const CachedClusterState &), ordered by endpoint and cluster id
+ *      CHIP_ERROR ForEachCluster(Func func) const;
+ *      CHIP_ERROR ForEachCluster(EndpointId endpointId, Func func) const;
+ *
+ *      // func(const ConcreteAttributePath &, const CachedAttributeState &), ordered by attribute id
+ *      CHIP_ERROR ForEachAttribute(const ConcreteClusterPath & path, Func func) const;
+ *
+ *      void ClearEndpoint(EndpointId endpointId);
+ *      void ClearCluster(const ConcreteClusterPath & path);
+ *      void ClearAttribute(const ConcreteAttributePath & path);
+ *
+ * The Set* methods create the cluster if it does not exist yet.  The cluster is kept when its last
+ * attribute gets cleared.  Iteration functions stop at, and return, the first error returned by func.
+ */
+
+/*
+ * Storage backend keeping nested std::maps by endpoint, cluster and attribute id, with the TLV data of
+ * every attribute in its own heap allocation.
+ *
+ * Attribute data remains valid until the cached value of that attribute is updated.
+ */
+template <bool CanEnableDataCaching>
+class ClusterStateCacheMapStorage
+{
+public:
+    bool HasEndpoint(EndpointId endpointId) const { return mCache.find(endpointId) != mCache.end(); }
+
+    CachedClusterState & GetOrCreateCluster(const ConcreteClusterPath & path) { return mCache[path.mEndpointId][path.mClusterId]; }
+
+    const CachedClusterState * FindCluster(const ConcreteClusterPath & path) const
+    {
+        auto endpointIter = mCache.find(path.mEndpointId);
+        VerifyOrReturnValue(endpointIter != mCache.end(), nullptr);
+
+        auto clusterIter = endpointIter->second.find(path.mClusterId);
+        VerifyOrReturnValue(clusterIter != endpointIter->second.end(), nullptr);
+
+        return &clusterIter->second;
+    }
+
+    CHIP_ERROR SetAttributeData(const ConcreteAttributePath & path, TLV::TLVReader & reader, uint32_t size)
+    {
+        AttributeData backingBuffer;
+        backingBuffer.Calloc(size);
+        VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+        TLV::ScopedBufferTLVWriter writer(std::move(backingBuffer), size);
+        ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), reader));
+        ReturnErrorOnFailure(writer.Finalize(backingBuffer));
+
+        GetOrCreateAttribute(path).template Set<AttributeData>(std::move(backingBuffer));
+        return CHIP_NO_ERROR;
+    }
+
+    void SetAttributeStatus(const ConcreteAttributePath & path, const StatusIB & status)
+    {
+        GetOrCreateAttribute(path).template Set<StatusIB>(status);
+    }
+
+    void SetAttributeSize(const ConcreteAttributePath & path, uint32_t size)
+    {
+        if constexpr (CanEnableDataCaching)
+        {
+            GetOrCreateAttribute(path).template Set<uint32_t>(size);
+        }
+        else
+        {
+            GetOrCreateAttribute(path) = size;
+        }
+    }
+
+    CHIP_ERROR GetAttribute(const ConcreteAttributePath & path, CachedAttributeState & state) const
+    {
+        auto clusterState = FindClusterState(path);
+        VerifyOrReturnError(clusterState != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+
+        auto attributeIter = clusterState->mAttributes.find(path.mAttributeId);
+        VerifyOrReturnError(attributeIter != clusterState->mAttributes.end(), CHIP_ERROR_KEY_NOT_FOUND);
+
+        state = ToCachedAttributeState(attributeIter->second);
+        return CHIP_NO_ERROR;
+    }
+
+    template <typename Func>
+    CHIP_ERROR ForEachCluster(Func func) const
+    {
+        for (const auto & [endpointId, endpointState] : mCache)
+        {
+            for (const auto & [clusterId, clusterState] : endpointState)
+            {
+                ReturnErrorOnFailure(func(ConcreteClusterPath(endpointId, clusterId), clusterState));
+            }
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    template <typename Func>
+    CHIP_ERROR ForEachCluster(EndpointId endpointId, Func func) const
+    {
+        auto endpointIter = mCache.find(endpointId);
+        VerifyOrReturnError(endpointIter != mCache.end(), CHIP_NO_ERROR);
+
+        for (const auto & [clusterId, clusterState] : endpointIter->second)
+        {
+            ReturnErrorOnFailure(func(ConcreteClusterPath(endpointId, clusterId), clusterState));
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    template <typename Func>
+    CHIP_ERROR ForEachAttribute(const ConcreteClusterPath & path, Func func) const
+    {
+        auto clusterState = FindClusterState(path);
+        VerifyOrReturnError(clusterState != nullptr, CHIP_NO_ERROR);
+
+        for (const auto & [attributeId, attributeState] : clusterState->mAttributes)
+        {
+            ReturnErrorOnFailure(func(ConcreteAttributePath(path.mEndpointId, path.mClusterId, attributeId),
+                                      ToCachedAttributeState(attributeState)));
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    void ClearEndpoint(EndpointId endpointId) { mCache.erase(endpointId); }
+
+    void ClearCluster(const ConcreteClusterPath & path)
+    {
+        auto endpointIter = mCache.find(path.mEndpointId);
+        VerifyOrReturn(endpointIter != mCache.end());
+        endpointIter->second.erase(path.mClusterId);
+    }
+
+    void ClearAttribute(const ConcreteAttributePath & path)
+    {
+        auto endpointIter = mCache.find(path.mEndpointId);
+        VerifyOrReturn(endpointIter != mCache.end());
+
+        auto clusterIter = endpointIter->second.find(path.mClusterId);
+        VerifyOrReturn(clusterIter != endpointIter->second.end());
+
+        clusterIter->second.mAttributes.erase(path.mAttributeId);
+    }
+
+private:
+    // The data for a single attribute is not going to be gigabytes in size, so
+    // using uint32_t for the size is fine; on 64-bit systems this can save
+    // quite a bit of space.
+    using AttributeData  = Platform::ScopedMemoryBufferWithSize<uint8_t>;
+    using AttributeState = std::conditional_t<CanEnableDataCaching, Variant<StatusIB, AttributeData, uint32_t>, uint32_t>;
+
+    struct ClusterState : public CachedClusterState
+    {
+        std::map<AttributeId, AttributeState> mAttributes;
+    };
+    using EndpointState = std::map<ClusterId, ClusterState>;
+    using NodeState     = std::map<EndpointId, EndpointState>;
+
+    const ClusterState * FindClusterState(const ConcreteClusterPath & path) const
+    {
+        return static_cast<const ClusterState *>(FindCluster(path));
+    }
+
+    AttributeState & GetOrCreateAttribute(const ConcreteAttributePath & path)
+    {
+        return mCache[path.mEndpointId][path.mClusterId].mAttributes[path.mAttributeId];
+    }
+
+    static CachedAttributeState ToCachedAttributeState(const AttributeState & attributeState)
+    {
+        CachedAttributeState state;
+        if constexpr (CanEnableDataCaching)
+        {
+            if (attributeState.template Is<StatusIB>())
+            {
+                state.Set<StatusIB>(attributeState.template Get<StatusIB>());
+            }
+            else if (attributeState.template Is<AttributeData>())
+            {
+                const AttributeData & data = attributeState.template Get<AttributeData>();
+                state.Set<ByteSpan>(data.Get(), data.AllocatedSize());
+            }
+            else
+            {
+                state.Set<uint32_t>(attributeState.template Get<uint32_t>());
+            }
+        }
+        else
+        {
+            state.Set<uint32_t>(attributeState);
+        }
+        return state;
+    }
+
+    NodeState mCache;
+};
+
+/*
+ * Storage backend keeping clusters and attributes in sorted vectors keyed by packed paths, with the TLV
+ * data of all attributes in a single arena.
+ *
+ * Compared to ClusterStateCacheMapStorage, this avoids one heap allocation per endpoint, cluster and
+ * attribute, which matters for controllers caching wildcard subscriptions to many nodes, at the cost
+ * of O(n) insertion of new paths (updates of existing paths are O(log n)).
+ *
+ * Updated and cleared attribute data is left in the arena until it makes up more than half of it, at
+ * which point the arena gets compacted.  Because of that, attribute data is only valid until the next
+ * modification of the storage.
+ */
+class ClusterStateCacheFlatStorage
+{
+public:
+    bool HasEndpoint(EndpointId endpointId) const;
+    CachedClusterState & GetOrCreateCluster(const ConcreteClusterPath & path);
+    const CachedClusterState * FindCluster(const ConcreteClusterPath & path) const;
+
+    CHIP_ERROR SetAttributeData(const ConcreteAttributePath & path, TLV::TLVReader & reader, uint32_t size);
+    void SetAttributeStatus(const ConcreteAttributePath & path, const StatusIB & status);
+    void SetAttributeSize(const ConcreteAttributePath & path, uint32_t size);
+    CHIP_ERROR GetAttribute(const ConcreteAttributePath & path, CachedAttributeState & state) const;
+
+    template <typename Func>
+    CHIP_ERROR ForEachCluster(Func func) const
+    {
+        for (const auto & cluster : mClusters)
+        {
+            ReturnErrorOnFailure(func(UnpackClusterPath(cluster.mKey), cluster.mState));
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    template <typename Func>
+    CHIP_ERROR ForEachCluster(EndpointId endpointId, Func func) const
+    {
+        for (auto iter = LowerBoundCluster(PackClusterPath(endpointId, 0));
+             iter != mClusters.end() && UnpackClusterPath(iter->mKey).mEndpointId == endpointId; ++iter)
+        {
+            ReturnErrorOnFailure(func(UnpackClusterPath(iter->mKey), iter->mState));
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    template <typename Func>
+    CHIP_ERROR ForEachAttribute(const ConcreteClusterPath & path, Func func) const
+    {
+        const uint64_t clusterKey = PackClusterPath(path.mEndpointId, path.mClusterId);
+        for (auto iter = LowerBoundAttribute(clusterKey, 0); iter != mAttributes.end() && iter->mClusterKey == clusterKey; ++iter)
+        {
+            ReturnErrorOnFailure(
+                func(ConcreteAttributePath(path.mEndpointId, path.mClusterId, iter->mAttributeId), ToCachedAttributeState(*iter)));
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    void ClearEndpoint(EndpointId endpointId);
+    void ClearCluster(const ConcreteClusterPath & path);
+    void ClearAttribute(const ConcreteAttributePath & path);
+
+    /*
+     * Moves the data of all attributes to a new arena that holds no unused bytes.  This is done
+     * automatically as attributes are updated and cleared.
+     */
+    void Compact();
+
+    /*
+     * Size of the data arena, including bytes of updated or cleared attributes that have not
+     * been reclaimed yet.
+     */
+    size_t GetArenaSize() const { return mArena.size(); }
+
+    /*
+     * Number of bytes of the data arena that are no longer used.
+     */
+    size_t GetUnusedArenaSize() const { return mUnusedArenaSize; }
+
+private:
+    enum class AttributeStateType : uint8_t
+    {
+        kStatus,
+        kData,
+        kSize,
+    };
+
+    struct ClusterEntry
+    {
+        uint64_t mKey;
+        CachedClusterState mState;
+    };
+
+    // mOffset is only meaningful for data, mSize is the data size for data and the
+    // size value for sizes.
+    struct AttributeEntry
+    {
+        uint64_t mClusterKey;
+        AttributeId mAttributeId;
+        uint32_t mOffset;
+        uint32_t mSize;
+        StatusIB mStatus;
+        AttributeStateType mType;
+    };
+
+    // Packing the endpoint id above the cluster id keeps entries ordered the same way as
+    // nested maps by endpoint and cluster id would be.
+    static constexpr uint64_t PackClusterPath(EndpointId endpointId, ClusterId clusterId)
+    {
+        return (static_cast<uint64_t>(endpointId) << 32) | clusterId;
+    }
+
+    static ConcreteClusterPath UnpackClusterPath(uint64_t key)
+    {
+        return ConcreteClusterPath(static_cast<EndpointId>(key >> 32), static_cast<ClusterId>(key));
+    }
+
+    std::vector<ClusterEntry>::const_iterator LowerBoundCluster(uint64_t key) const;
+    std::vector<AttributeEntry>::const_iterator LowerBoundAttribute(uint64_t clusterKey, AttributeId attributeId) const;
+
+    // Finds or inserts the entry for path (and its cluster).  Data previously held by the entry
+    // is released.
+    AttributeEntry & GetOrCreateAttribute(const ConcreteAttributePath & path);
+
+    // Releases the data of entries in [begin, end) and removes them.
+    void EraseAttributes(std::vector<AttributeEntry>::const_iterator begin, std::vector<AttributeEntry>::const_iterator end);
+
+    void ReleaseData(const AttributeEntry & entry);
+    void CompactIfNeeded();
+
+    CachedAttributeState ToCachedAttributeState(const AttributeEntry & entry) const;
+
+    std::vector<ClusterEntry> mClusters;
+    std::vector<AttributeEntry> mAttributes;
+    std::vector<uint8_t> mArena;
+    size_t mUnusedArenaSize = 0;
+};
+
+} // namespace app
+} // namespace chip
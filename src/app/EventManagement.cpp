@@ -66,6 +66,7 @@ struct ReclaimEventCtx
 {
     CircularEventBuffer * mpEventBuffer = nullptr;
     size_t mSpaceNeededForMovedEvent    = 0;
+    EventNumber mEventNumber            = 0;
 };
 
 /**
@@ -106,8 +107,7 @@ CHIP_ERROR EventManagement::Init(Messaging::ExchangeManager * apExchangeManager,
 
         prev = current;
 
-        current->mProcessEvictedElement = nullptr;
-        current->mAppData               = nullptr;
+        current->SetEvictionHandler(nullptr, nullptr);
     }
 
     mpEventNumberCounter = apEventNumberCounter;
@@ -124,7 +124,7 @@ CHIP_ERROR EventManagement::Init(Messaging::ExchangeManager * apExchangeManager,
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer)
+CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer, EventNumber aEventNumber)
 {
     CircularTLVWriter writer;
     CircularTLVReader reader;
@@ -135,9 +135,10 @@ CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
     CircularEventBuffer backup = *nextBuffer;
+    const uint32_t position    = nextBuffer->GetTailPosition();
 
     // Set up the next buffer s.t. it fails if needs to evict an element
-    nextBuffer->mProcessEvictedElement = AlwaysFail;
+    nextBuffer->SetEvictionHandler(AlwaysFail, nullptr);
 
     writer.Init(*nextBuffer);
 
@@ -153,6 +154,8 @@ CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer
     err = writer.Finalize();
     SuccessOrExit(err);
 
+    nextBuffer->IndexEvent(aEventNumber, position);
+
     ChipLogDetail(EventLogging, "Copy Event to next buffer with priority %u", static_cast<unsigned>(nextBuffer->GetPriority()));
 exit:
     if (err != CHIP_NO_ERROR)
@@ -195,9 +198,8 @@ CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace, P
             ctx.mpEventBuffer             = eventBuffer;
             ctx.mSpaceNeededForMovedEvent = 0;
 
-            eventBuffer->mProcessEvictedElement = EvictEvent;
-            eventBuffer->mAppData               = &ctx;
-            err                                 = eventBuffer->EvictHead();
+            eventBuffer->SetEvictionHandler(EvictEvent, &ctx);
+            err = eventBuffer->EvictHead();
 
             // one of two things happened: either the element was evicted immediately if the head's priority is same as current
             // buffer(final one), or we figured out how much space we need to evict it into the next buffer, the check happens in
@@ -215,11 +217,11 @@ CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace, P
                     // Since we're calling CopyElement and we've checked
                     // that there is space in the next buffer, we don't expect
                     // this to fail.
-                    err = CopyToNextBuffer(eventBuffer);
+                    err = CopyToNextBuffer(eventBuffer, ctx.mEventNumber);
                     SuccessOrExit(err);
                     // success; evict head unconditionally
-                    eventBuffer->mProcessEvictedElement = nullptr;
-                    err                                 = eventBuffer->EvictHead();
+                    eventBuffer->SetEvictionHandler(nullptr, nullptr);
+                    err = eventBuffer->EvictHead();
                     // if unconditional eviction failed, this
                     // means that we have no way of further
                     // clearing the buffer.  fail out and let the
@@ -255,8 +257,7 @@ CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace, P
         }
     }
 
-    mpEventBuffer->mProcessEvictedElement = nullptr;
-    mpEventBuffer->mAppData               = nullptr;
+    mpEventBuffer->SetEvictionHandler(nullptr, nullptr);
 
 exit:
     return err;
@@ -424,6 +425,7 @@ CHIP_ERROR EventManagement::LogEventPrivate(EventLoggingDelegate * apDelegate, c
     CircularTLVWriter writer;
     CHIP_ERROR err               = CHIP_NO_ERROR;
     uint32_t requestSize         = 0;
+    uint32_t position            = 0;
     aEventNumber                 = 0;
     CircularTLVWriter checkpoint = writer;
     EventLoadOutContext ctxt     = EventLoadOutContext(writer, aEventOptions.mPriority, mLastEventNumber);
@@ -465,7 +467,8 @@ CHIP_ERROR EventManagement::LogEventPrivate(EventLoggingDelegate * apDelegate, c
     err = EnsureSpaceInCircularBuffer(requestSize, aEventOptions.mPriority);
     SuccessOrExit(err);
 
-    err = ConstructEvent(&ctxt, apDelegate, &opts);
+    position = mpEventBuffer->GetTailPosition();
+    err      = ConstructEvent(&ctxt, apDelegate, &opts);
     SuccessOrExit(err);
 
     mBytesWritten += writer.GetLengthWritten();
@@ -479,6 +482,7 @@ exit:
     else if (opts.mPriority >= CHIP_CONFIG_EVENT_GLOBAL_PRIORITY)
     {
         aEventNumber = mLastEventNumber;
+        mpEventBuffer->IndexEvent(aEventNumber, position);
         VendEventNumber();
         mLastEventTimestamp = timestamp;
 #if CHIP_CONFIG_EVENT_LOGGING_VERBOSE_DEBUG_LOGS
@@ -653,6 +657,52 @@ CHIP_ERROR EventManagement::CopyEventsSince(const TLVReader & aReader, size_t aD
     return err;
 }
 
+void EventManagement::SeekEventReader(TLVReader & aReader, CircularEventBufferWrapper * apBufWrapper, EventNumber aEventMin)
+{
+    // Events are read from the highest-priority buffer down to mpEventBuffer and their numbers increase along the way, so
+    // the newest suitable entry lives in the first buffer, starting from mpEventBuffer, that has one.
+    for (auto * buffer = mpEventBuffer; buffer != nullptr; buffer = buffer->GetNextCircularEventBuffer())
+    {
+        EventNumber indexedEventNumber;
+        uint32_t offset;
+        if (!buffer->FindIndexedEvent(aEventMin, indexedEventNumber, offset))
+        {
+            continue;
+        }
+
+        CircularEventBuffer * const current = apBufWrapper->mpCurrent;
+        apBufWrapper->mpCurrent             = buffer;
+        apBufWrapper->mStartOffset          = offset;
+
+        CircularEventReader seekReader;
+        seekReader.Init(apBufWrapper);
+
+        // Only trust the entry if the event found at the recorded position is the one that was indexed.
+        TLVReader probe;
+        TLVType containerType;
+        EventEnvelopeContext event;
+        probe.Init(seekReader);
+        if (probe.Next() == CHIP_NO_ERROR && probe.EnterContainer(containerType) == CHIP_NO_ERROR &&
+            probe.Next(TLV::ContextTag(EventReportIB::Tag::kEventData)) == CHIP_NO_ERROR &&
+            probe.EnterContainer(containerType) == CHIP_NO_ERROR)
+        {
+            CHIP_ERROR err = TLV::Utilities::Iterate(probe, FetchEventParameters, &event, false /*recurse*/);
+            if ((err == CHIP_NO_ERROR || err == CHIP_END_OF_TLV) && event.mFieldsToRead == kRequiredEventField &&
+                event.mEventNumber == indexedEventNumber)
+            {
+                aReader.Init(seekReader);
+                return;
+            }
+        }
+
+        ChipLogError(EventLogging, "Event index out of sync at event number 0x" ChipLogFormatX64 ", reading the full log",
+                     ChipLogValueX64(indexedEventNumber));
+        apBufWrapper->mpCurrent    = current;
+        apBufWrapper->mStartOffset = 0;
+        return;
+    }
+}
+
 CHIP_ERROR EventManagement::FetchEventsSince(TLVWriter & aWriter, const SingleLinkedListNode<EventPathParams> * apEventPathList,
                                              EventNumber & aEventMin, size_t & aEventCount,
                                              const Access::SubjectDescriptor & aSubjectDescriptor)
@@ -669,6 +719,8 @@ CHIP_ERROR EventManagement::FetchEventsSince(TLVWriter & aWriter, const SingleLi
     err                            = GetEventReader(reader, PriorityLevel::Critical, &bufWrapper);
     SuccessOrExit(err);
 
+    SeekEventReader(reader, &bufWrapper, aEventMin);
+
     err = TLV::Utilities::Iterate(reader, CopyEventsSince, &context, recurse);
     if (err == CHIP_END_OF_TLV)
     {
@@ -842,6 +894,7 @@ CHIP_ERROR EventManagement::EvictEvent(TLVCircularBuffer & apBuffer, void * apAp
 
     ReclaimEventCtx * const ctx             = static_cast<ReclaimEventCtx *>(apAppData);
     CircularEventBuffer * const eventBuffer = ctx->mpEventBuffer;
+    ctx->mEventNumber                       = context.mEventNumber;
     if (eventBuffer->IsFinalDestinationForPriority(imp))
     {
         ChipLogProgress(EventLogging,
@@ -884,9 +937,83 @@ void CircularEventBuffer::Init(uint8_t * apBuffer, uint32_t aBufferLength, Circu
                                CircularEventBuffer * apNext, PriorityLevel aPriorityLevel)
 {
     TLVCircularBuffer::Init(apBuffer, aBufferLength);
-    mpPrev    = apPrev;
-    mpNext    = apNext;
-    mPriority = aPriorityLevel;
+    mpPrev        = apPrev;
+    mpNext        = apNext;
+    mPriority     = aPriorityLevel;
+    mIndexStart   = 0;
+    mIndexCount   = 0;
+    mHeadPosition = 0;
+
+    mProcessEvictedElement = ProcessEvictedEvent;
+    mAppData               = nullptr;
+}
+
+CHIP_ERROR CircularEventBuffer::ProcessEvictedEvent(TLVCircularBuffer & aBuffer, void * apAppData, TLVReader & aReader)
+{
+    // Only ever installed by CircularEventBuffer::Init.
+    CircularEventBuffer & eventBuffer = static_cast<CircularEventBuffer &>(aBuffer);
+
+    if (eventBuffer.mEvictionHandler != nullptr)
+    {
+        TLVReader reader;
+        reader.Init(aReader);
+        ReturnErrorOnFailure(eventBuffer.mEvictionHandler(aBuffer, eventBuffer.mEvictionAppData, reader));
+    }
+
+    // TLVCircularBuffer::EvictHead drops the element once we return successfully.
+    ReturnErrorOnFailure(aReader.Next());
+    ReturnErrorOnFailure(aReader.Skip());
+    eventBuffer.OnHeadEvicted(aReader.GetLengthRead());
+    return CHIP_NO_ERROR;
+}
+
+void CircularEventBuffer::OnHeadEvicted(uint32_t aEvictedLength)
+{
+    mHeadPosition += aEvictedLength;
+
+    // Drop the entries of the events that are being evicted; their positions now lie before the head.
+    const uint32_t remainingLength = DataLength() - aEvictedLength;
+    while ((mIndexCount > 0) && (static_cast<uint32_t>(IndexEntryAt(0).mPosition - mHeadPosition) >= remainingLength))
+    {
+        mIndexStart = static_cast<uint8_t>((mIndexStart + 1) % CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES);
+        mIndexCount--;
+    }
+}
+
+void CircularEventBuffer::IndexEvent(EventNumber aEventNumber, uint32_t aPosition)
+{
+    const uint32_t stride = GetTotalDataLength() / CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES;
+    if (mIndexCount > 0)
+    {
+        const EventIndexEntry & newest = IndexEntryAt(static_cast<uint8_t>(mIndexCount - 1));
+        VerifyOrReturn(static_cast<uint32_t>(aPosition - newest.mPosition) >= stride);
+    }
+
+    if (mIndexCount == CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES)
+    {
+        mIndexStart = static_cast<uint8_t>((mIndexStart + 1) % CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES);
+        mIndexCount--;
+    }
+
+    EventIndexEntry & entry = mIndex[(mIndexStart + mIndexCount) % CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES];
+    entry.mEventNumber      = aEventNumber;
+    entry.mPosition         = aPosition;
+    mIndexCount++;
+}
+
+bool CircularEventBuffer::FindIndexedEvent(EventNumber aEventMin, EventNumber & aEventNumber, uint32_t & aOffset) const
+{
+    for (uint8_t i = mIndexCount; i > 0; i--)
+    {
+        const EventIndexEntry & entry = IndexEntryAt(static_cast<uint8_t>(i - 1));
+        if (entry.mEventNumber <= aEventMin)
+        {
+            aEventNumber = entry.mEventNumber;
+            aOffset      = entry.mPosition - mHeadPosition;
+            return true;
+        }
+    }
+    return false;
 }
 
 bool CircularEventBuffer::IsFinalDestinationForPriority(PriorityLevel aPriority) const
@@ -912,8 +1039,8 @@ void CircularEventReader::Init(CircularEventBufferWrapper * apBufWrapper)
     if (apBufWrapper->mpCurrent == nullptr)
         return;
 
-    TEMPORARY_RETURN_IGNORED TLVReader::Init(*apBufWrapper, apBufWrapper->mpCurrent->DataLength());
-    mMaxLen = apBufWrapper->mpCurrent->DataLength();
+    TEMPORARY_RETURN_IGNORED TLVReader::Init(*apBufWrapper, apBufWrapper->mpCurrent->DataLength() - apBufWrapper->mStartOffset);
+    mMaxLen = apBufWrapper->mpCurrent->DataLength() - apBufWrapper->mStartOffset;
     for (prev = apBufWrapper->mpCurrent->GetPreviousCircularEventBuffer(); prev != nullptr;
          prev = prev->GetPreviousCircularEventBuffer())
     {
@@ -929,6 +1056,22 @@ CHIP_ERROR CircularEventBufferWrapper::GetNextBuffer(TLVReader & aReader, const
     TEMPORARY_RETURN_IGNORED mpCurrent->GetNextBuffer(aReader, aBufStart, aBufLen);
     SuccessOrExit(err);
 
+    // Skip the start of the current buffer when the reader was positioned past its head.  The data may wrap around the
+    // end of the storage, in which case the offset can extend into the second segment.
+    while ((mStartOffset > 0) && (aBufLen > 0))
+    {
+        if (mStartOffset < aBufLen)
+        {
+            aBufStart += mStartOffset;
+            aBufLen -= mStartOffset;
+            mStartOffset = 0;
+            break;
+        }
+        mStartOffset -= aBufLen;
+        aBufStart += aBufLen;
+        TEMPORARY_RETURN_IGNORED mpCurrent->GetNextBuffer(aReader, aBufStart, aBufLen);
+    }
+
     if ((aBufLen == 0) && (mpCurrent->GetPreviousCircularEventBuffer() != nullptr))
     {
         mpCurrent = mpCurrent->GetPreviousCircularEventBuffer();
@@ -130,9 +130,67 @@ public:
     void SetRequiredSpaceforEvicted(size_t aRequiredSpace) { mRequiredSpaceForEvicted = aRequiredSpace; }
     size_t GetRequiredSpaceforEvicted() const { return mRequiredSpaceForEvicted; }
 
+    /**
+     * @brief
+     *   Set the callback that processes an element before it is evicted from the buffer (internal API).
+     *
+     * The buffer installs its own TLV::TLVCircularBuffer eviction callback, which consults aHandler (if any) and then
+     * keeps the event index in step with the new head.  This covers every eviction, including the ones the writer
+     * triggers when it runs out of space, so mProcessEvictedElement and mAppData must not be set directly.
+     */
+    void SetEvictionHandler(ProcessEvictedElementFunct aHandler, void * apAppData)
+    {
+        mEvictionHandler = aHandler;
+        mEvictionAppData = apAppData;
+    }
+
+    /**
+     * @brief
+     *   The logical position of the next byte to be written to the buffer.  Positions grow monotonically (modulo
+     *   2^32) as data is appended and are what IndexEvent expects.
+     */
+    uint32_t GetTailPosition() const { return mHeadPosition + DataLength(); }
+
+    /**
+     * @brief
+     *   Record that the event with number aEventNumber starts at logical position aPosition.  Entries are only kept
+     *   for events at least 1/CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES of the buffer apart; when the index is full the
+     *   oldest entry is dropped.  Events must be indexed in increasing number order.
+     */
+    void IndexEvent(EventNumber aEventNumber, uint32_t aPosition);
+
+    /**
+     * @brief
+     *   Find the newest indexed event whose number is not larger than aEventMin.
+     *
+     * @param[in]  aEventMin    The smallest event number the caller is interested in.
+     * @param[out] aEventNumber The number of the indexed event.
+     * @param[out] aOffset      The offset of that event from the current head of the buffer.
+     *
+     * @retval true if such an event is indexed, false otherwise.
+     */
+    bool FindIndexedEvent(EventNumber aEventMin, EventNumber & aEventNumber, uint32_t & aOffset) const;
+
     ~CircularEventBuffer() override = default;
 
 private:
+    static_assert(CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES > 0 && CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES <= UINT8_MAX,
+                  "CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES must be between 1 and 255");
+
+    struct EventIndexEntry
+    {
+        EventNumber mEventNumber = 0;
+        uint32_t mPosition       = 0;
+    };
+
+    const EventIndexEntry & IndexEntryAt(uint8_t aIndex) const
+    {
+        return mIndex[(mIndexStart + aIndex) % CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES];
+    }
+
+    static CHIP_ERROR ProcessEvictedEvent(TLV::TLVCircularBuffer & aBuffer, void * apAppData, TLV::TLVReader & aReader);
+    void OnHeadEvicted(uint32_t aEvictedLength);
+
     CircularEventBuffer * mpPrev = nullptr; ///< A pointer CircularEventBuffer storing events less important events
     CircularEventBuffer * mpNext = nullptr; ///< A pointer CircularEventBuffer storing events more important events
 
@@ -141,6 +199,16 @@ private:
 
     size_t mRequiredSpaceForEvicted = 0; ///< Required space for previous buffer to evict event to new buffer
 
+    // Sparse index of the events held in the buffer, oldest entry first.  Positions are logical: mHeadPosition is the
+    // position of the current head and advances by the size of every evicted element.
+    EventIndexEntry mIndex[CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES];
+    uint8_t mIndexStart    = 0;
+    uint8_t mIndexCount    = 0;
+    uint32_t mHeadPosition = 0;
+
+    ProcessEvictedElementFunct mEvictionHandler = nullptr; ///< Decides whether the head may be evicted, see SetEvictionHandler()
+    void * mEvictionAppData                     = nullptr; ///< Context passed to mEvictionHandler
+
     CHIP_ERROR OnInit(TLV::TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override;
 };
 
@@ -157,6 +225,8 @@ class CircularEventBufferWrapper : public TLV::TLVCircularBuffer
 public:
     CircularEventBufferWrapper() : TLVCircularBuffer(nullptr, 0), mpCurrent(nullptr){};
     CircularEventBuffer * mpCurrent;
+    // Number of bytes past the head of mpCurrent at which reading starts; consumed by the first GetNextBuffer call.
+    uint32_t mStartOffset = 0;
 
 private:
     CHIP_ERROR GetNextBuffer(chip::TLV::TLVReader & aReader, const uint8_t *& aBufStart, uint32_t & aBufLen) override;
@@ -459,9 +529,10 @@ private:
      * @brief copy the event outright to next buffer with higher priority
      *
      * @param[in] apEventBuffer  CircularEventBuffer
+     * @param[in] aEventNumber   Number of the event at the head of apEventBuffer, used to index it in the next buffer
      *
      */
-    CHIP_ERROR CopyToNextBuffer(CircularEventBuffer * apEventBuffer);
+    CHIP_ERROR CopyToNextBuffer(CircularEventBuffer * apEventBuffer, EventNumber aEventNumber);
 
     /**
      * @brief Ensure that:
@@ -555,6 +626,13 @@ private:
      */
     static CHIP_ERROR CopyEvent(const TLV::TLVReader & aReader, TLV::TLVWriter & aWriter, EventLoadOutContext * apContext);
 
+    /**
+     * @brief Position aReader, which reads the whole log through apBufWrapper, at the newest indexed event whose number
+     *   is not larger than aEventMin.  Events before that point cannot be included in a fetch starting at aEventMin, so
+     *   FetchEventsSince does not need to decode them.  aReader is left untouched if no suitable event is indexed.
+     */
+    void SeekEventReader(TLV::TLVReader & aReader, CircularEventBufferWrapper * apBufWrapper, EventNumber aEventMin);
+
     /**
      * @brief
      *   A function to get the circular buffer for particular priority
@@ -143,8 +143,8 @@ bool MayHaveAccessibleEventPath(DataModel::Provider * aProvider, const EventPath
 }
 
 /// Checks if the given path/attributeId, entry are ACL-accessible
-/// for the given subject descriptor
-bool IsAccessibleAttributeEntry(const ConcreteAttributePath & path, const Access::SubjectDescriptor & subjectDescriptor,
+/// for the subject descriptor of the given ACL check batch
+bool IsAccessibleAttributeEntry(const ConcreteAttributePath & path, Access::AccessControl::CheckBatch & aclBatch,
                                 const std::optional<DataModel::AttributeEntry> & entry)
 {
     if (!entry.has_value() || !entry->GetReadPrivilege().has_value())
@@ -162,7 +162,7 @@ bool IsAccessibleAttributeEntry(const ConcreteAttributePath & path, const Access
     // the assign below is safe.
     const Access::Privilege privilege = *entry->GetReadPrivilege(); // NOLINT(bugprone-unchecked-optional-access)
 
-    return (Access::GetAccessControl().Check(subjectDescriptor, requestPath, privilege) == CHIP_NO_ERROR);
+    return (Access::GetAccessControl().Check(aclBatch, requestPath, privilege) == CHIP_NO_ERROR);
 }
 
 } // namespace
@@ -640,6 +640,9 @@ CHIP_ERROR InteractionModelEngine::ParseAttributePaths(const Access::SubjectDesc
     aHasValidAttributePath       = false;
     aRequestedAttributePathCount = 0;
 
+    // Wildcard paths expand cluster by cluster: check access once per cluster.
+    Access::AccessControl::CheckBatch aclBatch(aSubjectDescriptor);
+
     while (CHIP_NO_ERROR == (err = pathReader.Next(TLV::AnonymousTag())))
     {
         AttributePathIB::Parser path;
@@ -669,7 +672,7 @@ CHIP_ERROR InteractionModelEngine::ParseAttributePaths(const Access::SubjectDesc
                 //
                 // Here we check if the cluster is accessible at all (at least one attribute) for the
                 // given entry permissions.
-                if (IsAccessibleAttributeEntry(readPath, aSubjectDescriptor, entry))
+                if (IsAccessibleAttributeEntry(readPath, aclBatch, entry))
                 {
                     aHasValidAttributePath = true;
                     break;
@@ -683,7 +686,7 @@ CHIP_ERROR InteractionModelEngine::ParseAttributePaths(const Access::SubjectDesc
 
             std::optional<DataModel::AttributeEntry> entry = FindAttributeEntry(concretePath);
 
-            if (IsAccessibleAttributeEntry(concretePath, aSubjectDescriptor, entry))
+            if (IsAccessibleAttributeEntry(concretePath, aclBatch, entry))
             {
                 aHasValidAttributePath = true;
             }
@@ -2335,11 +2338,15 @@ MessageStats InteractionModelEngine::GetMessageStats()
 
 SubscriptionStats InteractionModelEngine::GetSubscriptionStats(FabricIndex fabric)
 {
+    const reporting::Engine::EncodedAttributeCacheStats cacheStats = mReportingEngine.GetEncodedAttributeCacheStats();
+
     return SubscriptionStats{ .numTotalSubscriptions = GetReportScheduler()->GetTotalSubscriptionsEstablished(),
                               .numCurrentSubscriptions =
                                   static_cast<uint16_t>(GetNumActiveReadHandlers(ReadHandler::InteractionType::Subscribe)),
                               .numCurrentSubscriptionsForFabric = static_cast<uint16_t>(
-                                  GetNumActiveReadHandlers(ReadHandler::InteractionType::Subscribe, fabric)) };
+                                  GetNumActiveReadHandlers(ReadHandler::InteractionType::Subscribe, fabric)),
+                              .numEncodedAttributeCacheHits   = cacheStats.mHits,
+                              .numEncodedAttributeCacheMisses = cacheStats.mMisses };
 }
 
 } // namespace app
@@ -627,6 +627,11 @@ CHIP_ERROR OperationalSessionSetup::LookupPeerAddress()
 
     NodeLookupRequest request(peerId);
 
+#if CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+    // Cached DNSSD records may be what made the previous attempt fail, so retries query the network.
+    request.SetAllowCachedResults(mAttemptsDone <= 1);
+#endif // CHIP_DEVICE_CONFIG_ENABLE_AUTOMATIC_CASE_RETRIES
+
     CHIP_ERROR err = Resolver::Instance().LookupNode(request, mAddressLookupHandle);
 
 #if CHIP_CONFIG_ENABLE_ADDRESS_RESOLVE_FALLBACK
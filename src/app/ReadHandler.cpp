@@ -118,6 +118,11 @@ void ReadHandler::OnSubscriptionResumed(const SessionHandle & sessionHandle,
             return;
         }
     }
+    if (mManagementCallback.GetInteractionModelEngine()->GetReportingEngine().RegisterInterestedPaths(this) != CHIP_NO_ERROR)
+    {
+        Close();
+        return;
+    }
 
     mSessionHandle.Grab(sessionHandle);
 
@@ -159,6 +164,7 @@ ReadHandler::~ReadHandler()
     {
         mManagementCallback.GetInteractionModelEngine()->GetReportingEngine().OnReportConfirm();
     }
+    mManagementCallback.GetInteractionModelEngine()->GetReportingEngine().UnregisterInterestedPaths(this);
     mManagementCallback.GetInteractionModelEngine()->ReleaseAttributePathList(mpAttributePathList);
     mManagementCallback.GetInteractionModelEngine()->ReleaseEventPathList(mpEventPathList);
     mManagementCallback.GetInteractionModelEngine()->ReleaseDataVersionFilterList(mpDataVersionFilterList);
@@ -529,7 +535,7 @@ CHIP_ERROR ReadHandler::ProcessAttributePaths(AttributePathIBs::Parser & aAttrib
     {
         mManagementCallback.GetInteractionModelEngine()->RemoveDuplicateConcreteAttributePath(mpAttributePathList);
         mAttributePathExpandPosition = AttributePathExpandIterator::Position::StartIterating(mpAttributePathList);
-        err                          = CHIP_NO_ERROR;
+        err = mManagementCallback.GetInteractionModelEngine()->GetReportingEngine().RegisterInterestedPaths(this);
     }
     return err;
 }
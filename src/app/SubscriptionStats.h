@@ -27,6 +27,11 @@ struct SubscriptionStats
     uint32_t numTotalSubscriptions            = 0;
     uint16_t numCurrentSubscriptions          = 0;
     uint16_t numCurrentSubscriptionsForFabric = 0;
+
+    // Attribute values the reporting engine copied from its encoded attribute cache (hits), and read and encoded because
+    // the cache had no usable encoding for them (misses), across all fabrics.
+    uint32_t numEncodedAttributeCacheHits   = 0;
+    uint32_t numEncodedAttributeCacheMisses = 0;
 };
 
 } // namespace app
@@ -72,6 +72,7 @@ CHIP_ERROR BDXDiagnosticLogsProvider::InitializeTransfer(CommandHandler * comman
     TransferSession::TransferInitData initOptions;
     initOptions.TransferCtlFlags = TransferControlFlags::kSenderDrive;
     initOptions.MaxBlockSize     = kBdxMaxBlockSize;
+    initOptions.MaxWindowSize    = CHIP_CONFIG_BDX_WINDOW_SIZE;
     initOptions.FileDesLength    = static_cast<uint16_t>(fileDesignator.size());
     initOptions.FileDesignator   = Uint8::from_const_char(fileDesignator.data());
 
@@ -151,12 +152,16 @@ void BDXDiagnosticLogsProvider::OnMsgToSend(TransferSession::OutputEvent & event
     bool isStatusReport = msgTypeData.HasMessageType(Protocols::SecureChannel::MsgType::StatusReport);
 
     // All messages sent from the Sender expect a response, except for a StatusReport which would indicate an error and the
-    // end of the transfer.
+    // end of the transfer. In a windowed transfer, the response may already be expected for a previous block.
     Messaging::SendFlags sendFlags;
-    if (!isStatusReport)
+    if (!isStatusReport && !mBDXTransferExchangeCtx->IsResponseExpected())
     {
         sendFlags.Set(Messaging::SendMessageFlags::kExpectResponse);
     }
+    if (msgTypeData.NoAutoRequestAck)
+    {
+        sendFlags.Set(Messaging::SendMessageFlags::kNoAutoRequestAck);
+    }
 
     auto err =
         mBDXTransferExchangeCtx->SendMessage(msgTypeData.ProtocolId, msgTypeData.MessageType, std::move(event.MsgData), sendFlags);
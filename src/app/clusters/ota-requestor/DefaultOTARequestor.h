@@ -153,11 +153,17 @@ private:
             VerifyOrReturnError(mExchangeCtx != nullptr, CHIP_ERROR_INCORRECT_STATE);
 
             chip::Messaging::SendFlags sendFlags;
+            // In a windowed transfer, the response may already be expected for a previous BlockQuery
             if (!event.msgTypeData.HasMessageType(chip::bdx::MessageType::BlockAckEOF) &&
-                !event.msgTypeData.HasMessageType(Protocols::SecureChannel::MsgType::StatusReport))
+                !event.msgTypeData.HasMessageType(Protocols::SecureChannel::MsgType::StatusReport) &&
+                !mExchangeCtx->IsResponseExpected())
             {
                 sendFlags.Set(chip::Messaging::SendMessageFlags::kExpectResponse);
             }
+            if (event.msgTypeData.NoAutoRequestAck)
+            {
+                sendFlags.Set(chip::Messaging::SendMessageFlags::kNoAutoRequestAck);
+            }
             CHIP_ERROR err = mExchangeCtx->SendMessage(event.msgTypeData.ProtocolId, event.msgTypeData.MessageType,
                                                        event.MsgData.Retain(), sendFlags);
             if (err != CHIP_NO_ERROR)
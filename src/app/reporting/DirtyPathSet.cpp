@@ -0,0 +1,262 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <app/reporting/DirtyPathSet.h>
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+
+#include <algorithm>
+#include <type_traits>
+
+namespace chip::app::reporting {
+
+namespace {
+
+// Entries are moved around with plain copies and grown with MemoryRealloc.
+static_assert(std::is_trivially_copyable<DirtyPathSetBase::Entry>::value);
+
+constexpr size_t kInitialHeapCapacity = 8;
+
+bool IsOrderedBefore(const AttributePathParams & a, const AttributePathParams & b)
+{
+    if (a.mEndpointId != b.mEndpointId)
+    {
+        return a.mEndpointId < b.mEndpointId;
+    }
+    if (a.mClusterId != b.mClusterId)
+    {
+        return a.mClusterId < b.mClusterId;
+    }
+    if (a.mAttributeId != b.mAttributeId)
+    {
+        return a.mAttributeId < b.mAttributeId;
+    }
+    return a.mListIndex < b.mListIndex;
+}
+
+bool IsSameKey(const AttributePathParams & a, const AttributePathParams & b)
+{
+    return a.mEndpointId == b.mEndpointId && a.mClusterId == b.mClusterId && a.mAttributeId == b.mAttributeId &&
+        a.mListIndex == b.mListIndex;
+}
+
+} // namespace
+
+DirtyPathSetBase::~DirtyPathSetBase()
+{
+    if (mHeapBacked)
+    {
+        Platform::MemoryFree(mEntries);
+    }
+}
+
+size_t DirtyPathSetBase::LowerBound(const AttributePathParams & aKey) const
+{
+    return static_cast<size_t>(std::lower_bound(mEntries, mEntries + mCount, aKey, IsOrderedBefore) - mEntries);
+}
+
+bool DirtyPathSetBase::HasEntryDirtyAfter(EndpointId aEndpointId, ClusterId aClusterId, AttributeId aAttributeId,
+                                          AttributeGeneration aGeneration) const
+{
+    for (size_t i = LowerBound(AttributePathParams(aEndpointId, aClusterId, aAttributeId, 0)); i < mCount; i++)
+    {
+        const Entry & entry = mEntries[i];
+        if (entry.mEndpointId != aEndpointId || entry.mClusterId != aClusterId || entry.mAttributeId != aAttributeId)
+        {
+            break;
+        }
+        if (entry.mGeneration.After(aGeneration))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool DirtyPathSetBase::IsDirtyAfter(const ConcreteAttributePath & aPath, AttributeGeneration aGeneration) const
+{
+    VerifyOrReturnValue(mCount > 0, false);
+
+    // A superset of a concrete path has, for each of endpoint/cluster/attribute, either the same id or a wildcard. The list
+    // index does not matter for concrete attribute paths.
+    for (const EndpointId endpoint : { aPath.mEndpointId, kInvalidEndpointId })
+    {
+        for (const ClusterId cluster : { aPath.mClusterId, kInvalidClusterId })
+        {
+            for (const AttributeId attribute : { aPath.mAttributeId, kInvalidAttributeId })
+            {
+                if (HasEntryDirtyAfter(endpoint, cluster, attribute, aGeneration))
+                {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+bool DirtyPathSetBase::MergeOverlapped(const AttributePathParams & aPath, AttributeGeneration aGeneration)
+{
+    VerifyOrReturnValue(mCount > 0, false);
+
+    // Look for an existing superset of aPath: each of its components is either equal to the one in aPath or a wildcard.
+    for (uint8_t wildcardMask = 0; wildcardMask < 16; wildcardMask++)
+    {
+        // Wildcarding a component that already is one would produce the same key as a smaller mask.
+        if (((wildcardMask & 0x1) && aPath.HasWildcardEndpointId()) || ((wildcardMask & 0x2) && aPath.HasWildcardClusterId()) ||
+            ((wildcardMask & 0x4) && aPath.HasWildcardAttributeId()) || ((wildcardMask & 0x8) && aPath.HasWildcardListIndex()))
+        {
+            continue;
+        }
+
+        AttributePathParams key = aPath;
+        key.mEndpointId         = (wildcardMask & 0x1) ? kInvalidEndpointId : aPath.mEndpointId;
+        key.mClusterId          = (wildcardMask & 0x2) ? kInvalidClusterId : aPath.mClusterId;
+        key.mAttributeId        = (wildcardMask & 0x4) ? kInvalidAttributeId : aPath.mAttributeId;
+        key.mListIndex          = (wildcardMask & 0x8) ? kInvalidListIndex : aPath.mListIndex;
+
+        size_t index = LowerBound(key);
+        if (index < mCount && IsSameKey(mEntries[index], key))
+        {
+            mEntries[index].mGeneration = aGeneration;
+            return true;
+        }
+    }
+
+    // Look for existing subsets of aPath. Concrete leading components of aPath narrow down the range to scan, since
+    // entries sharing them are contiguous.
+    size_t begin = 0;
+    size_t end   = mCount;
+    if (!aPath.HasWildcardEndpointId())
+    {
+        AttributePathParams low(aPath.mEndpointId, 0, 0, 0);
+        AttributePathParams high(static_cast<EndpointId>(aPath.mEndpointId + 1), 0, 0, 0);
+        if (!aPath.HasWildcardClusterId())
+        {
+            low.mClusterId  = aPath.mClusterId;
+            high            = low;
+            high.mClusterId = aPath.mClusterId + 1;
+            if (!aPath.HasWildcardAttributeId())
+            {
+                low.mAttributeId  = aPath.mAttributeId;
+                high              = low;
+                high.mAttributeId = aPath.mAttributeId + 1;
+            }
+        }
+        begin = LowerBound(low);
+        end   = LowerBound(high);
+    }
+
+    size_t kept = begin;
+    for (size_t i = begin; i < end; i++)
+    {
+        if (!aPath.IsAttributePathSupersetOf(mEntries[i]))
+        {
+            mEntries[kept++] = mEntries[i];
+        }
+    }
+    VerifyOrReturnValue(kept != end, false);
+
+    std::copy(mEntries + end, mEntries + mCount, mEntries + kept);
+    mCount -= end - kept;
+
+    // At least one slot was just released, so this cannot fail.
+    return Insert(aPath, aGeneration) == CHIP_NO_ERROR;
+}
+
+CHIP_ERROR DirtyPathSetBase::Insert(const AttributePathParams & aPath, AttributeGeneration aGeneration)
+{
+    if (mCount == mCapacity)
+    {
+        VerifyOrReturnError(mHeapBacked && Grow(), CHIP_ERROR_NO_MEMORY);
+    }
+
+    size_t index = LowerBound(aPath);
+    std::copy_backward(mEntries + index, mEntries + mCount, mEntries + mCount + 1);
+    mEntries[index]             = aPath;
+    mEntries[index].mGeneration = aGeneration;
+    mCount++;
+
+    return CHIP_NO_ERROR;
+}
+
+bool DirtyPathSetBase::Grow()
+{
+    size_t newCapacity = (mCapacity == 0) ? kInitialHeapCapacity : mCapacity * 2;
+    auto * newEntries  = static_cast<Entry *>(Platform::MemoryRealloc(mEntries, newCapacity * sizeof(Entry)));
+    VerifyOrReturnValue(newEntries != nullptr, false);
+
+    mEntries  = newEntries;
+    mCapacity = newCapacity;
+    return true;
+}
+
+template <typename SameGroup, typename Widen>
+bool DirtyPathSetBase::CollapseRuns(SameGroup && sameGroup, Widen && widen)
+{
+    size_t kept = 0;
+    for (size_t i = 0; i < mCount;)
+    {
+        Entry merged = mEntries[i];
+        size_t next  = i + 1;
+        for (; next < mCount && sameGroup(mEntries[i], mEntries[next]); next++)
+        {
+            if (mEntries[next].mGeneration.After(merged.mGeneration))
+            {
+                merged.mGeneration = mEntries[next].mGeneration;
+            }
+        }
+        if (next - i > 1)
+        {
+            // The widened path is still ordered after the previous run and before the next one.
+            widen(merged);
+        }
+        mEntries[kept++] = merged;
+        i                = next;
+    }
+
+    VerifyOrReturnValue(kept != mCount, false);
+    mCount = kept;
+    return true;
+}
+
+bool DirtyPathSetBase::MergePathsUnderSameCluster()
+{
+    // We don't support paths with a wildcard endpoint + a concrete cluster in the dirty set, so a simple == check on the
+    // endpoint is enough here.
+    return CollapseRuns(
+        [](const Entry & first, const Entry & other) {
+            return !first.HasWildcardClusterId() && first.mEndpointId == other.mEndpointId &&
+                first.mClusterId == other.mClusterId;
+        },
+        [](Entry & entry) { entry.SetWildcardAttributeId(); });
+}
+
+bool DirtyPathSetBase::MergePathsUnderSameEndpoint()
+{
+    return CollapseRuns(
+        [](const Entry & first, const Entry & other) {
+            return !first.HasWildcardEndpointId() && first.mEndpointId == other.mEndpointId;
+        },
+        [](Entry & entry) {
+            entry.SetWildcardClusterId();
+            entry.SetWildcardAttributeId();
+        });
+}
+
+} // namespace chip::app::reporting
@@ -0,0 +1,161 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <app/AttributePathParams.h>
+#include <app/ConcreteAttributePath.h>
+#include <app/reporting/Generations.h>
+#include <lib/core/CHIPError.h>
+#include <lib/support/Iterators.h>
+#include <lib/support/Pool.h>
+
+#include <cstddef>
+
+namespace chip::app::reporting {
+
+struct AttributePathParamsWithGeneration : public AttributePathParams
+{
+    AttributePathParamsWithGeneration() = default;
+    AttributePathParamsWithGeneration(const AttributePathParams aPath) : AttributePathParams(aPath) {}
+
+    AttributeGeneration mGeneration;
+};
+
+/// A set of dirty attribute paths, kept sorted by (endpoint, cluster, attribute, list index).
+///
+/// Wildcards are stored as their "invalid id" sentinels, which are the largest values of their
+/// respective types, so all paths under a given endpoint (and all paths under a given cluster of
+/// that endpoint) are contiguous. This allows:
+///   - finding the dirty supersets of a concrete path with a bounded number of binary searches
+///   - merging paths per cluster or per endpoint in a single linear pass
+///
+/// The set maintains the invariant that no stored path is a superset of another stored path:
+/// merging a path that covers existing entries replaces all of them.
+///
+/// Lookups (`IsDirtyAfter`, and the superset search in `MergeOverlapped`) are O(log N). Inserting
+/// a new path is O(N), since the entries after it are shifted to keep the array sorted. This is
+/// kept on purpose: entries are small (16 bytes) and the shift is a contiguous copy, which is
+/// cheap next to the rest of a report; sets are small (`CHIP_IM_SERVER_MAX_NUM_DIRTY_SET` defaults
+/// to 8), and re-marking a path that is already dirty does not insert. A node based tree would
+/// need an allocation per path, which does not fit the fixed pools used on constrained devices.
+///
+/// Storage is provided by `DirtyPathSet`, below. Heap backed sets grow on demand and are never
+/// exhausted, matching the behavior of heap backed `ObjectPool`s.
+class DirtyPathSetBase
+{
+public:
+    using Entry = AttributePathParamsWithGeneration;
+
+    DirtyPathSetBase(const DirtyPathSetBase &)             = delete;
+    DirtyPathSetBase & operator=(const DirtyPathSetBase &) = delete;
+
+    size_t Allocated() const { return mCount; }
+    bool Exhausted() const { return !mHeapBacked && mCount == mCapacity; }
+    void ReleaseAll() { mCount = 0; }
+
+    /// Calls `function(const Entry *)` for each stored path, in key order.
+    template <typename Function>
+    Loop ForEachActiveObject(Function && function) const
+    {
+        for (size_t i = 0; i < mCount; i++)
+        {
+            if (function(static_cast<const Entry *>(&mEntries[i])) == Loop::Break)
+            {
+                return Loop::Break;
+            }
+        }
+        return Loop::Finish;
+    }
+
+    /// Tries to record `aPath` as dirty at `aGeneration` without allocating a new entry:
+    ///   - if a stored path is a superset of `aPath`, its generation is updated
+    ///   - otherwise, if `aPath` is a superset of some stored paths, they are all replaced by `aPath`
+    ///
+    /// Returns whether `aPath` is now covered by the set.
+    bool MergeOverlapped(const AttributePathParams & aPath, AttributeGeneration aGeneration);
+
+    /// Inserts `aPath` as a new entry. Callers are expected to have called `MergeOverlapped` first.
+    ///
+    /// O(N): entries sorting after `aPath` are shifted by one.
+    ///
+    /// @retval CHIP_ERROR_NO_MEMORY if the set is exhausted or growing it failed.
+    CHIP_ERROR Insert(const AttributePathParams & aPath, AttributeGeneration aGeneration);
+
+    /// Returns whether a stored path covering `aPath` was marked dirty after `aGeneration`.
+    bool IsDirtyAfter(const ConcreteAttributePath & aPath, AttributeGeneration aGeneration) const;
+
+    /// Collapses the paths that share the same concrete endpoint and cluster into a single
+    /// wildcard-attribute path carrying their latest generation.
+    ///
+    /// Returns whether any entries were released.
+    bool MergePathsUnderSameCluster();
+
+    /// Collapses the paths that share the same concrete endpoint into a single wildcard-cluster
+    /// path carrying their latest generation.
+    ///
+    /// Returns whether any entries were released.
+    bool MergePathsUnderSameEndpoint();
+
+protected:
+    DirtyPathSetBase(Entry * aEntries, size_t aCapacity) : mEntries(aEntries), mCapacity(aCapacity), mHeapBacked(false) {}
+    DirtyPathSetBase() : mHeapBacked(true) {}
+    ~DirtyPathSetBase();
+
+private:
+    /// Index of the first entry not ordered before `aKey`.
+    size_t LowerBound(const AttributePathParams & aKey) const;
+
+    /// Whether any entry for exactly (endpoint, cluster, attribute) with any list index is dirty after `aGeneration`.
+    bool HasEntryDirtyAfter(EndpointId aEndpointId, ClusterId aClusterId, AttributeId aAttributeId,
+                            AttributeGeneration aGeneration) const;
+
+    bool Grow();
+
+    /// Collapses each run of entries for which `sameGroup(first, current)` holds into its first entry, which
+    /// is then widened by `widen`.
+    template <typename SameGroup, typename Widen>
+    bool CollapseRuns(SameGroup && sameGroup, Widen && widen);
+
+    Entry * mEntries = nullptr;
+    size_t mCapacity = 0;
+    size_t mCount    = 0;
+    const bool mHeapBacked;
+};
+
+template <size_t N, ObjectPoolMem P = ObjectPoolMem::kDefault>
+class DirtyPathSet;
+
+template <size_t N>
+class DirtyPathSet<N, ObjectPoolMem::kInline> : public DirtyPathSetBase
+{
+public:
+    DirtyPathSet() : DirtyPathSetBase(mStorage, N) {}
+
+private:
+    Entry mStorage[N];
+};
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+template <size_t N>
+class DirtyPathSet<N, ObjectPoolMem::kHeap> : public DirtyPathSetBase
+{
+    // As with ObjectPool, the size parameter is ignored for heap backed sets.
+};
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
+} // namespace chip::app::reporting
@@ -0,0 +1,137 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <app/reporting/EncodedAttributeCache.h>
+
+#include <lib/core/TLVReader.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+namespace chip::app::reporting {
+
+namespace {
+
+constexpr size_t kInitialEntryCapacity = 8;
+constexpr size_t kInitialDataCapacity  = 256;
+
+} // namespace
+
+void EncodedAttributeCache::Release()
+{
+    // The cache may be destroyed after Platform::MemoryShutdown() (e.g. as part of a global object), when it never allocated.
+    VerifyOrReturn(mEntries != nullptr || mData != nullptr);
+
+    Platform::MemoryFree(mEntries);
+    Platform::MemoryFree(mData);
+    mEntries       = nullptr;
+    mEntryCapacity = 0;
+    mEntryCount    = 0;
+    mData          = nullptr;
+    mDataCapacity  = 0;
+    mDataLength    = 0;
+}
+
+bool EncodedAttributeCache::ReserveEntries(size_t aCapacity)
+{
+    // Entries are grown with MemoryRealloc.
+    static_assert(std::is_trivially_copyable<Entry>::value);
+
+    VerifyOrReturnValue(aCapacity > mEntryCapacity, true);
+
+    size_t newCapacity = std::max(mEntryCapacity * 2, std::max(aCapacity, kInitialEntryCapacity));
+    auto * newEntries  = static_cast<Entry *>(Platform::MemoryRealloc(mEntries, newCapacity * sizeof(Entry)));
+    VerifyOrReturnValue(newEntries != nullptr, false);
+
+    mEntries       = newEntries;
+    mEntryCapacity = newCapacity;
+    return true;
+}
+
+bool EncodedAttributeCache::ReserveData(size_t aCapacity)
+{
+    VerifyOrReturnValue(aCapacity > mDataCapacity, true);
+
+    size_t newCapacity = std::max(mDataCapacity * 2, std::max(aCapacity, kInitialDataCapacity));
+    auto * newData     = static_cast<uint8_t *>(Platform::MemoryRealloc(mData, newCapacity));
+    VerifyOrReturnValue(newData != nullptr, false);
+
+    mData         = newData;
+    mDataCapacity = newCapacity;
+    return true;
+}
+
+bool EncodedAttributeCache::Find(const Key & aKey, size_t & aIndex) const
+{
+    for (size_t i = 0; i < mEntryCount; i++)
+    {
+        if (mEntries[i].mKey == aKey)
+        {
+            aIndex = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+CHIP_ERROR EncodedAttributeCache::Add(const Key & aKey, ByteSpan aElements, size_t & aIndex)
+{
+    return AddEntry(aKey, aElements, true, aIndex);
+}
+
+CHIP_ERROR EncodedAttributeCache::AddNotEncoded(const Key & aKey, size_t & aIndex)
+{
+    return AddEntry(aKey, ByteSpan(), false, aIndex);
+}
+
+CHIP_ERROR EncodedAttributeCache::AddEntry(const Key & aKey, ByteSpan aElements, bool aEncoded, size_t & aIndex)
+{
+    VerifyOrReturnError(ReserveEntries(mEntryCount + 1), CHIP_ERROR_NO_MEMORY);
+    VerifyOrReturnError(ReserveData(mDataLength + aElements.size()), CHIP_ERROR_NO_MEMORY);
+
+    if (!aElements.empty())
+    {
+        memcpy(mData + mDataLength, aElements.data(), aElements.size());
+    }
+    mEntries[mEntryCount] = Entry{ aKey, mDataLength, aElements.size(), aEncoded };
+    mDataLength += aElements.size();
+
+    aIndex = mEntryCount++;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR EncodedAttributeCache::Copy(size_t aIndex, TLV::TLVWriter & aWriter) const
+{
+    VerifyOrReturnError(aIndex < mEntryCount, CHIP_ERROR_INVALID_ARGUMENT);
+
+    const Entry & entry = mEntries[aIndex];
+    VerifyOrReturnError(entry.mEncoded, CHIP_ERROR_INCORRECT_STATE);
+    TLV::TLVReader reader;
+    reader.Init(mData + entry.mOffset, entry.mLength);
+
+    CHIP_ERROR err;
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        ReturnErrorOnFailure(aWriter.CopyElement(reader));
+    }
+    return err == CHIP_END_OF_TLV ? CHIP_NO_ERROR : err;
+}
+
+} // namespace chip::app::reporting
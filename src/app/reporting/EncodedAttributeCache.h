@@ -0,0 +1,124 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <app/ConcreteAttributePath.h>
+#include <app/data-model-provider/OperationTypes.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/core/TLVWriter.h>
+#include <lib/support/BitFlags.h>
+#include <lib/support/Span.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace chip::app::reporting {
+
+/// Encoded AttributeReportIB elements of the attributes read during a reporting run, so that read handlers reporting
+/// the same attribute copy the same bytes instead of reading and encoding the attribute again.
+///
+/// Besides the attribute value, identified by the path and the data version of its cluster, the encoding depends on the
+/// accessing fabric (fabric-sensitive data) and on the read flags (fabric filtering), which are part of the key. Access
+/// checks depend on the whole subject descriptor and are NOT covered by the
+/// key: they must pass for a read handler before it uses an entry.
+///
+/// Storage grows on the heap and is kept when the cache is cleared, so that following runs do not allocate again.
+class EncodedAttributeCache
+{
+public:
+    struct Key
+    {
+        ConcreteAttributePath mPath;
+        DataVersion mDataVersion          = 0;
+        FabricIndex mAccessingFabricIndex = kUndefinedFabricIndex;
+        BitFlags<DataModel::ReadFlags> mReadFlags;
+
+        bool operator==(const Key & aOther) const
+        {
+            return mPath == aOther.mPath && mDataVersion == aOther.mDataVersion &&
+                mAccessingFabricIndex == aOther.mAccessingFabricIndex && mReadFlags.Raw() == aOther.mReadFlags.Raw();
+        }
+    };
+
+    EncodedAttributeCache() = default;
+    ~EncodedAttributeCache() { Release(); }
+
+    EncodedAttributeCache(const EncodedAttributeCache &)             = delete;
+    EncodedAttributeCache & operator=(const EncodedAttributeCache &) = delete;
+
+    /// Number of cached entries.
+    size_t Allocated() const { return mEntryCount; }
+
+    /// Number of bytes of encoded elements held by the entries.
+    size_t DataLength() const { return mDataLength; }
+
+    /// Drops all entries, keeping the storage for reuse.
+    void Clear()
+    {
+        mEntryCount = 0;
+        mDataLength = 0;
+    }
+
+    /// Drops all entries and frees the storage.
+    void Release();
+
+    /// Looks up the entry for `aKey`. Returns false if there is none.
+    bool Find(const Key & aKey, size_t & aIndex) const;
+
+    /// Stores `aElements`, zero or more encoded AttributeReportIB elements, as the entry for `aKey`. There must not be
+    /// an entry for `aKey` yet.
+    ///
+    /// @retval CHIP_ERROR_NO_MEMORY if the storage cannot grow.
+    CHIP_ERROR Add(const Key & aKey, ByteSpan aElements, size_t & aIndex);
+
+    /// Adds an entry for `aKey` without elements, recording that the attribute could not be cached (e.g. because its
+    /// value has to be chunked), so that it does not get encoded just to find that out again.
+    CHIP_ERROR AddNotEncoded(const Key & aKey, size_t & aIndex);
+
+    /// Whether entry `aIndex` holds elements that can be copied.
+    bool IsEncoded(size_t aIndex) const { return aIndex < mEntryCount && mEntries[aIndex].mEncoded; }
+
+    /// Copies the elements of entry `aIndex` to `aWriter`, which must be positioned inside an AttributeReportIBs array.
+    ///
+    /// @retval CHIP_ERROR_INCORRECT_STATE if the entry was added with AddNotEncoded.
+    CHIP_ERROR Copy(size_t aIndex, TLV::TLVWriter & aWriter) const;
+
+private:
+    struct Entry
+    {
+        Key mKey;
+        size_t mOffset;
+        size_t mLength;
+        bool mEncoded;
+    };
+
+    bool ReserveEntries(size_t aCapacity);
+    bool ReserveData(size_t aCapacity);
+    CHIP_ERROR AddEntry(const Key & aKey, ByteSpan aElements, bool aEncoded, size_t & aIndex);
+
+    Entry * mEntries      = nullptr;
+    size_t mEntryCapacity = 0;
+    size_t mEntryCount    = 0;
+
+    uint8_t * mData      = nullptr;
+    size_t mDataCapacity = 0;
+    size_t mDataLength   = 0;
+};
+
+} // namespace chip::app::reporting
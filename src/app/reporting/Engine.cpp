@@ -37,7 +37,9 @@
 #include <lib/core/DataModelTypes.h>
 #include <lib/support/CodeUtils.h>
 #include <protocols/interaction_model/StatusCode.h>
+#include <tracing/metric_event.h>
 
+#include <algorithm>
 #include <optional>
 
 #if CHIP_CONFIG_ENABLE_ICD_SERVER
@@ -54,6 +56,19 @@ namespace {
 using DataModel::ReadFlags;
 using Protocols::InteractionModel::Status;
 
+// Reserved size for the MoreChunks boolean flag, which takes up 1 byte for the control tag and 1 byte for the context tag.
+constexpr uint32_t kReservedSizeForMoreChunksFlag = 1 + 1;
+
+// Reserved size for the uint8_t InteractionModelRevision flag, which takes up 1 byte for the control tag and 1 byte for the
+// context tag, 1 byte for value
+constexpr uint32_t kReservedSizeForIMRevision = 1 + 1 + 1;
+
+// Reserved size for the end of report message, which is an end-of-container (i.e 1 byte for the control tag).
+constexpr uint32_t kReservedSizeForEndOfReportMessage = 1;
+
+// Reserved size for an empty EventReportIBs, so we can at least check if there are any events need to be reported.
+constexpr uint32_t kReservedSizeForEventReportIBs = 3; // type, tag, end of container
+
 /// Returns the status of ACL validation.
 ///   If the return value has a status set, that means the ACL check failed,
 ///   the read must not be performed, and the returned status (which may
@@ -62,8 +77,11 @@ using Protocols::InteractionModel::Status;
 ///
 ///   If the returned value is std::nullopt, that means the ACL check passed and the
 ///   read should proceed.
-std::optional<CHIP_ERROR> ValidateReadAttributeACL(const SubjectDescriptor & subjectDescriptor,
-                                                   const ConcreteReadAttributePath & path, Privilege requiredPrivilege)
+///
+///   Checks go through `aclBatch`, so that the ACL is evaluated once per cluster
+///   when reading many attributes of the same cluster (e.g. wildcard reads).
+std::optional<CHIP_ERROR> ValidateReadAttributeACL(AccessControl::CheckBatch & aclBatch, const ConcreteReadAttributePath & path,
+                                                   Privilege requiredPrivilege)
 {
 
     RequestPath requestPath{ .cluster     = path.mClusterId,
@@ -71,7 +89,7 @@ std::optional<CHIP_ERROR> ValidateReadAttributeACL(const SubjectDescriptor & sub
                              .requestType = RequestType::kAttributeReadRequest,
                              .entityId    = path.mAttributeId };
 
-    CHIP_ERROR err = GetAccessControl().Check(subjectDescriptor, requestPath, requiredPrivilege);
+    CHIP_ERROR err = GetAccessControl().Check(aclBatch, requestPath, requiredPrivilege);
     if (err == CHIP_NO_ERROR)
     {
         return std::nullopt;
@@ -106,10 +124,53 @@ std::optional<Status> ValidateAttributeIsReadable(DataModel::Provider * dataMode
     return std::nullopt;
 }
 
-DataModel::ActionReturnStatus RetrieveClusterData(DataModel::Provider * dataModel, const SubjectDescriptor & subjectDescriptor,
+/// Runs the access and existence checks that precede reading `path`.
+///
+/// If the return value has a status set, the read must not be performed, and the returned status (which may be success,
+/// when dealing with non-concrete paths) should be used as the status for the read.
+std::optional<DataModel::ActionReturnStatus> CheckReadAttributeAccess(DataModel::Provider * dataModel,
+                                                                      AccessControl::CheckBatch & aclBatch,
+                                                                      const ConcreteReadAttributePath & path)
+{
+    // TODO: we explicitly DO NOT validate that path is a valid cluster path (even more, serverClusterFinder in
+    //       RetrieveClusterData explicitly ignores that case).
+    //       Validation of attribute existence is done after ACL, in `ValidateAttributeIsReadable` below
+    //
+    //       See https://github.com/project-chip/connectedhomeip/issues/37410
+
+    // Execute the ACL Access Granting Algorithm before existence checks, assuming the required_privilege for the element is
+    // View, to determine if the subject would have had at least some access against the concrete path. This is done so we don't
+    // leak information if we do fail existence checks.
+
+    DataModel::AttributeFinder finder(dataModel);
+    std::optional<DataModel::AttributeEntry> entry = finder.Find(path);
+
+    if (auto access_status = ValidateReadAttributeACL(aclBatch, path, Privilege::kView); access_status.has_value())
+    {
+        return *access_status;
+    }
+    if (auto readable_status = ValidateAttributeIsReadable(dataModel, path, entry); readable_status.has_value())
+    {
+        return *readable_status;
+    }
+    // Execute the ACL Access Granting Algorithm against the concrete path a second time, using the actual required_privilege.
+    // entry->GetReadPrivilege() is guaranteed to have a value, since that condition is checked in the previous condition (inside
+    // ValidateAttributeIsReadable()).
+    // NOLINTNEXTLINE(bugprone-unchecked-optional-access)
+    if (auto required_privilege_status = ValidateReadAttributeACL(aclBatch, path, entry->GetReadPrivilege().value());
+        required_privilege_status.has_value())
+    {
+        return *required_privilege_status;
+    }
+    return std::nullopt;
+}
+
+DataModel::ActionReturnStatus RetrieveClusterData(DataModel::Provider * dataModel, AccessControl::CheckBatch & aclBatch,
                                                   BitFlags<ReadFlags> flags, AttributeReportIBs::Builder & reportBuilder,
                                                   const ConcreteReadAttributePath & path, AttributeEncodeState * encoderState)
 {
+    const SubjectDescriptor & subjectDescriptor = aclBatch.GetSubjectDescriptor();
+
     ChipLogDetail(DataManagement, "<RE:Run> Cluster %" PRIx32 ", Attribute %" PRIx32 " is dirty", path.mClusterId,
                   path.mAttributeId);
     DataModelCallbacks::GetInstance()->AttributeOperation(DataModelCallbacks::OperationType::Read,
@@ -138,36 +199,10 @@ DataModel::ActionReturnStatus RetrieveClusterData(DataModel::Provider * dataMode
     bool isFabricFiltered = flags.Has(ReadFlags::kFabricFiltered);
     AttributeValueEncoder attributeValueEncoder(reportBuilder, subjectDescriptor, path, version, isFabricFiltered, encoderState);
 
-    // TODO: we explicitly DO NOT validate that path is a valid cluster path (even more, above serverClusterFinder
-    //       explicitly ignores that case).
-    //       Validation of attribute existence is done after ACL, in `ValidateAttributeIsReadable` below
-    //
-    //       See https://github.com/project-chip/connectedhomeip/issues/37410
-
-    // Execute the ACL Access Granting Algorithm before existence checks, assuming the required_privilege for the element is
-    // View, to determine if the subject would have had at least some access against the concrete path. This is done so we don't
-    // leak information if we do fail existence checks.
-
-    DataModel::AttributeFinder finder(dataModel);
-    std::optional<DataModel::AttributeEntry> entry = finder.Find(path);
-
-    if (auto access_status = ValidateReadAttributeACL(subjectDescriptor, path, Privilege::kView); access_status.has_value())
+    if (auto access_status = CheckReadAttributeAccess(dataModel, aclBatch, path); access_status.has_value())
     {
         status = *access_status;
     }
-    else if (auto readable_status = ValidateAttributeIsReadable(dataModel, path, entry); readable_status.has_value())
-    {
-        status = *readable_status;
-    }
-    // Execute the ACL Access Granting Algorithm against the concrete path a second time, using the actual required_privilege.
-    // entry->GetReadPrivilege() is guaranteed to have a value, since that condition is checked in the previous condition (inside
-    // ValidateAttributeIsReadable()).
-    // NOLINTNEXTLINE(bugprone-unchecked-optional-access)
-    else if (auto required_privilege_status = ValidateReadAttributeACL(subjectDescriptor, path, entry->GetReadPrivilege().value());
-             required_privilege_status.has_value())
-    {
-        status = *required_privilege_status;
-    }
     else if (IsSupportedGlobalAttributeNotInMetadata(readRequest.path.mAttributeId))
     {
         // Global attributes are NOT directly handled by data model providers, instead
@@ -298,6 +333,16 @@ CHIP_ERROR CheckEventValidity(const ConcreteEventPath & path, const SubjectDescr
     return CHIP_NO_ERROR;
 }
 
+// Attributes reported from the encoded attribute cache are not read again, but the read hooks still run for them, as they
+// would for RetrieveClusterData, so that applications observe one read per report.
+void NotifyAttributeReadFromCache(const ConcreteAttributePath & aPath)
+{
+    DataModelCallbacks::GetInstance()->AttributeOperation(DataModelCallbacks::OperationType::Read,
+                                                          DataModelCallbacks::OperationOrder::Pre, aPath);
+    DataModelCallbacks::GetInstance()->AttributeOperation(DataModelCallbacks::OperationType::Read,
+                                                          DataModelCallbacks::OperationOrder::Post, aPath);
+}
+
 } // namespace
 
 Engine::Engine(InteractionModelEngine * apImEngine) : mpImEngine(apImEngine) {}
@@ -320,6 +365,12 @@ void Engine::Shutdown()
     mNumReportsInFlight = 0;
     mCurReadHandlerIdx  = 0;
     mGlobalDirtySet.ReleaseAll();
+    mInterestIndex.ReleaseAll();
+    mInterestIndexStats = InterestIndexStats();
+
+    mAttributeSnapshot.Release();
+    mSnapshotScratch.Free();
+    mEncodedAttributeCacheStats = EncodedAttributeCacheStats();
 }
 
 bool Engine::IsClusterDataVersionMatch(const SingleLinkedListNode<DataVersionFilter> * aDataVersionFilterList,
@@ -394,6 +445,9 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
         uint32_t attributesRead = 0;
 #endif
 
+        // Paths are expanded cluster by cluster: check access once per cluster.
+        AccessControl::CheckBatch aclBatch(apReadHandler->GetSubjectDescriptor());
+
         // For each path included in the interested path of the read handler...
         for (RollbackAttributePathExpandIterator iterator(mpImEngine->GetDataModelProvider(),
                                                           apReadHandler->AttributeIterationPosition());
@@ -401,23 +455,9 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
         {
             if (!apReadHandler->IsPriming())
             {
-                bool concretePathDirty = false;
-                // TODO: Optimize this implementation by making the iterator only emit intersected paths.
-                mGlobalDirtySet.ForEachActiveObject([&](auto * dirtyPath) {
-                    if (dirtyPath->IsAttributePathSupersetOf(readPath))
-                    {
-                        // We don't need to worry about paths that were already marked dirty before the last time this read handler
-                        // started a report that it completed: those paths already got reported.
-                        if (dirtyPath->mGeneration.After(apReadHandler->mPreviousReportsBeginGeneration))
-                        {
-                            concretePathDirty = true;
-                            return Loop::Break;
-                        }
-                    }
-                    return Loop::Continue;
-                });
-
-                if (!concretePathDirty)
+                // We don't need to worry about paths that were already marked dirty before the last time this read handler
+                // started a report that it completed: those paths already got reported.
+                if (!mGlobalDirtySet.IsDirtyAfter(readPath, apReadHandler->mPreviousReportsBeginGeneration))
                 {
                     // This attribute is not dirty, we just skip this one.
                     continue;
@@ -449,9 +489,22 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
             BitFlags<ReadFlags> flags;
             flags.Set(ReadFlags::kFabricFiltered, apReadHandler->IsFabricFiltered());
             flags.Set(ReadFlags::kAllowsLargePayload, apReadHandler->AllowsLargePayload());
-            DataModel::ActionReturnStatus status =
-                RetrieveClusterData(mpImEngine->GetDataModelProvider(), apReadHandler->GetSubjectDescriptor(), flags,
-                                    attributeReportIBs, pathForRetrieval, &encodeState);
+
+            // Subscriptions reporting a change share the encoding of the changed attributes. Priming reports and reads are
+            // left out: they may be the only interaction reading the attribute, and expect a value read for them. So are
+            // values in the middle of being chunked, as the encoding state is specific to this read handler.
+            std::optional<DataModel::ActionReturnStatus> snapshotStatus;
+            if (mAttributeSnapshotEnabled && apReadHandler->IsType(ReadHandler::InteractionType::Subscribe) &&
+                !apReadHandler->IsPriming() && encodeState.CurrentEncodingListIndex() == kInvalidListIndex)
+            {
+                snapshotStatus = EncodeAttributeFromSnapshot(aclBatch, flags, pathForRetrieval,
+                                                             apReadHandler->GetReportBufferMaxSize(), attributeReportIBs);
+            }
+
+            DataModel::ActionReturnStatus status = snapshotStatus.has_value()
+                ? *snapshotStatus
+                : RetrieveClusterData(mpImEngine->GetDataModelProvider(), aclBatch, flags, attributeReportIBs, pathForRetrieval,
+                                      &encodeState);
             if (status.IsError())
             {
                 // Operation error set, since this will affect early return or override on status encoding
@@ -736,18 +789,7 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
     bool needCloseReadHandler            = false;
     size_t reportBufferMaxSize           = 0;
 
-    // Reserved size for the MoreChunks boolean flag, which takes up 1 byte for the control tag and 1 byte for the context tag.
-    const uint32_t kReservedSizeForMoreChunksFlag = 1 + 1;
-
-    // Reserved size for the uint8_t InteractionModelRevision flag, which takes up 1 byte for the control tag and 1 byte for the
-    // context tag, 1 byte for value
-    const uint32_t kReservedSizeForIMRevision = 1 + 1 + 1;
-
-    // Reserved size for the end of report message, which is an end-of-container (i.e 1 byte for the control tag).
-    const uint32_t kReservedSizeForEndOfReportMessage = 1;
-
-    // Reserved size for an empty EventReportIBs, so we can at least check if there are any events need to be reported.
-    const uint32_t kReservedSizeForEventReportIBs = 3; // type, tag, end of container
+    MATTER_LOG_METRIC_BEGIN(Tracing::kMetricDeviceReportGeneration);
 
     VerifyOrExit(apReadHandler != nullptr, err = CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrExit(apReadHandler->GetSession() != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
@@ -864,9 +906,97 @@ exit:
         apReadHandler->Close();
     }
 
+    MATTER_LOG_METRIC_END(Tracing::kMetricDeviceReportGeneration, err);
     return err;
 }
 
+CHIP_ERROR Engine::SnapshotAttribute(AccessControl::CheckBatch & aclBatch, BitFlags<ReadFlags> aFlags,
+                                     const ConcreteReadAttributePath & aPath, size_t aMaxLength, size_t & aIndex,
+                                     std::optional<DataModel::ActionReturnStatus> & aReadStatus)
+{
+    DataModel::Provider * dataModel = mpImEngine->GetDataModelProvider();
+
+    // The data version identifies the value: an attribute changing during the run gets a new entry.
+    DataVersion version = 0;
+    DataModel::ServerClusterFinder serverClusterFinder(dataModel);
+    if (auto clusterInfo = serverClusterFinder.Find(aPath); clusterInfo.has_value())
+    {
+        version = clusterInfo->dataVersion;
+    }
+
+    const EncodedAttributeCache::Key key{ aPath, version, aclBatch.GetSubjectDescriptor().fabricIndex, aFlags };
+    VerifyOrReturnError(!mAttributeSnapshot.Find(key, aIndex), CHIP_NO_ERROR);
+
+    mEncodedAttributeCacheStats.mMisses++;
+    VerifyOrReturnError(aMaxLength > 0, CHIP_ERROR_NO_MEMORY);
+    if (mSnapshotScratch.AllocatedSize() < aMaxLength)
+    {
+        mSnapshotScratch.Alloc(aMaxLength);
+        VerifyOrReturnError(mSnapshotScratch.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+    }
+
+    // Encode into an AttributeReportIBs array, and keep the AttributeReportIB elements written into it.
+    TLV::TLVWriter writer;
+    writer.Init(mSnapshotScratch.Get(), aMaxLength);
+    AttributeReportIBs::Builder attributeReportIBs;
+    ReturnErrorOnFailure(attributeReportIBs.Init(&writer));
+    const uint32_t elementsStart = writer.GetLengthWritten();
+
+    aReadStatus = RetrieveClusterData(dataModel, aclBatch, aFlags, attributeReportIBs, aPath, nullptr);
+    if (!aReadStatus->IsSuccess())
+    {
+        // Too large to be cached (e.g. a list that needs chunking), or failing to read: remember that, so that it does not
+        // get read here for every read handler before being read again.
+        return mAttributeSnapshot.AddNotEncoded(key, aIndex);
+    }
+
+    return mAttributeSnapshot.Add(
+        key, ByteSpan(mSnapshotScratch.Get() + elementsStart, writer.GetLengthWritten() - elementsStart), aIndex);
+}
+
+std::optional<DataModel::ActionReturnStatus>
+Engine::EncodeAttributeFromSnapshot(AccessControl::CheckBatch & aclBatch, BitFlags<ReadFlags> aFlags,
+                                    const ConcreteReadAttributePath & aPath, size_t aMaxLength,
+                                    AttributeReportIBs::Builder & aAttributeReportIBs)
+{
+    // Cached entries are shared with other subjects, so access is checked for this one first. Failures are left to
+    // RetrieveClusterData, which encodes the matching status.
+    VerifyOrReturnValue(!CheckReadAttributeAccess(mpImEngine->GetDataModelProvider(), aclBatch, aPath).has_value(),
+                        std::nullopt);
+
+    // Stay within the configured cache size: once it is used up, only what is already cached gets reused.
+    const size_t cacheSize = CHIP_CONFIG_IM_ENCODED_ATTRIBUTE_CACHE_SIZE;
+    const size_t cacheLeft = cacheSize - std::min(mAttributeSnapshot.DataLength(), cacheSize);
+
+    size_t index;
+    std::optional<DataModel::ActionReturnStatus> readStatus;
+    CHIP_ERROR err = SnapshotAttribute(aclBatch, aFlags, aPath, std::min(aMaxLength, cacheLeft), index, readStatus);
+    if (readStatus.has_value() && !readStatus->IsSuccess() && !readStatus->IsOutOfSpaceEncodingResponse())
+    {
+        // Reading the attribute just failed: report that rather than reading it again.
+        return readStatus;
+    }
+    VerifyOrReturnValue(err == CHIP_NO_ERROR && mAttributeSnapshot.IsEncoded(index), std::nullopt);
+
+    TLV::TLVWriter checkpoint;
+    aAttributeReportIBs.Checkpoint(checkpoint);
+    err = mAttributeSnapshot.Copy(index, *aAttributeReportIBs.GetWriter());
+    if (err != CHIP_NO_ERROR)
+    {
+        // Most likely out of space: RetrieveClusterData decides whether to chunk the value or to leave it to the next chunk.
+        aAttributeReportIBs.Rollback(checkpoint);
+        return std::nullopt;
+    }
+
+    if (!readStatus.has_value())
+    {
+        // Reported from an encoding cached for another read handler.
+        mEncodedAttributeCacheStats.mHits++;
+        NotifyAttributeReadFromCache(aPath);
+    }
+    return DataModel::ActionReturnStatus(CHIP_NO_ERROR);
+}
+
 void Engine::Run(System::Layer * aSystemLayer, void * apAppState)
 {
     Engine * const pEngine = reinterpret_cast<Engine *>(apAppState);
@@ -908,6 +1038,11 @@ void Engine::Run()
     // We may be deallocating read handlers as we go.  Track how many we had
     // initially, so we make sure to go through all of them.
     size_t initialAllocated = mpImEngine->mReadHandlers.Allocated();
+
+    // Attribute encodings are only shared within a run, and only pay off when several read handlers may report.
+    mAttributeSnapshot.Clear();
+    mAttributeSnapshotEnabled = (CHIP_CONFIG_IM_ENCODED_ATTRIBUTE_CACHE_SIZE > 0) && (initialAllocated > 1);
+
     while ((mNumReportsInFlight < CHIP_IM_MAX_REPORTS_IN_FLIGHT) && (numReadHandled < initialAllocated))
     {
         ReadHandler * readHandler =
@@ -965,109 +1100,7 @@ void Engine::Run()
 
 bool Engine::MergeOverlappedAttributePath(const AttributePathParams & aAttributePath)
 {
-    return Loop::Break == mGlobalDirtySet.ForEachActiveObject([&](auto * path) {
-        if (path->IsAttributePathSupersetOf(aAttributePath))
-        {
-            path->mGeneration = GetDirtySetGeneration();
-            return Loop::Break;
-        }
-        if (aAttributePath.IsAttributePathSupersetOf(*path))
-        {
-            // TODO: the wildcard input path may be superset of next paths in globalDirtySet, it is fine at this moment, since
-            // when building report, it would use the first path of globalDirtySet to compare against interested paths read clients
-            // want.
-            // It is better to eliminate the duplicate wildcard paths in follow-up
-            path->mGeneration  = GetDirtySetGeneration();
-            path->mEndpointId  = aAttributePath.mEndpointId;
-            path->mClusterId   = aAttributePath.mClusterId;
-            path->mListIndex   = aAttributePath.mListIndex;
-            path->mAttributeId = aAttributePath.mAttributeId;
-            return Loop::Break;
-        }
-        return Loop::Continue;
-    });
-}
-
-bool Engine::ClearTombPaths()
-{
-    bool pathReleased = false;
-    mGlobalDirtySet.ForEachActiveObject([&](auto * path) {
-        if (path->mGeneration.IsZero())
-        {
-            mGlobalDirtySet.ReleaseObject(path);
-            pathReleased = true;
-        }
-        return Loop::Continue;
-    });
-    return pathReleased;
-}
-
-bool Engine::MergeDirtyPathsUnderSameCluster()
-{
-    mGlobalDirtySet.ForEachActiveObject([&](auto * outerPath) {
-        if (outerPath->HasWildcardClusterId() || outerPath->mGeneration.IsZero())
-        {
-            return Loop::Continue;
-        }
-        mGlobalDirtySet.ForEachActiveObject([&](auto * innerPath) {
-            if (innerPath == outerPath)
-            {
-                return Loop::Continue;
-            }
-            // We don't support paths with a wildcard endpoint + a concrete cluster in global dirty set, so we do a simple == check
-            // here.
-            if (innerPath->mEndpointId != outerPath->mEndpointId || innerPath->mClusterId != outerPath->mClusterId)
-            {
-                return Loop::Continue;
-            }
-            if (innerPath->mGeneration.After(outerPath->mGeneration))
-            {
-                outerPath->mGeneration = innerPath->mGeneration;
-            }
-            outerPath->SetWildcardAttributeId();
-
-            // The object pool does not allow us to release objects in a nested iteration, mark the path as a tomb by setting its
-            // generation to 0 and then clear it later.
-            innerPath->mGeneration.Clear();
-            return Loop::Continue;
-        });
-        return Loop::Continue;
-    });
-
-    return ClearTombPaths();
-}
-
-bool Engine::MergeDirtyPathsUnderSameEndpoint()
-{
-    mGlobalDirtySet.ForEachActiveObject([&](auto * outerPath) {
-        if (outerPath->HasWildcardEndpointId() || outerPath->mGeneration.IsZero())
-        {
-            return Loop::Continue;
-        }
-        mGlobalDirtySet.ForEachActiveObject([&](auto * innerPath) {
-            if (innerPath == outerPath)
-            {
-                return Loop::Continue;
-            }
-            if (innerPath->mEndpointId != outerPath->mEndpointId)
-            {
-                return Loop::Continue;
-            }
-            if (innerPath->mGeneration.After(outerPath->mGeneration))
-            {
-                outerPath->mGeneration = innerPath->mGeneration;
-            }
-            outerPath->SetWildcardClusterId();
-            outerPath->SetWildcardAttributeId();
-
-            // The object pool does not allow us to release objects in a nested iteration, mark the path as a tomb by setting its
-            // generation to 0 and then clear it later.
-            innerPath->mGeneration.Clear();
-            return Loop::Continue;
-        });
-        return Loop::Continue;
-    });
-    return ClearTombPaths();
+    return mGlobalDirtySet.MergeOverlapped(aAttributePath, GetDirtySetGeneration());
 }
 
 CHIP_ERROR Engine::InsertPathIntoDirtySet(const AttributePathParams & aAttributePath)
@@ -1078,24 +1111,31 @@ CHIP_ERROR Engine::InsertPathIntoDirtySet(const AttributePathParams & aAttribute
     {
         ChipLogDetail(DataManagement, "Global dirty set pool exhausted, merge all paths.");
         mGlobalDirtySet.ReleaseAll();
-        auto object         = mGlobalDirtySet.CreateObject();
-        object->mGeneration = GetDirtySetGeneration();
+        ReturnErrorOnFailure(mGlobalDirtySet.Insert(AttributePathParams(), GetDirtySetGeneration()));
     }
 
     VerifyOrReturnError(!MergeOverlappedAttributePath(aAttributePath), CHIP_NO_ERROR);
     ChipLogDetail(DataManagement, "Cannot merge the new path into any existing path, create one.");
 
-    auto object = mGlobalDirtySet.CreateObject();
-    if (object == nullptr)
+    CHIP_ERROR err = mGlobalDirtySet.Insert(aAttributePath, GetDirtySetGeneration());
+    if (err != CHIP_NO_ERROR)
     {
         // This should not happen, this path should be merged into the wildcard endpoint at least.
-        ChipLogError(DataManagement, "mGlobalDirtySet pool full, cannot handle more entries!");
-        return CHIP_ERROR_NO_MEMORY;
+        ChipLogError(DataManagement, "mGlobalDirtySet full, cannot handle more entries!");
     }
-    *object             = aAttributePath;
-    object->mGeneration = GetDirtySetGeneration();
+    return err;
+}
 
-    return CHIP_NO_ERROR;
+CHIP_ERROR Engine::RegisterInterestedPaths(ReadHandler * apReadHandler)
+{
+    mInterestIndex.Remove(apReadHandler);
+    CHIP_ERROR err = mInterestIndex.Add(apReadHandler, apReadHandler->GetAttributePathList());
+    if (err == CHIP_ERROR_NO_MEMORY)
+    {
+        ChipLogError(DataManagement, "Subscription interest index full");
+        return CHIP_IM_GLOBAL_STATUS(PathsExhausted);
+    }
+    return err;
 }
 
 CHIP_ERROR Engine::SetDirty(const AttributePathParams & aAttributePath)
@@ -1104,21 +1144,23 @@ CHIP_ERROR Engine::SetDirty(const AttributePathParams & aAttributePath)
 
     bool intersectsInterestPath     = false;
     DataModel::Provider * dataModel = mpImEngine->GetDataModelProvider();
-    mpImEngine->mReadHandlers.ForEachActiveObject([&dataModel, &aAttributePath, &intersectsInterestPath](ReadHandler * handler) {
+    mInterestIndexStats.mLookups++;
+    mInterestIndex.ForEachIntersecting(aAttributePath, [&](ReadHandler * handler) {
+        // A read handler with several paths intersecting the change is visited once per path. AttributePathIsDirty records
+        // the generation we just bumped to, so a handler already carrying it has been marked dirty for this change.
+        if (handler->mDirtyGeneration.Raw() == GetDirtySetGeneration().Raw())
+        {
+            return Loop::Continue;
+        }
+
         // We call AttributePathIsDirty for both read interactions and subscribe interactions, since we may send inconsistent
         // attribute data between two chunks. AttributePathIsDirty will not schedule a new run for read handlers which are
         // waiting for a response to the last message chunk for read interactions.
         if (handler->CanStartReporting() || handler->IsAwaitingReportResponse())
         {
-            for (auto object = handler->GetAttributePathList(); object != nullptr; object = object->mpNext)
-            {
-                if (object->mValue.Intersects(aAttributePath))
-                {
-                    handler->AttributePathIsDirty(dataModel, aAttributePath);
-                    intersectsInterestPath = true;
-                    break;
-                }
-            }
+            handler->AttributePathIsDirty(dataModel, aAttributePath);
+            intersectsInterestPath = true;
+            mInterestIndexStats.mHandlerHits++;
         }
 
         return Loop::Continue;
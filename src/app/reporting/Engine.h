@@ -29,10 +29,15 @@
 #include <app/EventReporter.h>
 #include <app/MessageDef/ReportDataMessage.h>
 #include <app/ReadHandler.h>
+#include <app/data-model-provider/ActionReturnStatus.h>
+#include <app/reporting/DirtyPathSet.h>
+#include <app/reporting/EncodedAttributeCache.h>
 #include <app/reporting/Generations.h>
+#include <app/reporting/SubscriptionInterestIndex.h>
 #include <app/util/basic-types.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/ScopedMemoryBuffer.h>
 #include <lib/support/logging/CHIPLogging.h>
 #include <messaging/ExchangeContext.h>
 #include <messaging/ExchangeMgr.h>
@@ -40,6 +45,8 @@
 #include <system/SystemPacketBuffer.h>
 #include <system/TLVPacketBufferBackingStore.h>
 
+#include <optional>
+
 namespace chip {
 namespace app {
 
@@ -101,6 +108,52 @@ public:
      */
     CHIP_ERROR SetDirty(const AttributePathParams & aAttributePathParams);
 
+    /**
+     * Counters describing the subscription interest index used by SetDirty.
+     */
+    struct InterestIndexStats
+    {
+        // Number of (path, read handler) entries currently indexed.
+        size_t mIndexedPaths = 0;
+        // Number of SetDirty calls served from the index.
+        uint32_t mLookups = 0;
+        // Number of read handlers marked dirty by those lookups.
+        uint32_t mHandlerHits = 0;
+    };
+
+    /**
+     * Indexes the attribute paths of apReadHandler, so that SetDirty only visits read handlers whose paths intersect the
+     * changed path. Must be called once the attribute path list of the read handler is final.
+     *
+     * @retval #CHIP_IM_GLOBAL_STATUS(PathsExhausted) if the index has no room for the paths of the read handler.
+     */
+    CHIP_ERROR RegisterInterestedPaths(ReadHandler * apReadHandler);
+
+    /**
+     * Removes the attribute paths of apReadHandler from the index, before the read handler releases them.
+     */
+    void UnregisterInterestedPaths(ReadHandler * apReadHandler) { mInterestIndex.Remove(apReadHandler); }
+
+    InterestIndexStats GetInterestIndexStats() const
+    {
+        InterestIndexStats stats = mInterestIndexStats;
+        stats.mIndexedPaths      = mInterestIndex.Allocated();
+        return stats;
+    }
+
+    /**
+     * Counters describing the encoded attribute cache shared by the subscriptions reporting in a run.
+     */
+    struct EncodedAttributeCacheStats
+    {
+        // Number of attribute values copied from an encoding cached earlier in the run.
+        uint32_t mHits = 0;
+        // Number of attribute values read because no encoding of them was cached.
+        uint32_t mMisses = 0;
+    };
+
+    EncodedAttributeCacheStats GetEncodedAttributeCacheStats() const { return mEncodedAttributeCacheStats; }
+
     /*
      * Resets the tracker that tracks the currently serviced read handler.
      * apReadHandler can be non-null to indicate that the reset is due to a
@@ -146,14 +199,6 @@ private:
 
     bool IsRunScheduled() const { return mRunScheduled; }
 
-    struct AttributePathParamsWithGeneration : public AttributePathParams
-    {
-        AttributePathParamsWithGeneration() = default;
-        AttributePathParamsWithGeneration(const AttributePathParams aPath) : AttributePathParams(aPath) {}
-
-        AttributeGeneration mGeneration;
-    };
-
     /**
      * Build Single Report Data including attribute changes and event data stream, and send out
      *
@@ -165,6 +210,32 @@ private:
     CHIP_ERROR BuildSingleReportDataEventReports(ReportDataMessage::Builder & reportDataBuilder, ReadHandler * apReadHandler,
                                                  bool aBufferIsUsed, bool * apHasMoreChunks, bool * apHasEncodedData);
 
+    /**
+     * Finds the entry of mAttributeSnapshot for aPath as read with aFlags by the subject of aclBatch, reading and encoding
+     * the attribute if there is none yet. Encodings longer than aMaxLength, and reads that fail, are recorded as not
+     * encoded; with an aMaxLength of 0, the attribute is only looked up.
+     *
+     * aReadStatus is set to the outcome of reading the attribute when this call read it, and left empty when the entry was
+     * already there.
+     *
+     * Access checks are not performed: the caller must have validated access to aPath for the subject.
+     */
+    CHIP_ERROR SnapshotAttribute(Access::AccessControl::CheckBatch & aclBatch, BitFlags<DataModel::ReadFlags> aFlags,
+                                 const ConcreteReadAttributePath & aPath, size_t aMaxLength, size_t & aIndex,
+                                 std::optional<DataModel::ActionReturnStatus> & aReadStatus);
+
+    /**
+     * Encodes aPath into aAttributeReportIBs from mAttributeSnapshot, caching its encoding first if needed.
+     *
+     * Returns std::nullopt, with aAttributeReportIBs unchanged, if the attribute has to be read through RetrieveClusterData
+     * instead. Otherwise returns the outcome to report: success once the encoding was copied, or the failure of reading the
+     * attribute for the cache, which the caller encodes like a failure of RetrieveClusterData.
+     */
+    std::optional<DataModel::ActionReturnStatus>
+    EncodeAttributeFromSnapshot(Access::AccessControl::CheckBatch & aclBatch, BitFlags<DataModel::ReadFlags> aFlags,
+                                const ConcreteReadAttributePath & aPath, size_t aMaxLength,
+                                AttributeReportIBs::Builder & aAttributeReportIBs);
+
     /**
      * Encodes StatusIB event reports for non-wildcard paths that fail to be validated:
      *   - invalid paths (invalid endpoint/cluster id)
@@ -213,27 +284,19 @@ private:
     bool MergeOverlappedAttributePath(const AttributePathParams & aAttributePath);
 
     /**
-     * If we are running out of ObjectPool for the global dirty set, we will try to merge the existing items by clusters.
+     * If we are running out of space for the global dirty set, we will try to merge the existing items by clusters.
      *
      * Returns whether we have released any paths.
      */
-    bool MergeDirtyPathsUnderSameCluster();
+    bool MergeDirtyPathsUnderSameCluster() { return mGlobalDirtySet.MergePathsUnderSameCluster(); }
 
     /**
-     * If we are running out of ObjectPool for the global dirty set and we cannot find a slot after merging the existing items by
+     * If we are running out of space for the global dirty set and we cannot find a slot after merging the existing items by
      * clusters, we will try to merge the existing items by endpoints.
      *
      * Returns whether we have released any paths.
      */
-    bool MergeDirtyPathsUnderSameEndpoint();
-
-    /**
-     * During the iterating of the paths, releasing the object in the inner loop will cause undefined behavior of the ObjectPool, so
-     * we replace the items to be cleared by a tomb first, then clear all the tombs after the iteration.
-     *
-     * Returns whether we have released any paths.
-     */
-    bool ClearTombPaths();
+    bool MergeDirtyPathsUnderSameEndpoint() { return mGlobalDirtySet.MergePathsUnderSameEndpoint(); }
 
     CHIP_ERROR InsertPathIntoDirtySet(const AttributePathParams & aAttributePath);
 
@@ -264,16 +327,33 @@ private:
     ReadHandler * mRunningReadHandler = nullptr;
 
     /**
-     *  mGlobalDirtySet is used to track the set of attribute/event paths marked dirty for reporting purposes.
+     *  mGlobalDirtySet is used to track the set of attribute paths marked dirty for reporting purposes.
+     *  It is kept sorted by path, so looking up whether a concrete path is dirty does not scan the whole set.
      *
      */
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
     // For unit tests, always use inline allocation for code coverage.
-    ObjectPool<AttributePathParamsWithGeneration, CHIP_IM_SERVER_MAX_NUM_DIRTY_SET, ObjectPoolMem::kInline> mGlobalDirtySet;
+    DirtyPathSet<CHIP_IM_SERVER_MAX_NUM_DIRTY_SET, ObjectPoolMem::kInline> mGlobalDirtySet;
+#else
+    DirtyPathSet<CHIP_IM_SERVER_MAX_NUM_DIRTY_SET> mGlobalDirtySet;
+#endif
+
+    /**
+     *  mInterestIndex maps attribute paths to the read handlers interested in them.
+     *  Every attribute path of a read handler lives in the InteractionModelEngine path pool, so sizing the index like that
+     *  pool guarantees registering paths cannot run out of space.
+     */
+#if CONFIG_BUILD_FOR_HOST_UNIT_TEST
+    SubscriptionInterestIndex<CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_READS + CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_SUBSCRIPTIONS,
+                              ObjectPoolMem::kInline>
+        mInterestIndex;
 #else
-    ObjectPool<AttributePathParamsWithGeneration, CHIP_IM_SERVER_MAX_NUM_DIRTY_SET> mGlobalDirtySet;
+    SubscriptionInterestIndex<CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_READS + CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_SUBSCRIPTIONS>
+        mInterestIndex;
 #endif
 
+    InterestIndexStats mInterestIndexStats;
+
     /**
      * A generation counter for the dirty attrbute set.
      * ReadHandlers can save the generation value when generating reports.
@@ -293,6 +373,15 @@ private:
     uint32_t mMaxAttributesPerChunk = UINT32_MAX;
 #endif
 
+    /**
+     * Encoded values of the attributes read for subscription reports in the current run, shared by the read handlers
+     * reporting them.
+     */
+    EncodedAttributeCache mAttributeSnapshot;
+    Platform::ScopedMemoryBufferWithSize<uint8_t> mSnapshotScratch;
+    bool mAttributeSnapshotEnabled = false;
+    EncodedAttributeCacheStats mEncodedAttributeCacheStats;
+
     InteractionModelEngine * mpImEngine = nullptr;
 
     EventManagement * mpEventManagement = nullptr;
@@ -0,0 +1,127 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <app/reporting/SubscriptionInterestIndex.h>
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+
+namespace chip::app::reporting {
+
+namespace {
+
+using Entry = SubscriptionInterestIndexBase::Entry;
+
+// Entries are moved around with plain copies and grown with MemoryRealloc.
+static_assert(std::is_trivially_copyable<Entry>::value);
+
+constexpr size_t kInitialHeapCapacity = 8;
+
+/// Orders entries on their first `prefixLength` key components.
+struct PrefixLess
+{
+    uint8_t prefixLength;
+
+    bool operator()(const Entry & a, const Entry & b) const
+    {
+        if (a.mEndpointId != b.mEndpointId)
+        {
+            return a.mEndpointId < b.mEndpointId;
+        }
+        VerifyOrReturnValue(prefixLength > 1, false);
+        if (a.mClusterId != b.mClusterId)
+        {
+            return a.mClusterId < b.mClusterId;
+        }
+        VerifyOrReturnValue(prefixLength > 2, false);
+        if (a.mAttributeId != b.mAttributeId)
+        {
+            return a.mAttributeId < b.mAttributeId;
+        }
+        VerifyOrReturnValue(prefixLength > 3, false);
+        return std::less<ReadHandler *>()(a.mReadHandler, b.mReadHandler);
+    }
+};
+
+constexpr PrefixLess kFullKeyLess{ 4 };
+
+} // namespace
+
+SubscriptionInterestIndexBase::~SubscriptionInterestIndexBase()
+{
+    if (mHeapBacked)
+    {
+        Platform::MemoryFree(mEntries);
+    }
+}
+
+void SubscriptionInterestIndexBase::EqualRange(const Entry & aKey, uint8_t aPrefixLength, size_t & aBegin, size_t & aEnd) const
+{
+    auto range = std::equal_range(mEntries, mEntries + mCount, aKey, PrefixLess{ aPrefixLength });
+    aBegin     = static_cast<size_t>(range.first - mEntries);
+    aEnd       = static_cast<size_t>(range.second - mEntries);
+}
+
+bool SubscriptionInterestIndexBase::Reserve(size_t aCapacity)
+{
+    VerifyOrReturnValue(aCapacity > mCapacity, true);
+    VerifyOrReturnValue(mHeapBacked, false);
+
+    size_t newCapacity = std::max(mCapacity * 2, std::max(aCapacity, kInitialHeapCapacity));
+    auto * newEntries  = static_cast<Entry *>(Platform::MemoryRealloc(mEntries, newCapacity * sizeof(Entry)));
+    VerifyOrReturnValue(newEntries != nullptr, false);
+
+    mEntries  = newEntries;
+    mCapacity = newCapacity;
+    return true;
+}
+
+CHIP_ERROR SubscriptionInterestIndexBase::Add(ReadHandler * aReadHandler, const SingleLinkedListNode<AttributePathParams> * aPaths)
+{
+    size_t pathCount = 0;
+    for (auto * path = aPaths; path != nullptr; path = path->mpNext)
+    {
+        pathCount++;
+    }
+    VerifyOrReturnError(Reserve(mCount + pathCount), CHIP_ERROR_NO_MEMORY);
+
+    for (auto * path = aPaths; path != nullptr; path = path->mpNext)
+    {
+        const Entry entry{ path->mValue.mEndpointId, path->mValue.mClusterId, path->mValue.mAttributeId, aReadHandler };
+        Entry * position = std::upper_bound(mEntries, mEntries + mCount, entry, kFullKeyLess);
+        std::copy_backward(position, mEntries + mCount, mEntries + mCount + 1);
+        *position = entry;
+        mCount++;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+void SubscriptionInterestIndexBase::Remove(ReadHandler * aReadHandler)
+{
+    Entry * end = std::remove_if(mEntries, mEntries + mCount, [aReadHandler](const Entry & entry) {
+        return entry.mReadHandler == aReadHandler;
+    });
+
+    mCount = static_cast<size_t>(end - mEntries);
+}
+
+} // namespace chip::app::reporting
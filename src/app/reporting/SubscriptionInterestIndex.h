@@ -0,0 +1,179 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <app/AttributePathParams.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/support/Iterators.h>
+#include <lib/support/LinkedList.h>
+#include <lib/support/Pool.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace chip::app {
+class ReadHandler;
+} // namespace chip::app
+
+namespace chip::app::reporting {
+
+/// Inverted index of the attribute paths that read handlers are interested in, so that an attribute change
+/// only visits the handlers whose paths intersect it.
+///
+/// Entries are (endpoint, cluster, attribute, handler) tuples kept sorted in that order. Wildcards are stored
+/// as their "invalid id" sentinels and thus form their own bucket at the end of each level. Looking up the
+/// handlers interested in a concrete path visits at most 8 contiguous buckets, each located with a binary
+/// search; changes that have a wildcard endpoint fall back to scanning the whole index.
+///
+/// Storage is provided by `SubscriptionInterestIndex`, below. Heap backed indexes grow on demand.
+class SubscriptionInterestIndexBase
+{
+public:
+    struct Entry
+    {
+        EndpointId mEndpointId;
+        ClusterId mClusterId;
+        AttributeId mAttributeId;
+        ReadHandler * mReadHandler;
+    };
+
+    SubscriptionInterestIndexBase(const SubscriptionInterestIndexBase &)             = delete;
+    SubscriptionInterestIndexBase & operator=(const SubscriptionInterestIndexBase &) = delete;
+
+    /// Number of indexed paths.
+    size_t Allocated() const { return mCount; }
+    void ReleaseAll() { mCount = 0; }
+
+    /// Indexes all the paths in `aPaths` for `aReadHandler`. Either all paths are indexed, or none are.
+    ///
+    /// @retval CHIP_ERROR_NO_MEMORY if there is no room left for all the paths.
+    CHIP_ERROR Add(ReadHandler * aReadHandler, const SingleLinkedListNode<AttributePathParams> * aPaths);
+
+    /// Removes all the paths indexed for `aReadHandler`, if any.
+    void Remove(ReadHandler * aReadHandler);
+
+    /// Calls `function(ReadHandler *)` for each indexed path that intersects `aChangedPath`.
+    ///
+    /// A handler is visited once per intersecting path, so it may be visited more than once.
+    template <typename Function>
+    Loop ForEachIntersecting(const AttributePathParams & aChangedPath, Function && function) const
+    {
+        if (aChangedPath.HasWildcardEndpointId())
+        {
+            return VisitRange(0, mCount, aChangedPath, function);
+        }
+
+        for (const EndpointId endpoint : { aChangedPath.mEndpointId, kInvalidEndpointId })
+        {
+            if (aChangedPath.HasWildcardClusterId())
+            {
+                if (VisitBucket(Entry{ endpoint, 0, 0, nullptr }, 1, aChangedPath, function) == Loop::Break)
+                {
+                    return Loop::Break;
+                }
+                continue;
+            }
+            for (const ClusterId cluster : { aChangedPath.mClusterId, kInvalidClusterId })
+            {
+                if (aChangedPath.HasWildcardAttributeId())
+                {
+                    if (VisitBucket(Entry{ endpoint, cluster, 0, nullptr }, 2, aChangedPath, function) == Loop::Break)
+                    {
+                        return Loop::Break;
+                    }
+                    continue;
+                }
+                for (const AttributeId attribute : { aChangedPath.mAttributeId, kInvalidAttributeId })
+                {
+                    if (VisitBucket(Entry{ endpoint, cluster, attribute, nullptr }, 3, aChangedPath, function) == Loop::Break)
+                    {
+                        return Loop::Break;
+                    }
+                }
+            }
+        }
+        return Loop::Finish;
+    }
+
+protected:
+    SubscriptionInterestIndexBase(Entry * aEntries, size_t aCapacity) :
+        mEntries(aEntries), mCapacity(aCapacity), mHeapBacked(false)
+    {}
+    SubscriptionInterestIndexBase() : mHeapBacked(true) {}
+    ~SubscriptionInterestIndexBase();
+
+private:
+    /// Finds the range of entries sharing the first `aPrefixLength` (1 to 3) key components with `aKey`.
+    void EqualRange(const Entry & aKey, uint8_t aPrefixLength, size_t & aBegin, size_t & aEnd) const;
+
+    template <typename Function>
+    Loop VisitBucket(const Entry & aKey, uint8_t aPrefixLength, const AttributePathParams & aChangedPath,
+                     Function & function) const
+    {
+        size_t begin;
+        size_t end;
+        EqualRange(aKey, aPrefixLength, begin, end);
+        return VisitRange(begin, end, aChangedPath, function);
+    }
+
+    template <typename Function>
+    Loop VisitRange(size_t aBegin, size_t aEnd, const AttributePathParams & aChangedPath, Function & function) const
+    {
+        for (size_t i = aBegin; i < aEnd; i++)
+        {
+            const Entry & entry = mEntries[i];
+            if (AttributePathParams(entry.mEndpointId, entry.mClusterId, entry.mAttributeId).Intersects(aChangedPath) &&
+                function(entry.mReadHandler) == Loop::Break)
+            {
+                return Loop::Break;
+            }
+        }
+        return Loop::Finish;
+    }
+
+    bool Reserve(size_t aCapacity);
+
+    Entry * mEntries = nullptr;
+    size_t mCapacity = 0;
+    size_t mCount    = 0;
+    const bool mHeapBacked;
+};
+
+template <size_t N, ObjectPoolMem P = ObjectPoolMem::kDefault>
+class SubscriptionInterestIndex;
+
+template <size_t N>
+class SubscriptionInterestIndex<N, ObjectPoolMem::kInline> : public SubscriptionInterestIndexBase
+{
+public:
+    SubscriptionInterestIndex() : SubscriptionInterestIndexBase(mStorage, N) {}
+
+private:
+    Entry mStorage[N];
+};
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+template <size_t N>
+class SubscriptionInterestIndex<N, ObjectPoolMem::kHeap> : public SubscriptionInterestIndexBase
+{
+    // As with ObjectPool, the size parameter is ignored for heap backed indexes.
+};
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
+} // namespace chip::app::reporting
@@ -0,0 +1,278 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/reporting/DirtyPathSet.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemClock.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <tuple>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::reporting;
+
+constexpr size_t kBenchmarkCapacity = 1024;
+
+class TestDirtyPathSet : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+bool Contains(const DirtyPathSetBase & set, const AttributePathParams & path)
+{
+    return set.ForEachActiveObject([&](auto * entry) {
+        return (static_cast<const AttributePathParams &>(*entry) == path) ? Loop::Break : Loop::Continue;
+    }) == Loop::Break;
+}
+
+bool IsSorted(const DirtyPathSetBase & set)
+{
+    const AttributePathParams * previous = nullptr;
+    return set.ForEachActiveObject([&](auto * entry) {
+        if (previous != nullptr &&
+            std::make_tuple(previous->mEndpointId, previous->mClusterId, previous->mAttributeId, previous->mListIndex) >=
+                std::make_tuple(entry->mEndpointId, entry->mClusterId, entry->mAttributeId, entry->mListIndex))
+        {
+            return Loop::Break;
+        }
+        previous = entry;
+        return Loop::Continue;
+    }) == Loop::Finish;
+}
+
+TEST_F(TestDirtyPathSet, TestInsertKeepsOrder)
+{
+    DirtyPathSet<8, ObjectPoolMem::kInline> set;
+    AttributeGeneration generation(1);
+
+    EXPECT_EQ(set.Insert(AttributePathParams(2, 6, 1), generation), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Insert(AttributePathParams(EndpointId(1), ClusterId(6)), generation), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Insert(AttributePathParams(1, 6, 0), generation), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Insert(AttributePathParams(), generation), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Insert(AttributePathParams(2, 5, 3), generation), CHIP_NO_ERROR);
+
+    EXPECT_EQ(set.Allocated(), 5u);
+    EXPECT_TRUE(IsSorted(set));
+
+    for (size_t i = set.Allocated(); i < 8; i++)
+    {
+        EXPECT_EQ(set.Insert(AttributePathParams(3, 1, static_cast<AttributeId>(i)), generation), CHIP_NO_ERROR);
+    }
+    EXPECT_TRUE(set.Exhausted());
+    EXPECT_EQ(set.Insert(AttributePathParams(4, 1, 1), generation), CHIP_ERROR_NO_MEMORY);
+
+    set.ReleaseAll();
+    EXPECT_EQ(set.Allocated(), 0u);
+}
+
+TEST_F(TestDirtyPathSet, TestMergeOverlapped)
+{
+    DirtyPathSet<8, ObjectPoolMem::kInline> set;
+
+    EXPECT_FALSE(set.MergeOverlapped(AttributePathParams(1, 1, 1), AttributeGeneration(1)));
+    EXPECT_EQ(set.Insert(AttributePathParams(1, 1, 1), AttributeGeneration(1)), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Insert(AttributePathParams(1, 1, 2), AttributeGeneration(2)), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Insert(AttributePathParams(1, 2, 1), AttributeGeneration(3)), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Insert(AttributePathParams(2, 1, 1), AttributeGeneration(4)), CHIP_NO_ERROR);
+
+    // Disjoint path: nothing to merge into.
+    EXPECT_FALSE(set.MergeOverlapped(AttributePathParams(1, 1, 3), AttributeGeneration(5)));
+
+    // Subset of an existing path: only the generation is updated.
+    EXPECT_TRUE(set.MergeOverlapped(AttributePathParams(1, 1, 1, 2), AttributeGeneration(6)));
+    EXPECT_EQ(set.Allocated(), 4u);
+    EXPECT_TRUE(set.IsDirtyAfter(ConcreteAttributePath(1, 1, 1), AttributeGeneration(5)));
+    EXPECT_FALSE(set.IsDirtyAfter(ConcreteAttributePath(1, 1, 2), AttributeGeneration(5)));
+
+    // Superset of several existing paths: they are all replaced.
+    EXPECT_TRUE(set.MergeOverlapped(AttributePathParams(EndpointId(1), ClusterId(1)), AttributeGeneration(7)));
+    EXPECT_EQ(set.Allocated(), 3u);
+    EXPECT_TRUE(Contains(set, AttributePathParams(EndpointId(1), ClusterId(1))));
+    EXPECT_TRUE(Contains(set, AttributePathParams(1, 2, 1)));
+    EXPECT_TRUE(Contains(set, AttributePathParams(2, 1, 1)));
+
+    EXPECT_TRUE(set.MergeOverlapped(AttributePathParams(1), AttributeGeneration(8)));
+    EXPECT_EQ(set.Allocated(), 2u);
+    EXPECT_TRUE(Contains(set, AttributePathParams(1)));
+
+    EXPECT_TRUE(set.MergeOverlapped(AttributePathParams(), AttributeGeneration(9)));
+    EXPECT_EQ(set.Allocated(), 1u);
+    EXPECT_TRUE(Contains(set, AttributePathParams()));
+}
+
+TEST_F(TestDirtyPathSet, TestIsDirtyAfter)
+{
+    DirtyPathSet<8, ObjectPoolMem::kInline> set;
+
+    EXPECT_FALSE(set.IsDirtyAfter(ConcreteAttributePath(1, 1, 1), AttributeGeneration(0)));
+
+    EXPECT_EQ(set.Insert(AttributePathParams(1, 1, 1, 5), AttributeGeneration(10)), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Insert(AttributePathParams(EndpointId(2), ClusterId(3)), AttributeGeneration(20)), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Insert(AttributePathParams(ClusterId(4), AttributeId(7)), AttributeGeneration(30)), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Insert(AttributePathParams(EndpointId(9)), AttributeGeneration(40)), CHIP_NO_ERROR);
+
+    // List indices do not matter for concrete paths.
+    EXPECT_TRUE(set.IsDirtyAfter(ConcreteAttributePath(1, 1, 1), AttributeGeneration(9)));
+    EXPECT_FALSE(set.IsDirtyAfter(ConcreteAttributePath(1, 1, 1), AttributeGeneration(10)));
+    EXPECT_FALSE(set.IsDirtyAfter(ConcreteAttributePath(1, 1, 2), AttributeGeneration(0)));
+
+    EXPECT_TRUE(set.IsDirtyAfter(ConcreteAttributePath(2, 3, 100), AttributeGeneration(19)));
+    EXPECT_FALSE(set.IsDirtyAfter(ConcreteAttributePath(2, 4, 100), AttributeGeneration(0)));
+
+    // Wildcard endpoint with a concrete cluster.
+    EXPECT_TRUE(set.IsDirtyAfter(ConcreteAttributePath(7, 4, 7), AttributeGeneration(29)));
+    EXPECT_FALSE(set.IsDirtyAfter(ConcreteAttributePath(7, 4, 8), AttributeGeneration(0)));
+
+    // Wildcard cluster under a concrete endpoint.
+    EXPECT_TRUE(set.IsDirtyAfter(ConcreteAttributePath(9, 1234, 1), AttributeGeneration(39)));
+    EXPECT_FALSE(set.IsDirtyAfter(ConcreteAttributePath(9, 1234, 1), AttributeGeneration(40)));
+}
+
+TEST_F(TestDirtyPathSet, TestMergeUnderSameClusterAndEndpoint)
+{
+    DirtyPathSet<8, ObjectPoolMem::kInline> set;
+
+    EXPECT_EQ(set.Insert(AttributePathParams(1, 1, 1), AttributeGeneration(1)), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Insert(AttributePathParams(1, 1, 2), AttributeGeneration(5)), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Insert(AttributePathParams(1, 2, 1), AttributeGeneration(2)), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Insert(AttributePathParams(2, 1, 1), AttributeGeneration(3)), CHIP_NO_ERROR);
+    EXPECT_EQ(set.Insert(AttributePathParams(2, 2, 1), AttributeGeneration(4)), CHIP_NO_ERROR);
+
+    EXPECT_TRUE(set.MergePathsUnderSameCluster());
+    EXPECT_EQ(set.Allocated(), 4u);
+    EXPECT_TRUE(Contains(set, AttributePathParams(EndpointId(1), ClusterId(1))));
+    EXPECT_TRUE(IsSorted(set));
+    // The merged path keeps the latest generation of the paths it replaced.
+    EXPECT_TRUE(set.IsDirtyAfter(ConcreteAttributePath(1, 1, 1), AttributeGeneration(4)));
+
+    EXPECT_FALSE(set.MergePathsUnderSameCluster());
+
+    EXPECT_TRUE(set.MergePathsUnderSameEndpoint());
+    EXPECT_EQ(set.Allocated(), 2u);
+    EXPECT_TRUE(Contains(set, AttributePathParams(1)));
+    EXPECT_TRUE(Contains(set, AttributePathParams(2)));
+    EXPECT_TRUE(set.IsDirtyAfter(ConcreteAttributePath(1, 2, 1), AttributeGeneration(4)));
+    EXPECT_TRUE(set.IsDirtyAfter(ConcreteAttributePath(2, 1, 1), AttributeGeneration(3)));
+    EXPECT_FALSE(set.IsDirtyAfter(ConcreteAttributePath(2, 1, 1), AttributeGeneration(4)));
+
+    EXPECT_FALSE(set.MergePathsUnderSameEndpoint());
+}
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+TEST_F(TestDirtyPathSet, TestHeapBackedSetGrows)
+{
+    DirtyPathSet<1, ObjectPoolMem::kHeap> set;
+
+    for (AttributeId i = 0; i < 100; i++)
+    {
+        EXPECT_FALSE(set.Exhausted());
+        EXPECT_EQ(set.Insert(AttributePathParams(1, 1, 99 - i), AttributeGeneration(i + 1)), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(set.Allocated(), 100u);
+    EXPECT_TRUE(IsSorted(set));
+    EXPECT_TRUE(set.IsDirtyAfter(ConcreteAttributePath(1, 1, 0), AttributeGeneration(99)));
+}
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
+/// Measures the cost of the operations done when marking attributes dirty and when checking concrete paths
+/// against the dirty set while building reports, with `count` distinct dirty paths spread over endpoints of
+/// 10 clusters with 10 attributes each.
+void BenchmarkDirtyMarking(size_t count)
+{
+    using namespace chip::System::Clock;
+
+    DirtyPathSet<kBenchmarkCapacity, ObjectPoolMem::kInline> set;
+    AttributeGeneration generation(1);
+
+    auto pathAt = [](size_t i) {
+        return AttributePathParams(static_cast<EndpointId>(i / 100), static_cast<ClusterId>((i / 10) % 10),
+                                   static_cast<AttributeId>(i % 10));
+    };
+
+    Microseconds64 start = chip::System::SystemClock().GetMonotonicMicroseconds64();
+    for (size_t i = 0; i < count; i++)
+    {
+        generation.Increment();
+        ASSERT_FALSE(set.MergeOverlapped(pathAt(i), generation));
+        ASSERT_EQ(set.Insert(pathAt(i), generation), CHIP_NO_ERROR);
+    }
+    Microseconds64 inserted = chip::System::SystemClock().GetMonotonicMicroseconds64();
+
+    constexpr size_t kRounds = 10;
+    for (size_t round = 0; round < kRounds; round++)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            generation.Increment();
+            ASSERT_TRUE(set.MergeOverlapped(pathAt(i), generation));
+        }
+    }
+    Microseconds64 remarked = chip::System::SystemClock().GetMonotonicMicroseconds64();
+
+    size_t dirty = 0;
+    for (size_t round = 0; round < kRounds; round++)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            const AttributePathParams path = pathAt(i);
+            dirty += set.IsDirtyAfter(ConcreteAttributePath(path.mEndpointId, path.mClusterId, path.mAttributeId),
+                                      AttributeGeneration(1))
+                ? 1
+                : 0;
+        }
+    }
+    Microseconds64 looked = chip::System::SystemClock().GetMonotonicMicroseconds64();
+
+    EXPECT_EQ(set.Allocated(), count);
+    EXPECT_EQ(dirty, count * kRounds);
+
+    // Inserting in descending order is the worst case: every insert shifts all stored entries.
+    set.ReleaseAll();
+    Microseconds64 released = chip::System::SystemClock().GetMonotonicMicroseconds64();
+    for (size_t i = count; i > 0; i--)
+    {
+        generation.Increment();
+        ASSERT_FALSE(set.MergeOverlapped(pathAt(i - 1), generation));
+        ASSERT_EQ(set.Insert(pathAt(i - 1), generation), CHIP_NO_ERROR);
+    }
+    Microseconds64 insertedFirst = chip::System::SystemClock().GetMonotonicMicroseconds64();
+
+    ChipLogProgress(Test,
+                    "DirtyPathSet with %u paths: insert %u ns/path (%u ns/path in descending order), re-mark %u ns/path, "
+                    "lookup %u ns/path",
+                    static_cast<unsigned>(count), static_cast<unsigned>((inserted - start).count() * 1000 / count),
+                    static_cast<unsigned>((insertedFirst - released).count() * 1000 / count),
+                    static_cast<unsigned>((remarked - inserted).count() * 1000 / (count * kRounds)),
+                    static_cast<unsigned>((looked - remarked).count() * 1000 / (count * kRounds)));
+}
+
+TEST_F(TestDirtyPathSet, BenchmarkDirtyMarking)
+{
+    BenchmarkDirtyMarking(10);
+    BenchmarkDirtyMarking(100);
+    BenchmarkDirtyMarking(1000);
+}
+
+} // namespace
@@ -0,0 +1,217 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/reporting/EncodedAttributeCache.h>
+#include <lib/core/TLVReader.h>
+#include <lib/core/TLVWriter.h>
+#include <lib/support/CHIPMem.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <vector>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::reporting;
+
+using DataModel::ReadFlags;
+using Key = EncodedAttributeCache::Key;
+
+class TestEncodedAttributeCache : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+Key MakeKey(AttributeId attribute, FabricIndex fabric = 1, bool fabricFiltered = true, DataVersion version = 1)
+{
+    Key key{ ConcreteAttributePath(1, 6, attribute), version, fabric, BitFlags<ReadFlags>() };
+    key.mReadFlags.Set(ReadFlags::kFabricFiltered, fabricFiltered);
+    return key;
+}
+
+/// Encodes one anonymous structure per value, the way AttributeReportIB elements sit in an AttributeReportIBs array.
+std::vector<uint8_t> EncodeElements(std::initializer_list<uint32_t> values)
+{
+    uint8_t buffer[128];
+    TLV::TLVWriter writer;
+    writer.Init(buffer);
+    for (uint32_t value : values)
+    {
+        TLV::TLVType outer;
+        EXPECT_EQ(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outer), CHIP_NO_ERROR);
+        EXPECT_EQ(writer.Put(TLV::ContextTag(1), value), CHIP_NO_ERROR);
+        EXPECT_EQ(writer.EndContainer(outer), CHIP_NO_ERROR);
+    }
+    return std::vector<uint8_t>(buffer, buffer + writer.GetLengthWritten());
+}
+
+/// Copies the given entries into an array, and returns the values of the structures found in it.
+std::vector<uint32_t> CopyEntries(const EncodedAttributeCache & cache, std::initializer_list<size_t> entries)
+{
+    uint8_t buffer[256];
+    TLV::TLVWriter writer;
+    writer.Init(buffer);
+    TLV::TLVType outerArray;
+    EXPECT_EQ(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Array, outerArray), CHIP_NO_ERROR);
+    for (size_t entry : entries)
+    {
+        EXPECT_EQ(cache.Copy(entry, writer), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(writer.EndContainer(outerArray), CHIP_NO_ERROR);
+
+    std::vector<uint32_t> values;
+    TLV::TLVReader reader;
+    reader.Init(buffer, writer.GetLengthWritten());
+    EXPECT_EQ(reader.Next(), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.EnterContainer(outerArray), CHIP_NO_ERROR);
+    while (reader.Next() == CHIP_NO_ERROR)
+    {
+        TLV::TLVType outerStructure;
+        uint32_t value = 0;
+        EXPECT_EQ(reader.EnterContainer(outerStructure), CHIP_NO_ERROR);
+        EXPECT_EQ(reader.Next(TLV::ContextTag(1)), CHIP_NO_ERROR);
+        EXPECT_EQ(reader.Get(value), CHIP_NO_ERROR);
+        EXPECT_EQ(reader.ExitContainer(outerStructure), CHIP_NO_ERROR);
+        values.push_back(value);
+    }
+    EXPECT_EQ(reader.ExitContainer(outerArray), CHIP_NO_ERROR);
+    return values;
+}
+
+TEST_F(TestEncodedAttributeCache, TestKeyCoversVersionFabricAndFlags)
+{
+    EncodedAttributeCache cache;
+    size_t index = 0;
+
+    std::vector<uint8_t> elements = EncodeElements({ 42 });
+    EXPECT_EQ(cache.Add(MakeKey(0), ByteSpan(elements.data(), elements.size()), index), CHIP_NO_ERROR);
+    EXPECT_EQ(index, 0u);
+
+    EXPECT_TRUE(cache.Find(MakeKey(0), index));
+    EXPECT_EQ(index, 0u);
+    EXPECT_FALSE(cache.Find(MakeKey(1), index));
+    EXPECT_FALSE(cache.Find(MakeKey(0, 2), index));
+    EXPECT_FALSE(cache.Find(MakeKey(0, 1, false), index));
+    EXPECT_FALSE(cache.Find(MakeKey(0, 1, true, 2), index));
+
+    EXPECT_EQ(cache.Add(MakeKey(0, 2), ByteSpan(elements.data(), elements.size()), index), CHIP_NO_ERROR);
+    EXPECT_EQ(index, 1u);
+    EXPECT_TRUE(cache.Find(MakeKey(0, 2), index));
+    EXPECT_EQ(index, 1u);
+    EXPECT_EQ(cache.Allocated(), 2u);
+}
+
+TEST_F(TestEncodedAttributeCache, TestCopy)
+{
+    EncodedAttributeCache cache;
+    size_t single   = 0;
+    size_t chunked  = 0;
+    size_t nothing  = 0;
+    size_t inserted = 0;
+
+    std::vector<uint8_t> singleElement   = EncodeElements({ 1 });
+    std::vector<uint8_t> severalElements = EncodeElements({ 2, 3, 4 });
+    EXPECT_EQ(cache.Add(MakeKey(0), ByteSpan(singleElement.data(), singleElement.size()), single), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.Add(MakeKey(1), ByteSpan(severalElements.data(), severalElements.size()), chunked), CHIP_NO_ERROR);
+    // Nothing gets encoded for paths the subject is denied access to.
+    EXPECT_EQ(cache.Add(MakeKey(2), ByteSpan(), nothing), CHIP_NO_ERROR);
+
+    EXPECT_EQ(CopyEntries(cache, { single }), (std::vector<uint32_t>{ 1 }));
+    EXPECT_EQ(CopyEntries(cache, { chunked, single, nothing }), (std::vector<uint32_t>{ 2, 3, 4, 1 }));
+    EXPECT_EQ(CopyEntries(cache, { nothing }), (std::vector<uint32_t>{}));
+
+    // Entries stay valid when the storage grows.
+    for (AttributeId attribute = 3; attribute < 100; attribute++)
+    {
+        EXPECT_EQ(cache.Add(MakeKey(attribute), ByteSpan(severalElements.data(), severalElements.size()), inserted),
+                  CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(CopyEntries(cache, { single, inserted }), (std::vector<uint32_t>{ 1, 2, 3, 4 }));
+
+    uint8_t buffer[4];
+    TLV::TLVWriter writer;
+    writer.Init(buffer);
+    EXPECT_EQ(cache.Copy(chunked, writer), CHIP_ERROR_BUFFER_TOO_SMALL);
+    EXPECT_EQ(cache.Copy(cache.Allocated(), writer), CHIP_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(TestEncodedAttributeCache, TestNotEncoded)
+{
+    EncodedAttributeCache cache;
+    size_t encoded    = 0;
+    size_t notEncoded = 0;
+    size_t index      = 0;
+
+    std::vector<uint8_t> elements = EncodeElements({ 5 });
+    EXPECT_EQ(cache.AddNotEncoded(MakeKey(0), notEncoded), CHIP_NO_ERROR);
+    EXPECT_EQ(cache.Add(MakeKey(1), ByteSpan(elements.data(), elements.size()), encoded), CHIP_NO_ERROR);
+
+    EXPECT_TRUE(cache.Find(MakeKey(0), index));
+    EXPECT_EQ(index, notEncoded);
+    EXPECT_FALSE(cache.IsEncoded(notEncoded));
+    EXPECT_TRUE(cache.IsEncoded(encoded));
+    EXPECT_FALSE(cache.IsEncoded(cache.Allocated()));
+    EXPECT_EQ(cache.DataLength(), elements.size());
+
+    uint8_t buffer[32];
+    TLV::TLVWriter writer;
+    writer.Init(buffer);
+    EXPECT_EQ(cache.Copy(notEncoded, writer), CHIP_ERROR_INCORRECT_STATE);
+    EXPECT_EQ(writer.GetLengthWritten(), 0u);
+    EXPECT_EQ(CopyEntries(cache, { encoded }), (std::vector<uint32_t>{ 5 }));
+}
+
+TEST_F(TestEncodedAttributeCache, TestClear)
+{
+    EncodedAttributeCache cache;
+    size_t index = 0;
+
+    std::vector<uint8_t> elements = EncodeElements({ 7 });
+    EXPECT_EQ(cache.Add(MakeKey(0), ByteSpan(elements.data(), elements.size()), index), CHIP_NO_ERROR);
+
+    cache.Clear();
+    EXPECT_EQ(cache.Allocated(), 0u);
+    EXPECT_EQ(cache.DataLength(), 0u);
+    EXPECT_FALSE(cache.Find(MakeKey(0), index));
+
+    elements = EncodeElements({ 8 });
+    EXPECT_EQ(cache.Add(MakeKey(0), ByteSpan(elements.data(), elements.size()), index), CHIP_NO_ERROR);
+    EXPECT_EQ(index, 0u);
+    EXPECT_EQ(CopyEntries(cache, { index }), (std::vector<uint32_t>{ 8 }));
+
+    cache.Release();
+    EXPECT_EQ(cache.Allocated(), 0u);
+    EXPECT_FALSE(cache.Find(MakeKey(0), index));
+}
+
+TEST_F(TestEncodedAttributeCache, TestDestroyAfterMemoryShutdown)
+{
+    // A cache that never allocated, e.g. in a global reporting engine, may be destroyed after the platform memory was shut
+    // down.
+    {
+        EncodedAttributeCache cache;
+        chip::Platform::MemoryShutdown();
+    }
+    ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR);
+}
+
+} // namespace
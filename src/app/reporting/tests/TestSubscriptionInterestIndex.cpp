@@ -0,0 +1,134 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/reporting/SubscriptionInterestIndex.h>
+#include <lib/support/CHIPMem.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <set>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::reporting;
+
+using PathList = SingleLinkedListNode<AttributePathParams>;
+
+class TestSubscriptionInterestIndex : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+
+protected:
+    // The index never dereferences read handlers, so distinct addresses are enough to tell them apart.
+    ReadHandler * Handler(size_t index) { return reinterpret_cast<ReadHandler *>(&mHandlerStorage[index]); }
+
+    uint8_t mHandlerStorage[4] = {};
+};
+
+std::set<ReadHandler *> Intersecting(const SubscriptionInterestIndexBase & index, const AttributePathParams & path)
+{
+    std::set<ReadHandler *> handlers;
+    index.ForEachIntersecting(path, [&](ReadHandler * handler) {
+        handlers.insert(handler);
+        return Loop::Continue;
+    });
+    return handlers;
+}
+
+TEST_F(TestSubscriptionInterestIndex, TestConcreteAndWildcardInterests)
+{
+    SubscriptionInterestIndex<16, ObjectPoolMem::kInline> index;
+
+    // Handler 0: a concrete attribute.
+    PathList concrete{ AttributePathParams(1, 6, 0) };
+    // Handler 1: a whole cluster and a whole endpoint.
+    PathList wholeEndpoint{ AttributePathParams(2) };
+    PathList wholeCluster{ AttributePathParams(EndpointId(1), ClusterId(8)), &wholeEndpoint };
+    // Handler 2: one attribute on every endpoint.
+    PathList everyEndpoint{ AttributePathParams(ClusterId(6), AttributeId(0)) };
+    // Handler 3: everything.
+    PathList everything{ AttributePathParams() };
+
+    EXPECT_EQ(index.Add(Handler(0), &concrete), CHIP_NO_ERROR);
+    EXPECT_EQ(index.Add(Handler(1), &wholeCluster), CHIP_NO_ERROR);
+    EXPECT_EQ(index.Add(Handler(2), &everyEndpoint), CHIP_NO_ERROR);
+    EXPECT_EQ(index.Add(Handler(3), &everything), CHIP_NO_ERROR);
+    EXPECT_EQ(index.Allocated(), 5u);
+
+    EXPECT_EQ(Intersecting(index, AttributePathParams(1, 6, 0)),
+              (std::set<ReadHandler *>{ Handler(0), Handler(2), Handler(3) }));
+    EXPECT_EQ(Intersecting(index, AttributePathParams(1, 6, 1)), (std::set<ReadHandler *>{ Handler(3) }));
+    EXPECT_EQ(Intersecting(index, AttributePathParams(1, 8, 5)), (std::set<ReadHandler *>{ Handler(1), Handler(3) }));
+    EXPECT_EQ(Intersecting(index, AttributePathParams(2, 6, 0)),
+              (std::set<ReadHandler *>{ Handler(1), Handler(2), Handler(3) }));
+    EXPECT_EQ(Intersecting(index, AttributePathParams(3, 6, 0)), (std::set<ReadHandler *>{ Handler(2), Handler(3) }));
+
+    // Changes with wildcards, e.g. from an endpoint or a cluster being marked dirty as a whole.
+    EXPECT_EQ(Intersecting(index, AttributePathParams(1)),
+              (std::set<ReadHandler *>{ Handler(0), Handler(1), Handler(2), Handler(3) }));
+    EXPECT_EQ(Intersecting(index, AttributePathParams(EndpointId(1), ClusterId(6))),
+              (std::set<ReadHandler *>{ Handler(0), Handler(2), Handler(3) }));
+    EXPECT_EQ(Intersecting(index, AttributePathParams(ClusterId(8), AttributeId(1))),
+              (std::set<ReadHandler *>{ Handler(1), Handler(3) }));
+
+    index.Remove(Handler(3));
+    EXPECT_EQ(index.Allocated(), 4u);
+    EXPECT_EQ(Intersecting(index, AttributePathParams(1, 6, 1)), (std::set<ReadHandler *>{}));
+
+    index.Remove(Handler(1));
+    EXPECT_EQ(index.Allocated(), 2u);
+    EXPECT_EQ(Intersecting(index, AttributePathParams(2, 6, 0)), (std::set<ReadHandler *>{ Handler(2) }));
+}
+
+TEST_F(TestSubscriptionInterestIndex, TestAddIsAllOrNothing)
+{
+    SubscriptionInterestIndex<2, ObjectPoolMem::kInline> index;
+
+    PathList third{ AttributePathParams(1, 1, 3) };
+    PathList second{ AttributePathParams(1, 1, 2), &third };
+    PathList first{ AttributePathParams(1, 1, 1), &second };
+
+    EXPECT_EQ(index.Add(Handler(0), &first), CHIP_ERROR_NO_MEMORY);
+    EXPECT_EQ(index.Allocated(), 0u);
+
+    EXPECT_EQ(index.Add(Handler(0), &second), CHIP_NO_ERROR);
+    EXPECT_EQ(index.Allocated(), 2u);
+    EXPECT_EQ(index.Add(Handler(1), &third), CHIP_ERROR_NO_MEMORY);
+    EXPECT_EQ(Intersecting(index, AttributePathParams(1, 1, 3)), (std::set<ReadHandler *>{ Handler(0) }));
+}
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+TEST_F(TestSubscriptionInterestIndex, TestHeapBackedIndexGrows)
+{
+    SubscriptionInterestIndex<1, ObjectPoolMem::kHeap> index;
+
+    for (EndpointId endpoint = 0; endpoint < 100; endpoint++)
+    {
+        PathList path{ AttributePathParams(endpoint, 6, 0) };
+        EXPECT_EQ(index.Add(Handler(endpoint % 4), &path), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(index.Allocated(), 100u);
+    EXPECT_EQ(Intersecting(index, AttributePathParams(42, 6, 0)), (std::set<ReadHandler *>{ Handler(2) }));
+}
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
+} // namespace
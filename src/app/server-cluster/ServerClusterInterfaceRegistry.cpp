@@ -67,6 +67,10 @@ CHIP_ERROR ServerClusterInterfaceRegistry::Register(ServerClusterRegistration &
         LogErrorOnFailure(entry.serverClusterInterface->Startup(*mContext));
     }
 
+#if CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX
+    IndexPaths(*entry.serverClusterInterface);
+#endif
+
     entry.next     = mRegistrations;
     mRegistrations = &entry;
 
@@ -99,6 +103,10 @@ CHIP_ERROR ServerClusterInterfaceRegistry::Unregister(ServerClusterInterface * w
                 mCachedInterface = nullptr;
             }
 
+#if CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX
+            UnindexPaths(*current->serverClusterInterface);
+#endif
+
             current->next = nullptr; // Make sure current does not look like part of a list.
             if (mContext.has_value())
             {
@@ -117,6 +125,13 @@ CHIP_ERROR ServerClusterInterfaceRegistry::Unregister(ServerClusterInterface * w
 
 ServerClusterInterface * ServerClusterInterfaceRegistry::Get(const ConcreteClusterPath & clusterPath)
 {
+#if CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX
+    if (mIndexValid)
+    {
+        return mIndex.Find(clusterPath);
+    }
+#endif
+
     // Check the cache to speed things up
     if ((mCachedInterface != nullptr) && mCachedInterface->PathsContains(clusterPath))
     {
@@ -199,5 +214,42 @@ ServerClusterInterfaceRegistry::ServerClusterInstances ServerClusterInterfaceReg
     return { mRegistrations };
 }
 
+#if CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX
+void ServerClusterInterfaceRegistry::IndexPaths(ServerClusterInterface & cluster)
+{
+    VerifyOrReturn(mIndexValid);
+
+    for (const ConcreteClusterPath & path : cluster.GetPaths())
+    {
+        CHIP_ERROR err = mIndex.Insert(path, &cluster);
+        if (err != CHIP_NO_ERROR)
+        {
+            // Registration still succeeds, lookups just become linear.
+            ChipLogError(DataManagement, "Cluster registry index disabled: %" CHIP_ERROR_FORMAT, err.Format());
+            mIndex.Clear();
+            mIndexValid = false;
+            return;
+        }
+    }
+}
+
+void ServerClusterInterfaceRegistry::UnindexPaths(ServerClusterInterface & cluster)
+{
+    if (mRegistrations == nullptr)
+    {
+        // Last registration gone: start over with an empty index.
+        mIndex.Clear();
+        mIndexValid = true;
+        return;
+    }
+    VerifyOrReturn(mIndexValid);
+
+    for (const ConcreteClusterPath & path : cluster.GetPaths())
+    {
+        mIndex.Remove(path, &cluster);
+    }
+}
+#endif // CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX
+
 } // namespace app
 } // namespace chip
@@ -19,6 +19,7 @@
 #include <app/AppConfig.h>
 #include <app/ConcreteClusterPath.h>
 #include <app/server-cluster/ServerClusterInterface.h>
+#include <lib/core/CHIPConfig.h>
 #include <lib/core/CHIPError.h>
 #include <lib/core/DataModelTypes.h>
 #include <lib/support/logging/CHIPLogging.h>
@@ -27,6 +28,10 @@
 #include <new>
 #include <optional>
 
+#if CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX
+#include <app/server-cluster/ServerClusterPathIndex.h>
+#endif
+
 namespace chip {
 namespace app {
 
@@ -144,6 +149,11 @@ private:
 };
 
 /// Allows registering and retrieving ServerClusterInterface instances for specific cluster paths.
+///
+/// When CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX is enabled, the registered paths are also kept
+/// in a hash table so that `Get` (and the duplicate checks of `Register`) do not scan all the
+/// registrations. The paths returned by `GetPaths()` MUST then not change while a cluster is
+/// registered.
 class ServerClusterInterfaceRegistry
 {
 public:
@@ -226,6 +236,17 @@ protected:
 
     // Managing context for this registry
     std::optional<ServerClusterContext> mContext;
+
+#if CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX
+    void IndexPaths(ServerClusterInterface & cluster);
+    void UnindexPaths(ServerClusterInterface & cluster);
+
+    ServerClusterPathIndex mIndex;
+
+    // Cleared if the index could not be grown: lookups go through the registration list until
+    // the registry becomes empty again.
+    bool mIndexValid = true;
+#endif
 };
 
 } // namespace app
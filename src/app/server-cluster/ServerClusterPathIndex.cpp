@@ -0,0 +1,146 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <app/server-cluster/ServerClusterPathIndex.h>
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+namespace app {
+
+namespace {
+
+constexpr size_t kMinCapacity = 16;
+
+} // namespace
+
+size_t ServerClusterPathIndex::Hash(EndpointId endpointId, ClusterId clusterId)
+{
+    // Cluster ids are mostly small and dense, and so are endpoint ids: mix them
+    // (murmur3 finalizer) so that consecutive paths do not end up in long runs.
+    uint64_t h = (static_cast<uint64_t>(endpointId) << 32) | clusterId;
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ull;
+    h ^= h >> 33;
+    return static_cast<size_t>(h);
+}
+
+size_t ServerClusterPathIndex::Probe(const ConcreteClusterPath & path) const
+{
+    const size_t mask = mCapacity - 1;
+    size_t i          = Hash(path.mEndpointId, path.mClusterId) & mask;
+
+    // The table is never full, so this ends at an empty entry at the latest.
+    while (mEntries[i].cluster != nullptr &&
+           (mEntries[i].endpointId != path.mEndpointId || mEntries[i].clusterId != path.mClusterId))
+    {
+        i = (i + 1) & mask;
+    }
+    return i;
+}
+
+CHIP_ERROR ServerClusterPathIndex::Grow()
+{
+    const size_t newCapacity = (mCapacity == 0) ? kMinCapacity : mCapacity * 2;
+    VerifyOrReturnError(newCapacity > mCapacity, CHIP_ERROR_NO_MEMORY);
+
+    auto * newEntries = static_cast<Entry *>(Platform::MemoryCalloc(newCapacity, sizeof(Entry)));
+    VerifyOrReturnError(newEntries != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    Entry * oldEntries       = mEntries;
+    const size_t oldCapacity = mCapacity;
+
+    mEntries  = newEntries;
+    mCapacity = newCapacity;
+    for (size_t i = 0; i < oldCapacity; i++)
+    {
+        if (oldEntries[i].cluster != nullptr)
+        {
+            mEntries[Probe({ oldEntries[i].endpointId, oldEntries[i].clusterId })] = oldEntries[i];
+        }
+    }
+
+    Platform::MemoryFree(oldEntries);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ServerClusterPathIndex::Insert(const ConcreteClusterPath & path, ServerClusterInterface * cluster)
+{
+    VerifyOrReturnError(cluster != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Keep the load factor at or below 3/4
+    if ((mSize + 1) * 4 > mCapacity * 3)
+    {
+        ReturnErrorOnFailure(Grow());
+    }
+
+    Entry & entry = mEntries[Probe(path)];
+    if (entry.cluster == nullptr)
+    {
+        mSize++;
+    }
+    entry.cluster    = cluster;
+    entry.endpointId = path.mEndpointId;
+    entry.clusterId  = path.mClusterId;
+    return CHIP_NO_ERROR;
+}
+
+void ServerClusterPathIndex::Remove(const ConcreteClusterPath & path, const ServerClusterInterface * cluster)
+{
+    VerifyOrReturn(mSize > 0);
+
+    const size_t mask = mCapacity - 1;
+    size_t hole       = Probe(path);
+    VerifyOrReturn(mEntries[hole].cluster != nullptr && mEntries[hole].cluster == cluster);
+
+    // Backward-shift deletion: move up any following entry whose probe sequence
+    // went through the hole, so that lookups never stop short of it.
+    for (size_t i = (hole + 1) & mask; mEntries[i].cluster != nullptr; i = (i + 1) & mask)
+    {
+        const size_t home = Hash(mEntries[i].endpointId, mEntries[i].clusterId) & mask;
+        if (((i - home) & mask) >= ((i - hole) & mask))
+        {
+            mEntries[hole] = mEntries[i];
+            hole           = i;
+        }
+    }
+
+    mEntries[hole] = {};
+    mSize--;
+}
+
+ServerClusterInterface * ServerClusterPathIndex::Find(const ConcreteClusterPath & path) const
+{
+    VerifyOrReturnValue(mSize > 0, nullptr);
+    return mEntries[Probe(path)].cluster;
+}
+
+void ServerClusterPathIndex::Clear()
+{
+    // An index that never allocated may be destroyed after Platform::MemoryShutdown(), e.g. as part of a global registry.
+    VerifyOrReturn(mEntries != nullptr);
+
+    Platform::MemoryFree(mEntries);
+    mEntries  = nullptr;
+    mCapacity = 0;
+    mSize     = 0;
+}
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,80 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <app/ConcreteClusterPath.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace chip {
+namespace app {
+
+class ServerClusterInterface;
+
+/// A hash table mapping cluster paths to the ServerClusterInterface serving them.
+///
+/// Uses open addressing with linear probing, and backward-shift deletion so that
+/// no tombstones are left behind. The table is heap allocated and doubles in size
+/// whenever it becomes 3/4 full.
+class ServerClusterPathIndex
+{
+public:
+    ServerClusterPathIndex() = default;
+    ~ServerClusterPathIndex() { Clear(); }
+
+    ServerClusterPathIndex(const ServerClusterPathIndex &)             = delete;
+    ServerClusterPathIndex & operator=(const ServerClusterPathIndex &) = delete;
+
+    /// Maps `path` to `cluster`, replacing any previous mapping of `path`.
+    ///
+    /// Returns CHIP_ERROR_NO_MEMORY if the table needed to grow and could not. The
+    /// table is left unchanged in that case.
+    CHIP_ERROR Insert(const ConcreteClusterPath & path, ServerClusterInterface * cluster);
+
+    /// Removes the mapping of `path`, if it is mapped to `cluster`.
+    void Remove(const ConcreteClusterPath & path, const ServerClusterInterface * cluster);
+
+    /// Returns the cluster mapped to `path`, or nullptr.
+    ServerClusterInterface * Find(const ConcreteClusterPath & path) const;
+
+    /// Removes all mappings and frees the table.
+    void Clear();
+
+    size_t Size() const { return mSize; }
+
+private:
+    struct Entry
+    {
+        ServerClusterInterface * cluster; // nullptr for an empty entry
+        ClusterId clusterId;
+        EndpointId endpointId;
+    };
+
+    static size_t Hash(EndpointId endpointId, ClusterId clusterId);
+    CHIP_ERROR Grow();
+    size_t Probe(const ConcreteClusterPath & path) const;
+
+    Entry * mEntries = nullptr;
+    size_t mCapacity = 0; // Always 0 or a power of 2
+    size_t mSize     = 0;
+};
+
+} // namespace app
+} // namespace chip
@@ -74,6 +74,10 @@ void SingleEndpointServerClusterRegistry::UnregisterAllFromEndpoint(EndpointId e
             }
             ServerClusterRegistration * actual_next = current->next;
 
+#if CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX
+            UnindexPaths(*current->serverClusterInterface);
+#endif
+
             current->next = nullptr; // Make sure current does not look like part of a list.
             if (mContext.has_value())
             {
@@ -26,10 +26,14 @@
 #include <lib/core/CHIPError.h>
 #include <lib/core/DataModelTypes.h>
 #include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/logging/CHIPLogging.h>
 #include <lib/support/tests/ExtraPwTestMacros.h>
+#include <system/SystemClock.h>
 
 #include <algorithm>
 #include <cstdlib>
+#include <memory>
+#include <vector>
 
 using namespace chip;
 using namespace chip::Testing;
@@ -125,6 +129,49 @@ struct TestServerClusterInterfaceRegistry : public ::testing::Test
     static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
 };
 
+void BenchmarkGet(size_t count)
+{
+    using namespace chip::System::Clock;
+
+    // 10 clusters per endpoint, like a bridge exposing many similar devices
+    auto pathAt = [](size_t i) {
+        return ConcreteClusterPath(static_cast<EndpointId>(i / 10 + 1), static_cast<ClusterId>(i % 10 + 1));
+    };
+
+    std::vector<std::unique_ptr<RegisteredServerCluster<FakeServerClusterInterface>>> clusters;
+    ServerClusterInterfaceRegistry registry;
+
+    Microseconds64 start = chip::System::SystemClock().GetMonotonicMicroseconds64();
+    for (size_t i = 0; i < count; i++)
+    {
+        clusters.push_back(std::make_unique<RegisteredServerCluster<FakeServerClusterInterface>>(pathAt(i)));
+        ASSERT_EQ(registry.Register(clusters.back()->Registration()), CHIP_NO_ERROR);
+    }
+    Microseconds64 registered = chip::System::SystemClock().GetMonotonicMicroseconds64();
+
+    // Visit the clusters in a scattered order, so that the single-entry cache does not help
+    constexpr size_t kLookups = 20000;
+    size_t found              = 0;
+    for (size_t i = 0; i < kLookups; i++)
+    {
+        const size_t n = (i * 7919) % count;
+        found += (registry.Get(pathAt(n)) == &clusters[n]->Cluster()) ? 1 : 0;
+    }
+    Microseconds64 looked = chip::System::SystemClock().GetMonotonicMicroseconds64();
+
+    EXPECT_EQ(found, kLookups);
+    EXPECT_EQ(registry.Get({ static_cast<EndpointId>(count), kCluster1 }), nullptr);
+
+    ChipLogProgress(Test, "Registry with %u clusters: register %u ns/cluster, get %u ns/lookup", static_cast<unsigned>(count),
+                    static_cast<unsigned>((registered - start).count() * 1000 / count),
+                    static_cast<unsigned>((looked - registered).count() * 1000 / kLookups));
+
+    for (auto & cluster : clusters)
+    {
+        EXPECT_EQ(registry.Unregister(&cluster->Cluster()), CHIP_NO_ERROR);
+    }
+}
+
 } // namespace
 
 TEST_F(TestServerClusterInterfaceRegistry, AcceptDifferentEndpointPaths)
@@ -405,3 +452,10 @@ TEST_F(TestServerClusterInterfaceRegistry, StartupShutdownWithoutContext)
     EXPECT_EQ(cluster2.Cluster().GetShutdownCallCount(), 1u);
     EXPECT_EQ(cluster3.Cluster().GetShutdownCallCount(), 1u);
 }
+
+TEST_F(TestServerClusterInterfaceRegistry, BenchmarkGet)
+{
+    BenchmarkGet(50);
+    BenchmarkGet(500);
+    BenchmarkGet(5000);
+}
@@ -0,0 +1,145 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <app/server-cluster/ServerClusterPathIndex.h>
+#include <pw_unit_test/framework.h>
+
+#include <app/ConcreteClusterPath.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+
+#include <map>
+#include <utility>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+// The index never dereferences the cluster pointers, so distinct addresses are enough.
+ServerClusterInterface * FakeCluster(uintptr_t n)
+{
+    return reinterpret_cast<ServerClusterInterface *>(n * 8);
+}
+
+struct TestServerClusterPathIndex : public ::testing::Test
+{
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+} // namespace
+
+TEST_F(TestServerClusterPathIndex, InsertFindRemove)
+{
+    ServerClusterPathIndex index;
+
+    EXPECT_EQ(index.Find({ 1, 6 }), nullptr);
+
+    EXPECT_EQ(index.Insert({ 1, 6 }, FakeCluster(1)), CHIP_NO_ERROR);
+    EXPECT_EQ(index.Insert({ 1, 8 }, FakeCluster(2)), CHIP_NO_ERROR);
+    EXPECT_EQ(index.Insert({ 2, 6 }, FakeCluster(3)), CHIP_NO_ERROR);
+    EXPECT_EQ(index.Size(), 3u);
+
+    EXPECT_EQ(index.Find({ 1, 6 }), FakeCluster(1));
+    EXPECT_EQ(index.Find({ 1, 8 }), FakeCluster(2));
+    EXPECT_EQ(index.Find({ 2, 6 }), FakeCluster(3));
+    EXPECT_EQ(index.Find({ 2, 8 }), nullptr);
+
+    // Removal only applies to the cluster owning the path
+    index.Remove({ 1, 6 }, FakeCluster(2));
+    EXPECT_EQ(index.Find({ 1, 6 }), FakeCluster(1));
+
+    index.Remove({ 1, 6 }, FakeCluster(1));
+    EXPECT_EQ(index.Find({ 1, 6 }), nullptr);
+    EXPECT_EQ(index.Find({ 1, 8 }), FakeCluster(2));
+    EXPECT_EQ(index.Size(), 2u);
+
+    // Removing a missing path is a no-op
+    index.Remove({ 1, 6 }, FakeCluster(1));
+    EXPECT_EQ(index.Size(), 2u);
+
+    EXPECT_EQ(index.Insert({ 1, 6 }, nullptr), CHIP_ERROR_INVALID_ARGUMENT);
+
+    index.Clear();
+    EXPECT_EQ(index.Size(), 0u);
+    EXPECT_EQ(index.Find({ 1, 8 }), nullptr);
+}
+
+TEST_F(TestServerClusterPathIndex, InsertReplaces)
+{
+    ServerClusterPathIndex index;
+
+    EXPECT_EQ(index.Insert({ 1, 6 }, FakeCluster(1)), CHIP_NO_ERROR);
+    EXPECT_EQ(index.Insert({ 1, 6 }, FakeCluster(2)), CHIP_NO_ERROR);
+    EXPECT_EQ(index.Size(), 1u);
+    EXPECT_EQ(index.Find({ 1, 6 }), FakeCluster(2));
+}
+
+TEST_F(TestServerClusterPathIndex, MatchesReferenceMap)
+{
+    // Grow through several sizes and remove entries in an order unrelated to the
+    // insertion order, so that deletions have to shift back probe runs.
+    ServerClusterPathIndex index;
+    std::map<std::pair<EndpointId, ClusterId>, ServerClusterInterface *> reference;
+
+    uintptr_t n = 1;
+    for (EndpointId endpoint = 0; endpoint < 40; endpoint++)
+    {
+        for (ClusterId cluster = 0; cluster < 25; cluster++)
+        {
+            ServerClusterInterface * value = FakeCluster(n++);
+            ASSERT_EQ(index.Insert({ endpoint, cluster }, value), CHIP_NO_ERROR);
+            reference[{ endpoint, cluster }] = value;
+        }
+    }
+    EXPECT_EQ(index.Size(), reference.size());
+
+    uint32_t step = 0;
+    for (auto it = reference.begin(); it != reference.end();)
+    {
+        if ((step++ % 3) != 0)
+        {
+            ++it;
+            continue;
+        }
+        index.Remove({ it->first.first, it->first.second }, it->second);
+        it = reference.erase(it);
+    }
+    EXPECT_EQ(index.Size(), reference.size());
+
+    for (EndpointId endpoint = 0; endpoint < 41; endpoint++)
+    {
+        for (ClusterId cluster = 0; cluster < 26; cluster++)
+        {
+            auto it                           = reference.find({ endpoint, cluster });
+            ServerClusterInterface * expected = (it == reference.end()) ? nullptr : it->second;
+            EXPECT_EQ(index.Find({ endpoint, cluster }), expected);
+        }
+    }
+}
+
+TEST_F(TestServerClusterPathIndex, DestroyAfterMemoryShutdown)
+{
+    // The registry of a global data model provider that never registered a cluster is destroyed after the platform memory
+    // was shut down.
+    {
+        ServerClusterPathIndex index;
+        chip::Platform::MemoryShutdown();
+    }
+    ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR);
+}
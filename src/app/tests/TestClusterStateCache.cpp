@@ -279,7 +279,8 @@ void DataSeriesGenerator::Generate(ForwardedDataCallbackValidator & dataCallback
     callback->OnReportEnd();
 }
 
-class CacheValidator : public ClusterStateCache::Callback
+template <typename CacheType>
+class CacheValidator : public CacheType::Callback
 {
 public:
     CacheValidator(AttributeInstructionListType & instructionList, ForwardedDataCallbackValidator & dataCallbackValidator);
@@ -310,7 +311,7 @@ private:
         }
     }
 
-    void DecodeAttribute(const AttributeInstruction & instruction, const ConcreteAttributePath & path, ClusterStateCache * cache)
+    void DecodeAttribute(const AttributeInstruction & instruction, const ConcreteAttributePath & path, CacheType * cache)
     {
         CHIP_ERROR err;
         bool gotStatus = false;
@@ -323,7 +324,7 @@ private:
             ChipLogProgress(DataManagement, "\t\t -- Validating A");
 
             Clusters::UnitTesting::Attributes::Int16u::TypeInfo::DecodableType v = 0;
-            err = cache->Get<Clusters::UnitTesting::Attributes::Int16u::TypeInfo>(path, v);
+            err = cache->template Get<Clusters::UnitTesting::Attributes::Int16u::TypeInfo>(path, v);
             if (err == CHIP_ERROR_IM_STATUS_CODE_RECEIVED)
             {
                 gotStatus = true;
@@ -342,7 +343,7 @@ private:
             ChipLogProgress(DataManagement, "\t\t -- Validating B");
 
             Clusters::UnitTesting::Attributes::OctetString::TypeInfo::DecodableType v;
-            err = cache->Get<Clusters::UnitTesting::Attributes::OctetString::TypeInfo>(path, v);
+            err = cache->template Get<Clusters::UnitTesting::Attributes::OctetString::TypeInfo>(path, v);
             if (err == CHIP_ERROR_IM_STATUS_CODE_RECEIVED)
             {
                 gotStatus = true;
@@ -361,7 +362,7 @@ private:
             ChipLogProgress(DataManagement, "\t\t -- Validating C");
 
             Clusters::UnitTesting::Attributes::StructAttr::TypeInfo::DecodableType v;
-            err = cache->Get<Clusters::UnitTesting::Attributes::StructAttr::TypeInfo>(path, v);
+            err = cache->template Get<Clusters::UnitTesting::Attributes::StructAttr::TypeInfo>(path, v);
             if (err == CHIP_ERROR_IM_STATUS_CODE_RECEIVED)
             {
                 gotStatus = true;
@@ -380,7 +381,7 @@ private:
             ChipLogProgress(DataManagement, "\t\t -- Validating D");
 
             Clusters::UnitTesting::Attributes::ListStructOctetString::TypeInfo::DecodableType v;
-            err = cache->Get<Clusters::UnitTesting::Attributes::ListStructOctetString::TypeInfo>(path, v);
+            err = cache->template Get<Clusters::UnitTesting::Attributes::ListStructOctetString::TypeInfo>(path, v);
             if (err == CHIP_ERROR_IM_STATUS_CODE_RECEIVED)
             {
                 gotStatus = true;
@@ -410,10 +411,9 @@ private:
         }
     }
 
-    void DecodeClusterObject(const AttributeInstruction & instruction, const ConcreteAttributePath & path,
-                             ClusterStateCache * cache)
+    void DecodeClusterObject(const AttributeInstruction & instruction, const ConcreteAttributePath & path, CacheType * cache)
     {
-        std::list<ClusterStateCache::AttributeStatus> statusList;
+        std::list<typename CacheType::AttributeStatus> statusList;
         EXPECT_EQ(cache->Get(path.mEndpointId, path.mClusterId, clusterValue, statusList), CHIP_NO_ERROR);
 
         if (instruction.mValueType == AttributeInstruction::kData)
@@ -463,7 +463,7 @@ private:
         }
     }
 
-    void OnAttributeChanged(ClusterStateCache * cache, const ConcreteAttributePath & path) override
+    void OnAttributeChanged(CacheType * cache, const ConcreteAttributePath & path) override
     {
         // Ensure that the provided path is one that we're expecting to find
         auto iter = mExpectedAttributes.find(path);
@@ -489,14 +489,14 @@ private:
         }
     }
 
-    void OnClusterChanged(ClusterStateCache * cache, EndpointId endpointId, ClusterId clusterId) override
+    void OnClusterChanged(CacheType * cache, EndpointId endpointId, ClusterId clusterId) override
     {
         auto iter = mExpectedClusters.find(std::make_tuple(endpointId, clusterId));
         ASSERT_NE(iter, mExpectedClusters.end());
         mExpectedClusters.erase(iter);
     }
 
-    void OnEndpointAdded(ClusterStateCache * cache, EndpointId endpointId) override
+    void OnEndpointAdded(CacheType * cache, EndpointId endpointId) override
     {
         auto iter = mExpectedEndpoints.find(endpointId);
         ASSERT_NE(iter, mExpectedEndpoints.end());
@@ -522,8 +522,9 @@ private:
     ForwardedDataCallbackValidator & mDataCallbackValidator;
 };
 
-CacheValidator::CacheValidator(AttributeInstructionListType & instructionList,
-                               ForwardedDataCallbackValidator & dataCallbackValidator) :
+template <typename CacheType>
+CacheValidator<CacheType>::CacheValidator(AttributeInstructionListType & instructionList,
+                                          ForwardedDataCallbackValidator & dataCallbackValidator) :
     mDataCallbackValidator(dataCallbackValidator)
 {
     for (auto & instruction : instructionList)
@@ -541,11 +542,12 @@ CacheValidator::CacheValidator(AttributeInstructionListType & instructionList,
     }
 }
 
-void RunAndValidateSequence(AttributeInstructionListType list)
+template <typename CacheType>
+void RunAndValidateSequenceWithCache(AttributeInstructionListType list)
 {
     ForwardedDataCallbackValidator dataCallbackValidator;
-    CacheValidator client(list, dataCallbackValidator);
-    ClusterStateCache cache(client);
+    CacheValidator<CacheType> client(list, dataCallbackValidator);
+    CacheType cache(client);
 
     // In order for the cache to track our data versions, we need to claim to it
     // that we are dealing with a wildcard path.  And we need to do that before
@@ -760,6 +762,15 @@ void RunAndValidateSequence(AttributeInstructionListType list)
     }
 }
 
+void RunAndValidateSequence(AttributeInstructionListType list)
+{
+    ChipLogProgress(DataManagement, "\t -- Using map storage");
+    RunAndValidateSequenceWithCache<ClusterStateCache>(list);
+
+    ChipLogProgress(DataManagement, "\t -- Using flat storage");
+    RunAndValidateSequenceWithCache<ClusterStateCacheFlat>(list);
+}
+
 /*
  * This validates the cache by issuing different sequences of attribute combinations
  * and ensuring that the latest view in the cache matches up with expectations.
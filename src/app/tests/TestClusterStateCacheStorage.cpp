@@ -0,0 +1,502 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/ClusterStateCacheStorage.h>
+#include <lib/core/TLV.h>
+#include <lib/support/CHIPMem.h>
+#include <system/SystemClock.h>
+
+#if CHIP_CONFIG_ENABLE_READ_CLIENT
+#include <app/ClusterStateCache.h>
+#include <app/MessageDef/DataVersionFilterIBs.h>
+#endif // CHIP_CONFIG_ENABLE_READ_CLIENT
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <pw_unit_test/framework.h>
+
+#include <type_traits>
+#include <vector>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+class TestClusterStateCacheStorage : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { Platform::MemoryShutdown(); }
+};
+
+// Holds an anonymous TLV octet string element of the given size, filled with `fill`.
+class EncodedValue
+{
+public:
+    EncodedValue(size_t size, uint8_t fill)
+    {
+        std::vector<uint8_t> value(size, fill);
+        TLV::TLVWriter writer;
+        writer.Init(mBuffer, sizeof(mBuffer));
+        EXPECT_EQ(writer.Put(TLV::AnonymousTag(), ByteSpan(value.data(), value.size())), CHIP_NO_ERROR);
+        EXPECT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+        mLength = writer.GetLengthWritten();
+    }
+
+    TLV::TLVReader Reader() const
+    {
+        TLV::TLVReader reader;
+        reader.Init(mBuffer, mLength);
+        EXPECT_EQ(reader.Next(), CHIP_NO_ERROR);
+        return reader;
+    }
+
+    uint32_t Size() const { return mLength; }
+
+private:
+    uint8_t mBuffer[512];
+    uint32_t mLength = 0;
+};
+
+CHIP_ERROR SetData(ClusterStateCacheFlatStorage & storage, const ConcreteAttributePath & path, const EncodedValue & value)
+{
+    TLV::TLVReader reader = value.Reader();
+    return storage.SetAttributeData(path, reader, value.Size());
+}
+
+// Returns the size of the cached value of path, or 0 if it does not hold the expected data.
+size_t GetDataSize(const ClusterStateCacheFlatStorage & storage, const ConcreteAttributePath & path, uint8_t fill)
+{
+    CachedAttributeState state;
+    VerifyOrReturnValue(storage.GetAttribute(path, state) == CHIP_NO_ERROR && state.Is<ByteSpan>(), 0);
+
+    TLV::TLVReader reader;
+    reader.Init(state.Get<ByteSpan>());
+    ByteSpan value;
+    VerifyOrReturnValue(reader.Next() == CHIP_NO_ERROR && reader.Get(value) == CHIP_NO_ERROR, 0);
+
+    for (auto byte : value)
+    {
+        VerifyOrReturnValue(byte == fill, 0);
+    }
+    return value.size();
+}
+
+TEST_F(TestClusterStateCacheStorage, StoresAttributeStates)
+{
+    ClusterStateCacheFlatStorage storage;
+    const ConcreteAttributePath dataPath(1, 6, 0);
+    const ConcreteAttributePath statusPath(1, 6, 1);
+    const ConcreteAttributePath sizePath(2, 8, 0);
+
+    EXPECT_FALSE(storage.HasEndpoint(1));
+    EXPECT_EQ(storage.FindCluster(dataPath), nullptr);
+
+    EXPECT_EQ(SetData(storage, dataPath, EncodedValue(10, 0xAA)), CHIP_NO_ERROR);
+    storage.SetAttributeStatus(statusPath, StatusIB(Protocols::InteractionModel::Status::UnsupportedRead));
+    storage.SetAttributeSize(sizePath, 42);
+
+    EXPECT_TRUE(storage.HasEndpoint(1));
+    EXPECT_TRUE(storage.HasEndpoint(2));
+    EXPECT_FALSE(storage.HasEndpoint(3));
+    EXPECT_NE(storage.FindCluster(ConcreteClusterPath(1, 6)), nullptr);
+    EXPECT_NE(storage.FindCluster(ConcreteClusterPath(2, 8)), nullptr);
+    EXPECT_EQ(storage.FindCluster(ConcreteClusterPath(1, 8)), nullptr);
+
+    EXPECT_EQ(GetDataSize(storage, dataPath, 0xAA), 10u);
+
+    CachedAttributeState state;
+    EXPECT_EQ(storage.GetAttribute(statusPath, state), CHIP_NO_ERROR);
+    ASSERT_TRUE(state.Is<StatusIB>());
+    EXPECT_EQ(state.Get<StatusIB>().mStatus, Protocols::InteractionModel::Status::UnsupportedRead);
+
+    EXPECT_EQ(storage.GetAttribute(sizePath, state), CHIP_NO_ERROR);
+    ASSERT_TRUE(state.Is<uint32_t>());
+    EXPECT_EQ(state.Get<uint32_t>(), 42u);
+
+    EXPECT_EQ(storage.GetAttribute(ConcreteAttributePath(1, 6, 2), state), CHIP_ERROR_KEY_NOT_FOUND);
+
+    // Replacing data by a status and back
+    storage.SetAttributeStatus(dataPath, StatusIB(Protocols::InteractionModel::Status::Failure));
+    EXPECT_EQ(storage.GetAttribute(dataPath, state), CHIP_NO_ERROR);
+    EXPECT_TRUE(state.Is<StatusIB>());
+
+    EXPECT_EQ(SetData(storage, dataPath, EncodedValue(20, 0xBB)), CHIP_NO_ERROR);
+    EXPECT_EQ(GetDataSize(storage, dataPath, 0xBB), 20u);
+}
+
+TEST_F(TestClusterStateCacheStorage, KeepsClusterVersions)
+{
+    ClusterStateCacheFlatStorage storage;
+    const ConcreteClusterPath clusterPath(1, 6);
+
+    storage.GetOrCreateCluster(clusterPath).mCommittedDataVersion.SetValue(7);
+    storage.SetAttributeSize(ConcreteAttributePath(1, 5, 0), 1);
+    storage.SetAttributeSize(ConcreteAttributePath(1, 6, 0), 1);
+
+    const CachedClusterState * clusterState = storage.FindCluster(clusterPath);
+    ASSERT_NE(clusterState, nullptr);
+    EXPECT_TRUE(clusterState->mCommittedDataVersion == MakeOptional<DataVersion>(7));
+
+    // Clearing the last attribute keeps the cluster and its versions
+    storage.ClearAttribute(ConcreteAttributePath(1, 6, 0));
+    clusterState = storage.FindCluster(clusterPath);
+    ASSERT_NE(clusterState, nullptr);
+    EXPECT_TRUE(clusterState->mCommittedDataVersion == MakeOptional<DataVersion>(7));
+}
+
+TEST_F(TestClusterStateCacheStorage, IteratesInPathOrder)
+{
+    ClusterStateCacheFlatStorage storage;
+    const ConcreteAttributePath paths[] = {
+        ConcreteAttributePath(2, 6, 0),
+        ConcreteAttributePath(0, 0x28, 0xFFFC),
+        ConcreteAttributePath(2, 6, 0x4000),
+        ConcreteAttributePath(0xFFFE, 6, 0),
+        ConcreteAttributePath(0, 0x1D, 0),
+        ConcreteAttributePath(2, 0x0300, 1),
+        ConcreteAttributePath(0, 0x28, 0),
+        ConcreteAttributePath(2, 6, 1),
+        ConcreteAttributePath(0, 0xFFF1FC01, 0),
+    };
+    for (const auto & path : paths)
+    {
+        storage.SetAttributeSize(path, 1);
+    }
+
+    std::vector<ConcreteClusterPath> clusters;
+    EXPECT_EQ(storage.ForEachCluster([&clusters](const ConcreteClusterPath & path, const CachedClusterState &) {
+        clusters.push_back(path);
+        return CHIP_NO_ERROR;
+    }),
+              CHIP_NO_ERROR);
+
+    const std::vector<ConcreteClusterPath> expectedClusters = {
+        ConcreteClusterPath(0, 0x1D), ConcreteClusterPath(0, 0x28),     ConcreteClusterPath(0, 0xFFF1FC01),
+        ConcreteClusterPath(2, 6),    ConcreteClusterPath(2, 0x0300),   ConcreteClusterPath(0xFFFE, 6),
+    };
+    EXPECT_TRUE(clusters == expectedClusters);
+
+    clusters.clear();
+    EXPECT_EQ(storage.ForEachCluster(2,
+                                     [&clusters](const ConcreteClusterPath & path, const CachedClusterState &) {
+                                         clusters.push_back(path);
+                                         return CHIP_NO_ERROR;
+                                     }),
+              CHIP_NO_ERROR);
+    EXPECT_TRUE(clusters == std::vector<ConcreteClusterPath>({ ConcreteClusterPath(2, 6), ConcreteClusterPath(2, 0x0300) }));
+
+    std::vector<AttributeId> attributes;
+    EXPECT_EQ(storage.ForEachAttribute(ConcreteClusterPath(2, 6),
+                                       [&attributes](const ConcreteAttributePath & path, const CachedAttributeState &) {
+                                           attributes.push_back(path.mAttributeId);
+                                           return CHIP_NO_ERROR;
+                                       }),
+              CHIP_NO_ERROR);
+    EXPECT_TRUE(attributes == std::vector<AttributeId>({ 0, 1, 0x4000 }));
+
+    // Errors stop the iteration
+    size_t count = 0;
+    EXPECT_EQ(storage.ForEachCluster([&count](const ConcreteClusterPath &, const CachedClusterState &) {
+        count++;
+        return CHIP_ERROR_CANCELLED;
+    }),
+              CHIP_ERROR_CANCELLED);
+    EXPECT_EQ(count, 1u);
+}
+
+TEST_F(TestClusterStateCacheStorage, ClearsPaths)
+{
+    ClusterStateCacheFlatStorage storage;
+    for (EndpointId endpoint = 0; endpoint < 3; endpoint++)
+    {
+        for (ClusterId cluster = 0; cluster < 3; cluster++)
+        {
+            for (AttributeId attribute = 0; attribute < 3; attribute++)
+            {
+                EXPECT_EQ(SetData(storage, ConcreteAttributePath(endpoint, cluster, attribute), EncodedValue(8, 0x11)),
+                          CHIP_NO_ERROR);
+            }
+        }
+    }
+
+    storage.ClearAttribute(ConcreteAttributePath(0, 0, 1));
+    storage.ClearCluster(ConcreteClusterPath(0, 1));
+    storage.ClearEndpoint(1);
+
+    EXPECT_TRUE(storage.HasEndpoint(0));
+    EXPECT_FALSE(storage.HasEndpoint(1));
+    EXPECT_TRUE(storage.HasEndpoint(2));
+    EXPECT_EQ(storage.FindCluster(ConcreteClusterPath(0, 1)), nullptr);
+    EXPECT_EQ(storage.FindCluster(ConcreteClusterPath(1, 0)), nullptr);
+
+    for (EndpointId endpoint = 0; endpoint < 3; endpoint++)
+    {
+        for (ClusterId cluster = 0; cluster < 3; cluster++)
+        {
+            for (AttributeId attribute = 0; attribute < 3; attribute++)
+            {
+                const bool cleared = (endpoint == 1) || (endpoint == 0 && cluster == 1) ||
+                    (endpoint == 0 && cluster == 0 && attribute == 1);
+                EXPECT_EQ(GetDataSize(storage, ConcreteAttributePath(endpoint, cluster, attribute), 0x11), cleared ? 0u : 8u);
+            }
+        }
+    }
+}
+
+TEST_F(TestClusterStateCacheStorage, ReclaimsUnusedArenaSpace)
+{
+    ClusterStateCacheFlatStorage storage;
+    const ConcreteAttributePath updatedPath(1, 6, 0);
+    const ConcreteAttributePath stablePath(1, 6, 1);
+    const EncodedValue stableValue(100, 0x22);
+
+    EXPECT_EQ(SetData(storage, stablePath, stableValue), CHIP_NO_ERROR);
+
+    // Keep updating an attribute, the arena should not grow with the number of updates.
+    for (uint8_t i = 0; i < 200; i++)
+    {
+        EXPECT_EQ(SetData(storage, updatedPath, EncodedValue(200, i)), CHIP_NO_ERROR);
+        EXPECT_EQ(GetDataSize(storage, updatedPath, i), 200u);
+        EXPECT_EQ(GetDataSize(storage, stablePath, 0x22), 100u);
+    }
+    EXPECT_LT(storage.GetArenaSize(), 4096u);
+    EXPECT_LE(storage.GetUnusedArenaSize(), storage.GetArenaSize());
+
+    storage.Compact();
+    EXPECT_EQ(storage.GetUnusedArenaSize(), 0u);
+    EXPECT_EQ(storage.GetArenaSize(), stableValue.Size() + EncodedValue(200, 0).Size());
+    EXPECT_EQ(GetDataSize(storage, updatedPath, 199), 200u);
+    EXPECT_EQ(GetDataSize(storage, stablePath, 0x22), 100u);
+
+    // Clearing everything leaves nothing behind once compacted.
+    storage.ClearEndpoint(1);
+    storage.Compact();
+    EXPECT_EQ(storage.GetArenaSize(), 0u);
+}
+
+TEST_F(TestClusterStateCacheStorage, FailedCopyKeepsPreviousData)
+{
+    ClusterStateCacheFlatStorage storage;
+    const ConcreteAttributePath path(1, 6, 0);
+    const EncodedValue value(50, 0x33);
+
+    EXPECT_EQ(SetData(storage, path, value), CHIP_NO_ERROR);
+    const size_t arenaSize = storage.GetArenaSize();
+
+    // Claim a size too small for the value
+    const EncodedValue largerValue(60, 0x44);
+    TLV::TLVReader reader = largerValue.Reader();
+    EXPECT_NE(storage.SetAttributeData(path, reader, value.Size()), CHIP_NO_ERROR);
+
+    EXPECT_EQ(storage.GetArenaSize(), arenaSize);
+    EXPECT_EQ(GetDataSize(storage, path, 0x33), 50u);
+}
+
+#if CHIP_CONFIG_ENABLE_READ_CLIENT
+
+// Endpoints, clusters and attributes of the device a wildcard subscription is made to.
+constexpr EndpointId kBenchmarkEndpoints     = 24;
+constexpr ClusterId kBenchmarkClusters[]     = { 0x0003, 0x0004, 0x0006, 0x0008, 0x001D, 0x0300 };
+constexpr AttributeId kBenchmarkAttributes[] = { 0x0000, 0x0001, 0x0002, 0x0003, 0xFFFC, 0xFFFD };
+constexpr size_t kBenchmarkClusterCount      = kBenchmarkEndpoints * MATTER_ARRAY_SIZE(kBenchmarkClusters);
+constexpr size_t kBenchmarkAttributeCount    = kBenchmarkClusterCount * MATTER_ARRAY_SIZE(kBenchmarkAttributes);
+constexpr uint32_t kBenchmarkLookupPasses    = 20;
+constexpr DataVersion kBenchmarkDataVersion  = 0x1234;
+constexpr uint8_t kBenchmarkString[]         = "a moderately long attribute value";
+
+// Returns the number of heap bytes in use, if the platform can tell.
+bool GetHeapBytesInUse(size_t & bytes)
+{
+#if defined(__GLIBC__)
+#if __GLIBC_PREREQ(2, 33)
+    bytes = mallinfo2().uordblks;
+#else
+    bytes = static_cast<size_t>(mallinfo().uordblks);
+#endif
+    return true;
+#else
+    return false;
+#endif
+}
+
+// Encodes the value of the attribute: mostly small scalars, with some strings of different lengths.
+CHIP_ERROR EncodeBenchmarkValue(TLV::TLVWriter & writer, const ConcreteAttributePath & path)
+{
+    switch (path.mAttributeId)
+    {
+    case 0x0000:
+        return writer.PutBoolean(TLV::AnonymousTag(), (path.mEndpointId % 2) == 0);
+    case 0x0001:
+        return writer.Put(TLV::AnonymousTag(), static_cast<uint16_t>(path.mEndpointId * path.mClusterId));
+    case 0x0002:
+        return writer.Put(TLV::AnonymousTag(), ByteSpan(kBenchmarkString, 1 + (path.mClusterId % (sizeof(kBenchmarkString) - 1))));
+    case 0x0003:
+        return writer.PutString(TLV::AnonymousTag(), reinterpret_cast<const char *>(kBenchmarkString));
+    default:
+        return writer.Put(TLV::AnonymousTag(), static_cast<uint32_t>(path.mAttributeId ^ path.mClusterId));
+    }
+}
+
+template <typename CacheType>
+class NullCacheCallback : public CacheType::Callback
+{
+    void OnDone(ReadClient *) override {}
+};
+
+// Delivers one priming report of every benchmark attribute, the way a wildcard subscription fills the cache.
+template <typename CacheType>
+void FillBenchmarkCache(CacheType & cache)
+{
+    ReadClient::Callback & callback = cache.GetBufferedCallback();
+
+    AttributePathParams wildcardPath;
+    uint8_t filterBuffer[32];
+    TLV::TLVWriter filterWriter;
+    filterWriter.Init(filterBuffer);
+    DataVersionFilterIBs::Builder filterBuilder;
+    ASSERT_EQ(filterBuilder.Init(&filterWriter), CHIP_NO_ERROR);
+    bool encodedDataVersionList = false;
+    ASSERT_EQ(callback.OnUpdateDataVersionFilterList(filterBuilder, Span<AttributePathParams>(&wildcardPath, 1),
+                                                     encodedDataVersionList),
+              CHIP_NO_ERROR);
+
+    callback.OnReportBegin();
+    for (EndpointId endpoint = 0; endpoint < kBenchmarkEndpoints; endpoint++)
+    {
+        for (ClusterId cluster : kBenchmarkClusters)
+        {
+            for (AttributeId attribute : kBenchmarkAttributes)
+            {
+                ConcreteDataAttributePath path(endpoint, cluster, attribute, MakeOptional(kBenchmarkDataVersion));
+                uint8_t buffer[64];
+                TLV::TLVWriter writer;
+                writer.Init(buffer);
+                ASSERT_EQ(EncodeBenchmarkValue(writer, path), CHIP_NO_ERROR);
+                ASSERT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+
+                TLV::TLVReader reader;
+                reader.Init(buffer, writer.GetLengthWritten());
+                ASSERT_EQ(reader.Next(), CHIP_NO_ERROR);
+                callback.OnAttributeData(path, &reader, StatusIB());
+            }
+        }
+    }
+    callback.OnReportEnd();
+}
+
+template <typename CacheType>
+void BenchmarkCache(const char * name)
+{
+    NullCacheCallback<CacheType> callback;
+    size_t heapBefore    = 0;
+    size_t heapAfter     = 0;
+    const bool heapKnown = GetHeapBytesInUse(heapBefore);
+
+    auto cache = Platform::MakeUnique<CacheType>(callback);
+    ASSERT_NE(cache.get(), nullptr);
+    FillBenchmarkCache(*cache);
+    GetHeapBytesInUse(heapAfter);
+
+    uint32_t found                      = 0;
+    System::Clock::Microseconds64 start = System::SystemClock().GetMonotonicMicroseconds64();
+    for (uint32_t pass = 0; pass < kBenchmarkLookupPasses; pass++)
+    {
+        for (EndpointId endpoint = 0; endpoint < kBenchmarkEndpoints; endpoint++)
+        {
+            for (ClusterId cluster : kBenchmarkClusters)
+            {
+                for (AttributeId attribute : kBenchmarkAttributes)
+                {
+                    TLV::TLVReader reader;
+                    if (cache->Get(ConcreteAttributePath(endpoint, cluster, attribute), reader) == CHIP_NO_ERROR)
+                    {
+                        found++;
+                    }
+                }
+            }
+        }
+    }
+    const System::Clock::Microseconds64 getElapsed = System::SystemClock().GetMonotonicMicroseconds64() - start;
+    EXPECT_EQ(found, kBenchmarkLookupPasses * kBenchmarkAttributeCount);
+
+    found = 0;
+    start = System::SystemClock().GetMonotonicMicroseconds64();
+    for (uint32_t pass = 0; pass < kBenchmarkLookupPasses; pass++)
+    {
+        for (EndpointId endpoint = 0; endpoint < kBenchmarkEndpoints; endpoint++)
+        {
+            for (ClusterId cluster : kBenchmarkClusters)
+            {
+                Optional<DataVersion> version;
+                if (cache->GetVersion(ConcreteClusterPath(endpoint, cluster), version) == CHIP_NO_ERROR &&
+                    version == MakeOptional(kBenchmarkDataVersion))
+                {
+                    found++;
+                }
+            }
+        }
+    }
+    const System::Clock::Microseconds64 versionElapsed = System::SystemClock().GetMonotonicMicroseconds64() - start;
+    EXPECT_EQ(found, kBenchmarkLookupPasses * kBenchmarkClusterCount);
+
+    found = 0;
+    start = System::SystemClock().GetMonotonicMicroseconds64();
+    for (uint32_t pass = 0; pass < kBenchmarkLookupPasses; pass++)
+    {
+        EXPECT_EQ(cache->ForEachAttribute([&found](const ConcreteAttributePath &) {
+            found++;
+            return CHIP_NO_ERROR;
+        }),
+                  CHIP_NO_ERROR);
+    }
+    const System::Clock::Microseconds64 iterateElapsed = System::SystemClock().GetMonotonicMicroseconds64() - start;
+    EXPECT_EQ(found, kBenchmarkLookupPasses * kBenchmarkAttributeCount);
+
+    if constexpr (std::is_same_v<CacheType, ClusterStateCacheFlat>)
+    {
+        // Attribute data of the flat cache lives in its arena, which a priming report fills without unused bytes.
+        EXPECT_EQ(cache->GetStorage().GetUnusedArenaSize(), 0u);
+        ChipLogProgress(Test, "%s: %u arena bytes", name, static_cast<unsigned>(cache->GetStorage().GetArenaSize()));
+    }
+    if (heapKnown)
+    {
+        ChipLogProgress(Test, "%s: %u attributes of %u clusters in %u heap bytes", name,
+                        static_cast<unsigned>(kBenchmarkAttributeCount), static_cast<unsigned>(kBenchmarkClusterCount),
+                        static_cast<unsigned>(heapAfter - heapBefore));
+    }
+    ChipLogProgress(Test, "%s: %u x %u Get in %llu us, %u x %u GetVersion in %llu us, %u x ForEachAttribute in %llu us", name,
+                    static_cast<unsigned>(kBenchmarkLookupPasses), static_cast<unsigned>(kBenchmarkAttributeCount),
+                    static_cast<unsigned long long>(getElapsed.count()), static_cast<unsigned>(kBenchmarkLookupPasses),
+                    static_cast<unsigned>(kBenchmarkClusterCount), static_cast<unsigned long long>(versionElapsed.count()),
+                    static_cast<unsigned>(kBenchmarkLookupPasses), static_cast<unsigned long long>(iterateElapsed.count()));
+}
+
+TEST_F(TestClusterStateCacheStorage, BenchmarkWildcardSubscriptionCache)
+{
+    BenchmarkCache<ClusterStateCache>("ClusterStateCache");
+    BenchmarkCache<ClusterStateCacheFlat>("ClusterStateCacheFlat");
+}
+
+#endif // CHIP_CONFIG_ENABLE_READ_CLIENT
+
+} // namespace
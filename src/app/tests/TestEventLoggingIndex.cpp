@@ -0,0 +1,294 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <access/SubjectDescriptor.h>
+#include <app/EventLoggingDelegate.h>
+#include <app/EventLoggingTypes.h>
+#include <app/EventManagement.h>
+#include <app/InteractionModelEngine.h>
+#include <app/MessageDef/EventReportIB.h>
+#include <app/tests/AppTestContext.h>
+#include <data-model-providers/codegen/Instance.h>
+#include <lib/core/CHIPCore.h>
+#include <lib/core/TLV.h>
+#include <lib/support/CHIPCounter.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/LinkedList.h>
+#include <lib/support/ScopedMemoryBuffer.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemClock.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <pw_unit_test/framework.h>
+
+#include <vector>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+
+constexpr ClusterId kLivenessClusterId   = 0x00000022;
+constexpr uint32_t kLivenessChangeEvent  = 1;
+constexpr EndpointId kTestEndpointId     = 2;
+constexpr TLV::Tag kLivenessDeviceStatus = TLV::ContextTag(1);
+
+// Together large enough to keep a bit more than kBufferedEvents critical events.
+constexpr size_t kBufferedEvents = 1000;
+uint8_t gDebugEventBuffer[8 * 1024];
+uint8_t gInfoEventBuffer[16 * 1024];
+uint8_t gCritEventBuffer[32 * 1024];
+CircularEventBuffer gCircularEventBuffer[3];
+
+class TestEventGenerator : public EventLoggingDelegate
+{
+public:
+    CHIP_ERROR WriteEvent(TLV::TLVWriter & aWriter) override
+    {
+        TLV::TLVType dataContainerType;
+        ReturnErrorOnFailure(aWriter.StartContainer(TLV::ContextTag(EventDataIB::Tag::kData), TLV::kTLVType_Structure,
+                                                    dataContainerType));
+        ReturnErrorOnFailure(aWriter.Put(kLivenessDeviceStatus, mStatus));
+        return aWriter.EndContainer(dataContainerType);
+    }
+
+    void SetStatus(int32_t aStatus) { mStatus = aStatus; }
+
+private:
+    int32_t mStatus = 0;
+};
+
+class TestEventLoggingIndex : public Testing::AppContext
+{
+public:
+    void SetUp() override
+    {
+        const LogStorageResources logStorageResources[] = {
+            { &gDebugEventBuffer[0], sizeof(gDebugEventBuffer), PriorityLevel::Debug },
+            { &gInfoEventBuffer[0], sizeof(gInfoEventBuffer), PriorityLevel::Info },
+            { &gCritEventBuffer[0], sizeof(gCritEventBuffer), PriorityLevel::Critical },
+        };
+
+        AppContext::SetUp();
+        InteractionModelEngine::GetInstance()->SetDataModelProvider(CodegenDataModelProviderInstance(nullptr));
+        ASSERT_EQ(mEventCounter.Init(0), CHIP_NO_ERROR);
+        EventManagement::CreateEventManagement(&GetExchangeManager(), MATTER_ARRAY_SIZE(logStorageResources), gCircularEventBuffer,
+                                               logStorageResources, &mEventCounter);
+    }
+
+    void TearDown() override
+    {
+        EventManagement::DestroyEventManagement();
+        AppContext::TearDown();
+    }
+
+protected:
+    // Log aCount events.  With aMixPriorities, cycle through the priorities so that events get moved between and dropped
+    // from buffers; otherwise log critical events only, which are kept until all the buffers are full.
+    static void LogEvents(size_t aCount, bool aMixPriorities)
+    {
+        TestEventGenerator generator;
+        EventOptions options;
+        options.mPath = { kTestEndpointId, kLivenessClusterId, kLivenessChangeEvent };
+
+        for (size_t i = 0; i < aCount; i++)
+        {
+            EventNumber eventNumber;
+            options.mPriority = PriorityLevel::Critical;
+            if (aMixPriorities && (i % 5 != 0))
+            {
+                options.mPriority = (i % 2 == 0) ? PriorityLevel::Info : PriorityLevel::Debug;
+            }
+            generator.SetStatus(static_cast<int32_t>(i));
+            ASSERT_EQ(EventManagement::GetInstance().LogEvent(&generator, options, eventNumber), CHIP_NO_ERROR);
+        }
+    }
+
+    // Collect the numbers of the events in aReader, which is positioned before a sequence of EventReportIBs.
+    static std::vector<EventNumber> CollectEventNumbers(TLV::TLVReader & aReader)
+    {
+        std::vector<EventNumber> eventNumbers;
+        while (aReader.Next() == CHIP_NO_ERROR)
+        {
+            EventReportIB::Parser report;
+            EventDataIB::Parser data;
+            EventNumber eventNumber;
+            EXPECT_EQ(report.Init(aReader), CHIP_NO_ERROR);
+            EXPECT_EQ(report.GetEventData(&data), CHIP_NO_ERROR);
+            EXPECT_EQ(data.GetEventNumber(&eventNumber), CHIP_NO_ERROR);
+            eventNumbers.push_back(eventNumber);
+        }
+        return eventNumbers;
+    }
+
+    // Numbers of all the events currently held by the log, oldest first.
+    static std::vector<EventNumber> LoggedEventNumbers()
+    {
+        TLV::TLVReader reader;
+        CircularEventBufferWrapper bufWrapper;
+        EXPECT_EQ(EventManagement::GetInstance().GetEventReader(reader, PriorityLevel::Critical, &bufWrapper), CHIP_NO_ERROR);
+        return CollectEventNumbers(reader);
+    }
+
+private:
+    MonotonicallyIncreasingCounter<EventNumber> mEventCounter;
+};
+
+TEST_F(TestEventLoggingIndex, TestFetchMatchesFullScan)
+{
+    EventManagement & logMgmt = EventManagement::GetInstance();
+    SingleLinkedListNode<EventPathParams> wildcardPath;
+    Platform::ScopedMemoryBuffer<uint8_t> backingStore;
+    constexpr size_t kBackingStoreSize = 64 * 1024;
+    ASSERT_TRUE(backingStore.Alloc(kBackingStoreSize));
+
+    // Several rounds, so that the buffers wrap around and indexed events get evicted.
+    for (int round = 0; round < 3; round++)
+    {
+        LogEvents(kBufferedEvents, true /* aMixPriorities */);
+
+        std::vector<EventNumber> logged = LoggedEventNumbers();
+        ASSERT_FALSE(logged.empty());
+
+        // Starting points before and throughout the log.  The stride is coprime with the priority cycle so that the
+        // starting events are of every priority and in every buffer.
+        const EventNumber firstEventMin = (logged.front() > 10) ? logged.front() - 10 : 0;
+        for (EventNumber eventMin = firstEventMin; eventMin <= logMgmt.GetLastEventNumber() + 1; eventMin += 13)
+        {
+            TLV::TLVWriter writer;
+            writer.Init(backingStore.Get(), kBackingStoreSize);
+            EventNumber nextEventMin = eventMin;
+            size_t eventCount        = 0;
+            EXPECT_EQ(logMgmt.FetchEventsSince(writer, &wildcardPath, nextEventMin, eventCount, Access::SubjectDescriptor{}),
+                      CHIP_NO_ERROR);
+
+            std::vector<EventNumber> expected;
+            for (EventNumber eventNumber : logged)
+            {
+                if (eventNumber >= eventMin)
+                {
+                    expected.push_back(eventNumber);
+                }
+            }
+
+            TLV::TLVReader reader;
+            reader.Init(backingStore.Get(), writer.GetLengthWritten());
+            EXPECT_EQ(CollectEventNumbers(reader), expected);
+            EXPECT_EQ(eventCount, expected.size());
+        }
+    }
+}
+
+TEST_F(TestEventLoggingIndex, TestWriterEvictionsKeepIndexInStep)
+{
+    uint8_t storage[256];
+    CircularEventBuffer buffer;
+    buffer.Init(storage, sizeof(storage), nullptr, nullptr, PriorityLevel::Critical);
+
+    // Write past the end of the buffer without making room first, so that the writer evicts the oldest elements itself
+    // through TLVCircularBuffer::GetNewBuffer.  The 3-byte elements do not divide the buffer evenly, so once it has wrapped
+    // around every element straddles the head and the writer evicts to finish it.
+    constexpr uint16_t kWrittenElements = 200;
+    for (uint16_t eventNumber = 0; eventNumber < kWrittenElements; eventNumber++)
+    {
+        const uint32_t position = buffer.GetTailPosition();
+        TLV::CircularTLVWriter writer;
+        writer.Init(buffer);
+        ASSERT_EQ(writer.Put(TLV::AnonymousTag(), eventNumber, true /* preserveSize */), CHIP_NO_ERROR);
+        ASSERT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+        buffer.IndexEvent(eventNumber, position);
+    }
+
+    // Every indexed element must be found at the offset the index reports for it.
+    size_t checked = 0;
+    for (EventNumber eventMin = 0; eventMin < kWrittenElements; eventMin++)
+    {
+        EventNumber indexedEventNumber;
+        uint32_t offset;
+        if (!buffer.FindIndexedEvent(eventMin, indexedEventNumber, offset))
+        {
+            continue;
+        }
+        ASSERT_LT(offset, buffer.DataLength());
+
+        TLV::CircularTLVReader reader;
+        reader.Init(buffer);
+        while (reader.GetLengthRead() < offset)
+        {
+            ASSERT_EQ(reader.Next(), CHIP_NO_ERROR);
+        }
+        ASSERT_EQ(reader.GetLengthRead(), offset);
+        ASSERT_EQ(reader.Next(), CHIP_NO_ERROR);
+
+        uint16_t storedEventNumber;
+        ASSERT_EQ(reader.Get(storedEventNumber), CHIP_NO_ERROR);
+        EXPECT_EQ(storedEventNumber, indexedEventNumber);
+        checked++;
+    }
+    EXPECT_GT(checked, 0u);
+}
+
+TEST_F(TestEventLoggingIndex, BenchmarkSubscribersFetchingNewEvents)
+{
+    constexpr size_t kSubscriberCount    = 10;
+    constexpr size_t kReportChunkSize    = 1024;
+    constexpr size_t kIterations         = 20;
+    constexpr size_t kEventsPerIteration = 10;
+
+    EventManagement & logMgmt = EventManagement::GetInstance();
+    SingleLinkedListNode<EventPathParams> wildcardPath;
+    uint8_t reportChunk[kReportChunkSize];
+
+    LogEvents(kBufferedEvents, false /* aMixPriorities */);
+    ASSERT_EQ(LoggedEventNumbers().size(), kBufferedEvents);
+
+    // Every subscriber has already been sent all the buffered events; each iteration logs a few more and every subscriber
+    // fetches them, which is the steady state of an engine serving several subscriptions.
+    EventNumber subscriberEventMin[kSubscriberCount];
+    for (auto & eventMin : subscriberEventMin)
+    {
+        eventMin = logMgmt.GetLastEventNumber();
+    }
+
+    size_t fetched                        = 0;
+    System::Clock::Microseconds64 elapsed = System::Clock::kZero;
+    for (size_t iteration = 0; iteration < kIterations; iteration++)
+    {
+        LogEvents(kEventsPerIteration, false /* aMixPriorities */);
+
+        const System::Clock::Microseconds64 start = System::SystemClock().GetMonotonicMicroseconds64();
+        for (auto & eventMin : subscriberEventMin)
+        {
+            TLV::TLVWriter writer;
+            writer.Init(reportChunk, sizeof(reportChunk));
+            size_t eventCount = 0;
+            EXPECT_EQ(logMgmt.FetchEventsSince(writer, &wildcardPath, eventMin, eventCount, Access::SubjectDescriptor{}),
+                      CHIP_NO_ERROR);
+            EXPECT_EQ(eventCount, kEventsPerIteration);
+            fetched += eventCount;
+        }
+        elapsed += System::SystemClock().GetMonotonicMicroseconds64() - start;
+    }
+
+    EXPECT_EQ(fetched, kSubscriberCount * kIterations * kEventsPerIteration);
+    ChipLogProgress(EventLogging, "%u subscribers fetched %u events from a log of %u events in %" PRIu64 " us",
+                    static_cast<unsigned>(kSubscriberCount), static_cast<unsigned>(fetched),
+                    static_cast<unsigned>(kBufferedEvents), elapsed.count());
+}
+
+} // namespace
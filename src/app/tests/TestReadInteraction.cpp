@@ -30,6 +30,7 @@
 #include <app/reporting/tests/MockReportScheduler.h>
 #include <app/tests/AppTestContext.h>
 #include <app/tests/test-interaction-model-api.h>
+#include <app/util/MatterCallbacks.h>
 #include <app/util/basic-types.h>
 #include <app/util/mock/Constants.h>
 #include <app/util/mock/Functions.h>
@@ -460,6 +461,34 @@ public:
     }
 };
 
+// Counts the attribute read hooks called for one attribute path.
+class ReadHookCounter : public chip::DataModelCallbacks
+{
+public:
+    ReadHookCounter(const chip::app::ConcreteAttributePath & path) : mPath(path) { mPrevious = SetInstance(this); }
+    ~ReadHookCounter() override { SetInstance(mPrevious); }
+
+    void AttributeOperation(OperationType operation, OperationOrder order, const chip::app::ConcreteAttributePath & path) override
+    {
+        VerifyOrReturn(operation == OperationType::Read && path == mPath);
+        if (order == OperationOrder::Pre)
+        {
+            mPreReads++;
+        }
+        else
+        {
+            mPostReads++;
+        }
+    }
+
+    unsigned mPreReads  = 0;
+    unsigned mPostReads = 0;
+
+private:
+    chip::app::ConcreteAttributePath mPath;
+    chip::DataModelCallbacks * mPrevious;
+};
+
 } // namespace
 
 using ReportScheduler     = chip::app::reporting::ReportScheduler;
@@ -573,6 +602,7 @@ public:
     void TestSubscribeClientReceiveWellFormedStatusResponse();
     void TestSubscribeEarlyReport();
     void TestSubscribeEarlyShutdown();
+    void TestSubscribeFanOut();
     void TestSubscribeInvalidateFabric();
     void TestSubscribeInvalidAttributePathRoundtrip();
     void TestSubscribeInvalidInterval();
@@ -3490,6 +3520,89 @@ void TestReadInteraction::TestSubscribeSetDirtyFullyOverlap()
     EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
 }
 
+// Report one attribute change to many subscribers, and log how long it takes until the last one got its report.
+TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteraction, TestSubscribeFanOut)
+TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteractionSync, TestSubscribeFanOut)
+void TestReadInteraction::TestSubscribeFanOut()
+{
+    constexpr size_t kSubscriberCount = 50;
+
+    MockInteractionModelApp delegate;
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    EXPECT_EQ(engine->Init(&GetExchangeManager(), &GetFabricTable(), gReportScheduler), CHIP_NO_ERROR);
+
+    AttributePathParams attributePathParams(chip::Testing::kMockEndpoint2, chip::Testing::MockClusterId(3),
+                                            chip::Testing::MockAttributeId(1));
+
+    {
+        std::vector<std::unique_ptr<app::ReadClient>> readClients;
+        for (size_t i = 0; i < kSubscriberCount; i++)
+        {
+            ReadPrepareParams readPrepareParams(GetSessionBobToAlice());
+            readPrepareParams.mpAttributePathParamsList    = &attributePathParams;
+            readPrepareParams.mAttributePathParamsListSize = 1;
+            readPrepareParams.mMinIntervalFloorSeconds     = 0;
+            readPrepareParams.mMaxIntervalCeilingSeconds   = 10;
+            readPrepareParams.mKeepSubscriptions           = true;
+
+            readClients.push_back(std::make_unique<app::ReadClient>(engine, &GetExchangeManager(), delegate,
+                                                                    chip::app::ReadClient::InteractionType::Subscribe));
+            EXPECT_EQ(readClients.back()->SendRequest(readPrepareParams), CHIP_NO_ERROR);
+
+            // One subscription at a time, so that priming reports do not run out of exchanges.
+            DrainAndServiceIO();
+        }
+
+        EXPECT_EQ(delegate.mNumAttributeResponse, static_cast<int>(kSubscriberCount));
+        EXPECT_EQ(engine->GetNumActiveReadHandlers(ReadHandler::InteractionType::Subscribe), kSubscriberCount);
+
+        {
+            delegate.mNumAttributeResponse = 0;
+            delegate.mReceivedAttributePaths.clear();
+            const SubscriptionStats statsBefore = engine->GetSubscriptionStats(kUndefinedFabricIndex);
+            ReadHookCounter readHooks(ConcreteAttributePath(attributePathParams.mEndpointId, attributePathParams.mClusterId,
+                                                            attributePathParams.mAttributeId));
+
+            System::Clock::Microseconds64 start = gRealClock->GetMonotonicMicroseconds64();
+            EXPECT_EQ(engine->GetReportingEngine().SetDirty(attributePathParams), CHIP_NO_ERROR);
+            // Only CHIP_IM_MAX_REPORTS_IN_FLIGHT reports are sent at once, the next ones are scheduled when they are confirmed.
+            GetIOContext().DriveIOUntil(System::Clock::Seconds16(5), [&]() {
+                return delegate.mNumAttributeResponse == static_cast<int>(kSubscriberCount);
+            });
+            System::Clock::Microseconds64 elapsed = gRealClock->GetMonotonicMicroseconds64() - start;
+            DrainAndServiceIO();
+
+            const SubscriptionStats statsAfter = engine->GetSubscriptionStats(kUndefinedFabricIndex);
+            const uint32_t cacheHits   = statsAfter.numEncodedAttributeCacheHits - statsBefore.numEncodedAttributeCacheHits;
+            const uint32_t cacheMisses = statsAfter.numEncodedAttributeCacheMisses - statsBefore.numEncodedAttributeCacheMisses;
+#if CHIP_CONFIG_IM_ENCODED_ATTRIBUTE_CACHE_SIZE > 0
+            // Every subscriber looked the changed attribute up, and the ones reporting in the same run as the first one
+            // copied its encoding.
+            EXPECT_GE(cacheHits + cacheMisses, kSubscriberCount);
+            EXPECT_GT(cacheHits, 0u);
+#endif // CHIP_CONFIG_IM_ENCODED_ATTRIBUTE_CACHE_SIZE > 0
+            // Whether or not the value was shared, the read hooks ran once for each report.
+            EXPECT_EQ(readHooks.mPreReads, kSubscriberCount);
+            EXPECT_EQ(readHooks.mPostReads, kSubscriberCount);
+
+            EXPECT_EQ(delegate.mNumAttributeResponse, static_cast<int>(kSubscriberCount));
+            for (const auto & path : delegate.mReceivedAttributePaths)
+            {
+                EXPECT_EQ(path.mEndpointId, chip::Testing::kMockEndpoint2);
+                EXPECT_EQ(path.mClusterId, chip::Testing::MockClusterId(3));
+                EXPECT_EQ(path.mAttributeId, chip::Testing::MockAttributeId(1));
+            }
+            ChipLogProgress(DataManagement, "Reported to %u subscribers in %" PRIu64 " us, %u cache hits, %u cache misses",
+                            static_cast<unsigned>(kSubscriberCount), elapsed.count(), static_cast<unsigned>(cacheHits),
+                            static_cast<unsigned>(cacheMisses));
+        }
+    }
+
+    EXPECT_EQ(engine->GetNumActiveReadClients(), 0u);
+    engine->Shutdown();
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
 // Verify that subscription can be shut down just after receiving SUBSCRIBE RESPONSE,
 // before receiving any subsequent REPORT DATA.
 TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteraction, TestSubscribeEarlyShutdown)
@@ -169,11 +169,8 @@ bool TestReportingEngine::VerifyDirtySetContent(const Args &... args)
 
 bool TestReportingEngine::InsertToDirtySet(const AttributePathParams & aPath)
 {
-    auto path = InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.CreateObject();
-    VerifyOrReturnError(path != nullptr, false);
-    *path             = aPath;
-    path->mGeneration = InteractionModelEngine::GetInstance()->GetReportingEngine().GetDirtySetGeneration();
-    return true;
+    Engine & engine = InteractionModelEngine::GetInstance()->GetReportingEngine();
+    return engine.mGlobalDirtySet.Insert(aPath, engine.GetDirtySetGeneration()) == CHIP_NO_ERROR;
 }
 
 TEST_F_FROM_FIXTURE(TestReportingEngine, TestBuildAndSendSingleReportData)
@@ -220,6 +217,9 @@ TEST_F_FROM_FIXTURE(TestReportingEngine, TestBuildAndSendSingleReportData)
                                  app::reporting::GetDefaultReportScheduler());
     readHandler.OnInitialRequest(std::move(readRequestbuf));
 
+    // Both requested paths are indexed, so attribute changes can find this handler without scanning all of them.
+    EXPECT_EQ(InteractionModelEngine::GetInstance()->GetReportingEngine().GetInterestIndexStats().mIndexedPaths, 2u);
+
     EXPECT_EQ(InteractionModelEngine::GetInstance()->GetReportingEngine().BuildAndSendSingleReportData(&readHandler),
               CHIP_NO_ERROR);
 
@@ -232,10 +232,7 @@ TEST_F_FROM_FIXTURE(TestReportingEngine, TestMergeOverlappedAttributePath)
                                                           app::reporting::GetDefaultReportScheduler()),
               CHIP_NO_ERROR);
 
-    AttributePathParams * clusterInfo = InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.CreateObject();
-    clusterInfo->mEndpointId          = 1;
-    clusterInfo->mClusterId           = 1;
-    clusterInfo->mAttributeId         = 1;
+    EXPECT_TRUE(InsertToDirtySet(AttributePathParams(1, 1, 1)));
 
     {
         AttributePathParams testClusterInfo;
@@ -266,7 +263,7 @@ TEST_F_FROM_FIXTURE(TestReportingEngine, TestMergeOverlappedAttributePath)
         testClusterInfo.mClusterId   = kInvalidClusterId;
         testClusterInfo.mAttributeId = kInvalidAttributeId;
         EXPECT_TRUE(InteractionModelEngine::GetInstance()->GetReportingEngine().MergeOverlappedAttributePath(testClusterInfo));
-        EXPECT_TRUE(clusterInfo->mClusterId == kInvalidClusterId && clusterInfo->mAttributeId == kInvalidAttributeId);
+        EXPECT_TRUE(VerifyDirtySetContent(testClusterInfo));
     }
 
     {
@@ -275,8 +272,7 @@ TEST_F_FROM_FIXTURE(TestReportingEngine, TestMergeOverlappedAttributePath)
         testClusterInfo.mClusterId   = kInvalidClusterId;
         testClusterInfo.mAttributeId = kInvalidAttributeId;
         EXPECT_TRUE(InteractionModelEngine::GetInstance()->GetReportingEngine().MergeOverlappedAttributePath(testClusterInfo));
-        EXPECT_TRUE(clusterInfo->mEndpointId == kInvalidEndpointId && clusterInfo->mClusterId == kInvalidClusterId &&
-                    clusterInfo->mAttributeId == kInvalidAttributeId);
+        EXPECT_TRUE(VerifyDirtySetContent(testClusterInfo));
     }
     InteractionModelEngine::GetInstance()->GetReportingEngine().Shutdown();
 }
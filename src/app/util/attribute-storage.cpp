@@ -94,6 +94,174 @@ uint16_t emberEndpointCount = 0;
 /// ember metadata (e.g. changing dynamic endpoints or enabling/disabling endpoints)
 unsigned emberMetadataStructureGeneration = 0;
 
+#if CHIP_CONFIG_EMBER_ENDPOINT_LOOKUP_TABLES
+
+constexpr size_t NextPowerOfTwo(size_t value)
+{
+    size_t result = 1;
+    while (result < value)
+    {
+        result <<= 1;
+    }
+    return result;
+}
+
+constexpr unsigned Log2(size_t powerOfTwo)
+{
+    unsigned result = 0;
+    while (powerOfTwo > 1)
+    {
+        powerOfTwo >>= 1;
+        result++;
+    }
+    return result;
+}
+
+/// Maps endpoint ids to their index in emAfEndpoints, so that resolving an
+/// endpoint id does not scan all the endpoints.
+///
+/// Open addressing with linear probing: a slot holds 1 + the index of an
+/// endpoint in emAfEndpoints (0 for an empty slot), the key being the id of
+/// that endpoint. Clearing a dynamic endpoint is rare, so the map is rebuilt
+/// then rather than supporting removals.
+///
+/// Endpoint ids are normally unique, but nothing prevents a dynamic endpoint
+/// from reusing the id of a fixed one. Lookups then go back to scanning
+/// emAfEndpoints, which resolves the duplicates in index order as before.
+class EndpointIndexMap
+{
+public:
+    void Rebuild()
+    {
+        memset(mSlots, 0, sizeof(mSlots));
+        mHasDuplicates = false;
+        for (uint16_t index = 0; index < MAX_ENDPOINT_COUNT; index++)
+        {
+            Add(index);
+        }
+    }
+
+    void Add(uint16_t index)
+    {
+        const EndpointId endpoint = emAfEndpoints[index].endpoint;
+        if (endpoint == kInvalidEndpointId)
+        {
+            return;
+        }
+
+        size_t slot = Hash(endpoint);
+        while (mSlots[slot] != 0)
+        {
+            if (emAfEndpoints[mSlots[slot] - 1].endpoint == endpoint)
+            {
+                mHasDuplicates = true;
+                return;
+            }
+            slot = (slot + 1) & (kSlotCount - 1);
+        }
+        mSlots[slot] = static_cast<uint16_t>(index + 1);
+    }
+
+    /// Returns the index of the endpoint with the given id, or kEmberInvalidEndpointIndex.
+    /// Only meaningful when !HasDuplicates().
+    uint16_t Find(EndpointId endpoint) const
+    {
+        for (size_t slot = Hash(endpoint); mSlots[slot] != 0; slot = (slot + 1) & (kSlotCount - 1))
+        {
+            const uint16_t index = static_cast<uint16_t>(mSlots[slot] - 1);
+            if (emAfEndpoints[index].endpoint == endpoint)
+            {
+                return index;
+            }
+        }
+        return kEmberInvalidEndpointIndex;
+    }
+
+    bool HasDuplicates() const { return mHasDuplicates; }
+
+private:
+    // At most half full, so that probe sequences stay short.
+    static constexpr size_t kSlotCount  = NextPowerOfTwo(2 * MAX_ENDPOINT_COUNT + 2);
+    static constexpr unsigned kSlotBits = Log2(kSlotCount);
+
+    static size_t Hash(EndpointId endpoint)
+    {
+        // Fibonacci hashing: spreads both dense and strided endpoint ids.
+        return static_cast<size_t>((static_cast<uint32_t>(endpoint) * 2654435769u) >> (32 - kSlotBits)) & (kSlotCount - 1);
+    }
+
+    uint16_t mSlots[kSlotCount];
+    bool mHasDuplicates = false;
+};
+
+EndpointIndexMap gEndpointIndexMap;
+
+/// Remembers where recently looked up server clusters are within the endpoint
+/// type of their endpoint. Flushed whenever the metadata structure generation
+/// changes, as endpoint indexes and endpoint types may then be different.
+class ServerClusterLookupCache
+{
+public:
+    const EmberAfCluster * Find(uint16_t endpointIndex, ClusterId clusterId)
+    {
+        FlushIfStale();
+
+        const Entry & entry = mEntries[Hash(endpointIndex, clusterId)];
+        VerifyOrReturnValue(entry.endpointIndex == endpointIndex && entry.clusterId == clusterId, nullptr);
+
+        // Entries are only hints: check them against the current metadata.
+        const EmberAfEndpointType * endpointType = emAfEndpoints[endpointIndex].endpointType;
+        VerifyOrReturnValue(entry.position < endpointType->clusterCount, nullptr);
+        const EmberAfCluster * cluster = &endpointType->cluster[entry.position];
+        VerifyOrReturnValue(cluster->clusterId == clusterId && (cluster->mask & MATTER_CLUSTER_FLAG_SERVER) != 0, nullptr);
+        return cluster;
+    }
+
+    void Add(uint16_t endpointIndex, const EmberAfCluster * cluster)
+    {
+        FlushIfStale();
+
+        Entry & entry       = mEntries[Hash(endpointIndex, cluster->clusterId)];
+        entry.clusterId     = cluster->clusterId;
+        entry.endpointIndex = endpointIndex;
+        entry.position      = static_cast<uint8_t>(cluster - emAfEndpoints[endpointIndex].endpointType->cluster);
+    }
+
+private:
+    static constexpr size_t kEntryCount = 16;
+
+    struct Entry
+    {
+        ClusterId clusterId    = kInvalidClusterId;
+        uint16_t endpointIndex = kEmberInvalidEndpointIndex;
+        uint8_t position       = 0;
+    };
+
+    static size_t Hash(uint16_t endpointIndex, ClusterId clusterId)
+    {
+        return (static_cast<size_t>(clusterId) * 31 + endpointIndex) & (kEntryCount - 1);
+    }
+
+    void FlushIfStale()
+    {
+        if (mGeneration != emberMetadataStructureGeneration)
+        {
+            for (auto & entry : mEntries)
+            {
+                entry = Entry();
+            }
+            mGeneration = emberMetadataStructureGeneration;
+        }
+    }
+
+    Entry mEntries[kEntryCount];
+    unsigned mGeneration = 0;
+};
+
+ServerClusterLookupCache gServerClusterLookupCache;
+
+#endif // CHIP_CONFIG_EMBER_ENDPOINT_LOOKUP_TABLES
+
 // If we have attributes that are more than 4 bytes, then
 // we need this data block for the defaults
 #if (defined(GENERATED_DEFAULTS) && GENERATED_DEFAULTS_COUNT)
@@ -155,6 +323,19 @@ uint16_t findIndexFromEndpoint(EndpointId endpoint, bool ignoreDisabledEndpoints
     }
 
     uint16_t epi;
+#if CHIP_CONFIG_EMBER_ENDPOINT_LOOKUP_TABLES
+    if (!gEndpointIndexMap.HasDuplicates())
+    {
+        epi = gEndpointIndexMap.Find(endpoint);
+        if (epi < emberAfEndpointCount() &&
+            (!ignoreDisabledEndpoints || emAfEndpoints[epi].bitmask.Has(EmberAfEndpointOptions::isEnabled)))
+        {
+            return epi;
+        }
+        return kEmberInvalidEndpointIndex;
+    }
+#endif // CHIP_CONFIG_EMBER_ENDPOINT_LOOKUP_TABLES
+
     for (epi = 0; epi < emberAfEndpointCount(); epi++)
     {
         if (emAfEndpoints[epi].endpoint == endpoint &&
@@ -270,6 +451,10 @@ void emberAfEndpointConfigure()
         }
     }
 #endif
+
+#if CHIP_CONFIG_EMBER_ENDPOINT_LOOKUP_TABLES
+    gEndpointIndexMap.Rebuild();
+#endif
 }
 
 void emberAfSetDynamicEndpointCount(uint16_t dynamicEndpointCount)
@@ -285,6 +470,18 @@ uint16_t emberAfGetDynamicIndexFromEndpoint(EndpointId id)
     }
 
     uint16_t index;
+#if CHIP_CONFIG_EMBER_ENDPOINT_LOOKUP_TABLES
+    if (!gEndpointIndexMap.HasDuplicates())
+    {
+        index = gEndpointIndexMap.Find(id);
+        if (index != kEmberInvalidEndpointIndex && index >= FIXED_ENDPOINT_COUNT)
+        {
+            return static_cast<uint16_t>(index - FIXED_ENDPOINT_COUNT);
+        }
+        return kEmberInvalidEndpointIndex;
+    }
+#endif // CHIP_CONFIG_EMBER_ENDPOINT_LOOKUP_TABLES
+
     for (index = FIXED_ENDPOINT_COUNT; index < MAX_ENDPOINT_COUNT; index++)
     {
         if (emAfEndpoints[index].endpoint == id)
@@ -361,6 +558,9 @@ CHIP_ERROR emberAfSetDynamicEndpointWithEpUniqueId(uint16_t index, EndpointId id
     emAfEndpoints[index].deviceTypeList = deviceTypeList;
     emAfEndpoints[index].endpointType   = ep;
     emAfEndpoints[index].dataVersions   = dataVersionStorage.data();
+#if CHIP_CONFIG_EMBER_ENDPOINT_LOOKUP_TABLES
+    gEndpointIndexMap.Add(index);
+#endif
 #if CHIP_CONFIG_USE_ENDPOINT_UNIQUE_ID
     MutableCharSpan targetSpan(emAfEndpoints[index].endpointUniqueId);
     if (CopyCharSpanToMutableCharSpan(endpointUniqueId, targetSpan) != CHIP_NO_ERROR)
@@ -410,6 +610,9 @@ EndpointId emberAfClearDynamicEndpoint(uint16_t index, MatterClusterShutdownType
         ep = emAfEndpoints[index].endpoint;
         emberAfEndpointEnableDisable(ep, false, shutdownType);
         emAfEndpoints[index].endpoint = kInvalidEndpointId;
+#if CHIP_CONFIG_EMBER_ENDPOINT_LOOKUP_TABLES
+        gEndpointIndexMap.Rebuild();
+#endif
     }
 
     emberMetadataStructureGeneration++;
@@ -820,6 +1023,19 @@ const EmberAfCluster * emberAfFindClusterInType(const EmberAfEndpointType * endp
 
 uint8_t emberAfClusterIndex(EndpointId endpoint, ClusterId clusterId, EmberAfClusterMask mask)
 {
+#if CHIP_CONFIG_EMBER_ENDPOINT_LOOKUP_TABLES
+    if (!gEndpointIndexMap.HasDuplicates())
+    {
+        uint16_t ep   = emberAfIndexFromEndpointIncludingDisabledEndpoints(endpoint);
+        uint8_t index = 0xFF;
+        if (ep != kEmberInvalidEndpointIndex)
+        {
+            emberAfFindClusterInType(emAfEndpoints[ep].endpointType, clusterId, mask, &index);
+        }
+        return index;
+    }
+#endif // CHIP_CONFIG_EMBER_ENDPOINT_LOOKUP_TABLES
+
     for (uint16_t ep = 0; ep < emberAfEndpointCount(); ep++)
     {
         // Check the endpoint id first, because that way we avoid examining the
@@ -915,7 +1131,20 @@ const EmberAfCluster * emberAfFindServerCluster(EndpointId endpoint, ClusterId c
         return nullptr;
     }
 
+#if CHIP_CONFIG_EMBER_ENDPOINT_LOOKUP_TABLES
+    const EmberAfCluster * cluster = gServerClusterLookupCache.Find(ep, clusterId);
+    if (cluster == nullptr)
+    {
+        cluster = emberAfFindClusterInType(emAfEndpoints[ep].endpointType, clusterId, MATTER_CLUSTER_FLAG_SERVER);
+        if (cluster != nullptr)
+        {
+            gServerClusterLookupCache.Add(ep, cluster);
+        }
+    }
+    return cluster;
+#else
     return emberAfFindClusterInType(emAfEndpoints[ep].endpointType, clusterId, MATTER_CLUSTER_FLAG_SERVER);
+#endif // CHIP_CONFIG_EMBER_ENDPOINT_LOOKUP_TABLES
 }
 
 // Returns cluster within the endpoint; Does not ignore disabled endpoints
@@ -25,6 +25,7 @@
 #include <app/InteractionModelEngine.h>
 #include <app/tests/AppTestContext.h>
 #include <app/util/attribute-storage.h>
+#include <app/util/endpoint-config-api.h>
 #include <clusters/UnitTesting/Metadata.h>
 #include <controller/InvokeInteraction.h>
 #include <controller/ReadInteraction.h>
@@ -174,6 +175,10 @@ protected:
     chip::app::DataModel::Provider * mOldProvider = nullptr;
 
     void TestDataResponseHelper(const EmberAfEndpointType * aEndpoint, bool aExpectSuccess);
+
+    // Invokes a command of the UnitTesting cluster on aEndpointId and returns the status of the outcome: Success if a data
+    // response was received.
+    Protocols::InteractionModel::Status InvokeOnEndpoint(EndpointId aEndpointId);
 };
 
 // We want to send a TestSimpleArgumentRequest::Type, but get a
@@ -265,6 +270,22 @@ DECLARE_DYNAMIC_CLUSTER(chip::app::Clusters::UnitTesting::Id, testClusterAttrs,
 
 DECLARE_DYNAMIC_ENDPOINT(testEndpoint3, testEndpointClusters3);
 
+// The clusters of testEndpoint1, in the opposite order.
+DECLARE_DYNAMIC_CLUSTER_LIST_BEGIN(testEndpointClusters4)
+DECLARE_DYNAMIC_CLUSTER(chip::app::Clusters::Descriptor::Id, descriptorAttrs, ZAP_CLUSTER_MASK(SERVER), nullptr, nullptr),
+    DECLARE_DYNAMIC_CLUSTER(chip::app::Clusters::UnitTesting::Id, testClusterAttrs, ZAP_CLUSTER_MASK(SERVER), testClusterCommands1,
+                            nullptr),
+    DECLARE_DYNAMIC_CLUSTER_LIST_END;
+
+DECLARE_DYNAMIC_ENDPOINT(testEndpoint4, testEndpointClusters4);
+
+// Only the descriptor cluster.
+DECLARE_DYNAMIC_CLUSTER_LIST_BEGIN(testEndpointClusters5)
+DECLARE_DYNAMIC_CLUSTER(chip::app::Clusters::Descriptor::Id, descriptorAttrs, ZAP_CLUSTER_MASK(SERVER), nullptr, nullptr),
+    DECLARE_DYNAMIC_CLUSTER_LIST_END;
+
+DECLARE_DYNAMIC_ENDPOINT(testEndpoint5, testEndpointClusters5);
+
 void TestServerCommandDispatch::TestDataResponseHelper(const EmberAfEndpointType * aEndpoint, bool aExpectSuccess)
 {
     FakeRequest request;
@@ -409,4 +430,98 @@ TEST_F(TestServerCommandDispatch, TestDataResponseHandlerOverride2)
     TestDataResponseHelper(&testEndpoint3, true);
 }
 
+Protocols::InteractionModel::Status TestServerCommandDispatch::InvokeOnEndpoint(EndpointId aEndpointId)
+{
+    FakeRequest request;
+    request.arg1 = true;
+
+    bool onSuccessWasCalled = false;
+    CHIP_ERROR failure      = CHIP_NO_ERROR;
+
+    // Passing of stack variables by reference is only safe because of synchronous completion of the interaction. Otherwise, it's
+    // not safe to do so.
+    auto onSuccessCb = [&onSuccessWasCalled](const app::ConcreteCommandPath & commandPath, const app::StatusIB & aStatus,
+                                             const auto & dataResponse) { onSuccessWasCalled = true; };
+    auto onFailureCb = [&failure](CHIP_ERROR aError) { failure = aError; };
+
+    responseDirective = kSendDataResponse;
+
+    EXPECT_SUCCESS(chip::Controller::InvokeCommandRequest(&GetExchangeManager(), GetSessionBobToAlice(), aEndpointId, request,
+                                                          onSuccessCb, onFailureCb));
+
+    DrainAndServiceIO();
+
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+    EXPECT_NE(onSuccessWasCalled, failure != CHIP_NO_ERROR);
+    if (onSuccessWasCalled)
+    {
+        return Protocols::InteractionModel::Status::Success;
+    }
+    EXPECT_TRUE(failure.IsIMStatus());
+    return app::StatusIB(failure).mStatus;
+}
+
+TEST_F(TestServerCommandDispatch, TestDynamicEndpointReusedWithAnotherId)
+{
+    // Endpoint lookups must follow a dynamic endpoint slot as it is cleared and set again with other endpoint ids.
+    constexpr EndpointId kOtherEndpointId = 2;
+    using Protocols::InteractionModel::Status;
+
+    TestClusterCommandHandler commandHandler;
+    DataVersion dataVersionStorage[MATTER_ARRAY_SIZE(testEndpointClusters1)];
+
+    EXPECT_SUCCESS(emberAfSetDynamicEndpoint(0, kTestEndpointId, &testEndpoint1, Span<DataVersion>(dataVersionStorage)));
+    EXPECT_EQ(InvokeOnEndpoint(kTestEndpointId), Status::Success);
+    EXPECT_EQ(InvokeOnEndpoint(kOtherEndpointId), Status::UnsupportedEndpoint);
+    EXPECT_EQ(emberAfGetDynamicIndexFromEndpoint(kTestEndpointId), 0);
+    emberAfClearDynamicEndpoint(0);
+
+    EXPECT_EQ(InvokeOnEndpoint(kTestEndpointId), Status::UnsupportedEndpoint);
+    EXPECT_EQ(emberAfGetDynamicIndexFromEndpoint(kTestEndpointId), kEmberInvalidEndpointIndex);
+
+    EXPECT_SUCCESS(emberAfSetDynamicEndpoint(0, kOtherEndpointId, &testEndpoint1, Span<DataVersion>(dataVersionStorage)));
+    EXPECT_EQ(InvokeOnEndpoint(kTestEndpointId), Status::UnsupportedEndpoint);
+    EXPECT_EQ(InvokeOnEndpoint(kOtherEndpointId), Status::Success);
+    EXPECT_EQ(emberAfGetDynamicIndexFromEndpoint(kTestEndpointId), kEmberInvalidEndpointIndex);
+    EXPECT_EQ(emberAfGetDynamicIndexFromEndpoint(kOtherEndpointId), 0);
+    emberAfClearDynamicEndpoint(0);
+
+    EXPECT_SUCCESS(emberAfSetDynamicEndpoint(0, kTestEndpointId, &testEndpoint1, Span<DataVersion>(dataVersionStorage)));
+    EXPECT_EQ(InvokeOnEndpoint(kTestEndpointId), Status::Success);
+    EXPECT_EQ(InvokeOnEndpoint(kOtherEndpointId), Status::UnsupportedEndpoint);
+    emberAfClearDynamicEndpoint(0);
+}
+
+TEST_F(TestServerCommandDispatch, TestDynamicEndpointReusedWithOtherClusters)
+{
+    // Server cluster lookups must not reuse what they found on the previous endpoint in the same slot and with the same id.
+    using Protocols::InteractionModel::Status;
+
+    TestClusterCommandHandler commandHandler;
+    DataVersion dataVersionStorage[MATTER_ARRAY_SIZE(testEndpointClusters1)];
+
+    EXPECT_SUCCESS(emberAfSetDynamicEndpoint(0, kTestEndpointId, &testEndpoint1, Span<DataVersion>(dataVersionStorage)));
+    EXPECT_EQ(InvokeOnEndpoint(kTestEndpointId), Status::Success);
+    EXPECT_EQ(emberAfFindServerCluster(kTestEndpointId, Clusters::UnitTesting::Id), &testEndpointClusters1[0]);
+    emberAfClearDynamicEndpoint(0);
+
+    // Same clusters, at other positions.
+    EXPECT_SUCCESS(emberAfSetDynamicEndpoint(0, kTestEndpointId, &testEndpoint4, Span<DataVersion>(dataVersionStorage)));
+    EXPECT_EQ(InvokeOnEndpoint(kTestEndpointId), Status::Success);
+    EXPECT_EQ(emberAfFindServerCluster(kTestEndpointId, Clusters::UnitTesting::Id), &testEndpointClusters4[1]);
+    EXPECT_EQ(emberAfFindServerCluster(kTestEndpointId, Clusters::Descriptor::Id), &testEndpointClusters4[0]);
+    emberAfClearDynamicEndpoint(0);
+
+    // The cluster is gone.
+    EXPECT_SUCCESS(emberAfSetDynamicEndpoint(0, kTestEndpointId, &testEndpoint5, Span<DataVersion>(dataVersionStorage)));
+    EXPECT_EQ(InvokeOnEndpoint(kTestEndpointId), Status::UnsupportedCluster);
+    EXPECT_EQ(emberAfFindServerCluster(kTestEndpointId, Clusters::UnitTesting::Id), nullptr);
+    emberAfClearDynamicEndpoint(0);
+
+    EXPECT_SUCCESS(emberAfSetDynamicEndpoint(0, kTestEndpointId, &testEndpoint1, Span<DataVersion>(dataVersionStorage)));
+    EXPECT_EQ(InvokeOnEndpoint(kTestEndpointId), Status::Success);
+    EXPECT_EQ(emberAfFindServerCluster(kTestEndpointId, Clusters::UnitTesting::Id), &testEndpointClusters1[0]);
+    emberAfClearDynamicEndpoint(0);
+}
+
 } // namespace
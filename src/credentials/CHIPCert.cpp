@@ -412,8 +412,11 @@ CHIP_ERROR ChipCertificateSet::ValidateCert(const ChipCertificateData * cert, Va
 
     // Verify signature of the current certificate against public key of the CA certificate. If signature verification
     // succeeds, the current certificate is valid.
-    err = VerifyCertSignature(*cert, *caCert);
-    SuccessOrExit(err);
+    if (!context.mSkipSignatureVerification)
+    {
+        err = VerifyCertSignature(*cert, *caCert);
+        SuccessOrExit(err);
+    }
 
 exit:
     return err;
@@ -505,7 +508,8 @@ void ValidationContext::Reset()
     mValidityPolicy = nullptr;
     mRequiredKeyUsages.ClearAll();
     mRequiredKeyPurposes.ClearAll();
-    mRequiredCertType = CertType::kNotSpecified;
+    mRequiredCertType          = CertType::kNotSpecified;
+    mSkipSignatureVerification = false;
 }
 
 bool ChipRDN::IsEqual(const ChipRDN & other) const
@@ -75,6 +75,10 @@ struct ValidationContext
     CertificateValidityPolicy * mValidityPolicy =
         nullptr; /**< Optional application policy to apply for certificate validity period evaluation. */
 
+    bool mSkipSignatureVerification = false; /**< Skip verifying the certificate signatures of the chain, because the
+                                                exact same certificates were verified before against the same trust
+                                                anchor. All other checks are still applied. */
+
     void Reset();
 
     template <typename T>
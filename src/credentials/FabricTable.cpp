@@ -394,8 +394,18 @@ CHIP_ERROR FabricTable::VerifyCredentials(FabricIndex fabricIndex, ByteSpan noc,
     uint8_t rootCertBuf[kMaxCHIPCertLength];
     MutableByteSpan rootCertSpan{ rootCertBuf };
     ReturnErrorOnFailure(FetchRootCert(fabricIndex, rootCertSpan));
-    return VerifyCredentials(noc, icac, rootCertSpan, context, outCompressedFabricId, outFabricId, outNodeId, outNocPubkey,
-                             outRootPublicKey);
+
+    ValidationContext chainContext = context;
+    chainContext.mSkipSignatureVerification =
+        context.mSkipSignatureVerification || mVerifiedCertChainCache.Contains(fabricIndex, noc, icac, rootCertSpan);
+    ReturnErrorOnFailure(VerifyCredentials(noc, icac, rootCertSpan, chainContext, outCompressedFabricId, outFabricId, outNodeId,
+                                           outNocPubkey, outRootPublicKey));
+
+    if (!chainContext.mSkipSignatureVerification)
+    {
+        mVerifiedCertChainCache.Add(fabricIndex, noc, icac, rootCertSpan);
+    }
+    return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR FabricTable::VerifyCredentials(ByteSpan noc, ByteSpan icac, ByteSpan rcac, ValidationContext & context,
@@ -970,6 +980,8 @@ CHIP_ERROR FabricTable::Delete(FabricIndex fabricIndex)
         }
     }
 
+    mVerifiedCertChainCache.Invalidate(fabricIndex);
+
     FabricInfo * fabricInfo = GetMutableFabricByIndex(fabricIndex);
     if (fabricInfo == &mPendingFabric)
     {
@@ -1157,6 +1169,7 @@ void FabricTable::Forget(FabricIndex fabricIndex)
     VerifyOrReturn(fabricInfo != nullptr);
 
     RevertPendingFabricData();
+    mVerifiedCertChainCache.Invalidate(fabricIndex);
     fabricInfo->Reset();
 }
 
@@ -1181,6 +1194,7 @@ void FabricTable::Shutdown()
         // direct lookups fail.
         fabricInfo.Reset();
     }
+    mVerifiedCertChainCache.Clear();
 
     mStorage = nullptr;
 }
@@ -2056,6 +2070,9 @@ CHIP_ERROR FabricTable::CommitPendingFabricData()
         stickyError = (stickyError != CHIP_NO_ERROR) ? stickyError : fabricIndexErr;
     }
 
+    // Peer chains verified against the previous (or pending) state of the fabric are not trusted any more.
+    mVerifiedCertChainCache.Invalidate(fabricIndexBeingCommitted);
+
     // Commit must have same side-effect as reverting all pending data
     mStateFlags.ClearAll();
     mFabricIndexWithPendingState = kUndefinedFabricIndex;
@@ -2100,6 +2117,8 @@ void FabricTable::RevertPendingFabricData()
 
     TEMPORARY_RETURN_IGNORED mLastKnownGoodTime.RevertPendingLastKnownGoodChipEpochTime();
 
+    mVerifiedCertChainCache.Invalidate(mFabricIndexWithPendingState);
+
     mStateFlags.ClearAll();
     mFabricIndexWithPendingState = kUndefinedFabricIndex;
 }
@@ -29,6 +29,7 @@
 #include <credentials/CertificateValidityPolicy.h>
 #include <credentials/LastKnownGoodTime.h>
 #include <credentials/OperationalCertificateStore.h>
+#include <credentials/VerifiedCertificateChainCache.h>
 #include <crypto/CHIPCryptoPAL.h>
 #include <crypto/OperationalKeystore.h>
 #include <lib/core/CHIPEncoding.h>
@@ -1007,7 +1008,8 @@ public:
      */
     void RevertPendingOpCertsExceptRoot();
 
-    // Verifies credentials, using the root certificate of the provided fabric index.
+    // Verifies credentials, using the root certificate of the provided fabric index.  Signatures of a chain
+    // that was verified successfully before for the same fabric are not checked again.
     CHIP_ERROR VerifyCredentials(FabricIndex fabricIndex, ByteSpan noc, ByteSpan icac, Credentials::ValidationContext & context,
                                  CompressedFabricId & outCompressedFabricId, FabricId & outFabricId, NodeId & outNodeId,
                                  Crypto::P256PublicKey & outNocPubkey, Crypto::P256PublicKey * outRootPublicKey = nullptr) const;
@@ -1016,6 +1018,17 @@ public:
     static CHIP_ERROR VerifyCredentials(ByteSpan noc, ByteSpan icac, ByteSpan rcac, Credentials::ValidationContext & context,
                                         CompressedFabricId & outCompressedFabricId, FabricId & outFabricId, NodeId & outNodeId,
                                         Crypto::P256PublicKey & outNocPubkey, Crypto::P256PublicKey * outRootPublicKey = nullptr);
+
+    /**
+     * @brief Get the cache of peer certificate chains whose signatures were verified against the
+     *        root certificates of this table.
+     *
+     * The entries of a fabric are dropped when that fabric is updated or removed.  This is for use
+     * by callers that verify chains with the static VerifyCredentials() off the Matter thread: the
+     * cache must only be used from the Matter thread.
+     */
+    VerifiedCertificateChainCache & GetVerifiedCertificateChainCache() { return mVerifiedCertChainCache; }
+
     /**
      * @brief Enables FabricInfo instances to collide and reference the same logical fabric (i.e Root Public Key + FabricId).
      *
@@ -1298,6 +1311,9 @@ private:
 
     LastKnownGoodTime mLastKnownGoodTime;
 
+    // Updated from const VerifyCredentials(); does not affect the observable state of the table.
+    mutable VerifiedCertificateChainCache mVerifiedCertChainCache;
+
     // We may not have an mNextAvailableFabricIndex if our table is as large as
     // it can go and is full.
     Optional<FabricIndex> mNextAvailableFabricIndex;
@@ -855,11 +855,19 @@ void GroupDataProviderImpl::Finish()
     mKeySetIterators.ReleaseAll();
     mGroupSessionsIterator.ReleaseAll();
     mGroupKeyContexPool.ReleaseAll();
+
+    // The iterators holding cache slots are gone
+    for (auto & slot : mGroupSessionCache)
+    {
+        slot.pins = 0;
+        ClearGroupSessionCacheSlot(slot);
+    }
 }
 
 void GroupDataProviderImpl::SetStorageDelegate(PersistentStorageDelegate * storage)
 {
     VerifyOrDie(storage != nullptr);
+    InvalidateGroupSessionCache();
     mStorage = storage;
 }
 
@@ -1431,6 +1439,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveEndpoints(chip::FabricIndex fabric_index
 CHIP_ERROR GroupDataProviderImpl::SetGroupKey(FabricIndex fabric_index, GroupId group_id, KeysetId keyset_id)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionCache();
 
     FabricData fabric(fabric_index);
     ReturnErrorOnFailure(fabric.Load(mStorage));
@@ -1461,6 +1470,7 @@ CHIP_ERROR GroupDataProviderImpl::SetGroupKey(FabricIndex fabric_index, GroupId
 CHIP_ERROR GroupDataProviderImpl::SetGroupKeyAt(chip::FabricIndex fabric_index, size_t index, const GroupKey & in_map)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionCache();
 
     FabricData fabric(fabric_index);
     KeyMapData map(fabric_index);
@@ -1552,6 +1562,7 @@ CHIP_ERROR GroupDataProviderImpl::GetGroupKeyAt(chip::FabricIndex fabric_index,
 CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeyAt(chip::FabricIndex fabric_index, size_t index)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionCache();
 
     FabricData fabric(fabric_index);
     KeyMapData map;
@@ -1585,6 +1596,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeyAt(chip::FabricIndex fabric_inde
 CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeys(chip::FabricIndex fabric_index)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionCache();
 
     FabricData fabric(fabric_index);
     VerifyOrReturnError(CHIP_NO_ERROR == fabric.Load(mStorage), CHIP_ERROR_INVALID_FABRIC_INDEX);
@@ -1662,6 +1674,7 @@ CHIP_ERROR GroupDataProviderImpl::SetKeySet(chip::FabricIndex fabric_index, cons
                                             const KeySet & in_keyset)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionCache();
     VerifyOrReturnError(in_keyset.num_keys_used >= 1 && in_keyset.num_keys_used <= KeySet::kEpochKeysMax,
                         CHIP_ERROR_INVALID_ARGUMENT);
     if (in_keyset.policy != SecurityPolicy::kTrustFirst)
@@ -1737,6 +1750,7 @@ CHIP_ERROR GroupDataProviderImpl::GetKeySet(chip::FabricIndex fabric_index, uint
 CHIP_ERROR GroupDataProviderImpl::RemoveKeySet(chip::FabricIndex fabric_index, uint16_t target_id)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionCache();
 
     FabricData fabric(fabric_index);
     KeySetData keyset;
@@ -1838,6 +1852,8 @@ void GroupDataProviderImpl::KeySetIteratorImpl::Release()
 
 CHIP_ERROR GroupDataProviderImpl::RemoveFabric(chip::FabricIndex fabric_index)
 {
+    InvalidateGroupSessionCache();
+
     FabricData fabric(fabric_index);
 
     // Fabric data defaults to zero, so if not entry is found, no mappings, or keys are removed
@@ -1988,9 +2004,129 @@ GroupDataProviderImpl::GroupSessionIterator * GroupDataProviderImpl::IterateGrou
     return mGroupSessionsIterator.CreateObject(*this, session_id);
 }
 
+GroupDataProviderImpl::GroupSessionCacheSlot * GroupDataProviderImpl::GetGroupSessionCacheSlot(uint16_t session_id)
+{
+    GroupSessionCacheSlot * victim = nullptr;
+
+    for (auto & slot : mGroupSessionCache)
+    {
+        if (slot.in_use && !slot.stale && slot.session_id == session_id)
+        {
+            slot.last_used = ++mGroupSessionCacheClock;
+            return &slot;
+        }
+        if (slot.pins > 0)
+        {
+            continue;
+        }
+        // Prefer a free slot, then the least recently used one
+        if (victim == nullptr || (victim->in_use && (!slot.in_use || slot.last_used < victim->last_used)))
+        {
+            victim = &slot;
+        }
+    }
+    VerifyOrReturnValue(victim != nullptr, nullptr);
+
+    ClearGroupSessionCacheSlot(*victim);
+    if (CHIP_NO_ERROR != LoadGroupSessions(session_id, *victim))
+    {
+        // Too many matches, or storage errors: fall back to reading the storage
+        ClearGroupSessionCacheSlot(*victim);
+        return nullptr;
+    }
+    // Session IDs without any key are cached too, so that unknown traffic does not hit the storage either
+    victim->session_id = session_id;
+    victim->in_use     = true;
+    victim->last_used  = ++mGroupSessionCacheClock;
+    return victim;
+}
+
+CHIP_ERROR GroupDataProviderImpl::LoadGroupSessions(uint16_t session_id, GroupSessionCacheSlot & slot)
+{
+    FabricList fabric_list;
+    ReturnErrorOnFailure(fabric_list.Load(mStorage));
+
+    FabricData fabric(fabric_list.first_entry);
+    for (size_t i = 0; i < fabric_list.entry_count; i++, fabric.fabric_index = fabric.next)
+    {
+        ReturnErrorOnFailure(fabric.Load(mStorage));
+
+        KeyMapData mapping(fabric.fabric_index, fabric.first_map);
+        for (uint16_t j = 0; j < fabric.map_count; ++j, mapping.id = mapping.next)
+        {
+            ReturnErrorOnFailure(mapping.Load(mStorage));
+
+            KeySetData keyset;
+            VerifyOrReturnError(keyset.Find(mStorage, fabric, mapping.keyset_id), CHIP_ERROR_KEY_NOT_FOUND);
+            for (uint16_t k = 0; k < keyset.keys_count && k < KeySet::kEpochKeysMax; ++k)
+            {
+                const Crypto::GroupOperationalCredentials & creds = keyset.operational_keys[k];
+                if (creds.hash != session_id)
+                {
+                    continue;
+                }
+                VerifyOrReturnError(slot.entry_count < kGroupSessionCacheKeysMax, CHIP_ERROR_NO_MEMORY);
+
+                GroupSessionCacheEntry & entry = slot.entries[slot.entry_count++];
+                entry.fabric_index             = fabric.fabric_index;
+                entry.group_id                 = mapping.group_id;
+                entry.security_policy          = keyset.policy;
+                memcpy(entry.encryption_key, creds.encryption_key, sizeof(entry.encryption_key));
+                memcpy(entry.privacy_key, creds.privacy_key, sizeof(entry.privacy_key));
+            }
+        }
+    }
+    return CHIP_NO_ERROR;
+}
+
+void GroupDataProviderImpl::ReleaseGroupSessionCacheSlot(GroupSessionCacheSlot & slot)
+{
+    VerifyOrReturn(slot.pins > 0);
+    slot.pins--;
+    if (slot.pins == 0 && slot.stale)
+    {
+        ClearGroupSessionCacheSlot(slot);
+    }
+}
+
+void GroupDataProviderImpl::ClearGroupSessionCacheSlot(GroupSessionCacheSlot & slot)
+{
+    Crypto::ClearSecretData(reinterpret_cast<uint8_t *>(slot.entries), sizeof(slot.entries));
+    slot.session_id  = 0;
+    slot.entry_count = 0;
+    slot.in_use      = false;
+    slot.stale       = false;
+    slot.last_used   = 0;
+}
+
+void GroupDataProviderImpl::InvalidateGroupSessionCache()
+{
+    for (auto & slot : mGroupSessionCache)
+    {
+        if (slot.pins > 0)
+        {
+            // Still read by an iterator, cleared when released
+            slot.stale = slot.in_use;
+        }
+        else if (slot.in_use)
+        {
+            ClearGroupSessionCacheSlot(slot);
+        }
+    }
+}
+
 GroupDataProviderImpl::GroupSessionIteratorImpl::GroupSessionIteratorImpl(GroupDataProviderImpl & provider, uint16_t session_id) :
     mProvider(provider), mSessionId(session_id), mGroupKeyContext(provider)
 {
+    mCacheSlot = provider.GetGroupSessionCacheSlot(session_id);
+    if (mCacheSlot != nullptr)
+    {
+        mCacheSlot->pins++;
+        mKeyCount = mCacheSlot->entry_count;
+        mKeyIndex = 0;
+        return;
+    }
+
     FabricList fabric_list;
     ReturnOnFailure(fabric_list.Load(provider.mStorage));
     mFirstFabric = fabric_list.first_entry;
@@ -2003,6 +2139,11 @@ GroupDataProviderImpl::GroupSessionIteratorImpl::GroupSessionIteratorImpl(GroupD
 
 size_t GroupDataProviderImpl::GroupSessionIteratorImpl::Count()
 {
+    if (mCacheSlot != nullptr)
+    {
+        return mKeyCount;
+    }
+
     FabricData fabric(mFirstFabric);
     size_t count = 0;
 
@@ -2044,6 +2185,18 @@ size_t GroupDataProviderImpl::GroupSessionIteratorImpl::Count()
 
 bool GroupDataProviderImpl::GroupSessionIteratorImpl::Next(GroupSession & output)
 {
+    if (mCacheSlot != nullptr)
+    {
+        VerifyOrReturnValue(mKeyIndex < mKeyCount, false);
+        const GroupSessionCacheEntry & entry = mCacheSlot->entries[mKeyIndex++];
+        TEMPORARY_RETURN_IGNORED mGroupKeyContext.Initialize(entry.encryption_key, mSessionId, entry.privacy_key);
+        output.fabric_index    = entry.fabric_index;
+        output.group_id        = entry.group_id;
+        output.security_policy = entry.security_policy;
+        output.keyContext      = &mGroupKeyContext;
+        return true;
+    }
+
     while (mFabricCount < mFabricTotal)
     {
         FabricData fabric(mFabric);
@@ -2099,6 +2252,11 @@ bool GroupDataProviderImpl::GroupSessionIteratorImpl::Next(GroupSession & output
 void GroupDataProviderImpl::GroupSessionIteratorImpl::Release()
 {
     mGroupKeyContext.ReleaseKeys();
+    if (mCacheSlot != nullptr)
+    {
+        mProvider.ReleaseGroupSessionCacheSlot(*mCacheSlot);
+        mCacheSlot = nullptr;
+    }
     mProvider.mGroupSessionsIterator.ReleaseObject(this);
 }
 
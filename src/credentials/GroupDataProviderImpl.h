@@ -21,6 +21,8 @@
 #include <lib/core/CHIPPersistentStorageDelegate.h>
 #include <lib/support/Pool.h>
 
+#include <array>
+
 namespace chip {
 namespace Credentials {
 
@@ -32,6 +34,8 @@ public:
     // Per spec, a single fabric cannot use more than half of the total memberships
     static constexpr uint16_t kMaxMembershipPerFabric = kMaxMembershipCount / 2;
     static constexpr uint16_t kMaxGroupKeysPerFabric  = CHIP_CONFIG_MAX_GROUP_KEYS_PER_FABRIC;
+    static constexpr size_t kGroupSessionCacheSize    = CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE;
+    static constexpr size_t kGroupSessionCacheKeysMax = CHIP_CONFIG_GROUP_SESSION_CACHE_KEYS_PER_SESSION;
 
     // TODO Make this configurable. Note: if PGA feature is enabled it SHALL be >= 4. else it SHALL = 1.
     static constexpr uint16_t kMaxMcastAddrCount = 4;
@@ -251,6 +255,30 @@ protected:
         size_t mTotal       = 0;
     };
 
+    // Operational keys matching a group session ID, cached to avoid reading the key sets on every incoming group message
+    struct GroupSessionCacheEntry
+    {
+        FabricIndex fabric_index       = kUndefinedFabricIndex;
+        GroupId group_id               = kUndefinedGroupId;
+        SecurityPolicy security_policy = SecurityPolicy::kTrustFirst;
+        Crypto::Symmetric128BitsKeyByteArray encryption_key;
+        Crypto::Symmetric128BitsKeyByteArray privacy_key;
+    };
+
+    static_assert(kGroupSessionCacheKeysMax > 0 && kGroupSessionCacheKeysMax <= UINT8_MAX,
+                  "CHIP_CONFIG_GROUP_SESSION_CACHE_KEYS_PER_SESSION must be between 1 and 255");
+
+    struct GroupSessionCacheSlot
+    {
+        uint16_t session_id = 0;
+        uint8_t entry_count = 0;
+        uint8_t pins        = 0; // Number of iterators reading the entries
+        bool in_use         = false;
+        bool stale          = false; // Invalidated while pinned, cleared on the last unpin
+        uint32_t last_used  = 0;
+        GroupSessionCacheEntry entries[kGroupSessionCacheKeysMax];
+    };
+
     class GroupSessionIteratorImpl : public GroupSessionIterator
     {
     public:
@@ -272,8 +300,16 @@ protected:
         uint16_t mKeyCount       = 0;
         bool mFirstMap           = true;
         GroupKeyContext mGroupKeyContext;
+        // When set, the sessions are served from this cache slot instead of persistent storage
+        GroupSessionCacheSlot * mCacheSlot = nullptr;
     };
 
+    GroupSessionCacheSlot * GetGroupSessionCacheSlot(uint16_t session_id);
+    CHIP_ERROR LoadGroupSessions(uint16_t session_id, GroupSessionCacheSlot & slot);
+    void ReleaseGroupSessionCacheSlot(GroupSessionCacheSlot & slot);
+    void ClearGroupSessionCacheSlot(GroupSessionCacheSlot & slot);
+    void InvalidateGroupSessionCache();
+
     PersistentStorageDelegate * mStorage       = nullptr;
     Crypto::SessionKeystore * mSessionKeystore = nullptr;
     ObjectPool<GroupInfoIteratorImpl, kIteratorsMax> mGroupInfoIterators;
@@ -282,7 +318,9 @@ protected:
     ObjectPool<KeySetIteratorImpl, kIteratorsMax> mKeySetIterators;
     ObjectPool<GroupSessionIteratorImpl, kIteratorsMax> mGroupSessionsIterator;
     ObjectPool<GroupKeyContext, kIteratorsMax> mGroupKeyContexPool;
-    bool mAuxAclNotificationNeeded = false;
+    std::array<GroupSessionCacheSlot, kGroupSessionCacheSize> mGroupSessionCache;
+    uint32_t mGroupSessionCacheClock = 0;
+    bool mAuxAclNotificationNeeded   = false;
 };
 
 } // namespace Credentials
@@ -0,0 +1,136 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <credentials/VerifiedCertificateChainCache.h>
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/SafeInt.h>
+
+#include <string.h>
+
+namespace chip {
+
+CHIP_ERROR VerifiedCertificateChainCache::ComputeChainHash(const ByteSpan & noc, const ByteSpan & icac, const ByteSpan & rcac,
+                                                           ChainHash & outHash)
+{
+    Crypto::Hash_SHA256_stream hash;
+    ReturnErrorOnFailure(hash.Begin());
+
+    // Each certificate is prefixed by its length, so that bytes cannot move between certificates without changing the hash.
+    for (const ByteSpan & cert : { noc, icac, rcac })
+    {
+        VerifyOrReturnError(CanCastTo<uint16_t>(cert.size()), CHIP_ERROR_INVALID_ARGUMENT);
+        uint8_t length[sizeof(uint16_t)];
+        Encoding::LittleEndian::Put16(length, static_cast<uint16_t>(cert.size()));
+        ReturnErrorOnFailure(hash.AddData(ByteSpan(length)));
+        ReturnErrorOnFailure(hash.AddData(cert));
+    }
+
+    MutableByteSpan out(outHash);
+    return hash.Finish(out);
+}
+
+VerifiedCertificateChainCache::Entry * VerifiedCertificateChainCache::Find(FabricIndex fabricIndex, const ChainHash & hash)
+{
+#if CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+    for (auto & entry : mEntries)
+    {
+        if (entry.mFabricIndex == fabricIndex && memcmp(entry.mHash, hash, sizeof(ChainHash)) == 0)
+        {
+            return &entry;
+        }
+    }
+#endif
+    return nullptr;
+}
+
+bool VerifiedCertificateChainCache::Contains(FabricIndex fabricIndex, const ByteSpan & noc, const ByteSpan & icac,
+                                             const ByteSpan & rcac)
+{
+    VerifyOrReturnValue(kCacheSize > 0 && fabricIndex != kUndefinedFabricIndex, false);
+
+    ChainHash hash;
+    VerifyOrReturnValue(ComputeChainHash(noc, icac, rcac, hash) == CHIP_NO_ERROR, false);
+
+    Entry * entry = Find(fabricIndex, hash);
+    VerifyOrReturnValue(entry != nullptr, false);
+
+    entry->mLastUsed = ++mUseCounter;
+    return true;
+}
+
+void VerifiedCertificateChainCache::Add(FabricIndex fabricIndex, const ByteSpan & noc, const ByteSpan & icac,
+                                        const ByteSpan & rcac)
+{
+#if CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+    VerifyOrReturn(fabricIndex != kUndefinedFabricIndex);
+
+    ChainHash hash;
+    VerifyOrReturn(ComputeChainHash(noc, icac, rcac, hash) == CHIP_NO_ERROR);
+
+    Entry * entry = Find(fabricIndex, hash);
+    if (entry == nullptr)
+    {
+        // Use a free entry if there is one, otherwise replace the least recently used one.
+        entry = &mEntries[0];
+        for (auto & candidate : mEntries)
+        {
+            if (candidate.mFabricIndex == kUndefinedFabricIndex)
+            {
+                entry = &candidate;
+                break;
+            }
+            if (candidate.mLastUsed < entry->mLastUsed)
+            {
+                entry = &candidate;
+            }
+        }
+
+        memcpy(entry->mHash, hash, sizeof(ChainHash));
+        entry->mFabricIndex = fabricIndex;
+    }
+
+    entry->mLastUsed = ++mUseCounter;
+#endif
+}
+
+void VerifiedCertificateChainCache::Invalidate(FabricIndex fabricIndex)
+{
+#if CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+    for (auto & entry : mEntries)
+    {
+        if (entry.mFabricIndex == fabricIndex)
+        {
+            entry.mFabricIndex = kUndefinedFabricIndex;
+        }
+    }
+#endif
+}
+
+void VerifiedCertificateChainCache::Clear()
+{
+#if CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+    for (auto & entry : mEntries)
+    {
+        entry.mFabricIndex = kUndefinedFabricIndex;
+    }
+#endif
+    mUseCounter = 0;
+}
+
+} // namespace chip
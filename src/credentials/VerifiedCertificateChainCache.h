@@ -0,0 +1,89 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * @brief Defines a cache of operational certificate chains whose signatures were verified.
+ */
+
+#pragma once
+
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/support/Span.h>
+
+namespace chip {
+
+/**
+ * Remembers operational certificate chains (NOC, optional ICAC and RCAC) whose signatures were
+ * verified successfully, so that a chain presented again, e.g. by a peer that reconnects over
+ * CASE, can be validated without repeating the ECDSA signature checks.
+ *
+ * Entries are keyed by fabric index and a SHA-256 hash over the encoded certificates, so any
+ * change to any certificate of the chain, including the root, results in a miss.  Only the
+ * signature checks may be skipped for a known chain: the validity period, key usages and other
+ * constraints of each certificate still have to be checked on every use.
+ *
+ * When full, the least recently used entry is replaced.
+ */
+class VerifiedCertificateChainCache
+{
+public:
+    static constexpr size_t kCacheSize = CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE;
+
+    /**
+     * Returns true if the given chain was added for the given fabric and not invalidated since.
+     */
+    bool Contains(FabricIndex fabricIndex, const ByteSpan & noc, const ByteSpan & icac, const ByteSpan & rcac);
+
+    /**
+     * Records that the signatures of the given chain were verified successfully.  Must only be
+     * called after the full chain was validated against `rcac`.
+     */
+    void Add(FabricIndex fabricIndex, const ByteSpan & noc, const ByteSpan & icac, const ByteSpan & rcac);
+
+    /**
+     * Drops all entries of the given fabric.
+     */
+    void Invalidate(FabricIndex fabricIndex);
+
+    /**
+     * Drops all entries.
+     */
+    void Clear();
+
+private:
+    using ChainHash = uint8_t[Crypto::kSHA256_Hash_Length];
+
+    struct Entry
+    {
+        ChainHash mHash;
+        uint32_t mLastUsed      = 0;
+        FabricIndex mFabricIndex = kUndefinedFabricIndex;
+    };
+
+    static CHIP_ERROR ComputeChainHash(const ByteSpan & noc, const ByteSpan & icac, const ByteSpan & rcac, ChainHash & outHash);
+
+    Entry * Find(FabricIndex fabricIndex, const ChainHash & hash);
+
+#if CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+    Entry mEntries[kCacheSize];
+#endif
+    uint32_t mUseCounter = 0;
+};
+
+} // namespace chip
@@ -1293,6 +1293,78 @@ TEST_F(TestGroupDataProvider, TestGroupDecryption)
     it->Release();
 }
 
+TEST_F(TestGroupDataProvider, TestGroupSessionCache)
+{
+    GroupDataProvider * provider = GetGroupDataProvider();
+    EXPECT_TRUE(provider);
+
+    // Reset test
+    ResetProvider(provider);
+
+    EXPECT_EQ(provider->SetGroupInfoAt(kFabric1, 0, kGroupInfo1_1), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetKeySet(kFabric1, kCompressedFabricId1, kKeySet1), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetGroupKeyAt(kFabric1, 0, kGroup1Keyset1), CHIP_NO_ERROR);
+
+    Crypto::SymmetricKeyContext * key_context = provider->GetKeyContext(kFabric1, kGroup1);
+    ASSERT_NE(nullptr, key_context);
+    uint16_t session_id = key_context->GetKeyHash();
+    key_context->Release();
+
+    GroupSession session;
+    auto it = provider->IterateGroupSessions(session_id);
+    ASSERT_TRUE(it);
+    EXPECT_EQ(1u, it->Count());
+    EXPECT_TRUE(it->Next(session));
+    EXPECT_EQ(kFabric1, session.fabric_index);
+    EXPECT_EQ(kGroup1, session.group_id);
+    EXPECT_EQ(session_id, session.keyContext->GetKeyHash());
+    EXPECT_FALSE(it->Next(session));
+    it->Release();
+
+#if CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+    // Once cached, the sessions are found without reading the storage
+    sDelegate.AddPoisonKey(DefaultStorageKeyAllocator::GroupFabricList().KeyName());
+    it = provider->IterateGroupSessions(session_id);
+    ASSERT_TRUE(it);
+    EXPECT_EQ(1u, it->Count());
+    EXPECT_TRUE(it->Next(session));
+    EXPECT_EQ(kFabric1, session.fabric_index);
+    EXPECT_EQ(kGroup1, session.group_id);
+    EXPECT_FALSE(it->Next(session));
+    it->Release();
+    sDelegate.ClearPoisonKeys();
+
+    // An iterator opened before a key change keeps the cached sessions
+    it = provider->IterateGroupSessions(session_id);
+    ASSERT_TRUE(it);
+#endif // CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+
+    // Removing the key set (and its mappings) invalidates the cache
+    EXPECT_EQ(provider->RemoveKeySet(kFabric1, kKeysetId1), CHIP_NO_ERROR);
+
+#if CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+    EXPECT_TRUE(it->Next(session));
+    EXPECT_EQ(kGroup1, session.group_id);
+    it->Release();
+#endif // CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+
+    auto it2 = provider->IterateGroupSessions(session_id);
+    ASSERT_TRUE(it2);
+    EXPECT_EQ(0u, it2->Count());
+    EXPECT_FALSE(it2->Next(session));
+    it2->Release();
+
+    // Restoring the key set and its mapping makes the session available again
+    EXPECT_EQ(provider->SetKeySet(kFabric1, kCompressedFabricId1, kKeySet1), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetGroupKeyAt(kFabric1, 0, kGroup1Keyset1), CHIP_NO_ERROR);
+    it2 = provider->IterateGroupSessions(session_id);
+    ASSERT_TRUE(it2);
+    EXPECT_EQ(1u, it2->Count());
+    EXPECT_TRUE(it2->Next(session));
+    EXPECT_EQ(kGroup1, session.group_id);
+    it2->Release();
+}
+
 } // namespace TestGroups
 } // namespace app
 } // namespace chip
@@ -0,0 +1,119 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <credentials/VerifiedCertificateChainCache.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/Span.h>
+
+using namespace chip;
+
+namespace {
+
+constexpr FabricIndex kFabricIndex1 = 1;
+constexpr FabricIndex kFabricIndex2 = 2;
+
+// The cache does not parse certificates, so we can use simple constants
+const uint8_t kTestRcacBuf[] = { 'r', 'c', 'a', 'c' };
+const ByteSpan kTestRcacSpan{ kTestRcacBuf };
+
+const uint8_t kTestIcacBuf[] = { 'i', 'c', 'a', 'c' };
+const ByteSpan kTestIcacSpan{ kTestIcacBuf };
+
+const uint8_t kTestNocBuf[] = { 'n', 'o', 'c' };
+const ByteSpan kTestNocSpan{ kTestNocBuf };
+
+struct TestVerifiedCertificateChainCache : public ::testing::Test
+{
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+TEST_F(TestVerifiedCertificateChainCache, MatchesExactChain)
+{
+    VerifiedCertificateChainCache cache;
+    EXPECT_FALSE(cache.Contains(kFabricIndex1, kTestNocSpan, kTestIcacSpan, kTestRcacSpan));
+
+    cache.Add(kFabricIndex1, kTestNocSpan, kTestIcacSpan, kTestRcacSpan);
+    EXPECT_TRUE(cache.Contains(kFabricIndex1, kTestNocSpan, kTestIcacSpan, kTestRcacSpan));
+
+    // Another fabric, or any other certificate in the chain, does not match.
+    EXPECT_FALSE(cache.Contains(kFabricIndex2, kTestNocSpan, kTestIcacSpan, kTestRcacSpan));
+    EXPECT_FALSE(cache.Contains(kFabricIndex1, kTestNocSpan, ByteSpan(), kTestRcacSpan));
+    EXPECT_FALSE(cache.Contains(kFabricIndex1, kTestNocSpan, kTestIcacSpan, kTestIcacSpan));
+    EXPECT_FALSE(cache.Contains(kFabricIndex1, kTestIcacSpan, kTestIcacSpan, kTestRcacSpan));
+
+    // Chains are never cached for an undefined fabric.
+    cache.Add(kUndefinedFabricIndex, kTestNocSpan, kTestIcacSpan, kTestRcacSpan);
+    EXPECT_FALSE(cache.Contains(kUndefinedFabricIndex, kTestNocSpan, kTestIcacSpan, kTestRcacSpan));
+}
+
+TEST_F(TestVerifiedCertificateChainCache, SeparatesCertificates)
+{
+    const uint8_t chainBuf[] = { 'n', 'o', 'c', 'i', 'c', 'a', 'c', 'r', 'c', 'a', 'c' };
+    const ByteSpan chain{ chainBuf };
+
+    VerifiedCertificateChainCache cache;
+    cache.Add(kFabricIndex1, chain.SubSpan(0, 3), chain.SubSpan(3, 4), chain.SubSpan(7, 4));
+    EXPECT_TRUE(cache.Contains(kFabricIndex1, chain.SubSpan(0, 3), chain.SubSpan(3, 4), chain.SubSpan(7, 4)));
+
+    // Moving bytes from one certificate to the next does not match.
+    EXPECT_FALSE(cache.Contains(kFabricIndex1, chain.SubSpan(0, 4), chain.SubSpan(4, 3), chain.SubSpan(7, 4)));
+}
+
+TEST_F(TestVerifiedCertificateChainCache, InvalidatesPerFabric)
+{
+    VerifiedCertificateChainCache cache;
+    cache.Add(kFabricIndex1, kTestNocSpan, kTestIcacSpan, kTestRcacSpan);
+    cache.Add(kFabricIndex2, kTestNocSpan, kTestIcacSpan, kTestRcacSpan);
+
+    cache.Invalidate(kFabricIndex1);
+    EXPECT_FALSE(cache.Contains(kFabricIndex1, kTestNocSpan, kTestIcacSpan, kTestRcacSpan));
+    EXPECT_TRUE(cache.Contains(kFabricIndex2, kTestNocSpan, kTestIcacSpan, kTestRcacSpan));
+
+    cache.Clear();
+    EXPECT_FALSE(cache.Contains(kFabricIndex2, kTestNocSpan, kTestIcacSpan, kTestRcacSpan));
+}
+
+TEST_F(TestVerifiedCertificateChainCache, ReplacesLeastRecentlyUsed)
+{
+    VerifiedCertificateChainCache cache;
+
+    // Fill the cache with one chain per fabric.
+    for (size_t i = 0; i < VerifiedCertificateChainCache::kCacheSize; i++)
+    {
+        cache.Add(static_cast<FabricIndex>(i + 1), kTestNocSpan, kTestIcacSpan, kTestRcacSpan);
+    }
+
+    // Use the first chain, so the second one becomes the least recently used.
+    EXPECT_TRUE(cache.Contains(1, kTestNocSpan, kTestIcacSpan, kTestRcacSpan));
+
+    const auto newFabricIndex = static_cast<FabricIndex>(VerifiedCertificateChainCache::kCacheSize + 1);
+    cache.Add(newFabricIndex, kTestNocSpan, kTestIcacSpan, kTestRcacSpan);
+
+    EXPECT_TRUE(cache.Contains(newFabricIndex, kTestNocSpan, kTestIcacSpan, kTestRcacSpan));
+    EXPECT_TRUE(cache.Contains(1, kTestNocSpan, kTestIcacSpan, kTestRcacSpan));
+    EXPECT_FALSE(cache.Contains(2, kTestNocSpan, kTestIcacSpan, kTestRcacSpan));
+    for (size_t i = 2; i < VerifiedCertificateChainCache::kCacheSize; i++)
+    {
+        EXPECT_TRUE(cache.Contains(static_cast<FabricIndex>(i + 1), kTestNocSpan, kTestIcacSpan, kTestRcacSpan));
+    }
+}
+
+} // namespace
@@ -31,6 +31,7 @@
 
 #include <openssl/bn.h>
 #include <openssl/conf.h>
+#include <openssl/crypto.h>
 #include <openssl/ec.h>
 #include <openssl/ecdsa.h>
 #include <openssl/err.h>
@@ -53,6 +54,7 @@
 #include <lib/support/SafePointerCast.h>
 #include <lib/support/logging/CHIPLogging.h>
 
+#include <mutex>
 #include <string.h>
 
 namespace chip {
@@ -138,6 +140,175 @@ static int _compareDaysAndSeconds(const int days, const int seconds)
     return 0;
 }
 
+#if CHIP_CRYPTO_BORINGSSL
+using AesCcmContext = EVP_AEAD_CTX;
+#else
+using AesCcmContext = EVP_CIPHER_CTX;
+#endif // CHIP_CRYPTO_BORINGSSL
+
+static void _freeAesCcmContext(AesCcmContext * context)
+{
+#if CHIP_CRYPTO_BORINGSSL
+    EVP_AEAD_CTX_free(context);
+#else
+    EVP_CIPHER_CTX_free(context);
+#endif // CHIP_CRYPTO_BORINGSSL
+}
+
+// Create an AES-CCM context keyed with the given key, for the nonce and tag lengths of Matter messages.  With OpenSSL,
+// the context can only be used in the direction it was keyed for: switching it over requires passing the key again.
+static AesCcmContext * _newKeyedAesCcmContext(const Symmetric128BitsKeyByteArray & key, bool encrypt)
+{
+#if CHIP_CRYPTO_BORINGSSL
+    (void) encrypt;
+    return EVP_AEAD_CTX_new(EVP_aead_aes_128_ccm_matter(), key, sizeof(key), CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES);
+#else
+    EVP_CIPHER_CTX * context = EVP_CIPHER_CTX_new();
+    VerifyOrReturnValue(context != nullptr, nullptr);
+
+    // The nonce and tag lengths are part of the CCM key setup, so they are fixed for the lifetime of the context.
+    const int enc = encrypt ? 1 : 0;
+    if (EVP_CipherInit_ex(context, EVP_aes_128_ccm(), nullptr, nullptr, nullptr, enc) != 1 ||
+        EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_IVLEN, static_cast<int>(CHIP_CRYPTO_AEAD_NONCE_LENGTH_BYTES), nullptr) != 1 ||
+        EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES), nullptr) != 1 ||
+        EVP_CipherInit_ex(context, nullptr, nullptr, key, nullptr, enc) != 1)
+    {
+        EVP_CIPHER_CTX_free(context);
+        return nullptr;
+    }
+    return context;
+#endif // CHIP_CRYPTO_BORINGSSL
+}
+
+namespace {
+
+// AES-CCM contexts for a session key registered with AES_CCM_CacheKeyContext().  A session key is normally only used in
+// one direction, so each context is keyed on its first use.  The entry is checked out while a message is processed with
+// it, so a thread using the same key at the same time takes the uncached path instead of sharing it.
+struct CachedAesCcmContext
+{
+    const Symmetric128BitsKeyHandle * keyHandle = nullptr;
+    Symmetric128BitsKeyByteArray key            = {};
+    AesCcmContext * encryptContext              = nullptr;
+    AesCcmContext * decryptContext              = nullptr;
+    bool inUse                                  = false;
+
+    AesCcmContext *& Context(bool encrypt) { return encrypt ? encryptContext : decryptContext; }
+};
+
+#if CHIP_CONFIG_AES_CCM_CONTEXT_CACHE_SIZE > 0
+std::mutex gAesCcmContextCacheLock;
+CachedAesCcmContext gAesCcmContextCache[CHIP_CONFIG_AES_CCM_CONTEXT_CACHE_SIZE];
+
+void ClearCachedAesCcmContext(CachedAesCcmContext & entry)
+{
+    _freeAesCcmContext(entry.encryptContext);
+    _freeAesCcmContext(entry.decryptContext);
+    ClearSecretData(entry.key);
+    entry.keyHandle      = nullptr;
+    entry.encryptContext = nullptr;
+    entry.decryptContext = nullptr;
+}
+
+// Must be called with gAesCcmContextCacheLock held.
+void ReleaseCachedAesCcmContext(const Symmetric128BitsKeyHandle & key)
+{
+    for (auto & entry : gAesCcmContextCache)
+    {
+        if (entry.keyHandle == &key)
+        {
+            // A context still in use is cleared when it is checked back in.
+            entry.keyHandle = nullptr;
+            if (!entry.inUse)
+            {
+                ClearCachedAesCcmContext(entry);
+            }
+        }
+    }
+}
+#endif // CHIP_CONFIG_AES_CCM_CONTEXT_CACHE_SIZE > 0
+
+// Check out the cached contexts for the key, if it has some that are not in use and the nonce and tag lengths suit them.
+// On success, the context for the given direction is keyed and ready for a nonce.
+CachedAesCcmContext * CheckOutAesCcmContext(const Aes128KeyHandle & key, size_t nonce_length, size_t tag_length, bool encrypt)
+{
+#if CHIP_CONFIG_AES_CCM_CONTEXT_CACHE_SIZE > 0
+    VerifyOrReturnValue(nonce_length == CHIP_CRYPTO_AEAD_NONCE_LENGTH_BYTES && tag_length == CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES,
+                        nullptr);
+
+    std::lock_guard<std::mutex> lock(gAesCcmContextCacheLock);
+    for (auto & entry : gAesCcmContextCache)
+    {
+        if (entry.keyHandle != &key)
+        {
+            continue;
+        }
+
+        // Only use the context if the handle still holds the key it was made for.
+        VerifyOrReturnValue(!entry.inUse, nullptr);
+        VerifyOrReturnValue(CRYPTO_memcmp(entry.key, key.As<Symmetric128BitsKeyByteArray>(), sizeof(entry.key)) == 0, nullptr);
+        AesCcmContext *& context = entry.Context(encrypt);
+        if (context == nullptr)
+        {
+            context = _newKeyedAesCcmContext(entry.key, encrypt);
+            VerifyOrReturnValue(context != nullptr, nullptr);
+        }
+        entry.inUse = true;
+        return &entry;
+    }
+#endif // CHIP_CONFIG_AES_CCM_CONTEXT_CACHE_SIZE > 0
+    return nullptr;
+}
+
+// Check in contexts taken with CheckOutAesCcmContext().  A context that failed an operation may be in any state, so
+// it is freed and keyed again on its next use.
+void CheckInAesCcmContext(CachedAesCcmContext & entry, bool encrypt, bool succeeded)
+{
+#if CHIP_CONFIG_AES_CCM_CONTEXT_CACHE_SIZE > 0
+    std::lock_guard<std::mutex> lock(gAesCcmContextCacheLock);
+    entry.inUse = false;
+    if (entry.keyHandle == nullptr)
+    {
+        ClearCachedAesCcmContext(entry);
+    }
+    else if (!succeeded)
+    {
+        _freeAesCcmContext(entry.Context(encrypt));
+        entry.Context(encrypt) = nullptr;
+    }
+#endif // CHIP_CONFIG_AES_CCM_CONTEXT_CACHE_SIZE > 0
+}
+
+} // namespace
+
+void AES_CCM_CacheKeyContext(const Aes128KeyHandle & key)
+{
+#if CHIP_CONFIG_AES_CCM_CONTEXT_CACHE_SIZE > 0
+    std::lock_guard<std::mutex> lock(gAesCcmContextCacheLock);
+
+    // The handle may have been given a new key without the old one being released.
+    ReleaseCachedAesCcmContext(key);
+
+    for (auto & entry : gAesCcmContextCache)
+    {
+        if (entry.keyHandle == nullptr && !entry.inUse)
+        {
+            memcpy(entry.key, key.As<Symmetric128BitsKeyByteArray>(), sizeof(entry.key));
+            entry.keyHandle = &key;
+            return;
+        }
+    }
+#endif // CHIP_CONFIG_AES_CCM_CONTEXT_CACHE_SIZE > 0
+}
+
+void AES_CCM_ReleaseKeyContext(const Symmetric128BitsKeyHandle & key)
+{
+#if CHIP_CONFIG_AES_CCM_CONTEXT_CACHE_SIZE > 0
+    std::lock_guard<std::mutex> lock(gAesCcmContextCacheLock);
+    ReleaseCachedAesCcmContext(key);
+#endif // CHIP_CONFIG_AES_CCM_CONTEXT_CACHE_SIZE > 0
+}
+
 CHIP_ERROR AES_CCM_encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
                            const Aes128KeyHandle & key, const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext,
                            uint8_t * tag, size_t tag_length)
@@ -152,8 +323,9 @@ CHIP_ERROR AES_CCM_encrypt(const uint8_t * plaintext, size_t plaintext_length, c
     size_t ciphertext_length = 0;
     const EVP_CIPHER * type  = nullptr;
 #endif
-    CHIP_ERROR error = CHIP_NO_ERROR;
-    int result       = 1;
+    CachedAesCcmContext * cachedContext = nullptr;
+    CHIP_ERROR error                    = CHIP_NO_ERROR;
+    int result                          = 1;
 
     // Placeholder location for avoiding null params for plaintexts when
     // size is zero.
@@ -193,11 +365,21 @@ CHIP_ERROR AES_CCM_encrypt(const uint8_t * plaintext, size_t plaintext_length, c
                             error = CHIP_ERROR_INVALID_ARGUMENT);
 #endif // CHIP_CRYPTO_BORINGSSL
 
+    cachedContext = CheckOutAesCcmContext(key, nonce_length, tag_length, true /* encrypt */);
+
 #if CHIP_CRYPTO_BORINGSSL
-    aead = EVP_aead_aes_128_ccm_matter();
+    if (cachedContext != nullptr)
+    {
+        context = cachedContext->encryptContext;
+    }
+    else
+    {
+        aead = EVP_aead_aes_128_ccm_matter();
 
-    context = EVP_AEAD_CTX_new(aead, key.As<Symmetric128BitsKeyByteArray>(), sizeof(Symmetric128BitsKeyByteArray), tag_length);
-    VerifyOrExit(context != nullptr, error = CHIP_ERROR_NO_MEMORY);
+        context =
+            EVP_AEAD_CTX_new(aead, key.As<Symmetric128BitsKeyByteArray>(), sizeof(Symmetric128BitsKeyByteArray), tag_length);
+        VerifyOrExit(context != nullptr, error = CHIP_ERROR_NO_MEMORY);
+    }
 
     result = EVP_AEAD_CTX_seal_scatter(context, ciphertext, tag, &written_tag_len, tag_length, nonce, nonce_length, plaintext,
                                        plaintext_length, nullptr, 0, aad, aad_length);
@@ -205,27 +387,38 @@ CHIP_ERROR AES_CCM_encrypt(const uint8_t * plaintext, size_t plaintext_length, c
     VerifyOrExit(written_tag_len == tag_length, error = CHIP_ERROR_INTERNAL);
 #else
 
-    type = EVP_aes_128_ccm();
+    if (cachedContext != nullptr)
+    {
+        // The cached context is keyed and set up for this nonce and tag length already; pass in the nonce.
+        context = cachedContext->encryptContext;
+        result  = EVP_EncryptInit_ex(context, nullptr, nullptr, nullptr, Uint8::to_const_uchar(nonce));
+        VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+    }
+    else
+    {
+        type = EVP_aes_128_ccm();
 
-    context = EVP_CIPHER_CTX_new();
-    VerifyOrExit(context != nullptr, error = CHIP_ERROR_NO_MEMORY);
+        context = EVP_CIPHER_CTX_new();
+        VerifyOrExit(context != nullptr, error = CHIP_ERROR_NO_MEMORY);
 
-    // Pass in cipher
-    result = EVP_EncryptInit_ex(context, type, nullptr, nullptr, nullptr);
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+        // Pass in cipher
+        result = EVP_EncryptInit_ex(context, type, nullptr, nullptr, nullptr);
+        VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
 
-    // Pass in nonce length.  Cast is safe because we checked with CanCastTo.
-    result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_IVLEN, static_cast<int>(nonce_length), nullptr);
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+        // Pass in nonce length.  Cast is safe because we checked with CanCastTo.
+        result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_IVLEN, static_cast<int>(nonce_length), nullptr);
+        VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
 
-    // Pass in tag length. Cast is safe because we checked against CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES.
-    result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(tag_length), nullptr);
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+        // Pass in tag length. Cast is safe because we checked against CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES.
+        result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(tag_length), nullptr);
+        VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
 
-    // Pass in key + nonce
-    static_assert(kAES_CCM128_Key_Length == sizeof(Symmetric128BitsKeyByteArray), "Unexpected key length");
-    result = EVP_EncryptInit_ex(context, nullptr, nullptr, key.As<Symmetric128BitsKeyByteArray>(), Uint8::to_const_uchar(nonce));
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+        // Pass in key + nonce
+        static_assert(kAES_CCM128_Key_Length == sizeof(Symmetric128BitsKeyByteArray), "Unexpected key length");
+        result =
+            EVP_EncryptInit_ex(context, nullptr, nullptr, key.As<Symmetric128BitsKeyByteArray>(), Uint8::to_const_uchar(nonce));
+        VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+    }
 
     // Pass in plain text length
     VerifyOrExit(CanCastTo<int>(plaintext_length), error = CHIP_ERROR_INVALID_ARGUMENT);
@@ -260,15 +453,15 @@ CHIP_ERROR AES_CCM_encrypt(const uint8_t * plaintext, size_t plaintext_length, c
 #endif // CHIP_CRYPTO_BORINGSSL
 
 exit:
-    if (context != nullptr)
+    if (cachedContext != nullptr)
     {
-#if CHIP_CRYPTO_BORINGSSL
-        EVP_AEAD_CTX_free(context);
-#else
-        EVP_CIPHER_CTX_free(context);
-#endif // CHIP_CRYPTO_BORINGSSL
-        context = nullptr;
+        CheckInAesCcmContext(*cachedContext, true /* encrypt */, error == CHIP_NO_ERROR);
+    }
+    else if (context != nullptr)
+    {
+        _freeAesCcmContext(context);
     }
+    context = nullptr;
 
     return error;
 }
@@ -286,8 +479,9 @@ CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length,
     int bytesOutput          = 0;
     const EVP_CIPHER * type  = nullptr;
 #endif // CHIP_CRYPTO_BORINGSSL
-    CHIP_ERROR error = CHIP_NO_ERROR;
-    int result       = 1;
+    CachedAesCcmContext * cachedContext = nullptr;
+    CHIP_ERROR error                    = CHIP_NO_ERROR;
+    int result                          = 1;
 
     // Placeholder location for avoiding null params for ciphertext when
     // size is zero.
@@ -325,42 +519,68 @@ CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length,
     VerifyOrExit(nonce != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrExit(nonce_length > 0, error = CHIP_ERROR_INVALID_ARGUMENT);
 
+    cachedContext = CheckOutAesCcmContext(key, nonce_length, tag_length, false /* encrypt */);
+
 #if CHIP_CRYPTO_BORINGSSL
-    aead = EVP_aead_aes_128_ccm_matter();
+    if (cachedContext != nullptr)
+    {
+        context = cachedContext->decryptContext;
+    }
+    else
+    {
+        aead = EVP_aead_aes_128_ccm_matter();
 
-    context = EVP_AEAD_CTX_new(aead, key.As<Symmetric128BitsKeyByteArray>(), sizeof(Symmetric128BitsKeyByteArray), tag_length);
-    VerifyOrExit(context != nullptr, error = CHIP_ERROR_NO_MEMORY);
+        context =
+            EVP_AEAD_CTX_new(aead, key.As<Symmetric128BitsKeyByteArray>(), sizeof(Symmetric128BitsKeyByteArray), tag_length);
+        VerifyOrExit(context != nullptr, error = CHIP_ERROR_NO_MEMORY);
+    }
 
     result = EVP_AEAD_CTX_open_gather(context, plaintext, nonce, nonce_length, ciphertext, ciphertext_length, tag, tag_length, aad,
                                       aad_length);
     VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
 #else
-    type = EVP_aes_128_ccm();
+    if (cachedContext != nullptr)
+    {
+        // The cached context is keyed and set up for this nonce and tag length already; pass in the expected tag and
+        // the nonce.
+        context = cachedContext->decryptContext;
+        result  = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(tag_length),
+                                     const_cast<void *>(static_cast<const void *>(tag)));
+        VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
 
-    context = EVP_CIPHER_CTX_new();
-    VerifyOrExit(context != nullptr, error = CHIP_ERROR_NO_MEMORY);
+        result = EVP_DecryptInit_ex(context, nullptr, nullptr, nullptr, Uint8::to_const_uchar(nonce));
+        VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+    }
+    else
+    {
+        type = EVP_aes_128_ccm();
 
-    // Pass in cipher
-    result = EVP_DecryptInit_ex(context, type, nullptr, nullptr, nullptr);
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+        context = EVP_CIPHER_CTX_new();
+        VerifyOrExit(context != nullptr, error = CHIP_ERROR_NO_MEMORY);
 
-    // Pass in nonce length
-    VerifyOrExit(CanCastTo<int>(nonce_length), error = CHIP_ERROR_INVALID_ARGUMENT);
-    result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_IVLEN, static_cast<int>(nonce_length), nullptr);
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+        // Pass in cipher
+        result = EVP_DecryptInit_ex(context, type, nullptr, nullptr, nullptr);
+        VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
 
-    // Pass in expected tag
-    // Removing "const" from |tag| here should hopefully be safe as
-    // we're writing the tag, not reading.
-    VerifyOrExit(CanCastTo<int>(tag_length), error = CHIP_ERROR_INVALID_ARGUMENT);
-    result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(tag_length),
-                                            const_cast<void *>(static_cast<const void *>(tag)));
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+        // Pass in nonce length
+        VerifyOrExit(CanCastTo<int>(nonce_length), error = CHIP_ERROR_INVALID_ARGUMENT);
+        result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_IVLEN, static_cast<int>(nonce_length), nullptr);
+        VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
 
-    // Pass in key + nonce
-    static_assert(kAES_CCM128_Key_Length == sizeof(Symmetric128BitsKeyByteArray), "Unexpected key length");
-    result = EVP_DecryptInit_ex(context, nullptr, nullptr, key.As<Symmetric128BitsKeyByteArray>(), Uint8::to_const_uchar(nonce));
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+        // Pass in expected tag
+        // Removing "const" from |tag| here should hopefully be safe as
+        // we're writing the tag, not reading.
+        VerifyOrExit(CanCastTo<int>(tag_length), error = CHIP_ERROR_INVALID_ARGUMENT);
+        result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(tag_length),
+                                                const_cast<void *>(static_cast<const void *>(tag)));
+        VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+
+        // Pass in key + nonce
+        static_assert(kAES_CCM128_Key_Length == sizeof(Symmetric128BitsKeyByteArray), "Unexpected key length");
+        result =
+            EVP_DecryptInit_ex(context, nullptr, nullptr, key.As<Symmetric128BitsKeyByteArray>(), Uint8::to_const_uchar(nonce));
+        VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+    }
 
     // Pass in cipher text length
     VerifyOrExit(CanCastTo<int>(ciphertext_length), error = CHIP_ERROR_INVALID_ARGUMENT);
@@ -389,16 +609,15 @@ CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length,
 #endif // CHIP_CRYPTO_BORINGSSL
 
 exit:
-    if (context != nullptr)
+    if (cachedContext != nullptr)
     {
-#if CHIP_CRYPTO_BORINGSSL
-        EVP_AEAD_CTX_free(context);
-#else
-        EVP_CIPHER_CTX_free(context);
-#endif // CHIP_CRYPTO_BORINGSSL
-
-        context = nullptr;
+        CheckInAesCcmContext(*cachedContext, false /* encrypt */, error == CHIP_NO_ERROR);
+    }
+    else if (context != nullptr)
+    {
+        _freeAesCcmContext(context);
     }
+    context = nullptr;
 
     return error;
 }
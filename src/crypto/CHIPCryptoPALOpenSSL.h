@@ -40,6 +40,21 @@ enum class ECName
     P256v1 = 1,
 };
 
+/**
+ * @brief Keep reusable AES-CCM contexts for a session key
+ *
+ * The first AES_CCM_encrypt() or AES_CCM_decrypt() with that key sets up a context with the key expanded, and later
+ * messages in the same direction only set the nonce, tag and AAD of that context instead of allocating a context and
+ * expanding the key again.  Not having room for the key is not an error: the key keeps working without a cached
+ * context.  Must be balanced by AES_CCM_ReleaseKeyContext() before the key handle is cleared or goes away.
+ **/
+void AES_CCM_CacheKeyContext(const Aes128KeyHandle & key);
+
+/**
+ * @brief Free the AES-CCM contexts kept for the key by AES_CCM_CacheKeyContext(), if any
+ **/
+void AES_CCM_ReleaseKeyContext(const Symmetric128BitsKeyHandle & key);
+
 /**
  * @brief Collect and print SSL-related error information
  **/
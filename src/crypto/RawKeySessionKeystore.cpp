@@ -17,6 +17,10 @@
 
 #include <crypto/RawKeySessionKeystore.h>
 
+#if CHIP_CRYPTO_OPENSSL || CHIP_CRYPTO_BORINGSSL
+#include <crypto/CHIPCryptoPALOpenSSL.h>
+#endif // CHIP_CRYPTO_OPENSSL || CHIP_CRYPTO_BORINGSSL
+
 #include <lib/support/BufferReader.h>
 
 #include <cstdint>
@@ -80,10 +84,18 @@ CHIP_ERROR RawKeySessionKeystore::DeriveSessionKeys(const ByteSpan & secret, con
 
     Encoding::LittleEndian::Reader reader(keyMaterial.Bytes(), keyMaterial.Capacity());
 
-    return reader.ReadBytes(i2rKey.AsMutable<Symmetric128BitsKeyByteArray>(), sizeof(Symmetric128BitsKeyByteArray))
-        .ReadBytes(r2iKey.AsMutable<Symmetric128BitsKeyByteArray>(), sizeof(Symmetric128BitsKeyByteArray))
-        .ReadBytes(attestationChallenge.Bytes(), AttestationChallenge::Capacity())
-        .StatusCode();
+    ReturnErrorOnFailure(reader.ReadBytes(i2rKey.AsMutable<Symmetric128BitsKeyByteArray>(), sizeof(Symmetric128BitsKeyByteArray))
+                             .ReadBytes(r2iKey.AsMutable<Symmetric128BitsKeyByteArray>(), sizeof(Symmetric128BitsKeyByteArray))
+                             .ReadBytes(attestationChallenge.Bytes(), AttestationChallenge::Capacity())
+                             .StatusCode());
+
+#if CHIP_CRYPTO_OPENSSL || CHIP_CRYPTO_BORINGSSL
+    // Session keys encrypt or decrypt every message of the session, so keep their expanded AES-CCM contexts around.
+    AES_CCM_CacheKeyContext(i2rKey);
+    AES_CCM_CacheKeyContext(r2iKey);
+#endif // CHIP_CRYPTO_OPENSSL || CHIP_CRYPTO_BORINGSSL
+
+    return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR RawKeySessionKeystore::DeriveSessionKeys(const HkdfKeyHandle & hkdfKey, const ByteSpan & salt, const ByteSpan & info,
@@ -95,6 +107,9 @@ CHIP_ERROR RawKeySessionKeystore::DeriveSessionKeys(const HkdfKeyHandle & hkdfKe
 
 void RawKeySessionKeystore::DestroyKey(Symmetric128BitsKeyHandle & key)
 {
+#if CHIP_CRYPTO_OPENSSL || CHIP_CRYPTO_BORINGSSL
+    AES_CCM_ReleaseKeyContext(key);
+#endif // CHIP_CRYPTO_OPENSSL || CHIP_CRYPTO_BORINGSSL
     ClearSecretData(key.AsMutable<Symmetric128BitsKeyByteArray>());
 }
 
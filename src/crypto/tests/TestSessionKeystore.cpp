@@ -27,12 +27,16 @@
 #include <lib/support/CodeUtils.h>
 #include <lib/support/ScopedMemoryBuffer.h>
 #include <lib/support/Span.h>
+#include <lib/support/logging/CHIPLogging.h>
 #include <lib/support/tests/ExtraPwTestMacros.h>
+#include <system/SystemClock.h>
 
 #if CHIP_CRYPTO_PSA
 #include <psa/crypto.h>
 #endif
 
+#include <algorithm>
+
 using namespace chip;
 using namespace chip::Crypto;
 
@@ -209,4 +213,120 @@ TEST_F(TestSessionKeystore, TestDeriveSessionKeys)
     }
 }
 
+TEST_F(TestSessionKeystore, TestSessionKeysAesCcm)
+{
+    TestSessionKeystoreImpl keystore;
+    const DeriveSessionKeysTestVector & test = deriveSessionKeysTestVectors[0];
+
+    // Session keys, which crypto backends may keep a keyed AES-CCM context for, and the same I2R key imported directly.
+    Aes128KeyHandle i2r;
+    Aes128KeyHandle r2i;
+    AttestationChallenge challenge;
+    ASSERT_EQ(keystore.DeriveSessionKeys(ToSpan(test.secret), ToSpan(test.salt), ToSpan(test.info), i2r, r2i, challenge),
+              CHIP_NO_ERROR);
+
+    const Symmetric128BitsKeyByteArray i2rKeyMaterial = { 0xa1, 0x34, 0xe2, 0x84, 0xe8, 0x62, 0x84, 0x86,
+                                                          0xf4, 0xd6, 0x20, 0xa7, 0x11, 0xf3, 0xcb, 0x50 };
+    Aes128KeyHandle imported;
+    ASSERT_EQ(keystore.CreateKey(i2rKeyMaterial, imported), CHIP_NO_ERROR);
+
+    uint8_t plaintext[64];
+    uint8_t aad[8];
+    uint8_t nonce[CHIP_CRYPTO_AEAD_NONCE_LENGTH_BYTES] = { 0 };
+    for (size_t i = 0; i < sizeof(plaintext); i++)
+    {
+        plaintext[i] = static_cast<uint8_t>(i);
+    }
+    memset(aad, 0xaa, sizeof(aad));
+
+    // Several messages with the same keys, so that any cached context gets reused.
+    for (uint8_t message = 0; message < 4; message++)
+    {
+        nonce[0] = message;
+
+        uint8_t ciphertext[sizeof(plaintext)];
+        uint8_t tag[CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES];
+        uint8_t expectedCiphertext[sizeof(plaintext)];
+        uint8_t expectedTag[CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES];
+        EXPECT_EQ(AES_CCM_encrypt(plaintext, sizeof(plaintext), aad, sizeof(aad), i2r, nonce, sizeof(nonce), ciphertext, tag,
+                                  sizeof(tag)),
+                  CHIP_NO_ERROR);
+        EXPECT_EQ(AES_CCM_encrypt(plaintext, sizeof(plaintext), aad, sizeof(aad), imported, nonce, sizeof(nonce),
+                                  expectedCiphertext, expectedTag, sizeof(expectedTag)),
+                  CHIP_NO_ERROR);
+        EXPECT_EQ(memcmp(ciphertext, expectedCiphertext, sizeof(ciphertext)), 0);
+        EXPECT_EQ(memcmp(tag, expectedTag, sizeof(tag)), 0);
+
+        // A corrupted tag must be rejected, without affecting the next message.
+        uint8_t decrypted[sizeof(plaintext)];
+        tag[0] ^= 0x01;
+        EXPECT_NE(AES_CCM_decrypt(ciphertext, sizeof(ciphertext), aad, sizeof(aad), tag, sizeof(tag), i2r, nonce, sizeof(nonce),
+                                  decrypted),
+                  CHIP_NO_ERROR);
+        tag[0] ^= 0x01;
+        EXPECT_EQ(AES_CCM_decrypt(ciphertext, sizeof(ciphertext), aad, sizeof(aad), tag, sizeof(tag), i2r, nonce, sizeof(nonce),
+                                  decrypted),
+                  CHIP_NO_ERROR);
+        EXPECT_EQ(memcmp(decrypted, plaintext, sizeof(plaintext)), 0);
+
+        // The other session key must not be mixed up with the first one.
+        EXPECT_NE(AES_CCM_decrypt(ciphertext, sizeof(ciphertext), aad, sizeof(aad), tag, sizeof(tag), r2i, nonce, sizeof(nonce),
+                                  decrypted),
+                  CHIP_NO_ERROR);
+    }
+
+    keystore.DestroyKey(i2r);
+    keystore.DestroyKey(r2i);
+    keystore.DestroyKey(imported);
+}
+
+// Times encrypting and decrypting a typical message with session keys and with imported keys, e.g. to see what keyed
+// AES-CCM contexts save per message.  Only reports the numbers; the relative cost depends on the crypto backend.
+TEST_F(TestSessionKeystore, BenchmarkAesCcmPerMessage)
+{
+    constexpr size_t kMessages = 2000;
+
+    TestSessionKeystoreImpl keystore;
+    const DeriveSessionKeysTestVector & test = deriveSessionKeysTestVectors[0];
+
+    Aes128KeyHandle sessionKey;
+    Aes128KeyHandle unusedKey;
+    AttestationChallenge challenge;
+    ASSERT_EQ(
+        keystore.DeriveSessionKeys(ToSpan(test.secret), ToSpan(test.salt), ToSpan(test.info), sessionKey, unusedKey, challenge),
+        CHIP_NO_ERROR);
+
+    Aes128KeyHandle importedKey;
+    const Symmetric128BitsKeyByteArray keyMaterial = { 0 };
+    ASSERT_EQ(keystore.CreateKey(keyMaterial, importedKey), CHIP_NO_ERROR);
+
+    uint8_t message[100]                               = { 0 };
+    uint8_t aad[8]                                     = { 0 };
+    uint8_t nonce[CHIP_CRYPTO_AEAD_NONCE_LENGTH_BYTES] = { 0 };
+    uint8_t tag[CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES];
+
+    for (const Aes128KeyHandle * key : { &sessionKey, &importedKey })
+    {
+        const System::Clock::Microseconds64 start = System::SystemClock().GetMonotonicMicroseconds64();
+        for (size_t i = 0; i < kMessages; i++)
+        {
+            memcpy(nonce, &i, std::min(sizeof(i), sizeof(nonce)));
+            ASSERT_EQ(
+                AES_CCM_encrypt(message, sizeof(message), aad, sizeof(aad), *key, nonce, sizeof(nonce), message, tag, sizeof(tag)),
+                CHIP_NO_ERROR);
+            ASSERT_EQ(AES_CCM_decrypt(message, sizeof(message), aad, sizeof(aad), tag, sizeof(tag), *key, nonce, sizeof(nonce),
+                                      message),
+                      CHIP_NO_ERROR);
+        }
+        const System::Clock::Microseconds64 elapsed = System::SystemClock().GetMonotonicMicroseconds64() - start;
+
+        ChipLogProgress(Crypto, "AES-CCM with %s key: %u messages encrypted and decrypted in %" PRIu64 " us",
+                        (key == &sessionKey) ? "session" : "imported", static_cast<unsigned>(kMessages), elapsed.count());
+    }
+
+    keystore.DestroyKey(sessionKey);
+    keystore.DestroyKey(unusedKey);
+    keystore.DestroyKey(importedKey);
+}
+
 } // namespace
@@ -47,6 +47,8 @@ SET(CODEGEN_DATA_MODEL_SOURCES
   # "${chip_root}/src/app/server-cluster:registry",
   "${BASE_DIR}/../../app/server-cluster/ServerClusterInterfaceRegistry.cpp"
   "${BASE_DIR}/../../app/server-cluster/ServerClusterInterfaceRegistry.h"
+  "${BASE_DIR}/../../app/server-cluster/ServerClusterPathIndex.cpp"
+  "${BASE_DIR}/../../app/server-cluster/ServerClusterPathIndex.h"
   "${BASE_DIR}/../../app/server-cluster/SingleEndpointServerClusterRegistry.cpp"
   "${BASE_DIR}/../../app/server-cluster/SingleEndpointServerClusterRegistry.h"
 )
@@ -127,6 +127,17 @@
 #define CHIP_DEVICE_CONFIG_BG_TASK_PRIORITY 1
 #endif
 
+/**
+ * CHIP_DEVICE_CONFIG_BG_TASK_COUNT
+ *
+ * The number of background tasks processing background events, for platforms that can run
+ * more than one (e.g. POSIX).  Background work items are then processed concurrently, in no
+ * particular order.
+ */
+#ifndef CHIP_DEVICE_CONFIG_BG_TASK_COUNT
+#define CHIP_DEVICE_CONFIG_BG_TASK_COUNT 1
+#endif
+
 /**
  * CHIP_DEVICE_CONFIG_BG_MAX_EVENT_QUEUE_SIZE
  *
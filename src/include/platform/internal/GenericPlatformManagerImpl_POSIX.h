@@ -91,6 +91,10 @@ protected:
     CHIP_ERROR _StartEventLoopTask();
     CHIP_ERROR _StopEventLoopTask();
     CHIP_ERROR _StartChipTimer(System::Clock::Timeout duration);
+    CHIP_ERROR _PostBackgroundEvent(const ChipDeviceEvent * event);
+    void _RunBackgroundEventLoop();
+    CHIP_ERROR _StartBackgroundEventLoopTask();
+    CHIP_ERROR _StopBackgroundEventLoopTask();
     void _Shutdown();
 
 #if CHIP_STACK_LOCK_TRACKING_ENABLED
@@ -111,6 +115,20 @@ private:
     DeviceSafeQueue mChipEventQueue;
     std::atomic<bool> mShouldRunEventLoop{ true };
     static void * EventLoopTaskMain(void * arg);
+
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+    static_assert(CHIP_DEVICE_CONFIG_BG_TASK_COUNT > 0, "Background event processing requires at least one background task");
+
+    // Background events are processed by a pool of tasks, all waiting on the same queue.
+    // The queue and the task state are protected by mBackgroundEventQueueLock.
+    pthread_mutex_t mBackgroundEventQueueLock = PTHREAD_MUTEX_INITIALIZER;
+    pthread_cond_t mBackgroundEventQueueCond  = PTHREAD_COND_INITIALIZER;
+    std::queue<ChipDeviceEvent> mBackgroundEventQueue;
+    pthread_t mBackgroundTasks[CHIP_DEVICE_CONFIG_BG_TASK_COUNT];
+    size_t mBackgroundTaskCount        = 0;
+    bool mShouldRunBackgroundEventLoop = false;
+    static void * BackgroundEventLoopTaskMain(void * arg);
+#endif
 #endif
     void ProcessDeviceEvents();
 };
@@ -83,6 +83,10 @@ CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_InitChipStack()
 
     ret = pthread_mutex_init(&mStateLock, nullptr);
     VerifyOrReturnError(ret == 0, CHIP_ERROR_POSIX(ret));
+
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+    ReturnErrorOnFailure(Impl()->StartBackgroundEventLoopTask());
+#endif
 #endif
 
     return CHIP_NO_ERROR;
@@ -273,6 +277,142 @@ void * GenericPlatformManagerImpl_POSIX<ImplClass>::EventLoopTaskMain(void * arg
 
 #endif // !CHIP_SYSTEM_CONFIG_USE_LIBEV
 
+template <class ImplClass>
+CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_PostBackgroundEvent(const ChipDeviceEvent * event)
+{
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING && !CHIP_SYSTEM_CONFIG_USE_LIBEV
+    VerifyOrReturnError(event->Type == DeviceEventType::kCallWorkFunct || event->Type == DeviceEventType::kNoOp,
+                        CHIP_ERROR_INVALID_ARGUMENT);
+
+    pthread_mutex_lock(&mBackgroundEventQueueLock);
+    if (mShouldRunBackgroundEventLoop)
+    {
+        mBackgroundEventQueue.push(*event);
+        pthread_cond_signal(&mBackgroundEventQueueCond);
+        pthread_mutex_unlock(&mBackgroundEventQueueLock);
+        return CHIP_NO_ERROR;
+    }
+    pthread_mutex_unlock(&mBackgroundEventQueueLock);
+#endif
+
+    // Use foreground event loop for background events
+    return Impl()->PostEvent(event);
+}
+
+template <class ImplClass>
+void GenericPlatformManagerImpl_POSIX<ImplClass>::_RunBackgroundEventLoop()
+{
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING && !CHIP_SYSTEM_CONFIG_USE_LIBEV
+    // Each background task runs this loop. Events still queued when the loop is stopped are
+    // processed before returning, so that no scheduled work is silently dropped.
+    pthread_mutex_lock(&mBackgroundEventQueueLock);
+    while (true)
+    {
+        while (mShouldRunBackgroundEventLoop && mBackgroundEventQueue.empty())
+        {
+            pthread_cond_wait(&mBackgroundEventQueueCond, &mBackgroundEventQueueLock);
+        }
+        if (mBackgroundEventQueue.empty())
+        {
+            break;
+        }
+
+        const ChipDeviceEvent event = mBackgroundEventQueue.front();
+        mBackgroundEventQueue.pop();
+
+        pthread_mutex_unlock(&mBackgroundEventQueueLock);
+        Impl()->DispatchEvent(&event);
+        pthread_mutex_lock(&mBackgroundEventQueueLock);
+    }
+    pthread_mutex_unlock(&mBackgroundEventQueueLock);
+#else
+    // Use foreground event loop for background events
+#endif
+}
+
+template <class ImplClass>
+CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_StartBackgroundEventLoopTask()
+{
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING && !CHIP_SYSTEM_CONFIG_USE_LIBEV
+    int err = 0;
+
+    pthread_mutex_lock(&mBackgroundEventQueueLock);
+    VerifyOrExit(mBackgroundTaskCount == 0, ); // Already running
+
+    mShouldRunBackgroundEventLoop = true;
+    for (auto & task : mBackgroundTasks)
+    {
+        err = pthread_create(&task, nullptr, BackgroundEventLoopTaskMain, this);
+        VerifyOrExit(err == 0, );
+        mBackgroundTaskCount++;
+    }
+
+exit:
+    // Run with the tasks that could be started, if any.
+    const size_t taskCount        = mBackgroundTaskCount;
+    mShouldRunBackgroundEventLoop = (taskCount > 0);
+    pthread_mutex_unlock(&mBackgroundEventQueueLock);
+
+    if (err != 0)
+    {
+        ChipLogError(DeviceLayer, "Failed to start background task %u of %u: %" CHIP_ERROR_FORMAT,
+                     static_cast<unsigned>(taskCount + 1), static_cast<unsigned>(CHIP_DEVICE_CONFIG_BG_TASK_COUNT),
+                     CHIP_ERROR_POSIX(err).Format());
+    }
+    return (taskCount > 0) ? CHIP_NO_ERROR : CHIP_ERROR_POSIX(err);
+#else
+    // Use foreground event loop for background events
+    return CHIP_NO_ERROR;
+#endif
+}
+
+template <class ImplClass>
+CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_StopBackgroundEventLoopTask()
+{
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING && !CHIP_SYSTEM_CONFIG_USE_LIBEV
+    pthread_t tasks[CHIP_DEVICE_CONFIG_BG_TASK_COUNT];
+
+    pthread_mutex_lock(&mBackgroundEventQueueLock);
+    const size_t taskCount        = mBackgroundTaskCount;
+    mShouldRunBackgroundEventLoop = false;
+    mBackgroundTaskCount          = 0;
+    for (size_t i = 0; i < taskCount; i++)
+    {
+        tasks[i] = mBackgroundTasks[i];
+    }
+    pthread_cond_broadcast(&mBackgroundEventQueueCond);
+    pthread_mutex_unlock(&mBackgroundEventQueueLock);
+
+    //
+    // Wait for the tasks to process the remaining events and terminate. A background task
+    // stopping the pool cannot wait for itself, it terminates once done with its current event.
+    //
+    int err = 0;
+    for (size_t i = 0; i < taskCount; i++)
+    {
+        int result = pthread_equal(pthread_self(), tasks[i]) ? pthread_detach(tasks[i]) : pthread_join(tasks[i], nullptr);
+        if (result != 0)
+        {
+            err = result;
+        }
+    }
+    return CHIP_ERROR_POSIX(err);
+#else
+    // Use foreground event loop for background events
+    return CHIP_NO_ERROR;
+#endif
+}
+
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING && !CHIP_SYSTEM_CONFIG_USE_LIBEV
+template <class ImplClass>
+void * GenericPlatformManagerImpl_POSIX<ImplClass>::BackgroundEventLoopTaskMain(void * arg)
+{
+    ChipLogDetail(DeviceLayer, "CHIP background task running");
+    static_cast<GenericPlatformManagerImpl_POSIX<ImplClass> *>(arg)->Impl()->RunBackgroundEventLoop();
+    return nullptr;
+}
+#endif
+
 template <class ImplClass>
 CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_StartEventLoopTask()
 {
@@ -408,6 +548,11 @@ void GenericPlatformManagerImpl_POSIX<ImplClass>::_Shutdown()
     VerifyOrDie(mState.load(std::memory_order_relaxed) == State::kStopped);
 
 #if !CHIP_SYSTEM_CONFIG_USE_LIBEV
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+    // Pending background work may still access the stack, let it complete first.
+    RETURN_SAFELY_IGNORED Impl()->StopBackgroundEventLoopTask();
+#endif
+
     pthread_mutex_destroy(&mStateLock);
     pthread_cond_destroy(&mEventQueueStoppedCond);
 #endif
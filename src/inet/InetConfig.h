@@ -272,6 +272,25 @@
 #endif
 #endif // INET_CONFIG_UDP_SOCKET_PKTINFO
 
+/**
+ *  @def INET_CONFIG_UDP_SOCKET_BATCH_SIZE
+ *
+ *  @brief
+ *    The maximum number of datagrams the socket-based implementation of UDP
+ *    endpoints moves with a single system call.
+ *
+ *  @details
+ *    When set above 1, listening endpoints drain up to this many datagrams per
+ *    read wakeup with recvmmsg(), into packet buffers they keep allocated
+ *    between wakeups, and outgoing datagrams are queued until the event loop
+ *    next finds the socket writable, then sent together with sendmmsg().
+ *    Errors for queued datagrams are logged instead of being returned by
+ *    SendMsg().  Requires recvmmsg() and sendmmsg(), e.g. Linux or FreeBSD.
+ */
+#ifndef INET_CONFIG_UDP_SOCKET_BATCH_SIZE
+#define INET_CONFIG_UDP_SOCKET_BATCH_SIZE 1
+#endif // INET_CONFIG_UDP_SOCKET_BATCH_SIZE
+
 /**
  *  @def HAVE_SO_BINDTODEVICE
  *
@@ -167,6 +167,182 @@ CHIP_ERROR IPv4Bind(int socket, const IPAddress & address, uint16_t port)
 }
 #endif // INET_CONFIG_ENABLE_IPV4
 
+/**
+ * Fill in msgHeader to send msg to the destination described by aPktInfo from a socket of type addrType.  The header
+ * refers to msgIOV, peerSockAddr and controlData, which must stay valid for as long as the header is used.
+ */
+CHIP_ERROR PrepareSendHeader(IPAddressType addrType, InterfaceId boundIntfId, const IPPacketInfo * aPktInfo,
+                             const System::PacketBufferHandle & msg, struct msghdr & msgHeader, struct iovec & msgIOV,
+                             SockAddrWithoutStorage & peerSockAddr, uint8_t * controlData, size_t controlDataSize)
+{
+    msgIOV.iov_base = msg->Start();
+    msgIOV.iov_len  = msg->DataLength();
+
+    memset(controlData, 0, controlDataSize);
+    memset(&msgHeader, 0, sizeof(msgHeader));
+    msgHeader.msg_iov    = &msgIOV;
+    msgHeader.msg_iovlen = 1;
+
+    // Construct a sockaddr_in/sockaddr_in6 structure containing the destination information.
+    memset(&peerSockAddr, 0, sizeof(peerSockAddr));
+    msgHeader.msg_name = &peerSockAddr;
+    if (addrType == IPAddressType::kIPv6)
+    {
+        peerSockAddr.in6.sin6_family     = AF_INET6;
+        peerSockAddr.in6.sin6_port       = htons(aPktInfo->DestPort);
+        peerSockAddr.in6.sin6_addr       = aPktInfo->DestAddress.ToIPv6();
+        InterfaceId::PlatformType intfId = aPktInfo->Interface.GetPlatformInterface();
+        VerifyOrReturnError(CanCastTo<decltype(peerSockAddr.in6.sin6_scope_id)>(intfId), CHIP_ERROR_INCORRECT_STATE);
+        peerSockAddr.in6.sin6_scope_id = static_cast<decltype(peerSockAddr.in6.sin6_scope_id)>(intfId);
+        msgHeader.msg_namelen          = sizeof(sockaddr_in6);
+    }
+#if INET_CONFIG_ENABLE_IPV4
+    else
+    {
+        peerSockAddr.in.sin_family = AF_INET;
+        peerSockAddr.in.sin_port   = htons(aPktInfo->DestPort);
+        peerSockAddr.in.sin_addr   = aPktInfo->DestAddress.ToIPv4();
+        msgHeader.msg_namelen      = sizeof(sockaddr_in);
+    }
+#endif // INET_CONFIG_ENABLE_IPV4
+
+    // If the endpoint has been bound to a particular interface,
+    // and the caller didn't supply a specific interface to send
+    // on, use the bound interface. This appears to be necessary
+    // for messages to multicast addresses, which under Linux
+    // don't seem to get sent out the correct interface, despite
+    // the socket being bound.
+    InterfaceId intf = aPktInfo->Interface;
+    if (!intf.IsPresent())
+    {
+        intf = boundIntfId;
+    }
+
+#if INET_CONFIG_UDP_SOCKET_PKTINFO
+    // If the packet should be sent over a specific interface, or with a specific source
+    // address, construct an IP_PKTINFO/IPV6_PKTINFO "control message" to that effect
+    // add add it to the message header.  If the local OS doesn't support IP_PKTINFO/IPV6_PKTINFO
+    // fail with an error.
+    if (intf.IsPresent() || aPktInfo->SrcAddress.Type() != IPAddressType::kAny)
+    {
+#if defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
+        msgHeader.msg_control    = controlData;
+        msgHeader.msg_controllen = controlDataSize;
+
+        struct cmsghdr * controlHdr      = CMSG_FIRSTHDR(&msgHeader);
+        InterfaceId::PlatformType intfId = intf.GetPlatformInterface();
+
+#if INET_CONFIG_ENABLE_IPV4
+
+        if (addrType == IPAddressType::kIPv4)
+        {
+#if defined(IP_PKTINFO)
+            controlHdr->cmsg_level = IPPROTO_IP;
+            controlHdr->cmsg_type  = IP_PKTINFO;
+            controlHdr->cmsg_len   = CMSG_LEN(sizeof(in_pktinfo));
+
+            auto * pktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
+            if (!CanCastTo<decltype(pktInfo->ipi_ifindex)>(intfId))
+            {
+                return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
+            }
+
+            pktInfo->ipi_ifindex  = static_cast<decltype(pktInfo->ipi_ifindex)>(intfId);
+            pktInfo->ipi_spec_dst = aPktInfo->SrcAddress.ToIPv4();
+
+            msgHeader.msg_controllen = CMSG_SPACE(sizeof(in_pktinfo));
+#else  // !defined(IP_PKTINFO)
+            return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
+#endif // !defined(IP_PKTINFO)
+        }
+
+#endif // INET_CONFIG_ENABLE_IPV4
+
+        if (addrType == IPAddressType::kIPv6)
+        {
+#if defined(IPV6_PKTINFO)
+            controlHdr->cmsg_level = IPPROTO_IPV6;
+            controlHdr->cmsg_type  = IPV6_PKTINFO;
+            controlHdr->cmsg_len   = CMSG_LEN(sizeof(in6_pktinfo));
+
+            auto * pktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
+            if (!CanCastTo<decltype(pktInfo->ipi6_ifindex)>(intfId))
+            {
+                return CHIP_ERROR_UNEXPECTED_EVENT;
+            }
+            pktInfo->ipi6_ifindex = static_cast<decltype(pktInfo->ipi6_ifindex)>(intfId);
+            pktInfo->ipi6_addr    = aPktInfo->SrcAddress.ToIPv6();
+
+            msgHeader.msg_controllen = CMSG_SPACE(sizeof(in6_pktinfo));
+#else  // !defined(IPV6_PKTINFO)
+            return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
+#endif // !defined(IPV6_PKTINFO)
+        }
+
+#else  // !(defined(IP_PKTINFO) && defined(IPV6_PKTINFO))
+        return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
+#endif // !(defined(IP_PKTINFO) && defined(IPV6_PKTINFO))
+    }
+#endif // INET_CONFIG_UDP_SOCKET_PKTINFO
+
+    return CHIP_NO_ERROR;
+}
+
+/**
+ * Fill in the source of a received datagram, and its destination and arrival interface when IP_PKTINFO/IPV6_PKTINFO control
+ * messages were delivered with it, from the header recvmsg() or recvmmsg() returned for it.
+ */
+CHIP_ERROR ParseReceivedPacketInfo(struct msghdr & msgHeader, IPPacketInfo & packetInfo)
+{
+    const auto * peerSockAddr = static_cast<const SockAddr *>(msgHeader.msg_name);
+    if (peerSockAddr->any.sa_family == AF_INET6)
+    {
+        packetInfo.SrcAddress = IPAddress(peerSockAddr->in6.sin6_addr);
+        packetInfo.SrcPort    = ntohs(peerSockAddr->in6.sin6_port);
+    }
+#if INET_CONFIG_ENABLE_IPV4
+    else if (peerSockAddr->any.sa_family == AF_INET)
+    {
+        packetInfo.SrcAddress = IPAddress(peerSockAddr->in.sin_addr);
+        packetInfo.SrcPort    = ntohs(peerSockAddr->in.sin_port);
+    }
+#endif // INET_CONFIG_ENABLE_IPV4
+    else
+    {
+        return CHIP_ERROR_INCORRECT_STATE;
+    }
+
+    for (struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&msgHeader); controlHdr != nullptr;
+         controlHdr                  = CMSG_NXTHDR(&msgHeader, controlHdr))
+    {
+#if INET_CONFIG_ENABLE_IPV4
+#ifdef IP_PKTINFO
+        if (controlHdr->cmsg_level == IPPROTO_IP && controlHdr->cmsg_type == IP_PKTINFO)
+        {
+            auto * inPktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
+            VerifyOrReturnError(CanCastTo<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex), CHIP_ERROR_INCORRECT_STATE);
+            packetInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex));
+            packetInfo.DestAddress = IPAddress(inPktInfo->ipi_addr);
+            continue;
+        }
+#endif // defined(IP_PKTINFO)
+#endif // INET_CONFIG_ENABLE_IPV4
+
+#ifdef IPV6_PKTINFO
+        if (controlHdr->cmsg_level == IPPROTO_IPV6 && controlHdr->cmsg_type == IPV6_PKTINFO)
+        {
+            auto * in6PktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
+            VerifyOrReturnError(CanCastTo<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex), CHIP_ERROR_INCORRECT_STATE);
+            packetInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex));
+            packetInfo.DestAddress = IPAddress(in6PktInfo->ipi6_addr);
+            continue;
+        }
+#endif // defined(IPV6_PKTINFO)
+    }
+
+    return CHIP_NO_ERROR;
+}
+
 } // anonymous namespace
 
 #if CHIP_SYSTEM_CONFIG_USE_PLATFORM_MULTICAST_API
@@ -292,122 +468,15 @@ CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, Sy
     // For now the entire message must fit within a single buffer.
     VerifyOrReturnError(!msg->HasChainedBuffer(), CHIP_ERROR_MESSAGE_TOO_LONG);
 
+#if INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1
+    return QueueSend(aPktInfo, std::move(msg));
+#else  // INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1
     struct iovec msgIOV;
-    msgIOV.iov_base = msg->Start();
-    msgIOV.iov_len  = msg->DataLength();
-
-#if defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
+    SockAddrWithoutStorage peerSockAddr;
     uint8_t controlData[256];
-    memset(controlData, 0, sizeof(controlData));
-#endif // defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
-
     struct msghdr msgHeader;
-    memset(&msgHeader, 0, sizeof(msgHeader));
-    msgHeader.msg_iov    = &msgIOV;
-    msgHeader.msg_iovlen = 1;
-
-    // Construct a sockaddr_in/sockaddr_in6 structure containing the destination information.
-    SockAddr peerSockAddr;
-    memset(&peerSockAddr, 0, sizeof(peerSockAddr));
-    msgHeader.msg_name = &peerSockAddr;
-    if (mAddrType == IPAddressType::kIPv6)
-    {
-        peerSockAddr.in6.sin6_family     = AF_INET6;
-        peerSockAddr.in6.sin6_port       = htons(aPktInfo->DestPort);
-        peerSockAddr.in6.sin6_addr       = aPktInfo->DestAddress.ToIPv6();
-        InterfaceId::PlatformType intfId = aPktInfo->Interface.GetPlatformInterface();
-        VerifyOrReturnError(CanCastTo<decltype(peerSockAddr.in6.sin6_scope_id)>(intfId), CHIP_ERROR_INCORRECT_STATE);
-        peerSockAddr.in6.sin6_scope_id = static_cast<decltype(peerSockAddr.in6.sin6_scope_id)>(intfId);
-        msgHeader.msg_namelen          = sizeof(sockaddr_in6);
-    }
-#if INET_CONFIG_ENABLE_IPV4
-    else
-    {
-        peerSockAddr.in.sin_family = AF_INET;
-        peerSockAddr.in.sin_port   = htons(aPktInfo->DestPort);
-        peerSockAddr.in.sin_addr   = aPktInfo->DestAddress.ToIPv4();
-        msgHeader.msg_namelen      = sizeof(sockaddr_in);
-    }
-#endif // INET_CONFIG_ENABLE_IPV4
-
-    // If the endpoint has been bound to a particular interface,
-    // and the caller didn't supply a specific interface to send
-    // on, use the bound interface. This appears to be necessary
-    // for messages to multicast addresses, which under Linux
-    // don't seem to get sent out the correct interface, despite
-    // the socket being bound.
-    InterfaceId intf = aPktInfo->Interface;
-    if (!intf.IsPresent())
-    {
-        intf = mBoundIntfId;
-    }
-
-#if INET_CONFIG_UDP_SOCKET_PKTINFO
-    // If the packet should be sent over a specific interface, or with a specific source
-    // address, construct an IP_PKTINFO/IPV6_PKTINFO "control message" to that effect
-    // add add it to the message header.  If the local OS doesn't support IP_PKTINFO/IPV6_PKTINFO
-    // fail with an error.
-    if (intf.IsPresent() || aPktInfo->SrcAddress.Type() != IPAddressType::kAny)
-    {
-#if defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
-        msgHeader.msg_control    = controlData;
-        msgHeader.msg_controllen = sizeof(controlData);
-
-        struct cmsghdr * controlHdr      = CMSG_FIRSTHDR(&msgHeader);
-        InterfaceId::PlatformType intfId = intf.GetPlatformInterface();
-
-#if INET_CONFIG_ENABLE_IPV4
-
-        if (mAddrType == IPAddressType::kIPv4)
-        {
-#if defined(IP_PKTINFO)
-            controlHdr->cmsg_level = IPPROTO_IP;
-            controlHdr->cmsg_type  = IP_PKTINFO;
-            controlHdr->cmsg_len   = CMSG_LEN(sizeof(in_pktinfo));
-
-            auto * pktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
-            if (!CanCastTo<decltype(pktInfo->ipi_ifindex)>(intfId))
-            {
-                return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
-            }
-
-            pktInfo->ipi_ifindex  = static_cast<decltype(pktInfo->ipi_ifindex)>(intfId);
-            pktInfo->ipi_spec_dst = aPktInfo->SrcAddress.ToIPv4();
-
-            msgHeader.msg_controllen = CMSG_SPACE(sizeof(in_pktinfo));
-#else  // !defined(IP_PKTINFO)
-            return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
-#endif // !defined(IP_PKTINFO)
-        }
-
-#endif // INET_CONFIG_ENABLE_IPV4
-
-        if (mAddrType == IPAddressType::kIPv6)
-        {
-#if defined(IPV6_PKTINFO)
-            controlHdr->cmsg_level = IPPROTO_IPV6;
-            controlHdr->cmsg_type  = IPV6_PKTINFO;
-            controlHdr->cmsg_len   = CMSG_LEN(sizeof(in6_pktinfo));
-
-            auto * pktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
-            if (!CanCastTo<decltype(pktInfo->ipi6_ifindex)>(intfId))
-            {
-                return CHIP_ERROR_UNEXPECTED_EVENT;
-            }
-            pktInfo->ipi6_ifindex = static_cast<decltype(pktInfo->ipi6_ifindex)>(intfId);
-            pktInfo->ipi6_addr    = aPktInfo->SrcAddress.ToIPv6();
-
-            msgHeader.msg_controllen = CMSG_SPACE(sizeof(in6_pktinfo));
-#else  // !defined(IPV6_PKTINFO)
-            return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
-#endif // !defined(IPV6_PKTINFO)
-        }
-
-#else  // !(defined(IP_PKTINFO) && defined(IPV6_PKTINFO))
-        return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
-#endif // !(defined(IP_PKTINFO) && defined(IPV6_PKTINFO))
-    }
-#endif // INET_CONFIG_UDP_SOCKET_PKTINFO
+    ReturnErrorOnFailure(PrepareSendHeader(mAddrType, mBoundIntfId, aPktInfo, msg, msgHeader, msgIOV, peerSockAddr, controlData,
+                                           sizeof(controlData)));
 
     // Send IP packet.
     // NOLINTNEXTLINE(clang-analyzer-unix.StdCLibraryFunctions): GetSocket calls ensure mSocket is valid
@@ -424,16 +493,33 @@ CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, Sy
         return CHIP_ERROR_OUTBOUND_MESSAGE_TOO_BIG;
     }
     return CHIP_NO_ERROR;
+#endif // INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1
 }
 
 void UDPEndPointImplSockets::CloseImpl()
 {
     if (mSocket != kInvalidSocketFd)
     {
+#if INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1
+        // Give queued datagrams a last chance to go out; whatever the socket cannot take right away is dropped below.
+        FlushPendingSends();
+#endif // INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1
         TEMPORARY_RETURN_IGNORED static_cast<System::LayerSockets *>(&GetSystemLayer())->StopWatchingSocket(&mWatch);
         close(mSocket);
         mSocket = kInvalidSocketFd;
     }
+
+#if INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1
+    for (size_t i = 0; i < mPendingSendCount; i++)
+    {
+        mPendingSends[i].mMessage = nullptr;
+    }
+    mPendingSendCount = 0;
+    for (auto & buffer : mReceiveBuffers)
+    {
+        buffer = nullptr;
+    }
+#endif // INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1
 }
 
 CHIP_ERROR UDPEndPointImplSockets::GetSocket(IPAddressType addressType)
@@ -569,6 +655,13 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events, intptr
 
 void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
 {
+#if INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1
+    if (events.Has(System::SocketEventFlags::kWrite))
+    {
+        FlushPendingSends();
+    }
+#endif // INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1
+
     if (mState != State::kListening || OnMessageReceived == nullptr || !events.Has(System::SocketEventFlags::kRead))
     {
         return;
@@ -576,6 +669,10 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
 
     // Prevent the endpoint from being freed while in the middle of a callback.
     UDPEndPointHandle ref(this);
+
+#if INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1
+    ReceiveBatch();
+#else  // INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1
     CHIP_ERROR lStatus = CHIP_NO_ERROR;
     IPPacketInfo lPacketInfo;
     System::PacketBufferHandle lBuffer;
@@ -620,82 +717,240 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
         else
         {
             lBuffer->SetDataLength(static_cast<uint16_t>(rcvLen));
+            lStatus = ParseReceivedPacketInfo(msgHeader, lPacketInfo);
+        }
+    }
+    else
+    {
+        lStatus = CHIP_ERROR_NO_MEMORY;
+    }
 
-            if (lPeerSockAddr.any.sa_family == AF_INET6)
-            {
-                lPacketInfo.SrcAddress = IPAddress(lPeerSockAddr.in6.sin6_addr);
-                lPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in6.sin6_port);
-            }
-#if INET_CONFIG_ENABLE_IPV4
-            else if (lPeerSockAddr.any.sa_family == AF_INET)
-            {
-                lPacketInfo.SrcAddress = IPAddress(lPeerSockAddr.in.sin_addr);
-                lPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in.sin_port);
-            }
-#endif // INET_CONFIG_ENABLE_IPV4
-            else
+    if (lStatus == CHIP_NO_ERROR)
+    {
+        lBuffer.RightSize();
+        OnMessageReceived(this, std::move(lBuffer), &lPacketInfo);
+    }
+    else
+    {
+        if (OnReceiveError != nullptr && lStatus != CHIP_ERROR_POSIX(EAGAIN))
+        {
+            OnReceiveError(this, lStatus, nullptr);
+        }
+    }
+#endif // INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1
+}
+
+#if INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1
+void UDPEndPointImplSockets::ReceiveBatch()
+{
+    constexpr size_t kBatchSize = INET_CONFIG_UDP_SOCKET_BATCH_SIZE;
+    struct mmsghdr msgHeaders[kBatchSize];
+    struct iovec msgIOVs[kBatchSize];
+    SockAddr peerSockAddrs[kBatchSize];
+    uint8_t controlData[kBatchSize][256];
+    size_t bufferIndices[kBatchSize];
+    unsigned int count = 0;
+
+    memset(msgHeaders, 0, sizeof(msgHeaders));
+    memset(peerSockAddrs, 0, sizeof(peerSockAddrs));
+    memset(controlData, 0, sizeof(controlData));
+
+    // Buffers left over from the previous wakeup are reused; only those handed to OnMessageReceived need replacing.
+    for (size_t i = 0; i < kBatchSize; i++)
+    {
+        System::PacketBufferHandle & buffer = mReceiveBuffers[i];
+        if (buffer.IsNull())
+        {
+            buffer = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSizeWithoutReserve, 0);
+            if (buffer.IsNull())
             {
-                lStatus = CHIP_ERROR_INCORRECT_STATE;
+                continue;
             }
         }
 
+        msgIOVs[count].iov_base = buffer->Start();
+        msgIOVs[count].iov_len  = buffer->AvailableDataLength();
+
+        struct msghdr & msgHeader = msgHeaders[count].msg_hdr;
+        msgHeader.msg_name        = &peerSockAddrs[count];
+        msgHeader.msg_namelen     = sizeof(peerSockAddrs[count]);
+        msgHeader.msg_iov         = &msgIOVs[count];
+        msgHeader.msg_iovlen      = 1;
+        msgHeader.msg_control     = controlData[count];
+        msgHeader.msg_controllen  = sizeof(controlData[count]);
+
+        bufferIndices[count++] = i;
+    }
+
+    if (count == 0)
+    {
+        if (OnReceiveError != nullptr)
+        {
+            OnReceiveError(this, CHIP_ERROR_NO_MEMORY, nullptr);
+        }
+        return;
+    }
+
+    const int received = recvmmsg(mSocket, msgHeaders, count, MSG_DONTWAIT, nullptr);
+    if (received == -1)
+    {
+        const CHIP_ERROR lStatus = CHIP_ERROR_POSIX(errno);
+        if (OnReceiveError != nullptr && lStatus != CHIP_ERROR_POSIX(EAGAIN))
+        {
+            OnReceiveError(this, lStatus, nullptr);
+        }
+        return;
+    }
+
+    for (unsigned int i = 0; i < static_cast<unsigned int>(received); i++)
+    {
+        // A callback may have closed the endpoint, which also released the receive buffers.
+        if (mState != State::kListening || OnMessageReceived == nullptr)
+        {
+            return;
+        }
+
+        System::PacketBufferHandle & buffer = mReceiveBuffers[bufferIndices[i]];
+        CHIP_ERROR lStatus                  = CHIP_NO_ERROR;
+        IPPacketInfo lPacketInfo;
+
+        lPacketInfo.Clear();
+        lPacketInfo.DestPort  = mBoundPort;
+        lPacketInfo.Interface = mBoundIntfId;
+
+        if (buffer->AvailableDataLength() < msgHeaders[i].msg_len)
+        {
+            lStatus = CHIP_ERROR_INBOUND_MESSAGE_TOO_BIG;
+        }
+        else
+        {
+            buffer->SetDataLength(static_cast<uint16_t>(msgHeaders[i].msg_len));
+            lStatus = ParseReceivedPacketInfo(msgHeaders[i].msg_hdr, lPacketInfo);
+        }
+
         if (lStatus == CHIP_NO_ERROR)
         {
-            for (struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&msgHeader); controlHdr != nullptr;
-                 controlHdr                  = CMSG_NXTHDR(&msgHeader, controlHdr))
+            System::PacketBufferHandle lBuffer = std::move(buffer);
+            lBuffer.RightSize();
+            OnMessageReceived(this, std::move(lBuffer), &lPacketInfo);
+        }
+        else
+        {
+            // Keep the buffer for the next wakeup.
+            buffer->SetDataLength(0);
+            if (OnReceiveError != nullptr)
             {
-#if INET_CONFIG_ENABLE_IPV4
-#ifdef IP_PKTINFO
-                if (controlHdr->cmsg_level == IPPROTO_IP && controlHdr->cmsg_type == IP_PKTINFO)
-                {
-                    auto * inPktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
-                    if (!CanCastTo<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex))
-                    {
-                        lStatus = CHIP_ERROR_INCORRECT_STATE;
-                        break;
-                    }
-                    lPacketInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex));
-                    lPacketInfo.DestAddress = IPAddress(inPktInfo->ipi_addr);
-                    continue;
-                }
-#endif // defined(IP_PKTINFO)
-#endif // INET_CONFIG_ENABLE_IPV4
+                OnReceiveError(this, lStatus, nullptr);
+            }
+        }
+    }
+}
 
+CHIP_ERROR UDPEndPointImplSockets::QueueSend(const IPPacketInfo * aPktInfo, System::PacketBufferHandle && msg)
+{
 #ifdef IPV6_PKTINFO
-                if (controlHdr->cmsg_level == IPPROTO_IPV6 && controlHdr->cmsg_type == IPV6_PKTINFO)
-                {
-                    auto * in6PktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
-                    if (!CanCastTo<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex))
-                    {
-                        lStatus = CHIP_ERROR_INCORRECT_STATE;
-                        break;
-                    }
-                    lPacketInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex));
-                    lPacketInfo.DestAddress = IPAddress(in6PktInfo->ipi6_addr);
-                    continue;
-                }
+    static_assert(kSendControlDataSize >= CMSG_SPACE(sizeof(in6_pktinfo)), "No room for an IPV6_PKTINFO control message");
 #endif // defined(IPV6_PKTINFO)
-            }
-        }
+
+    if (mPendingSendCount == MATTER_ARRAY_SIZE(mPendingSends))
+    {
+        // The event loop has not found the socket writable since the queue filled up; make room right away.
+        FlushPendingSends();
+        VerifyOrReturnError(mPendingSendCount < MATTER_ARRAY_SIZE(mPendingSends), CHIP_ERROR_POSIX(EAGAIN));
     }
-    else
+
+    PendingSend & pending = mPendingSends[mPendingSendCount];
+    struct iovec msgIOV;
+    struct msghdr msgHeader;
+    ReturnErrorOnFailure(PrepareSendHeader(mAddrType, mBoundIntfId, aPktInfo, msg, msgHeader, msgIOV, pending.mPeerSockAddr,
+                                           pending.mControlData, sizeof(pending.mControlData)));
+
+    // Send once the socket is writable, together with whatever else gets queued until then.
+    auto * layer = static_cast<System::LayerSockets *>(&GetSystemLayer());
+    ReturnErrorOnFailure(layer->SetCallback(mWatch, HandlePendingIO, reinterpret_cast<intptr_t>(this)));
+    ReturnErrorOnFailure(layer->RequestCallbackOnPendingWrite(mWatch));
+
+    pending.mPeerSockAddrLen = static_cast<uint32_t>(msgHeader.msg_namelen);
+    pending.mControlDataLen  = (msgHeader.msg_control != nullptr) ? static_cast<size_t>(msgHeader.msg_controllen) : 0;
+    pending.mMessage         = std::move(msg);
+    mPendingSendCount++;
+
+    return CHIP_NO_ERROR;
+}
+
+void UDPEndPointImplSockets::FlushPendingSends()
+{
+    struct mmsghdr msgHeaders[INET_CONFIG_UDP_SOCKET_BATCH_SIZE];
+    struct iovec msgIOVs[INET_CONFIG_UDP_SOCKET_BATCH_SIZE];
+    size_t done = 0;
+
+    memset(msgHeaders, 0, sizeof(msgHeaders));
+    for (size_t i = 0; i < mPendingSendCount; i++)
     {
-        lStatus = CHIP_ERROR_NO_MEMORY;
+        PendingSend & pending = mPendingSends[i];
+
+        msgIOVs[i].iov_base = pending.mMessage->Start();
+        msgIOVs[i].iov_len  = pending.mMessage->DataLength();
+
+        struct msghdr & msgHeader = msgHeaders[i].msg_hdr;
+        msgHeader.msg_name        = &pending.mPeerSockAddr;
+        msgHeader.msg_namelen     = pending.mPeerSockAddrLen;
+        msgHeader.msg_iov         = &msgIOVs[i];
+        msgHeader.msg_iovlen      = 1;
+        msgHeader.msg_control     = (pending.mControlDataLen != 0) ? pending.mControlData : nullptr;
+        msgHeader.msg_controllen  = pending.mControlDataLen;
     }
 
-    if (lStatus == CHIP_NO_ERROR)
+    while (done < mPendingSendCount)
     {
-        lBuffer.RightSize();
-        OnMessageReceived(this, std::move(lBuffer), &lPacketInfo);
+        // NOLINTNEXTLINE(clang-analyzer-unix.StdCLibraryFunctions): messages are only queued once GetSocket succeeded
+        const int sent = sendmmsg(mSocket, &msgHeaders[done], static_cast<unsigned int>(mPendingSendCount - done), MSG_DONTWAIT);
+        if (sent == -1)
+        {
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+            {
+                // Keep the rest queued until the socket is writable again.
+                break;
+            }
+
+            // sendmmsg() only fails when the first datagram cannot be sent; drop it and carry on with the others.
+            ChipLogError(Inet, "Failed to send queued UDP message: %" CHIP_ERROR_FORMAT, CHIP_ERROR_POSIX(errno).Format());
+            done++;
+            continue;
+        }
+
+        for (size_t i = done; i < done + static_cast<size_t>(sent); i++)
+        {
+            if (msgHeaders[i].msg_len != mPendingSends[i].mMessage->DataLength())
+            {
+                ChipLogError(Inet, "Failed to send queued UDP message: %" CHIP_ERROR_FORMAT,
+                             CHIP_ERROR_OUTBOUND_MESSAGE_TOO_BIG.Format());
+            }
+        }
+        done += static_cast<size_t>(sent);
     }
-    else
+
+    // Release what was sent or dropped, and move what is left to the front of the queue.
+    const size_t remaining = mPendingSendCount - done;
+    if (done > 0)
     {
-        if (OnReceiveError != nullptr && lStatus != CHIP_ERROR_POSIX(EAGAIN))
+        for (size_t i = 0; i < remaining; i++)
         {
-            OnReceiveError(this, lStatus, nullptr);
+            mPendingSends[i] = std::move(mPendingSends[done + i]);
         }
+        for (size_t i = remaining; i < mPendingSendCount; i++)
+        {
+            mPendingSends[i].mMessage = nullptr;
+        }
+    }
+    mPendingSendCount = remaining;
+
+    if (mPendingSendCount == 0)
+    {
+        TEMPORARY_RETURN_IGNORED static_cast<System::LayerSockets *>(&GetSystemLayer())->ClearCallbackOnPendingWrite(mWatch);
     }
 }
+#endif // INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1
 
 #ifdef IPV6_MULTICAST_LOOP
 static CHIP_ERROR SocketsSetMulticastLoopback(int aSocket, bool aLoopback, int aProtocol, int aOption)
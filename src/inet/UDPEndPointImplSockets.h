@@ -60,6 +60,29 @@ private:
     InterfaceId mBoundIntfId;
     uint16_t mBoundPort;
 
+#if INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1
+    static constexpr size_t kSendControlDataSize = 64;
+
+    // A datagram accepted by SendMsgImpl and waiting for the next sendmmsg() call.
+    struct PendingSend
+    {
+        System::PacketBufferHandle mMessage;
+        SockAddrWithoutStorage mPeerSockAddr;
+        uint32_t mPeerSockAddrLen = 0;
+        uint8_t mControlData[kSendControlDataSize];
+        size_t mControlDataLen = 0;
+    };
+
+    CHIP_ERROR QueueSend(const IPPacketInfo * pktInfo, System::PacketBufferHandle && msg);
+    void FlushPendingSends();
+    void ReceiveBatch();
+
+    // Receive buffers are allocated ahead of the next read and only replaced once handed to OnMessageReceived.
+    System::PacketBufferHandle mReceiveBuffers[INET_CONFIG_UDP_SOCKET_BATCH_SIZE];
+    PendingSend mPendingSends[INET_CONFIG_UDP_SOCKET_BATCH_SIZE];
+    size_t mPendingSendCount = 0;
+#endif // INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1
+
 #if CHIP_SYSTEM_CONFIG_USE_PLATFORM_MULTICAST_API
 public:
     enum class MulticastOperation
@@ -89,6 +89,44 @@ public:
     }
 };
 
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS && !CHIP_SYSTEM_CONFIG_USE_DISPATCH
+// Receive side of TestInetUDPLoopbackThroughput.
+struct LoopbackReceiveState
+{
+    IPAddress address;
+    uint16_t senderPort   = 0;
+    uint16_t receiverPort = 0;
+    uint32_t received     = 0;
+    uint32_t mismatched   = 0;
+    uint32_t errors       = 0;
+};
+
+LoopbackReceiveState gLoopbackReceiveState;
+
+void HandleLoopbackMessage(UDPEndPoint * endPoint, PacketBufferHandle && msg, const IPPacketInfo * pktInfo)
+{
+    LoopbackReceiveState & state = gLoopbackReceiveState;
+    uint32_t sequence            = UINT32_MAX;
+
+    // Every datagram carries its sequence number, so drops and reordering show up as mismatches.
+    if (msg->DataLength() == sizeof(sequence))
+    {
+        memcpy(&sequence, msg->Start(), sizeof(sequence));
+    }
+    if (sequence != state.received || pktInfo->SrcAddress != state.address || pktInfo->DestAddress != state.address ||
+        pktInfo->SrcPort != state.senderPort || pktInfo->DestPort != state.receiverPort)
+    {
+        state.mismatched++;
+    }
+    state.received++;
+}
+
+void HandleLoopbackError(UDPEndPoint * endPoint, CHIP_ERROR err, const IPPacketInfo * pktInfo)
+{
+    gLoopbackReceiveState.errors++;
+}
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS && !CHIP_SYSTEM_CONFIG_USE_DISPATCH
+
 // Test before init network, Inet is not initialized
 TEST_F(TestInetEndPoint, TestInetPre)
 {
@@ -248,6 +286,64 @@ TEST_F(TestInetEndPoint, TestInetInterface)
     EXPECT_FALSE(addrIterator.HasBroadcastAddress());
 }
 
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS && !CHIP_SYSTEM_CONFIG_USE_DISPATCH
+// Sends bursts of datagrams over the IPv6 loopback interface, checks that each arrives with its own packet info, and
+// reports the achieved rate, e.g. to compare INET_CONFIG_UDP_SOCKET_BATCH_SIZE settings (gn arg
+// chip_inet_config_udp_socket_batch_size).
+TEST_F(TestInetEndPoint, TestInetUDPLoopbackThroughput)
+{
+    constexpr uint32_t kBurstSize = 64;
+    constexpr uint32_t kBursts    = 100;
+
+    LoopbackReceiveState & state = gLoopbackReceiveState;
+    state                        = LoopbackReceiveState();
+    ASSERT_TRUE(IPAddress::FromString("::1", state.address));
+
+    UDPEndPointHandle receiver;
+    UDPEndPointHandle sender;
+    ASSERT_EQ(gUDP.NewEndPoint(receiver), CHIP_NO_ERROR);
+    ASSERT_EQ(gUDP.NewEndPoint(sender), CHIP_NO_ERROR);
+    if (receiver->Bind(IPAddressType::kIPv6, state.address, 0) != CHIP_NO_ERROR)
+    {
+        GTEST_SKIP() << "Skipping test: no IPv6 loopback interface";
+    }
+    ASSERT_EQ(sender->Bind(IPAddressType::kIPv6, state.address, 0), CHIP_NO_ERROR);
+    ASSERT_EQ(receiver->Listen(HandleLoopbackMessage, HandleLoopbackError), CHIP_NO_ERROR);
+    state.receiverPort = receiver->GetBoundPort();
+    state.senderPort   = sender->GetBoundPort();
+
+    const Clock::Microseconds64 start = SystemClock().GetMonotonicMicroseconds64();
+    uint32_t sent                     = 0;
+    for (uint32_t burst = 0; burst < kBursts; burst++)
+    {
+        for (uint32_t i = 0; i < kBurstSize; i++, sent++)
+        {
+            PacketBufferHandle buf = PacketBufferHandle::NewWithData(&sent, sizeof(sent));
+            ASSERT_FALSE(buf.IsNull());
+            ASSERT_EQ(sender->SendTo(state.address, state.receiverPort, std::move(buf)), CHIP_NO_ERROR);
+        }
+
+        // Loopback delivery is synchronous, so anything still missing after a generous deadline was dropped.
+        const Clock::Microseconds64 deadline = SystemClock().GetMonotonicMicroseconds64() + Clock::Seconds32(5);
+        while (state.received + state.errors < sent && SystemClock().GetMonotonicMicroseconds64() < deadline)
+        {
+            ServiceEvents(0);
+        }
+        ASSERT_EQ(state.received, sent);
+    }
+    const Clock::Microseconds64 elapsed = SystemClock().GetMonotonicMicroseconds64() - start;
+
+    EXPECT_EQ(state.mismatched, 0u);
+    EXPECT_EQ(state.errors, 0u);
+    printf("    UDP loopback: %" PRIu32 " datagrams in %" PRIu64 " us (%" PRIu64 " packets/s, batch size %u)\n", sent,
+           elapsed.count(), elapsed.count() > 0 ? (static_cast<uint64_t>(sent) * 1000000u) / elapsed.count() : 0,
+           static_cast<unsigned>(INET_CONFIG_UDP_SOCKET_BATCH_SIZE));
+
+    receiver.Release();
+    sender.Release();
+}
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS && !CHIP_SYSTEM_CONFIG_USE_DISPATCH
+
 TEST_F(TestInetEndPoint, TestInetEndPointInternal)
 {
     CHIP_ERROR err;
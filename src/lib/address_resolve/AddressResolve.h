@@ -142,6 +142,18 @@ public:
         return *this;
     }
 
+    /// Whether the lookup may complete from records cached by the DNSSD
+    /// resolver, without querying the network. Enabled by default.
+    ///
+    /// Disable this when cached data is suspected to be stale, for example when
+    /// retrying after a failure to reach the node at a previously resolved address.
+    NodeLookupRequest & SetAllowCachedResults(bool value)
+    {
+        mAllowCachedResults = value;
+        return *this;
+    }
+    bool AllowsCachedResults() const { return mAllowCachedResults; }
+
 private:
     static_assert((CHIP_CONFIG_ADDRESS_RESOLVE_MIN_LOOKUP_TIME_MS) <= (CHIP_CONFIG_ADDRESS_RESOLVE_MAX_LOOKUP_TIME_MS),
                   "AddressResolveMinLookupTime must be equal or less than AddressResolveMaxLookupTime");
@@ -155,6 +167,7 @@ private:
     PeerId mPeerId;
     System::Clock::Milliseconds32 mMinLookupTimeMs{ kMinLookupTimeMsDefault };
     System::Clock::Milliseconds32 mMaxLookupTimeMs{ kMaxLookupTimeMsDefault };
+    bool mAllowCachedResults = true;
 };
 
 /// These things are expected to be defined by the implementation header.
@@ -32,9 +32,10 @@ static constexpr System::Clock::Timeout kInvalidTimeout{ System::Clock::Timeout:
 
 void NodeLookupHandle::ResetForLookup(System::Clock::Timestamp now, const NodeLookupRequest & request)
 {
-    mRequestStartTime = now;
-    mRequest          = request;
-    mResults          = NodeLookupResults();
+    mRequestStartTime  = now;
+    mRequest           = request;
+    mResults           = NodeLookupResults();
+    mResolvedFromCache = false;
 }
 
 void NodeLookupHandle::LookupResult(const ResolveResult & result)
@@ -62,10 +63,45 @@ void NodeLookupHandle::LookupResult(const ResolveResult & result)
 #endif
 }
 
+void NodeLookupHandle::LookupResults(const Dnssd::ResolvedNodeData & nodeData)
+{
+    ResolveResult result;
+
+    result.address.SetPort(nodeData.resolutionData.port);
+    result.address.SetInterface(nodeData.resolutionData.interfaceId);
+    result.mrpRemoteConfig   = nodeData.resolutionData.GetRemoteMRPConfig();
+    result.supportsTcpClient = nodeData.resolutionData.supportsTcpClient;
+    result.supportsTcpServer = nodeData.resolutionData.supportsTcpServer;
+
+    if (nodeData.resolutionData.isICDOperatingAsLIT.has_value())
+    {
+        result.isICDOperatingAsLIT = *(nodeData.resolutionData.isICDOperatingAsLIT);
+    }
+
+    for (size_t i = 0; i < nodeData.resolutionData.numIPs; i++)
+    {
+#if !INET_CONFIG_ENABLE_IPV4
+        if (!nodeData.resolutionData.ipAddress[i].IsIPv6())
+        {
+            ChipLogError(Discovery, "Skipping IPv4 address during operational resolve.");
+            continue;
+        }
+#endif
+        result.address.SetIPAddress(nodeData.resolutionData.ipAddress[i]);
+        LookupResult(result);
+    }
+}
+
 System::Clock::Timeout NodeLookupHandle::NextEventTimeout(System::Clock::Timestamp now)
 {
     const System::Clock::Timestamp elapsed = now - mRequestStartTime;
 
+    if (mResolvedFromCache && HasLookupResult())
+    {
+        // Nothing more to wait for: report the cached result right away.
+        return System::Clock::Timeout::zero();
+    }
+
     if (elapsed < mRequest.GetMinLookupTime())
     {
         return mRequest.GetMinLookupTime() - elapsed;
@@ -104,8 +140,9 @@ NodeLookupAction NodeLookupHandle::NextAction(System::Clock::Timestamp now)
     ChipLogProgress(Discovery, "Checking node lookup status for " ChipLogFormatPeerId " after %lu ms",
                     ChipLogValuePeerId(mRequest.GetPeerId()), static_cast<unsigned long>(elapsed.count()));
 
-    // We are still within the minimal search time. Wait for more results.
-    if (elapsed < mRequest.GetMinLookupTime())
+    // We are still within the minimal search time. Wait for more results,
+    // unless the results are already all that is known from the record cache.
+    if ((elapsed < mRequest.GetMinLookupTime()) && !mResolvedFromCache)
     {
         ChipLogProgress(Discovery, "Keeping DNSSD lookup active");
         return NodeLookupAction::KeepSearching();
@@ -206,10 +243,27 @@ CHIP_ERROR Resolver::LookupNode(const NodeLookupRequest & request, Impl::NodeLoo
 
     handle.ResetForLookup(mTimeSource.GetMonotonicTimestamp(), request);
     auto & peerId = request.GetPeerId();
-    ReturnErrorOnFailure(Dnssd::Resolver::Instance().ResolveNodeId(peerId));
+
+    Dnssd::ResolvedNodeData cachedData;
+    if (request.AllowsCachedResults() && (Dnssd::Resolver::Instance().ResolveNodeIdFromCache(peerId, cachedData) == CHIP_NO_ERROR))
+    {
+        handle.LookupResults(cachedData);
+    }
+
+    if (handle.HasLookupResult())
+    {
+        // No DNSSD resolve needed. The result is reported from the timer, as
+        // listeners do not expect to be called from within LookupNode.
+        handle.MarkResolvedFromCache();
+    }
+    else
+    {
+        ReturnErrorOnFailure(Dnssd::Resolver::Instance().ResolveNodeId(peerId));
+    }
     mActiveLookups.PushBack(&handle);
     ReArmTimer();
-    ChipLogProgress(Discovery, "Lookup started for " ChipLogFormatPeerId, ChipLogValuePeerId(peerId));
+    ChipLogProgress(Discovery, "Lookup started for " ChipLogFormatPeerId "%s", ChipLogValuePeerId(peerId),
+                    handle.IsResolvedFromCache() ? " (resolved from cache)" : "");
     return CHIP_NO_ERROR;
 }
 
@@ -232,7 +286,10 @@ CHIP_ERROR Resolver::CancelLookup(Impl::NodeLookupHandle & handle, FailureCallba
 {
     VerifyOrReturnError(handle.IsActive(), CHIP_ERROR_INVALID_ARGUMENT);
     mActiveLookups.Remove(&handle);
-    Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(handle.GetRequest().GetPeerId());
+    if (!handle.IsResolvedFromCache())
+    {
+        Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(handle.GetRequest().GetPeerId());
+    }
 
     // Adjust any timing updates.
     ReArmTimer();
@@ -271,14 +328,18 @@ void Resolver::Shutdown()
     {
         auto current = mActiveLookups.begin();
 
-        const PeerId peerId     = current->GetRequest().GetPeerId();
-        NodeListener * listener = current->GetListener();
+        const PeerId peerId          = current->GetRequest().GetPeerId();
+        NodeListener * listener      = current->GetListener();
+        const bool resolvedFromCache = current->IsResolvedFromCache();
 
         mActiveLookups.Erase(current);
 
         MATTER_LOG_NODE_DISCOVERY_FAILED(&peerId, CHIP_ERROR_SHUT_DOWN);
 
-        Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(peerId);
+        if (!resolvedFromCache)
+        {
+            Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(peerId);
+        }
         // Failure callback only called after iterator was cleared:
         // This allows failure handlers to deallocate structures that may
         // contain the active lookup data as a member (intrusive lists members)
@@ -305,32 +366,7 @@ void Resolver::OnOperationalNodeResolved(const Dnssd::ResolvedNodeData & nodeDat
             continue;
         }
 
-        ResolveResult result;
-
-        result.address.SetPort(nodeData.resolutionData.port);
-        result.address.SetInterface(nodeData.resolutionData.interfaceId);
-        result.mrpRemoteConfig   = nodeData.resolutionData.GetRemoteMRPConfig();
-        result.supportsTcpClient = nodeData.resolutionData.supportsTcpClient;
-        result.supportsTcpServer = nodeData.resolutionData.supportsTcpServer;
-
-        if (nodeData.resolutionData.isICDOperatingAsLIT.has_value())
-        {
-            result.isICDOperatingAsLIT = *(nodeData.resolutionData.isICDOperatingAsLIT);
-        }
-
-        for (size_t i = 0; i < nodeData.resolutionData.numIPs; i++)
-        {
-#if !INET_CONFIG_ENABLE_IPV4
-            if (!nodeData.resolutionData.ipAddress[i].IsIPv6())
-            {
-                ChipLogError(Discovery, "Skipping IPv4 address during operational resolve.");
-                continue;
-            }
-#endif
-            result.address.SetIPAddress(nodeData.resolutionData.ipAddress[i]);
-            current->LookupResult(result);
-        }
-
+        current->LookupResults(nodeData);
         HandleAction(current);
     }
 
@@ -348,11 +384,15 @@ void Resolver::HandleAction(IntrusiveList<NodeLookupHandle>::Iterator & current)
     }
 
     // final result, handle either success or failure
-    const PeerId peerId     = current->GetRequest().GetPeerId();
-    NodeListener * listener = current->GetListener();
+    const PeerId peerId          = current->GetRequest().GetPeerId();
+    NodeListener * listener      = current->GetListener();
+    const bool resolvedFromCache = current->IsResolvedFromCache();
     mActiveLookups.Erase(current);
 
-    Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(peerId);
+    if (!resolvedFromCache)
+    {
+        Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(peerId);
+    }
 
     // ensure action is taken AFTER the current current lookup is marked complete
     // This allows failure handlers to deallocate structures that may
@@ -394,8 +434,9 @@ void Resolver::OnOperationalNodeResolutionFailed(const PeerId & peerId, CHIP_ERR
     {
         auto current = it;
         it++;
-        if (current->GetRequest().GetPeerId() != peerId)
+        if ((current->GetRequest().GetPeerId() != peerId) || current->IsResolvedFromCache())
         {
+            // Lookups resolved from cache did not start the failed resolve
             continue;
         }
 
@@ -444,13 +485,17 @@ void Resolver::ReArmTimer()
         auto it = mActiveLookups.begin();
         while (it != mActiveLookups.end())
         {
-            const PeerId peerId     = it->GetRequest().GetPeerId();
-            NodeListener * listener = it->GetListener();
+            const PeerId peerId          = it->GetRequest().GetPeerId();
+            NodeListener * listener      = it->GetListener();
+            const bool resolvedFromCache = it->IsResolvedFromCache();
 
             mActiveLookups.Erase(it);
             it = mActiveLookups.begin();
 
-            Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(peerId);
+            if (!resolvedFromCache)
+            {
+                Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(peerId);
+            }
             // Callback only called after active lookup is cleared
             // This allows failure handlers to deallocate structures that may
             // contain the active lookup data as a member (intrusive lists members)
@@ -136,6 +136,15 @@ public:
     /// Mark that a specific IP address has been found
     void LookupResult(const ResolveResult & result);
 
+    /// Mark all IP addresses of the given resolution data as found
+    void LookupResults(const Dnssd::ResolvedNodeData & nodeData);
+
+    /// Mark that results came from the DNSSD record cache rather than from an
+    /// active DNSSD resolve. Such lookups complete without waiting for the
+    /// minimum lookup time.
+    void MarkResolvedFromCache() { mResolvedFromCache = true; }
+    bool IsResolvedFromCache() const { return mResolvedFromCache; }
+
     /// Called after timeouts or after a series of IP addresses have been
     /// marked as found.
     ///
@@ -161,6 +170,7 @@ private:
     NodeLookupResults mResults;
     NodeLookupRequest mRequest; // active request to process
     System::Clock::Timestamp mRequestStartTime;
+    bool mResolvedFromCache = false;
 };
 
 class Resolver : public ::chip::AddressResolve::Resolver, public Dnssd::OperationalResolveDelegate
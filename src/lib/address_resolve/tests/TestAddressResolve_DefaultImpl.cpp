@@ -529,7 +529,17 @@ public:
     bool IsInitialized() override { return true; }
     void Shutdown() override {}
     void SetOperationalDelegate(OperationalResolveDelegate * delegate) override {}
-    CHIP_ERROR ResolveNodeId(const PeerId & peerId) override { return ResolveNodeIdStatus; }
+    CHIP_ERROR ResolveNodeId(const PeerId & peerId) override
+    {
+        ResolveNodeIdCalls++;
+        return ResolveNodeIdStatus;
+    }
+    CHIP_ERROR ResolveNodeIdFromCache(const PeerId & peerId, Dnssd::ResolvedNodeData & nodeData) override
+    {
+        VerifyOrReturnError(CachedNodeData.has_value(), CHIP_ERROR_NOT_FOUND);
+        nodeData = *CachedNodeData;
+        return CHIP_NO_ERROR;
+    }
     void NodeIdResolutionNoLongerNeeded(const PeerId & peerId) override {}
     CHIP_ERROR StartDiscovery(DiscoveryType type, DiscoveryFilter filter, DiscoveryContext &) override
     {
@@ -546,6 +556,8 @@ public:
     CHIP_ERROR InitStatus                  = CHIP_NO_ERROR;
     CHIP_ERROR ResolveNodeIdStatus         = CHIP_NO_ERROR;
     CHIP_ERROR DiscoverCommissionersStatus = CHIP_NO_ERROR;
+    std::optional<Dnssd::ResolvedNodeData> CachedNodeData;
+    unsigned ResolveNodeIdCalls = 0;
 };
 
 class TestAddressResolveDefaultImplWithSystemLayer : public ::testing::Test
@@ -835,6 +847,67 @@ TEST_F(TestAddressResolveDefaultImplWithSystemLayerAndNodeListener,
     EXPECT_EQ(expectedError, CHIP_ERROR_TIMEOUT);
 }
 
+TEST_F(TestAddressResolveDefaultImplWithSystemLayerAndNodeListener, LookupCompletesFromResolverCache)
+{
+    chip::Dnssd::Resolver::SetInstance(mockResolver);
+
+    chip::AddressResolve::Impl::Resolver resolver;
+    ASSERT_EQ(resolver.Init(&mSystemLayer), CHIP_NO_ERROR);
+
+    System::Clock::Internal::RAIIMockClock clock;
+
+    auto request = NodeLookupRequest(chip::PeerId(1, 2));
+    request.SetMinLookupTime(100_ms32);
+    request.SetMaxLookupTime(200_ms32);
+
+    const Transport::PeerAddress address = GetAddressWithLowScore();
+
+    Dnssd::ResolvedNodeData cachedData;
+    cachedData.resolutionData.numIPs       = 1;
+    cachedData.resolutionData.ipAddress[0] = address.GetIPAddress();
+    cachedData.resolutionData.interfaceId  = address.GetInterface();
+    cachedData.resolutionData.port         = address.GetPort();
+    cachedData.operationalData.peerId      = request.GetPeerId();
+    mockResolver.CachedNodeData            = cachedData;
+
+    std::optional<System::Clock::Timeout> timerDelay;
+    System::TimerCompleteCallback timerCallback = nullptr;
+    void * timerContext                         = nullptr;
+    mSystemLayer.mStartTimerCallback            = [&](auto delay, auto callback, auto * context) {
+        timerDelay    = delay;
+        timerCallback = callback;
+        timerContext  = context;
+        return CHIP_NO_ERROR;
+    };
+
+    std::optional<ResolveResult> resolvedResult;
+    mNodeListener.SetOnNodeAddressResolved(
+        [&resolvedResult](const chip::PeerId & peerId, const chip::AddressResolve::ResolveResult & result) {
+            resolvedResult = result;
+        });
+
+    AddressResolve::NodeLookupHandle handle;
+    handle.SetListener(&mNodeListener);
+    EXPECT_SUCCESS(resolver.LookupNode(request, handle));
+
+    // No DNSSD query and no waiting for the min lookup time, however the
+    // listener is only called from the timer.
+    EXPECT_EQ(mockResolver.ResolveNodeIdCalls, 0u);
+    EXPECT_EQ(timerDelay, std::make_optional<System::Clock::Timeout>(System::Clock::Timeout::zero()));
+    EXPECT_FALSE(resolvedResult.has_value());
+
+    ASSERT_NE(timerCallback, nullptr);
+    timerCallback(&mSystemLayer, timerContext);
+    ASSERT_TRUE(resolvedResult.has_value());
+    EXPECT_EQ(resolvedResult->address, address);
+
+    // Lookups that do not allow cached results query the network
+    request.SetAllowCachedResults(false);
+    EXPECT_SUCCESS(resolver.LookupNode(request, handle));
+    EXPECT_EQ(mockResolver.ResolveNodeIdCalls, 1u);
+    EXPECT_SUCCESS(resolver.CancelLookup(handle, Resolver::FailureCallback::Skip));
+}
+
 TEST_F(TestAddressResolveDefaultImplWithSystemLayerAndNodeListener, ResolverShutsDownAndClearsAllPendingLookups)
 {
     chip::AddressResolve::Impl::Resolver resolver;
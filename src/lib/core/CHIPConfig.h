@@ -764,6 +764,26 @@
 #define CHIP_CONFIG_MAX_TRACING_BACKENDS 4
 #endif
 
+/**
+ * @def CHIP_CONFIG_TRACING_HISTOGRAM_MAX_METRICS
+ *
+ * @brief The number of distinct metric keys the histogram tracing backend
+ * aggregates. Each one uses a fixed size histogram of a little under 2KB.
+ */
+#ifndef CHIP_CONFIG_TRACING_HISTOGRAM_MAX_METRICS
+#define CHIP_CONFIG_TRACING_HISTOGRAM_MAX_METRICS 16
+#endif
+
+/**
+ * @def CHIP_CONFIG_TRACING_HISTOGRAM_MAX_PENDING_BEGINS
+ *
+ * @brief The number of metric begin events per key the histogram tracing
+ * backend remembers until their matching end event.
+ */
+#ifndef CHIP_CONFIG_TRACING_HISTOGRAM_MAX_PENDING_BEGINS
+#define CHIP_CONFIG_TRACING_HISTOGRAM_MAX_PENDING_BEGINS 4
+#endif
+
 /**
  * @def CHIP_CONFIG_UNAUTHENTICATED_CONNECTION_POOL_SIZE
  *
@@ -821,6 +841,21 @@
 #define CHIP_CONFIG_SECURE_SESSION_POOL_SIZE (CHIP_CONFIG_MAX_FABRICS * 3 + 2)
 #endif // CHIP_CONFIG_SECURE_SESSION_POOL_SIZE
 
+/**
+ * @def CHIP_CONFIG_AES_CCM_CONTEXT_CACHE_SIZE
+ *
+ * @brief Maximum number of session keys for which the OpenSSL and BoringSSL
+ * crypto backends keep an AES-CCM context with the key already expanded, so
+ * that encrypting or decrypting a message only sets its nonce and AAD.
+ *
+ * Every secure session has an encryption and a decryption key.  Keys beyond
+ * this limit still work, but set up a new context for every message.  Set to 0
+ * to disable the cache.
+ */
+#ifndef CHIP_CONFIG_AES_CCM_CONTEXT_CACHE_SIZE
+#define CHIP_CONFIG_AES_CCM_CONTEXT_CACHE_SIZE (2 * CHIP_CONFIG_SECURE_SESSION_POOL_SIZE)
+#endif // CHIP_CONFIG_AES_CCM_CONTEXT_CACHE_SIZE
+
 /**
  *  @def CHIP_CONFIG_MAX_GROUP_DATA_PEERS
  *
@@ -956,6 +991,24 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_IM_MAX_REPORTS_IN_FLIGHT 4
 #endif
 
+/**
+ * @def CHIP_CONFIG_IM_ENCODED_ATTRIBUTE_CACHE_SIZE
+ *
+ * @brief The maximum number of bytes of encoded attribute data the reporting engine keeps during a run, so that
+ *        subscriptions reporting the same attribute change copy its encoding instead of reading it again. Attributes whose
+ *        encoding does not fit are read for every read handler. The storage, and a scratch buffer as large as a report, are
+ *        allocated from the heap and kept between runs.
+ *
+ *        Values copied from the cache are not read from the data model again: the DataModelCallbacks read hooks are still
+ *        called for them, but the attribute accessors are not.
+ *
+ *        Defaults to 0, which disables the cache. Devices serving many subscriptions to the same attributes can enable
+ *        it.
+ */
+#ifndef CHIP_CONFIG_IM_ENCODED_ATTRIBUTE_CACHE_SIZE
+#define CHIP_CONFIG_IM_ENCODED_ATTRIBUTE_CACHE_SIZE 0
+#endif
+
 /**
  * @def CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_SUBSCRIPTIONS
  *
@@ -1200,6 +1253,35 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MAX_GROUP_CONCURRENT_ITERATORS 2
 #endif
 
+/**
+ * @def CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE
+ *
+ * @brief Defines the number of group session IDs whose operational keys are cached in RAM
+ *
+ * Incoming group messages are decrypted with the operational keys whose hash matches the message's
+ * session ID. The GroupDataProviderImpl keeps the keys found for the most recently seen session IDs,
+ * so that they do not have to be looked up in persistent storage for every message. The cache is
+ * cleared whenever the key sets or the group/key set mappings change.
+ *
+ * Each entry takes about (12 + 36 * CHIP_CONFIG_GROUP_SESSION_CACHE_KEYS_PER_SESSION) bytes.
+ * Set to 0 to disable the cache.
+ */
+#ifndef CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE
+#define CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE 4
+#endif
+
+/**
+ * @def CHIP_CONFIG_GROUP_SESSION_CACHE_KEYS_PER_SESSION
+ *
+ * @brief Defines the number of (group, key) pairs that can be cached for a single group session ID
+ *
+ * Session IDs matching more operational keys than this (a rare hash collision, or a key set mapped to
+ * many groups) are not cached and are always looked up in persistent storage.
+ */
+#ifndef CHIP_CONFIG_GROUP_SESSION_CACHE_KEYS_PER_SESSION
+#define CHIP_CONFIG_GROUP_SESSION_CACHE_KEYS_PER_SESSION 4
+#endif
+
 /**
  * @def CHIP_CONFIG_MAX_GROUP_NAME_LENGTH
  *
@@ -1209,6 +1291,20 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MAX_GROUP_NAME_LENGTH 16
 #endif
 
+/**
+ * @def CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE
+ *
+ * Defines the number of access control list decisions remembered by access
+ * control, so that requests spanning many paths of the same cluster (such as
+ * wildcard reads) do not evaluate every entry again for each path.
+ *
+ * The cache is cleared whenever the access control list changes. Set to 0 to
+ * disable it.
+ */
+#ifndef CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE
+#define CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE 32
+#endif
+
 /**
  * @def CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_MAX_ENTRIES_PER_FABRIC
  *
@@ -1342,6 +1438,19 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE (3 * CHIP_CONFIG_MAX_FABRICS)
 #endif
 
+/**
+ * @def CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE
+ *
+ * @brief
+ *   Number of peer operational certificate chains whose signatures the fabric
+ *   table remembers as verified, so that repeated CASE handshakes with the
+ *   same peers skip the ECDSA checks of the chain.  Each entry uses about 40
+ *   bytes of RAM.  Set to 0 to disable the cache.
+ */
+#ifndef CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE
+#define CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE 8
+#endif
+
 /**
  * @def CHIP_CONFIG_EVENT_LOGGING_BYTE_THRESHOLD
  *
@@ -1362,6 +1471,22 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_EVENT_LOGGING_BYTE_THRESHOLD 512
 #endif /* CHIP_CONFIG_EVENT_LOGGING_BYTE_THRESHOLD */
 
+/**
+ * @def CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES
+ *
+ * @brief The number of (event number, position) entries kept per event
+ *   buffer to let event fetches seek to the first event a reader has not
+ *   yet seen instead of decoding the buffers from their start.
+ *
+ * Entries are spread roughly evenly over each buffer, so a fetch decodes at
+ * most about 1/CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES of a buffer before
+ * reaching the events it is interested in.  Each entry costs 16 bytes of
+ * RAM per event buffer.
+ */
+#ifndef CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES
+#define CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES 8
+#endif /* CHIP_CONFIG_EVENT_LOGGING_INDEX_ENTRIES */
+
 /**
  * @def CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
  *
@@ -1472,6 +1597,31 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MINMDNS_MAX_PARALLEL_RESOLVES 2
 #endif // CHIP_CONFIG_MINMDNS_MAX_PARALLEL_RESOLVES
 
+/*
+ * @def CHIP_CONFIG_MINMDNS_RECORD_CACHE_SIZE
+ *
+ * @brief Number of records (PTR/SRV/TXT of Matter services and the A/AAAA
+ *        records of their hosts) that the minmdns resolver remembers until
+ *        their TTL expires.
+ *
+ *        Cached records allow operational lookups to complete without
+ *        sending queries and are sent as known answers on repeated browse
+ *        queries. Set to 0 to disable the cache.
+ *
+ * @note Every entry holds a full record (RecordCache::kMaxRecordSize, 192
+ *       bytes) plus its bookkeeping, so the cache statically takes a little
+ *       over 210 bytes per entry: about 3.4 KB for 16 entries. It is only
+ *       enabled by default on Linux and Darwin hosts, where memory is not
+ *       constrained.
+ */
+#ifndef CHIP_CONFIG_MINMDNS_RECORD_CACHE_SIZE
+#if (defined(__linux__) && __linux__) || (defined(__MACH__) && __MACH__)
+#define CHIP_CONFIG_MINMDNS_RECORD_CACHE_SIZE 16
+#else
+#define CHIP_CONFIG_MINMDNS_RECORD_CACHE_SIZE 0
+#endif
+#endif // CHIP_CONFIG_MINMDNS_RECORD_CACHE_SIZE
+
 /**
  * def CHIP_CONFIG_MDNS_RESOLVE_LOOKUP_RESULTS
  *
@@ -1911,6 +2061,18 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #error "CHIP_CONFIG_MAX_PATHS_PER_INVOKE is not allowed to be a number less than 1 or greater than 65535"
 #endif
 
+/**
+ * @def CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX
+ *
+ * @brief Index the clusters of a ServerClusterInterfaceRegistry by path, in a heap allocated hash table.
+ *
+ * Without the index, looking up the cluster for a path scans all the registered clusters, which becomes
+ * noticeable for devices with many endpoints (e.g. bridges). Defaults to enabled when pools use the heap.
+ */
+#ifndef CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX
+#define CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#endif
+
 /**
  * @def CHIP_CONFIG_ICD_OBSERVERS_POOL_SIZE
  *
@@ -1957,6 +2119,44 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_BDX_LOG_TRANSFER_MAX_BLOCK_SIZE 1024
 #endif // CHIP_CONFIG_BDX_LOG_TRANSFER_MAX_BLOCK_SIZE
 
+/**
+ *  @def CHIP_CONFIG_BDX_MAX_WINDOW_SIZE
+ *
+ *  @brief
+ *    Largest number of outstanding blocks a bdx::TransferSession supports in windowed mode.
+ *    Each outstanding block holds a packet buffer until it is acknowledged (sender) or
+ *    delivered to the application (receiver).
+ *
+ */
+#ifndef CHIP_CONFIG_BDX_MAX_WINDOW_SIZE
+#define CHIP_CONFIG_BDX_MAX_WINDOW_SIZE 8
+#endif // CHIP_CONFIG_BDX_MAX_WINDOW_SIZE
+
+/**
+ *  @def CHIP_CONFIG_BDX_WINDOW_SIZE
+ *
+ *  @brief
+ *    Window size proposed or accepted by the SDK's BDX endpoints (OTA requestor and provider,
+ *    diagnostic logs transfers). 1 keeps transfers lock-step, as with peers that do not
+ *    support windowed mode.
+ *
+ */
+#ifndef CHIP_CONFIG_BDX_WINDOW_SIZE
+#define CHIP_CONFIG_BDX_WINDOW_SIZE 1
+#endif // CHIP_CONFIG_BDX_WINDOW_SIZE
+
+/**
+ *  @def CHIP_CONFIG_BDX_WINDOW_RETRANSMIT_TIMEOUT
+ *
+ *  @brief
+ *    Time without progress, in milliseconds, after which a windowed bdx::TransferSession
+ *    resends its unacknowledged blocks (sender) or its last acknowledgement (receiver).
+ *
+ */
+#ifndef CHIP_CONFIG_BDX_WINDOW_RETRANSMIT_TIMEOUT
+#define CHIP_CONFIG_BDX_WINDOW_RETRANSMIT_TIMEOUT 1000
+#endif // CHIP_CONFIG_BDX_WINDOW_RETRANSMIT_TIMEOUT
+
 /**
  *  @def CHIP_CONFIG_TEST_GOOGLETEST
  *
@@ -1996,6 +2196,22 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_USE_ENDPOINT_UNIQUE_ID 0
 #endif // CHIP_CONFIG_USE_ENDPOINT_UNIQUE_ID
 
+/**
+ *  @def CHIP_CONFIG_EMBER_ENDPOINT_LOOKUP_TABLES
+ *
+ *  @brief
+ *    Enables the static lookup tables that ember attribute storage uses to resolve endpoint ids
+ *    and server clusters without scanning every endpoint: a map from endpoint id to endpoint
+ *    index (2 * MAX_ENDPOINT_COUNT + 2 slots rounded up to a power of two, 2 bytes each) and a
+ *    16-entry cache of server cluster positions.
+ *
+ * Devices with only a few endpoints, where the scans are cheap, can set this to 0 in their
+ * project specific configuration to save the RAM.
+ */
+#ifndef CHIP_CONFIG_EMBER_ENDPOINT_LOOKUP_TABLES
+#define CHIP_CONFIG_EMBER_ENDPOINT_LOOKUP_TABLES 1
+#endif // CHIP_CONFIG_EMBER_ENDPOINT_LOOKUP_TABLES
+
 /**
  * @def CHIP_CONFIG_TLS_PERSISTED_ROOT_CERT_BYTES
  *
@@ -0,0 +1,296 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/dnssd/RecordCache.h>
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/dnssd/ServiceNaming.h>
+#include <lib/dnssd/minimal_mdns/RecordData.h>
+#include <lib/support/CodeUtils.h>
+
+#include <string.h>
+
+namespace mdns {
+namespace Minimal {
+
+#if CHIP_CONFIG_MINMDNS_RECORD_CACHE_SIZE > 0
+
+namespace {
+
+using chip::Encoding::BigEndian::BufferWriter;
+using namespace chip::System::Clock::Literals;
+
+constexpr QNamePart kOperationalSuffix[]    = { chip::Dnssd::kOperationalServiceName, chip::Dnssd::kOperationalProtocol,
+                                                chip::Dnssd::kLocalDomain };
+constexpr QNamePart kCommissionableSuffix[] = { chip::Dnssd::kCommissionableServiceName, chip::Dnssd::kCommissionProtocol,
+                                                chip::Dnssd::kLocalDomain };
+constexpr QNamePart kCommissionerSuffix[]   = { chip::Dnssd::kCommissionerServiceName, chip::Dnssd::kCommissionProtocol,
+                                                chip::Dnssd::kLocalDomain };
+
+/// RFC 6762 section 10.2: records received within the last second are not
+/// flushed, as they are likely part of the same announcement.
+constexpr chip::System::Clock::Milliseconds64 kCacheFlushGracePeriod = 1000_ms64;
+
+/// Matches service, instance and subtype names of Matter services, e.g.
+/// `_matter._tcp.local`, `<instance>._matterc._udp.local` or
+/// `_S3._sub._matterd._udp.local`.
+bool HasMatterServiceSuffix(SerializedQNameIterator name)
+{
+    do
+    {
+        if ((name == kOperationalSuffix) || (name == kCommissionableSuffix) || (name == kCommissionerSuffix))
+        {
+            return true;
+        }
+    } while (name.Next());
+
+    return false;
+}
+
+bool WriteUncompressedName(BufferWriter & out, SerializedQNameIterator name)
+{
+    while (name.Next())
+    {
+        size_t length = strlen(name.Value());
+        out.Put8(static_cast<uint8_t>(length)).Put(name.Value(), length);
+    }
+    out.Put8(0);
+
+    return name.IsValid();
+}
+
+/// Writes `data` as a wire-format record in which no name (including names
+/// within SRV and PTR rdata) refers back to `packet`.
+bool SerializeRecord(const ResourceData & data, const BytesRange & packet, BufferWriter & out)
+{
+    VerifyOrReturnValue(WriteUncompressedName(out, data.GetName()), false);
+
+    out.Put16(static_cast<uint16_t>(data.GetType()))
+        .Put16(static_cast<uint16_t>(QClass::IN))
+        .Put32(static_cast<uint32_t>(data.GetTtlSeconds()));
+
+    BufferWriter lengthOutput(out); // copy to re-output the size
+    out.Put16(0);
+    size_t dataStart = out.Needed();
+
+    switch (data.GetType())
+    {
+    case QType::SRV: {
+        SrvRecord srv;
+        VerifyOrReturnValue(srv.Parse(data.GetData(), packet), false);
+        out.Put16(srv.GetPriority()).Put16(srv.GetWeight()).Put16(srv.GetPort());
+        VerifyOrReturnValue(WriteUncompressedName(out, srv.GetName()), false);
+        break;
+    }
+    case QType::PTR: {
+        SerializedQNameIterator target;
+        VerifyOrReturnValue(ParsePtrRecord(data.GetData(), packet, &target), false);
+        VerifyOrReturnValue(WriteUncompressedName(out, target), false);
+        break;
+    }
+    default:
+        out.Put(data.GetData().Start(), data.GetData().Size());
+        break;
+    }
+
+    lengthOutput.Put16(static_cast<uint16_t>(out.Needed() - dataStart));
+    return out.Fit();
+}
+
+bool SameData(const ResourceData & a, const ResourceData & b)
+{
+    const BytesRange & dataA = a.GetData();
+    const BytesRange & dataB = b.GetData();
+    return (dataA.Size() == dataB.Size()) && (memcmp(dataA.Start(), dataB.Start(), dataA.Size()) == 0);
+}
+
+} // namespace
+
+void RecordCache::OnResource(chip::Inet::InterfaceId interface, const ResourceData & data, const BytesRange & packet)
+{
+    const uint16_t rrClass = static_cast<uint16_t>(data.GetClass());
+    VerifyOrReturn((rrClass & ~kQClassResponseFlushBit) == static_cast<uint16_t>(QClass::IN));
+    VerifyOrReturn(data.GetType() == QType::PTR || data.GetType() == QType::SRV || data.GetType() == QType::TXT ||
+                   data.GetType() == QType::A || data.GetType() == QType::AAAA);
+
+    uint8_t buffer[kMaxRecordSize];
+    BufferWriter out(buffer, sizeof(buffer));
+    VerifyOrReturn(SerializeRecord(data, packet, out));
+
+    // Parse the serialized form back so that rdata compares against cached records
+    // regardless of name compression in the received packet.
+    ResourceData serialized;
+    const uint8_t * start = buffer;
+    VerifyOrReturn(serialized.Parse(BytesRange(buffer, buffer + out.Needed()), &start));
+
+    const bool flush                         = (rrClass & kQClassResponseFlushBit) != 0;
+    const chip::System::Clock::Timestamp now = mClock->GetMonotonicTimestamp();
+    Entry * existing                         = nullptr;
+
+    CachedRecord record;
+    for (size_t i = 0; NextRecord(i, record); i++)
+    {
+        const ResourceData & cached = record.GetResource();
+        if ((cached.GetType() != data.GetType()) || (record.GetInterface() != interface) || (cached.GetName() != data.GetName()))
+        {
+            continue;
+        }
+
+        if (SameData(cached, serialized))
+        {
+            existing = &mEntries[i];
+        }
+        else if (flush && (now - mEntries[i].receivedTime > kCacheFlushGracePeriod))
+        {
+            Remove(record);
+        }
+    }
+
+    if (data.GetTtlSeconds() == 0)
+    {
+        // Goodbye packet
+        VerifyOrReturn(existing != nullptr);
+        existing->length = 0;
+        return;
+    }
+
+    if (existing == nullptr)
+    {
+        VerifyOrReturn(IsCacheable(data));
+
+        // Expired entries were freed while looking for an existing record, so
+        // either a free entry exists or the one closest to expiry is replaced.
+        existing = &mEntries[0];
+        for (auto & entry : mEntries)
+        {
+            if (entry.length == 0)
+            {
+                existing = &entry;
+                break;
+            }
+            if (entry.receivedTime + chip::System::Clock::Seconds32(entry.ttlSeconds) <
+                existing->receivedTime + chip::System::Clock::Seconds32(existing->ttlSeconds))
+            {
+                existing = &entry;
+            }
+        }
+    }
+
+    existing->receivedTime = now;
+    existing->interface    = interface;
+    existing->ttlSeconds   = static_cast<uint32_t>(data.GetTtlSeconds());
+    existing->length       = static_cast<uint16_t>(out.Needed());
+    memcpy(existing->data, buffer, out.Needed());
+}
+
+bool RecordCache::IsCacheable(const ResourceData & data)
+{
+    switch (data.GetType())
+    {
+    case QType::PTR:
+    case QType::SRV:
+    case QType::TXT:
+        return HasMatterServiceSuffix(data.GetName());
+    case QType::A:
+    case QType::AAAA: {
+        // Only addresses of known Matter hosts are interesting
+        CachedRecord record;
+        for (size_t i = 0; NextRecord(i, record); i++)
+        {
+            SrvRecord srv;
+            if ((record.GetResource().GetType() == QType::SRV) && srv.Parse(record.GetResource().GetData(), record.GetRange()) &&
+                (srv.GetName() == data.GetName()))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+    default:
+        return false;
+    }
+}
+
+bool RecordCache::LoadRecord(size_t index, chip::System::Clock::Timestamp now, CachedRecord & record)
+{
+    Entry & entry = mEntries[index];
+    VerifyOrReturnValue(entry.length != 0, false);
+
+    const chip::System::Clock::Timestamp expiry = entry.receivedTime + chip::System::Clock::Seconds32(entry.ttlSeconds);
+    if (now >= expiry)
+    {
+        entry.length = 0;
+        return false;
+    }
+
+    record.mRange         = BytesRange(entry.data, entry.data + entry.length);
+    const uint8_t * start = entry.data;
+    if (!record.mResource.Parse(record.mRange, &start))
+    {
+        // Entries are only stored after being parsed successfully, so this is not expected
+        entry.length = 0;
+        return false;
+    }
+
+    record.mInterface           = entry.interface;
+    record.mTtlSeconds          = entry.ttlSeconds;
+    record.mRemainingTtlSeconds = static_cast<uint32_t>((expiry - now + 999_ms64) / 1000_ms64);
+    record.mIndex               = index;
+    return true;
+}
+
+#else // CHIP_CONFIG_MINMDNS_RECORD_CACHE_SIZE > 0
+
+void RecordCache::OnResource(chip::Inet::InterfaceId interface, const ResourceData & data, const BytesRange & packet) {}
+
+#endif // CHIP_CONFIG_MINMDNS_RECORD_CACHE_SIZE > 0
+
+bool RecordCache::NextRecord(size_t & index, CachedRecord & record)
+{
+#if CHIP_CONFIG_MINMDNS_RECORD_CACHE_SIZE > 0
+    const chip::System::Clock::Timestamp now = mClock->GetMonotonicTimestamp();
+    for (; index < kCacheSize; index++)
+    {
+        if (LoadRecord(index, now, record))
+        {
+            return true;
+        }
+    }
+#endif
+    return false;
+}
+
+void RecordCache::Remove(const CachedRecord & record)
+{
+#if CHIP_CONFIG_MINMDNS_RECORD_CACHE_SIZE > 0
+    VerifyOrReturn(record.mIndex < kCacheSize);
+    mEntries[record.mIndex].length = 0;
+#endif
+}
+
+void RecordCache::Clear()
+{
+#if CHIP_CONFIG_MINMDNS_RECORD_CACHE_SIZE > 0
+    for (auto & entry : mEntries)
+    {
+        entry.length = 0;
+    }
+#endif
+}
+
+} // namespace Minimal
+} // namespace mdns
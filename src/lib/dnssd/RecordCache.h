@@ -0,0 +1,149 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <inet/InetInterface.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/dnssd/minimal_mdns/Parser.h>
+#include <lib/dnssd/minimal_mdns/core/BytesRange.h>
+#include <system/SystemClock.h>
+
+namespace mdns {
+namespace Minimal {
+
+/// Remembers mDNS records received by the resolver until their TTL expires.
+///
+/// Only records that a Matter resolver can make use of are kept:
+///    - PTR, SRV and TXT records of Matter services (operational,
+///      commissionable and commissioner, including subtypes)
+///    - A and AAAA records of hosts targeted by a cached SRV record
+///
+/// Records are stored in wire format with all names uncompressed, so a cached
+/// record can be parsed (and its rdata copied into a query) without the packet
+/// it was received in.
+///
+/// The cache has a fixed number of entries (CHIP_CONFIG_MINMDNS_RECORD_CACHE_SIZE).
+/// When full, the record closest to expiry is replaced.
+class RecordCache
+{
+public:
+    /// Maximum size of a cached record (name, header and rdata). Larger
+    /// records are not cached.
+    static constexpr size_t kMaxRecordSize = 192;
+
+    /// A record returned by a cache lookup.
+    ///
+    /// VALIDITY: references cache storage, valid until the cache is next modified
+    ///           (except by `Remove` during iteration).
+    class CachedRecord
+    {
+    public:
+        /// The record as received. Its TTL is the TTL it was received with.
+        const ResourceData & GetResource() const { return mResource; }
+
+        /// Range of valid data for parsing names within the record (e.g. for
+        /// SrvRecord::Parse or IncrementalResolver::OnRecord).
+        const BytesRange & GetRange() const { return mRange; }
+
+        chip::Inet::InterfaceId GetInterface() const { return mInterface; }
+
+        /// TTL the record was received with
+        uint32_t GetTtlSeconds() const { return mTtlSeconds; }
+
+        /// TTL left until the record expires, always > 0 for records returned by the cache
+        uint32_t GetRemainingTtlSeconds() const { return mRemainingTtlSeconds; }
+
+    private:
+        friend class RecordCache;
+
+        ResourceData mResource;
+        BytesRange mRange;
+        chip::Inet::InterfaceId mInterface = chip::Inet::InterfaceId::Null();
+        uint32_t mTtlSeconds               = 0;
+        uint32_t mRemainingTtlSeconds      = 0;
+        size_t mIndex                      = 0;
+    };
+
+    RecordCache(chip::System::Clock::ClockBase * clock) : mClock(clock) { Clear(); }
+
+    /// Processes a record received on `interface` within a response `packet`.
+    ///
+    /// Caches the record if relevant and applies RFC 6762 cache maintenance:
+    ///    - a TTL of 0 (goodbye packet) removes the record
+    ///    - the cache-flush bit removes other records with the same name, type
+    ///      and interface that were received more than a second ago
+    void OnResource(chip::Inet::InterfaceId interface, const ResourceData & data, const BytesRange & packet);
+
+    /// Calls `function(const CachedRecord &)` for every unexpired record of the given
+    /// name and type. `name` may be a FullQName or a SerializedQNameIterator.
+    ///
+    /// `function` may call `Remove` for the record it is given.
+    template <typename NameType, typename Function>
+    void ForEachRecord(const NameType & name, QType type, Function && function)
+    {
+        CachedRecord record;
+        for (size_t i = 0; NextRecord(i, record); i++)
+        {
+            if ((record.GetResource().GetType() == type) && (record.GetResource().GetName() == name))
+            {
+                function(record);
+            }
+        }
+    }
+
+    /// Drops the given record from the cache.
+    void Remove(const CachedRecord & record);
+
+    /// Drops all records.
+    void Clear();
+
+private:
+    /// Finds the first unexpired record at or after `index` and updates `index` to its position.
+    ///
+    /// Returns false if no such record exists.
+    bool NextRecord(size_t & index, CachedRecord & record);
+
+#if CHIP_CONFIG_MINMDNS_RECORD_CACHE_SIZE > 0
+    struct Entry
+    {
+        chip::System::Clock::Timestamp receivedTime;
+        chip::Inet::InterfaceId interface;
+        uint32_t ttlSeconds;
+        uint16_t length; // 0 for unused entries
+        uint8_t data[kMaxRecordSize];
+    };
+
+    static constexpr size_t kCacheSize = CHIP_CONFIG_MINMDNS_RECORD_CACHE_SIZE;
+
+    /// Whether the record is worth caching given the records already cached.
+    bool IsCacheable(const ResourceData & data);
+
+    /// Loads the entry at `index` into `record`. Returns false (and frees the entry) if it expired.
+    bool LoadRecord(size_t index, chip::System::Clock::Timestamp now, CachedRecord & record);
+
+    Entry mEntries[kCacheSize];
+#endif
+
+    chip::System::Clock::ClockBase * mClock;
+};
+
+} // namespace Minimal
+} // namespace mdns
@@ -151,6 +151,19 @@ public:
      */
     virtual CHIP_ERROR ResolveNodeId(const PeerId & peerId) = 0;
 
+    /**
+     * Resolves the given operational node service from previously received
+     * records only, without sending any DNSSD query.
+     *
+     * This does not require a matching NodeIdResolutionNoLongerNeeded call and
+     * never calls the resolver delegate.
+     *
+     * @retval CHIP_NO_ERROR on success, with `nodeData` filled in
+     * @retval CHIP_ERROR_NOT_FOUND if no complete, unexpired data is known
+     *         for the node or the implementation does not cache records
+     */
+    virtual CHIP_ERROR ResolveNodeIdFromCache(const PeerId & peerId, ResolvedNodeData & nodeData) { return CHIP_ERROR_NOT_FOUND; }
+
     /*
      * Notify the resolver that one of the consumers that called ResolveNodeId
      * successfully no longer needs the resolution result (e.g. because it got
@@ -21,6 +21,7 @@
 #include <lib/dnssd/ActiveResolveAttempts.h>
 #include <lib/dnssd/IncrementalResolve.h>
 #include <lib/dnssd/MinimalMdnsServer.h>
+#include <lib/dnssd/RecordCache.h>
 #include <lib/dnssd/ServiceNaming.h>
 #include <lib/dnssd/minimal_mdns/Logging.h>
 #include <lib/dnssd/minimal_mdns/MinMdnsConfig.h>
@@ -49,11 +50,13 @@ using namespace mdns::Minimal;
 class PacketParser : private ParserDelegate
 {
 public:
-    PacketParser(ActiveResolveAttempts & activeResolves) : mActiveResolves(activeResolves) {}
+    PacketParser(ActiveResolveAttempts & activeResolves, RecordCache & recordCache) :
+        mActiveResolves(activeResolves), mRecordCache(recordCache)
+    {}
 
     /// Goes through the given SRV records within a response packet
     /// and sets up data resolution
-    void ParseSrvRecords(const BytesRange & packet);
+    void ParseSrvRecords(Inet::InterfaceId interface, const BytesRange & packet);
 
     /// Goes through non-SRV records and feeds them through the initialized
     /// SRV record parsing.
@@ -98,6 +101,7 @@ private:
 
     // resolvers kept between parse steps
     ActiveResolveAttempts & mActiveResolves;
+    RecordCache & mRecordCache;
     IncrementalResolver mResolvers[kMinMdnsNumParallelResolvers];
 };
 
@@ -136,14 +140,18 @@ void PacketParser::OnResource(ResourceType type, const ResourceData & data)
             return;
         }
         mdns::Minimal::Logging::LogReceivedResource(data);
+        // Cache SRV records first, so that addresses of their targets are cacheable
+        // regardless of record order within the packet.
+        mRecordCache.OnResource(mInterfaceId, data, mPacketRange);
         ParseSRVResource(data);
         break;
     }
     case RecordParsingState::kRecordParsing:
         if (data.GetType() != QType::SRV)
         {
-            // SRV packets logged during 'SrvInitialization' phase
+            // SRV packets logged and cached during 'SrvInitialization' phase
             mdns::Minimal::Logging::LogReceivedResource(data);
+            mRecordCache.OnResource(mInterfaceId, data, mPacketRange);
         }
         ParseResource(data);
         break;
@@ -231,12 +239,13 @@ void PacketParser::ParseSRVResource(const ResourceData & data)
 #endif
 }
 
-void PacketParser::ParseSrvRecords(const BytesRange & packet)
+void PacketParser::ParseSrvRecords(Inet::InterfaceId interface, const BytesRange & packet)
 {
     MATTER_TRACE_SCOPE("Searching SRV Records", "PacketParser");
 
     mParsingState = RecordParsingState::kSrvInitialization;
     mPacketRange  = packet;
+    mInterfaceId  = interface;
 
     if (!ParsePacket(packet, this))
     {
@@ -265,7 +274,9 @@ void PacketParser::ParseNonSrvRecords(Inet::InterfaceId interface, const BytesRa
 class MinMdnsResolver : public Resolver, public MdnsPacketDelegate
 {
 public:
-    MinMdnsResolver() : mActiveResolves(&chip::System::SystemClock()), mPacketParser(mActiveResolves)
+    MinMdnsResolver() :
+        mActiveResolves(&chip::System::SystemClock()), mRecordCache(&chip::System::SystemClock()),
+        mPacketParser(mActiveResolves, mRecordCache)
     {
         GlobalMinimalMdnsServer::Instance().SetResponseDelegate(this);
     }
@@ -280,6 +291,7 @@ public:
     void Shutdown() override;
     void SetOperationalDelegate(OperationalResolveDelegate * delegate) override { mOperationalDelegate = delegate; }
     CHIP_ERROR ResolveNodeId(const PeerId & peerId) override;
+    CHIP_ERROR ResolveNodeIdFromCache(const PeerId & peerId, ResolvedNodeData & nodeData) override;
     void NodeIdResolutionNoLongerNeeded(const PeerId & peerId) override;
     CHIP_ERROR StartDiscovery(DiscoveryType type, DiscoveryFilter filter, DiscoveryContext & context) override;
     CHIP_ERROR StopDiscovery(DiscoveryContext & context) override;
@@ -290,6 +302,7 @@ private:
     DiscoveryContext * mDiscoveryContext              = nullptr;
     System::Layer * mSystemLayer                      = nullptr;
     ActiveResolveAttempts mActiveResolves;
+    RecordCache mRecordCache;
     PacketParser mPacketParser;
 
     void SetDiscoveryContext(DiscoveryContext * context);
@@ -310,6 +323,9 @@ private:
     void ExpireIncrementalResolvers();
     void AdvancePendingResolverStates();
 
+    /// Feeds cached addresses of the resolver target host into the resolver.
+    void AddCachedAddresses(IncrementalResolver & resolver);
+
     static void RetryCallback(System::Layer *, void * self);
 
     CHIP_ERROR BrowseNodes(DiscoveryType type, DiscoveryFilter subtype);
@@ -366,6 +382,13 @@ void MinMdnsResolver::AdvancePendingResolverStates()
 
         IncrementalResolver::RequiredInformationFlags missing = resolver->GetMissingRequiredInformation();
 
+        if (missing.Has(IncrementalResolver::RequiredInformationBitFlags::kIpAddress))
+        {
+            // Addresses may be known from earlier responses, in which case there is no need to ask for them.
+            AddCachedAddresses(*resolver);
+            missing = resolver->GetMissingRequiredInformation();
+        }
+
         if (missing.Has(IncrementalResolver::RequiredInformationBitFlags::kIpAddress))
         {
             if (resolver->IsActiveCommissionParse())
@@ -502,7 +525,7 @@ void MinMdnsResolver::OnMdnsPacketData(const BytesRange & data, const chip::Inet
     MATTER_TRACE_SCOPE("Received MDNS Packet", "MinMdnsResolver");
 
     // Fill up any relevant data
-    mPacketParser.ParseSrvRecords(data);
+    mPacketParser.ParseSrvRecords(info->Interface, data);
     mPacketParser.ParseNonSrvRecords(info->Interface, data);
 
     AdvancePendingResolverStates();
@@ -600,6 +623,18 @@ CHIP_ERROR MinMdnsResolver::BuildQuery(QueryBuilder & builder, const ActiveResol
     mdns::Minimal::Logging::LogSendingQuery(query);
     builder.AddQuery(query);
 
+    if (!firstSend)
+    {
+        // Nodes that answered earlier attempts were already reported. List them as known
+        // answers (RFC 6762 section 7.1) so that only nodes not seen yet respond.
+        mRecordCache.ForEachRecord(qname, QType::PTR, [&builder](const RecordCache::CachedRecord & record) {
+            if (record.GetRemainingTtlSeconds() >= record.GetTtlSeconds() / 2)
+            {
+                builder.AddKnownAnswer(record.GetResource(), record.GetRemainingTtlSeconds());
+            }
+        });
+    }
+
     return CHIP_NO_ERROR;
 }
 
@@ -742,7 +777,23 @@ CHIP_ERROR MinMdnsResolver::StopDiscovery(DiscoveryContext & context)
 
 CHIP_ERROR MinMdnsResolver::ReconfirmRecord(const char * hostname, Inet::IPAddress address, Inet::InterfaceId interfaceId)
 {
-    return CHIP_ERROR_NOT_IMPLEMENTED;
+    // Forget the address, so that the next resolve queries the network for current data.
+    const char * hostQName[] = { hostname, kLocalDomain };
+
+    auto removeAddress = [&](const RecordCache::CachedRecord & record) {
+        const ResourceData & resource = record.GetResource();
+        Inet::IPAddress cachedAddress;
+        bool parsed = (resource.GetType() == QType::AAAA) ? ParseAAAARecord(resource.GetData(), &cachedAddress)
+                                                          : ParseARecord(resource.GetData(), &cachedAddress);
+        if (parsed && (cachedAddress == address) && (!interfaceId.IsPresent() || (record.GetInterface() == interfaceId)))
+        {
+            mRecordCache.Remove(record);
+        }
+    };
+    mRecordCache.ForEachRecord(FullQName(hostQName), QType::AAAA, removeAddress);
+    mRecordCache.ForEachRecord(FullQName(hostQName), QType::A, removeAddress);
+
+    return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR MinMdnsResolver::BrowseNodes(DiscoveryType type, DiscoveryFilter filter)
@@ -759,6 +810,44 @@ CHIP_ERROR MinMdnsResolver::ResolveNodeId(const PeerId & peerId)
     return SendAllPendingQueries();
 }
 
+CHIP_ERROR MinMdnsResolver::ResolveNodeIdFromCache(const PeerId & peerId, ResolvedNodeData & nodeData)
+{
+    char nameBuffer[kMaxOperationalServiceNameSize] = "";
+    ReturnErrorOnFailure(MakeInstanceName(nameBuffer, sizeof(nameBuffer), peerId));
+
+    const char * instanceQName[] = { nameBuffer, kOperationalServiceName, kOperationalProtocol, kLocalDomain };
+    FullQName instanceName(instanceQName);
+
+    IncrementalResolver resolver;
+    mRecordCache.ForEachRecord(instanceName, QType::SRV, [&resolver](const RecordCache::CachedRecord & record) {
+        SrvRecord srv;
+        VerifyOrReturn(!resolver.IsActive());
+        VerifyOrReturn(srv.Parse(record.GetResource().GetData(), record.GetRange()));
+        RETURN_SAFELY_IGNORED resolver.InitializeParsing(record.GetResource().GetName(), record.GetRemainingTtlSeconds(), srv);
+    });
+    VerifyOrReturnError(resolver.IsActiveOperationalParse(), CHIP_ERROR_NOT_FOUND);
+
+    mRecordCache.ForEachRecord(instanceName, QType::TXT, [&resolver](const RecordCache::CachedRecord & record) {
+        RETURN_SAFELY_IGNORED resolver.OnRecord(record.GetInterface(), record.GetResource(), record.GetRange());
+    });
+    AddCachedAddresses(resolver);
+
+    VerifyOrReturnError(!resolver.GetMissingRequiredInformation().HasAny(), CHIP_ERROR_NOT_FOUND);
+    return resolver.Take(nodeData);
+}
+
+void MinMdnsResolver::AddCachedAddresses(IncrementalResolver & resolver)
+{
+    auto addAddress = [&resolver](const RecordCache::CachedRecord & record) {
+        RETURN_SAFELY_IGNORED resolver.OnRecord(record.GetInterface(), record.GetResource(), record.GetRange());
+    };
+
+    mRecordCache.ForEachRecord(resolver.GetTargetHostName(), QType::AAAA, addAddress);
+#if INET_CONFIG_ENABLE_IPV4
+    mRecordCache.ForEachRecord(resolver.GetTargetHostName(), QType::A, addAddress);
+#endif
+}
+
 void MinMdnsResolver::NodeIdResolutionNoLongerNeeded(const PeerId & peerId)
 {
     mActiveResolves.NodeIdResolutionNoLongerNeeded(peerId);
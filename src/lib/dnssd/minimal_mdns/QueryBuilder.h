@@ -19,6 +19,7 @@
 
 #include <system/SystemPacketBuffer.h>
 
+#include <lib/dnssd/minimal_mdns/Parser.h>
 #include <lib/dnssd/minimal_mdns/Query.h>
 #include <lib/dnssd/minimal_mdns/core/DnsHeader.h>
 
@@ -81,6 +82,39 @@ public:
         return *this;
     }
 
+    /// Adds a known answer (RFC 6762 section 7.1) to the query.
+    ///
+    /// Known answers MUST be added after all queries. The rdata of `data` is
+    /// copied as-is, so it must not contain compressed names (e.g. records
+    /// from a RecordCache).
+    ///
+    /// Known answers are an optimization: an answer that does not fit in the
+    /// packet is left out without failing the query.
+    QueryBuilder & AddKnownAnswer(const ResourceData & data, uint32_t ttlSeconds)
+    {
+        if (!mQueryBuildOk)
+        {
+            return *this;
+        }
+
+        chip::Encoding::BigEndian::BufferWriter out(mPacket->Start() + mPacket->DataLength(), mPacket->AvailableDataLength());
+        RecordWriter writer(&out);
+
+        writer.WriteQName(data.GetName())
+            .Put16(static_cast<uint16_t>(data.GetType()))
+            .Put16(static_cast<uint16_t>(QClass::IN))
+            .Put32(ttlSeconds)
+            .Put16(static_cast<uint16_t>(data.GetData().Size()))
+            .Put(data.GetData());
+
+        if (writer.Fit())
+        {
+            mPacket->SetDataLength(static_cast<uint16_t>(mPacket->DataLength() + out.Needed()));
+            mHeader.SetAnswerCount(static_cast<uint16_t>(mHeader.GetAnswerCount() + 1));
+        }
+        return *this;
+    }
+
     bool Ok() const { return mQueryBuildOk; }
 
 private:
@@ -0,0 +1,352 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/dnssd/RecordCache.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/dnssd/minimal_mdns/QueryBuilder.h>
+#include <lib/dnssd/minimal_mdns/RecordData.h>
+#include <lib/dnssd/minimal_mdns/core/tests/QNameStrings.h>
+#include <lib/dnssd/minimal_mdns/records/IP.h>
+#include <lib/dnssd/minimal_mdns/records/Ptr.h>
+#include <lib/dnssd/minimal_mdns/records/ResourceRecord.h>
+#include <lib/dnssd/minimal_mdns/records/Srv.h>
+#include <lib/dnssd/minimal_mdns/records/Txt.h>
+#include <lib/support/CHIPMem.h>
+#include <system/SystemClock.h>
+
+#include <initializer_list>
+#include <stdio.h>
+
+#if CHIP_CONFIG_MINMDNS_RECORD_CACHE_SIZE > 0
+
+namespace {
+
+using namespace chip;
+using namespace chip::System::Clock::Literals;
+using namespace mdns::Minimal;
+
+const auto kOperationalService = testing::TestQName<3>({ "_matter", "_tcp", "local" });
+const auto kOperationalName    = testing::TestQName<4>({ "1234567898765432-ABCDEFEDCBAABCDE", "_matter", "_tcp", "local" });
+const auto kNonMatterName      = testing::TestQName<4>({ "printer", "_ipp", "_tcp", "local" });
+const auto kHostName           = testing::TestQName<2>({ "abcd", "local" });
+const auto kOtherHostName      = testing::TestQName<2>({ "efgh", "local" });
+
+Inet::IPAddress ParseAddress(const char * text)
+{
+    Inet::IPAddress address;
+    EXPECT_TRUE(Inet::IPAddress::FromString(text, address));
+    return address;
+}
+
+/// Feeds all records of a packet into the cache, the way the resolver does.
+class CacheFeeder : public ParserDelegate
+{
+public:
+    CacheFeeder(RecordCache & cache, const BytesRange & packet) : mCache(cache), mPacket(packet) {}
+
+    void OnHeader(ConstHeaderRef & header) override {}
+    void OnQuery(const QueryData & data) override {}
+    void OnResource(ResourceType type, const ResourceData & data) override
+    {
+        mCache.OnResource(Inet::InterfaceId::Null(), data, mPacket);
+    }
+
+private:
+    RecordCache & mCache;
+    BytesRange mPacket;
+};
+
+/// Writes the records into a single response packet, which compresses names
+/// across records, and feeds it to the cache.
+void Receive(RecordCache & cache, std::initializer_list<const ResourceRecord *> records)
+{
+    uint8_t buffer[512];
+    HeaderRef header(buffer);
+    header.Clear();
+    header.SetFlags(header.GetFlags().SetResponse());
+
+    // Compressed names are offsets from the packet start, so the writer covers the header too
+    chip::Encoding::BigEndian::BufferWriter output(buffer, sizeof(buffer));
+    output.Skip(HeaderRef::kSizeBytes);
+    RecordWriter writer(&output);
+    for (const ResourceRecord * record : records)
+    {
+        EXPECT_TRUE(record->Append(header, ResourceType::kAnswer, writer));
+    }
+    ASSERT_TRUE(writer.Fit());
+
+    BytesRange packet(buffer, buffer + output.Needed());
+    CacheFeeder feeder(cache, packet);
+    EXPECT_TRUE(ParsePacket(packet, &feeder));
+}
+
+template <typename NameType>
+size_t CountRecords(RecordCache & cache, const NameType & name, QType type)
+{
+    size_t count = 0;
+    cache.ForEachRecord(name, type, [&count](const RecordCache::CachedRecord &) { count++; });
+    return count;
+}
+
+struct TestRecordCache : public ::testing::Test
+{
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+TEST_F(TestRecordCache, CachesMatterRecords)
+{
+    System::Clock::Internal::MockClock clock;
+    RecordCache cache(&clock);
+
+    const char * txtEntries[] = { "SII=5300", "SAI=4000" };
+
+    PtrResourceRecord ptr(kOperationalService.Full(), kOperationalName.Full());
+    SrvResourceRecord srv(kOperationalName.Full(), kHostName.Full(), 5540);
+    TxtResourceRecord txt(kOperationalName.Full(), txtEntries);
+    IPResourceRecord aaaa(kHostName.Full(), ParseAddress("fe80::1"));
+
+    Receive(cache, { &ptr, &srv, &txt, &aaaa });
+
+    size_t srvCount = 0;
+    cache.ForEachRecord(kOperationalName.Full(), QType::SRV, [&](const RecordCache::CachedRecord & record) {
+        SrvRecord parsed;
+        EXPECT_TRUE(parsed.Parse(record.GetResource().GetData(), record.GetRange()));
+        EXPECT_EQ(parsed.GetPort(), 5540);
+        EXPECT_EQ(parsed.GetName(), kHostName.Serialized());
+        EXPECT_EQ(record.GetTtlSeconds(), srv.GetTtl());
+        srvCount++;
+    });
+    EXPECT_EQ(srvCount, 1u);
+
+    size_t ptrCount = 0;
+    cache.ForEachRecord(kOperationalService.Serialized(), QType::PTR, [&ptrCount](const RecordCache::CachedRecord & record) {
+        SerializedQNameIterator target;
+        EXPECT_TRUE(ParsePtrRecord(record.GetResource().GetData(), record.GetRange(), &target));
+        EXPECT_EQ(target, kOperationalName.Serialized());
+        ptrCount++;
+    });
+    EXPECT_EQ(ptrCount, 1u);
+
+    EXPECT_EQ(CountRecords(cache, kOperationalName.Full(), QType::TXT), 1u);
+    EXPECT_EQ(CountRecords(cache, kHostName.Full(), QType::AAAA), 1u);
+
+    // Receiving the same records again refreshes them rather than adding copies
+    Receive(cache, { &ptr, &srv, &txt, &aaaa });
+    EXPECT_EQ(CountRecords(cache, kOperationalName.Full(), QType::SRV), 1u);
+    EXPECT_EQ(CountRecords(cache, kHostName.Full(), QType::AAAA), 1u);
+
+    cache.Clear();
+    EXPECT_EQ(CountRecords(cache, kOperationalName.Full(), QType::SRV), 0u);
+}
+
+TEST_F(TestRecordCache, IgnoresUnrelatedRecords)
+{
+    System::Clock::Internal::MockClock clock;
+    RecordCache cache(&clock);
+
+    SrvResourceRecord nonMatterSrv(kNonMatterName.Full(), kOtherHostName.Full(), 631);
+    IPResourceRecord otherHostAddress(kOtherHostName.Full(), ParseAddress("fe80::2"));
+
+    Receive(cache, { &nonMatterSrv, &otherHostAddress });
+
+    EXPECT_EQ(CountRecords(cache, kNonMatterName.Full(), QType::SRV), 0u);
+    EXPECT_EQ(CountRecords(cache, kOtherHostName.Full(), QType::AAAA), 0u);
+
+    // Addresses are only kept for hosts of cached SRV records
+    SrvResourceRecord srv(kOperationalName.Full(), kHostName.Full(), 5540);
+    IPResourceRecord address(kHostName.Full(), ParseAddress("fe80::1"));
+
+    Receive(cache, { &address });
+    EXPECT_EQ(CountRecords(cache, kHostName.Full(), QType::AAAA), 0u);
+
+    Receive(cache, { &srv, &address });
+    EXPECT_EQ(CountRecords(cache, kHostName.Full(), QType::AAAA), 1u);
+}
+
+TEST_F(TestRecordCache, ExpiresRecords)
+{
+    System::Clock::Internal::MockClock clock;
+    RecordCache cache(&clock);
+
+    SrvResourceRecord srv(kOperationalName.Full(), kHostName.Full(), 5540);
+    srv.SetTtl(120);
+    Receive(cache, { &srv });
+
+    uint32_t remaining = 0;
+    auto getRemaining  = [&remaining](const RecordCache::CachedRecord & record) { remaining = record.GetRemainingTtlSeconds(); };
+
+    cache.ForEachRecord(kOperationalName.Full(), QType::SRV, getRemaining);
+    EXPECT_EQ(remaining, 120u);
+
+    clock.AdvanceMonotonic(100500_ms64);
+    cache.ForEachRecord(kOperationalName.Full(), QType::SRV, getRemaining);
+    EXPECT_EQ(remaining, 20u);
+
+    clock.AdvanceMonotonic(19500_ms64);
+    EXPECT_EQ(CountRecords(cache, kOperationalName.Full(), QType::SRV), 0u);
+}
+
+TEST_F(TestRecordCache, GoodbyeRemovesRecord)
+{
+    System::Clock::Internal::MockClock clock;
+    RecordCache cache(&clock);
+
+    SrvResourceRecord srv(kOperationalName.Full(), kHostName.Full(), 5540);
+    Receive(cache, { &srv });
+    EXPECT_EQ(CountRecords(cache, kOperationalName.Full(), QType::SRV), 1u);
+
+    srv.SetTtl(0);
+    Receive(cache, { &srv });
+    EXPECT_EQ(CountRecords(cache, kOperationalName.Full(), QType::SRV), 0u);
+}
+
+TEST_F(TestRecordCache, CacheFlushReplacesOlderRecords)
+{
+    System::Clock::Internal::MockClock clock;
+    RecordCache cache(&clock);
+
+    SrvResourceRecord srv(kOperationalName.Full(), kHostName.Full(), 5540);
+    IPResourceRecord first(kHostName.Full(), ParseAddress("fe80::1"));
+    IPResourceRecord second(kHostName.Full(), ParseAddress("fe80::2"));
+    IPResourceRecord third(kHostName.Full(), ParseAddress("fe80::3"));
+    first.SetCacheFlush(true);
+    second.SetCacheFlush(true);
+    third.SetCacheFlush(true);
+
+    // Records of the same announcement do not flush each other
+    Receive(cache, { &srv, &first, &second });
+    EXPECT_EQ(CountRecords(cache, kHostName.Full(), QType::AAAA), 2u);
+
+    // A later announcement replaces the addresses
+    clock.AdvanceMonotonic(2000_ms64);
+    Receive(cache, { &third });
+
+    size_t count = 0;
+    cache.ForEachRecord(kHostName.Full(), QType::AAAA, [&count](const RecordCache::CachedRecord & record) {
+        Inet::IPAddress address;
+        EXPECT_TRUE(ParseAAAARecord(record.GetResource().GetData(), &address));
+        EXPECT_EQ(address, ParseAddress("fe80::3"));
+        count++;
+    });
+    EXPECT_EQ(count, 1u);
+}
+
+TEST_F(TestRecordCache, ReplacesRecordClosestToExpiryWhenFull)
+{
+    System::Clock::Internal::MockClock clock;
+    RecordCache cache(&clock);
+
+    constexpr size_t kCacheSize = CHIP_CONFIG_MINMDNS_RECORD_CACHE_SIZE;
+    char instanceNames[kCacheSize + 1][16];
+    const char * txtEntries[] = { "SII=5300" };
+
+    auto receiveTxt = [&](size_t index, uint32_t ttl) {
+        snprintf(instanceNames[index], sizeof(instanceNames[index]), "node%u", static_cast<unsigned>(index));
+        const char * name[] = { instanceNames[index], "_matterc", "_udp", "local" };
+        TxtResourceRecord txt(FullQName(name), txtEntries);
+        txt.SetTtl(ttl);
+        Receive(cache, { &txt });
+    };
+    auto countTxt = [&](size_t index) {
+        const char * name[] = { instanceNames[index], "_matterc", "_udp", "local" };
+        return CountRecords(cache, FullQName(name), QType::TXT);
+    };
+
+    // The record at index 1 expires first
+    for (size_t i = 0; i < kCacheSize; i++)
+    {
+        receiveTxt(i, (i == 1) ? 100 : 1000);
+    }
+    for (size_t i = 0; i < kCacheSize; i++)
+    {
+        EXPECT_EQ(countTxt(i), 1u);
+    }
+
+    receiveTxt(kCacheSize, 1000);
+    EXPECT_EQ(countTxt(kCacheSize), 1u);
+    EXPECT_EQ(countTxt(1), 0u);
+    EXPECT_EQ(countTxt(0), 1u);
+}
+
+TEST_F(TestRecordCache, RemoveDuringIteration)
+{
+    System::Clock::Internal::MockClock clock;
+    RecordCache cache(&clock);
+
+    SrvResourceRecord srv(kOperationalName.Full(), kHostName.Full(), 5540);
+    IPResourceRecord first(kHostName.Full(), ParseAddress("fe80::1"));
+    IPResourceRecord second(kHostName.Full(), ParseAddress("fe80::2"));
+    Receive(cache, { &srv, &first, &second });
+
+    const Inet::IPAddress toRemove = ParseAddress("fe80::1");
+    cache.ForEachRecord(kHostName.Full(), QType::AAAA, [&](const RecordCache::CachedRecord & record) {
+        Inet::IPAddress address;
+        EXPECT_TRUE(ParseAAAARecord(record.GetResource().GetData(), &address));
+        if (address == toRemove)
+        {
+            cache.Remove(record);
+        }
+    });
+
+    EXPECT_EQ(CountRecords(cache, kHostName.Full(), QType::AAAA), 1u);
+}
+
+TEST_F(TestRecordCache, KnownAnswersInQuery)
+{
+    System::Clock::Internal::MockClock clock;
+    RecordCache cache(&clock);
+
+    PtrResourceRecord ptr(kOperationalService.Full(), kOperationalName.Full());
+    Receive(cache, { &ptr });
+
+    System::PacketBufferHandle buffer = System::PacketBufferHandle::New(512);
+    ASSERT_FALSE(buffer.IsNull());
+
+    QueryBuilder builder(std::move(buffer));
+    builder.AddQuery(Query(kOperationalService.Full()).SetType(QType::PTR));
+    cache.ForEachRecord(kOperationalService.Full(), QType::PTR, [&builder](const RecordCache::CachedRecord & record) {
+        builder.AddKnownAnswer(record.GetResource(), record.GetRemainingTtlSeconds());
+    });
+    ASSERT_TRUE(builder.Ok());
+    EXPECT_EQ(builder.Header().GetQueryCount(), 1u);
+    EXPECT_EQ(builder.Header().GetAnswerCount(), 1u);
+
+    // The known answer parses back from the query packet
+    System::PacketBufferHandle packet = builder.ReleasePacket();
+    RecordCache parsed(&clock);
+    BytesRange range(packet->Start(), packet->Start() + packet->DataLength());
+
+    CacheFeeder feeder(parsed, range);
+    EXPECT_TRUE(ParsePacket(range, &feeder));
+
+    size_t count = 0;
+    parsed.ForEachRecord(kOperationalService.Full(), QType::PTR, [&count](const RecordCache::CachedRecord & record) {
+        SerializedQNameIterator target;
+        EXPECT_TRUE(ParsePtrRecord(record.GetResource().GetData(), record.GetRange(), &target));
+        EXPECT_EQ(target, kOperationalName.Serialized());
+        count++;
+    });
+    EXPECT_EQ(count, 1u);
+}
+
+} // namespace
+
+#endif // CHIP_CONFIG_MINMDNS_RECORD_CACHE_SIZE > 0
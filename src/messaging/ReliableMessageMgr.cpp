@@ -329,8 +329,10 @@ System::Clock::Timeout ReliableMessageMgr::GetBackoff(System::Clock::Timeout bas
 void ReliableMessageMgr::StartRetransmision(RetransTableEntry * entry)
 {
     CalculateNextRetransTime(*entry);
-#if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
+#if CHIP_CONFIG_MRP_ANALYTICS_ENABLED || MATTER_TRACING_ENABLED
     entry->initialSentTime = System::SystemClock().GetMonotonicTimestamp();
+#endif // CHIP_CONFIG_MRP_ANALYTICS_ENABLED || MATTER_TRACING_ENABLED
+#if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
     NotifyMessageSendAnalytics(*entry, entry->ec->GetSessionHandle(), ReliableMessageAnalyticsDelegate::EventType::kInitialSend);
 #endif // CHIP_CONFIG_MRP_ANALYTICS_ENABLED
     StartTimer();
@@ -346,6 +348,10 @@ bool ReliableMessageMgr::CheckAndRemRetransTable(ReliableMessageContext * rc, ui
             auto session = entry->ec->GetSessionHandle();
             NotifyMessageSendAnalytics(*entry, session, ReliableMessageAnalyticsDelegate::EventType::kAcknowledged);
 #endif // CHIP_CONFIG_MRP_ANALYTICS_ENABLED
+#if MATTER_TRACING_ENABLED
+            const System::Clock::Timestamp roundTrip = System::SystemClock().GetMonotonicTimestamp() - entry->initialSentTime;
+            MATTER_LOG_METRIC(Tracing::kMetricDeviceRMPRoundTrip, static_cast<uint32_t>(roundTrip.count()));
+#endif // MATTER_TRACING_ENABLED
 
             // Clear the entry from the retransmision table.
             ClearRetransTable(*entry);
@@ -30,6 +30,7 @@
 #include <lib/core/Optional.h>
 #include <lib/support/BitFlags.h>
 #include <lib/support/Pool.h>
+#include <matter/tracing/build_config.h>
 #include <messaging/ExchangeContext.h>
 #include <messaging/ReliableMessageAnalyticsDelegate.h>
 #include <messaging/ReliableMessageProtocolConfig.h>
@@ -67,9 +68,9 @@ public:
         System::Clock::Timestamp nextRetransTime; /**< A counter representing the next retransmission time for the message. */
         uint8_t sendCount;                        /**< The number of times we have tried to send this entry,
                                                        including both successfully and failure send. */
-#if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
+#if CHIP_CONFIG_MRP_ANALYTICS_ENABLED || MATTER_TRACING_ENABLED
         System::Clock::Timestamp initialSentTime; /**< Timestamp when the initial message was sent */
-#endif                                            // CHIP_CONFIG_MRP_ANALYTICS_ENABLED
+#endif // CHIP_CONFIG_MRP_ANALYTICS_ENABLED || MATTER_TRACING_ENABLED
     };
 
     ReliableMessageMgr(ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & contextPool);
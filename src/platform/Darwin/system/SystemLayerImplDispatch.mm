@@ -249,11 +249,7 @@ namespace System {
 
         if (!timerIsActive) {
             // check if the timer is in the mExpiredTimers list about to be fired.
-            for (TimerList::Node * timer = mExpiredTimers.Earliest(); timer != nullptr; timer = timer->mNextTimer) {
-                if (timer->GetCallback().GetOnComplete() == onComplete && timer->GetCallback().GetAppState() == appState) {
-                    return true;
-                }
-            }
+            timerIsActive = (mExpiredTimers.Find(onComplete, appState) != nullptr);
         }
 
         return timerIsActive;
@@ -323,7 +319,7 @@ namespace System {
         // Obtain the list of currently expired timers. Any new timers added by timer callback are NOT handled on this pass,
         // since that could result in infinite handling of new timers blocking any other progress.
         VerifyOrDieWithMsg(mExpiredTimers.Empty(), DeviceLayer, "Re-entry into HandleEvents from a timer callback?");
-        mExpiredTimers = mTimerList.ExtractEarlier(Clock::Timeout(1) + SystemClock().GetMonotonicTimestamp());
+        mTimerList.ExtractEarlier(Clock::Timeout(1) + SystemClock().GetMonotonicTimestamp(), mExpiredTimers);
         TimerList::Node * timer = nullptr;
         while ((timer = mExpiredTimers.PopEarliest()) != nullptr) {
             DisableTimer(__func__, timer);
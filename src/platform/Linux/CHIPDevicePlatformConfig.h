@@ -55,6 +55,52 @@
 // These are configuration options that are unique to Linux platforms.
 // These can be overridden by the application as needed.
 
+/**
+ * CHIP_DEVICE_CONFIG_LINUX_KVS_USE_LOG
+ *
+ * Store the KeyValueStoreManager data in an append-only log (ChipLinuxStorageLog) rather
+ * than in an INI file that is rewritten on every update (ChipLinuxStorage). An existing
+ * INI file is migrated on first use.
+ */
+#ifndef CHIP_DEVICE_CONFIG_LINUX_KVS_USE_LOG
+#define CHIP_DEVICE_CONFIG_LINUX_KVS_USE_LOG 0
+#endif // CHIP_DEVICE_CONFIG_LINUX_KVS_USE_LOG
+
+/**
+ * CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_COMPACTION_THRESHOLD
+ *
+ * Number of bytes of superseded records above which the KVS log is compacted, provided
+ * they also outweigh the live records.
+ */
+#ifndef CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_COMPACTION_THRESHOLD
+#define CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_COMPACTION_THRESHOLD (64 * 1024)
+#endif // CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_COMPACTION_THRESHOLD
+
+/**
+ * CHIP_DEVICE_CONFIG_BG_TASK_COUNT
+ *
+ * Number of threads processing background work, such as the CASE Sigma3 crypto, so that
+ * concurrent handshakes do not queue behind one another.  When 0, background work runs on
+ * the Matter thread.
+ */
+#ifndef CHIP_DEVICE_CONFIG_BG_TASK_COUNT
+#define CHIP_DEVICE_CONFIG_BG_TASK_COUNT 0
+#endif // CHIP_DEVICE_CONFIG_BG_TASK_COUNT
+
+#ifndef CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+#define CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING (CHIP_DEVICE_CONFIG_BG_TASK_COUNT > 0)
+#endif // CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+
+/**
+ * CHIP_DEVICE_CONFIG_OTA_IMAGE_WRITE_QUEUE_DEPTH
+ *
+ * Number of downloaded OTA image blocks that can wait for the OTA image writer thread.  When
+ * the queue is full, the next block is only requested once the writer has caught up.
+ */
+#ifndef CHIP_DEVICE_CONFIG_OTA_IMAGE_WRITE_QUEUE_DEPTH
+#define CHIP_DEVICE_CONFIG_OTA_IMAGE_WRITE_QUEUE_DEPTH 4
+#endif // CHIP_DEVICE_CONFIG_OTA_IMAGE_WRITE_QUEUE_DEPTH
+
 // ========== Platform-specific Configuration Overrides =========
 
 #ifndef CHIP_DEVICE_CONFIG_CHIP_TASK_STACK_SIZE
@@ -0,0 +1,651 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *         This file implements a log-structured key-value store for the
+ *         Linux KeyValueStoreManager.
+ *
+ *         File layout:
+ *
+ *           magic   "CHIPKVL1"
+ *           record* crc32 (4), type (1), reserved (1), key length (2),
+ *                   value length (4), key, value
+ *
+ *         All integers are little-endian. The CRC-32 covers everything in
+ *         the record after the CRC itself.
+ *
+ */
+
+#include <platform/Linux/CHIPLinuxStorageLog.h>
+
+#include <algorithm>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/CHIPDeviceConfig.h>
+#include <platform/Linux/CHIPLinuxStorage.h>
+#include <system/SystemError.h>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+namespace {
+
+constexpr uint8_t kFileMagic[] = { 'C', 'H', 'I', 'P', 'K', 'V', 'L', '1' };
+
+constexpr size_t kRecordHeaderLength = 12;
+constexpr size_t kMaxKeyLength       = UINT16_MAX;
+
+constexpr uint8_t kRecordTypePut    = 1;
+constexpr uint8_t kRecordTypeDelete = 2;
+
+struct Crc32Table
+{
+    constexpr Crc32Table() : mEntries()
+    {
+        for (uint32_t i = 0; i < 256; i++)
+        {
+            uint32_t crc = i;
+            for (int bit = 0; bit < 8; bit++)
+            {
+                crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320u : (crc >> 1);
+            }
+            mEntries[i] = crc;
+        }
+    }
+
+    uint32_t mEntries[256];
+};
+
+constexpr Crc32Table kCrc32Table;
+
+uint32_t Crc32(uint32_t crc, const uint8_t * data, size_t length)
+{
+    crc = ~crc;
+    for (size_t i = 0; i < length; i++)
+    {
+        crc = kCrc32Table.mEntries[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+size_t RecordLength(size_t keyLength, size_t valueLength)
+{
+    return kRecordHeaderLength + keyLength + valueLength;
+}
+
+CHIP_ERROR ReadAll(int fd, uint8_t * data, size_t length, off_t offset)
+{
+    while (length > 0)
+    {
+        ssize_t rv = pread(fd, data, length, offset);
+        if (rv < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        VerifyOrReturnError(rv >= 0, CHIP_ERROR_POSIX(errno));
+        VerifyOrReturnError(rv > 0, CHIP_ERROR_READ_FAILED);
+        data += rv;
+        length -= static_cast<size_t>(rv);
+        offset += rv;
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR WriteAll(int fd, const uint8_t * data, size_t length, off_t offset)
+{
+    while (length > 0)
+    {
+        ssize_t rv = pwrite(fd, data, length, offset);
+        if (rv < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        VerifyOrReturnError(rv > 0, CHIP_ERROR_POSIX(errno));
+        data += rv;
+        length -= static_cast<size_t>(rv);
+        offset += rv;
+    }
+    return CHIP_NO_ERROR;
+}
+
+// Whether the file is text made of the sections and key=value lines ChipLinuxStorageIni writes,
+// with at least one of them. A log whose magic got damaged is not: its records hold binary lengths.
+bool IsIniFile(int fd, off_t size)
+{
+    std::string contents(static_cast<size_t>(size), '\0');
+    VerifyOrReturnValue(ReadAll(fd, reinterpret_cast<uint8_t *>(&contents[0]), contents.size(), 0) == CHIP_NO_ERROR, false);
+
+    bool hasEntries = false;
+    size_t start    = 0;
+    while (start < contents.size())
+    {
+        size_t end = contents.find('\n', start);
+        if (end == std::string::npos)
+        {
+            end = contents.size();
+        }
+        std::string line = contents.substr(start, end - start);
+        start            = end + 1;
+
+        for (char c : line)
+        {
+            VerifyOrReturnValue(static_cast<unsigned char>(c) >= 0x20 || c == '\t' || c == '\r', false);
+        }
+
+        const size_t first = line.find_first_not_of(" \t\r");
+        if (first == std::string::npos || line[first] == ';' || line[first] == '#')
+        {
+            continue;
+        }
+        const size_t last = line.find_last_not_of(" \t\r");
+        VerifyOrReturnValue((line[first] == '[' && line[last] == ']') || line.find('=') != std::string::npos, false);
+        hasEntries = true;
+    }
+    return hasEntries;
+}
+
+// Makes a rename() in the directory of `path` durable.
+void SyncDirectory(const std::string & path)
+{
+    size_t separator    = path.find_last_of('/');
+    std::string dirPath = (separator == std::string::npos) ? "." : (separator == 0 ? "/" : path.substr(0, separator));
+
+    FileDescriptor dir(open(dirPath.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC));
+    if (dir.Get() < 0 || fsync(dir.Get()) != 0)
+    {
+        ChipLogError(DeviceLayer, "Failed to sync directory %s: %s", dirPath.c_str(), strerror(errno));
+    }
+}
+
+} // namespace
+
+CHIP_ERROR ChipLinuxStorageLog::Init(const char * file)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    if (mInitialized)
+    {
+        ChipLogError(DeviceLayer, "ChipLinuxStorageLog::Init: Attempt to re-initialize with KVS file: %s, IGNORING.",
+                     StringOrNullMarker(file));
+        return CHIP_NO_ERROR;
+    }
+
+    VerifyOrReturnError(file != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    ChipLogDetail(DeviceLayer, "ChipLinuxStorageLog::Init: Using KVS file: %s", file);
+    mPath.assign(file);
+
+    FileDescriptor fd(open(file, O_RDWR | O_CLOEXEC));
+    if (fd.Get() < 0)
+    {
+        VerifyOrReturnError(errno == ENOENT, CHIP_ERROR_POSIX(errno),
+                            ChipLogError(DeviceLayer, "Failed to open %s: %s", file, strerror(errno)));
+        ReturnErrorOnFailure(CreateEmpty());
+    }
+    else
+    {
+        struct stat st;
+        VerifyOrReturnError(fstat(fd.Get(), &st) == 0, CHIP_ERROR_POSIX(errno));
+
+        uint8_t magic[sizeof(kFileMagic)];
+        if (st.st_size == 0)
+        {
+            ReturnErrorOnFailure(CreateEmpty());
+        }
+        else if (ReadAll(fd.Get(), magic, sizeof(magic), 0) != CHIP_NO_ERROR || memcmp(magic, kFileMagic, sizeof(magic)) != 0)
+        {
+            // Only migrate files that really are INI: anything else would parse as an empty store and replace the file.
+            VerifyOrReturnError(IsIniFile(fd.Get(), st.st_size), CHIP_ERROR_INTEGRITY_CHECK_FAILED,
+                                ChipLogError(DeviceLayer, "%s is neither a key-value log nor an INI file, not using it", file));
+            ReturnErrorOnFailure(MigrateFromIni());
+        }
+        else
+        {
+            mFd = std::move(fd);
+        }
+    }
+
+    ReturnErrorOnFailure(Load());
+    mInitialized = true;
+
+    return CHIP_NO_ERROR;
+}
+
+void ChipLinuxStorageLog::Shutdown()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    mFd.Close();
+    mIndex.clear();
+    mEnd         = 0;
+    mLiveBytes   = 0;
+    mDeadBytes   = 0;
+    mCompactions = 0;
+    mInitialized = false;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Load()
+{
+    struct stat st;
+    VerifyOrReturnError(fstat(mFd.Get(), &st) == 0, CHIP_ERROR_POSIX(errno));
+
+    const off_t size = st.st_size;
+    off_t offset     = static_cast<off_t>(sizeof(kFileMagic));
+
+    mIndex.clear();
+    mLiveBytes = 0;
+    mDeadBytes = 0;
+
+    // Replay the records, stopping at the first one that is incomplete or damaged: appends only ever
+    // tear the last record, and nothing written after a damaged record can be trusted to be ordered
+    // after it.
+    while (size - offset >= static_cast<off_t>(kRecordHeaderLength))
+    {
+        uint8_t header[kRecordHeaderLength];
+        ReturnErrorOnFailure(ReadAll(mFd.Get(), header, sizeof(header), offset));
+
+        const uint32_t crc         = Encoding::LittleEndian::Get32(&header[0]);
+        const uint8_t type         = header[4];
+        const uint16_t keyLength   = Encoding::LittleEndian::Get16(&header[6]);
+        const uint32_t valueLength = Encoding::LittleEndian::Get32(&header[8]);
+        const size_t recordLength  = RecordLength(keyLength, valueLength);
+
+        if ((type != kRecordTypePut && type != kRecordTypeDelete) || keyLength == 0 ||
+            (type == kRecordTypeDelete && valueLength != 0) || static_cast<off_t>(recordLength) > size - offset)
+        {
+            break;
+        }
+
+        mRecord.resize(recordLength - kRecordHeaderLength);
+        ReturnErrorOnFailure(ReadAll(mFd.Get(), mRecord.data(), mRecord.size(), offset + static_cast<off_t>(kRecordHeaderLength)));
+        if (Crc32(Crc32(0, &header[4], kRecordHeaderLength - 4), mRecord.data(), mRecord.size()) != crc)
+        {
+            break;
+        }
+
+        std::string key(reinterpret_cast<const char *>(mRecord.data()), keyLength);
+        auto it = mIndex.find(key);
+        if (it != mIndex.end())
+        {
+            const size_t supersededLength = RecordLength(it->first.size(), it->second.mValueLength);
+            mLiveBytes -= supersededLength;
+            mDeadBytes += supersededLength;
+        }
+
+        if (type == kRecordTypePut)
+        {
+            const Location location = { offset + static_cast<off_t>(kRecordHeaderLength + keyLength), valueLength };
+            if (it != mIndex.end())
+            {
+                it->second = location;
+            }
+            else
+            {
+                mIndex.emplace(std::move(key), location);
+            }
+            mLiveBytes += recordLength;
+        }
+        else
+        {
+            if (it != mIndex.end())
+            {
+                mIndex.erase(it);
+            }
+            mDeadBytes += recordLength;
+        }
+
+        offset += static_cast<off_t>(recordLength);
+    }
+
+    if (offset < size)
+    {
+        ChipLogError(DeviceLayer, "Dropping %" PRId64 " bytes of incomplete or damaged records at the end of %s",
+                     static_cast<int64_t>(size - offset), mPath.c_str());
+        VerifyOrReturnError(ftruncate(mFd.Get(), offset) == 0 && fdatasync(mFd.Get()) == 0, CHIP_ERROR_POSIX(errno));
+    }
+    mEnd = offset;
+
+    ChipLogDetail(DeviceLayer, "Loaded %u keys from %s", static_cast<unsigned>(mIndex.size()), mPath.c_str());
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::CreateTemporaryFile(FileDescriptor & fd, std::string & name)
+{
+    name = mPath + "-XXXXXX";
+    fd   = FileDescriptor(mkostemp(name.data(), O_CLOEXEC));
+    VerifyOrReturnError(fd.Get() >= 0, CHIP_ERROR_OPEN_FAILED,
+                        ChipLogError(DeviceLayer, "Failed to create temp file %s: %s", name.c_str(), strerror(errno)));
+
+    CHIP_ERROR err = WriteAll(fd.Get(), kFileMagic, sizeof(kFileMagic), 0);
+    if (err != CHIP_NO_ERROR)
+    {
+        unlink(name.c_str());
+    }
+    return err;
+}
+
+// Same sequence as ChipLinuxStorageIni::CommitConfig: sync the temporary file, then rename() it over the
+// storage file.
+CHIP_ERROR ChipLinuxStorageLog::InstallFile(FileDescriptor & fd, const std::string & name)
+{
+    VerifyOrReturnError(fdatasync(fd.Get()) == 0, CHIP_ERROR_WRITE_FAILED,
+                        ChipLogError(DeviceLayer, "Failed to sync temp file %s: %s", name.c_str(), strerror(errno)));
+    VerifyOrReturnError(rename(name.c_str(), mPath.c_str()) == 0, CHIP_ERROR_WRITE_FAILED,
+                        ChipLogError(DeviceLayer, "Failed to rename %s to %s: %s", name.c_str(), mPath.c_str(), strerror(errno)));
+    SyncDirectory(mPath);
+
+    mFd = std::move(fd);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::CreateEmpty()
+{
+    FileDescriptor fd;
+    std::string name;
+    ReturnErrorOnFailure(CreateTemporaryFile(fd, name));
+
+    CHIP_ERROR err = InstallFile(fd, name);
+    if (err != CHIP_NO_ERROR)
+    {
+        unlink(name.c_str());
+    }
+    return err;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::MigrateFromIni()
+{
+    ChipLinuxStorage ini;
+    std::vector<std::string> keys;
+    ReturnErrorOnFailure(ini.Init(mPath.c_str()));
+    ReturnErrorOnFailure(ini.GetKeys(keys));
+
+    FileDescriptor fd;
+    std::string name;
+    ReturnErrorOnFailure(CreateTemporaryFile(fd, name));
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    off_t end      = static_cast<off_t>(sizeof(kFileMagic));
+    std::vector<uint8_t> value;
+    for (const auto & key : keys)
+    {
+        size_t length = 0;
+        CHIP_ERROR readErr = ini.ReadValueBin(key.c_str(), nullptr, 0, length);
+        if (readErr == CHIP_NO_ERROR || readErr == CHIP_ERROR_BUFFER_TOO_SMALL)
+        {
+            value.resize(length);
+            readErr = ini.ReadValueBin(key.c_str(), value.data(), value.size(), length);
+        }
+        if (readErr != CHIP_NO_ERROR)
+        {
+            ChipLogError(DeviceLayer, "Not migrating unreadable key %s: %" CHIP_ERROR_FORMAT, key.c_str(), readErr.Format());
+            continue;
+        }
+
+        err = Append(fd.Get(), end, kRecordTypePut, key, value.data(), length, nullptr);
+        SuccessOrExit(err);
+    }
+
+    err = InstallFile(fd, name);
+    SuccessOrExit(err);
+
+    ChipLogProgress(DeviceLayer, "Migrated %u keys from INI storage %s", static_cast<unsigned>(keys.size()), mPath.c_str());
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        unlink(name.c_str());
+    }
+    return err;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Append(int fd, off_t & end, uint8_t type, const std::string & key, const uint8_t * value,
+                                       size_t valueLength, Location * location)
+{
+    VerifyOrReturnError(!key.empty() && key.size() <= kMaxKeyLength && valueLength <= UINT32_MAX, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(value != nullptr || valueLength == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    const size_t recordLength = RecordLength(key.size(), valueLength);
+    mRecord.resize(recordLength);
+
+    uint8_t * record = mRecord.data();
+    record[4]        = type;
+    record[5]        = 0;
+    Encoding::LittleEndian::Put16(&record[6], static_cast<uint16_t>(key.size()));
+    Encoding::LittleEndian::Put32(&record[8], static_cast<uint32_t>(valueLength));
+    memcpy(&record[kRecordHeaderLength], key.data(), key.size());
+    if (valueLength > 0)
+    {
+        memcpy(&record[kRecordHeaderLength + key.size()], value, valueLength);
+    }
+    Encoding::LittleEndian::Put32(&record[0], Crc32(0, &record[4], recordLength - 4));
+
+    CHIP_ERROR err = WriteAll(fd, record, recordLength, end);
+    if (err != CHIP_NO_ERROR)
+    {
+        // Don't leave a partial record behind: it would hide the records appended after it.
+        (void) ftruncate(fd, end);
+        return err;
+    }
+
+    if (location != nullptr)
+    {
+        location->mValueOffset = end + static_cast<off_t>(kRecordHeaderLength + key.size());
+        location->mValueLength = static_cast<uint32_t>(valueLength);
+    }
+    end += static_cast<off_t>(recordLength);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::ReadValueBin(const char * key, uint8_t * buf, size_t bufSize, size_t & outLen, size_t offset)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    auto it = mIndex.find(key);
+    VerifyOrReturnError(it != mIndex.end(), CHIP_ERROR_KEY_NOT_FOUND);
+
+    const Location & location = it->second;
+    VerifyOrReturnError(offset <= location.mValueLength, CHIP_ERROR_INVALID_ARGUMENT);
+
+    const size_t remaining = location.mValueLength - offset;
+    const size_t copySize  = std::min(bufSize, remaining);
+    if (copySize > 0)
+    {
+        VerifyOrReturnError(buf != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+        ReturnErrorOnFailure(ReadAll(mFd.Get(), buf, copySize, location.mValueOffset + static_cast<off_t>(offset)));
+    }
+    outLen = copySize;
+
+    return (copySize < remaining) ? CHIP_ERROR_BUFFER_TOO_SMALL : CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::WriteValueBin(const char * key, const uint8_t * data, size_t dataLen)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::string keyString(key);
+    Location location;
+    off_t end = mEnd;
+    ReturnErrorOnFailure(Append(mFd.Get(), end, kRecordTypePut, keyString, data, dataLen, &location));
+    if (fdatasync(mFd.Get()) != 0)
+    {
+        CHIP_ERROR err = CHIP_ERROR_POSIX(errno);
+        (void) ftruncate(mFd.Get(), mEnd);
+        return err;
+    }
+    mEnd = end;
+
+    auto it = mIndex.find(keyString);
+    if (it != mIndex.end())
+    {
+        const size_t supersededLength = RecordLength(keyString.size(), it->second.mValueLength);
+        mLiveBytes -= supersededLength;
+        mDeadBytes += supersededLength;
+        it->second = location;
+    }
+    else
+    {
+        mIndex.emplace(std::move(keyString), location);
+    }
+    mLiveBytes += RecordLength(strlen(key), dataLen);
+
+    MaybeCompactLocked();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::ClearValue(const char * key)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    auto it = mIndex.find(key);
+    VerifyOrReturnError(it != mIndex.end(), CHIP_ERROR_KEY_NOT_FOUND);
+
+    off_t end = mEnd;
+    ReturnErrorOnFailure(Append(mFd.Get(), end, kRecordTypeDelete, it->first, nullptr, 0, nullptr));
+    if (fdatasync(mFd.Get()) != 0)
+    {
+        CHIP_ERROR err = CHIP_ERROR_POSIX(errno);
+        (void) ftruncate(mFd.Get(), mEnd);
+        return err;
+    }
+    mEnd = end;
+
+    const size_t supersededLength = RecordLength(it->first.size(), it->second.mValueLength);
+    mLiveBytes -= supersededLength;
+    mDeadBytes += supersededLength + RecordLength(it->first.size(), 0);
+    mIndex.erase(it);
+
+    MaybeCompactLocked();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::ClearAll()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_INCORRECT_STATE);
+    ReturnErrorOnFailure(CreateEmpty());
+
+    mIndex.clear();
+    mEnd       = static_cast<off_t>(sizeof(kFileMagic));
+    mLiveBytes = 0;
+    mDeadBytes = 0;
+
+    return CHIP_NO_ERROR;
+}
+
+bool ChipLinuxStorageLog::HasValue(const char * key)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    return mInitialized && key != nullptr && mIndex.find(key) != mIndex.end();
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Compact()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_INCORRECT_STATE);
+    return CompactLocked();
+}
+
+ChipLinuxStorageLog::Stats ChipLinuxStorageLog::GetStats()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    return Stats{ mIndex.size(), mLiveBytes, mDeadBytes, mCompactions };
+}
+
+CHIP_ERROR ChipLinuxStorageLog::CompactLocked()
+{
+    FileDescriptor fd;
+    std::string name;
+    ReturnErrorOnFailure(CreateTemporaryFile(fd, name));
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    off_t end      = static_cast<off_t>(sizeof(kFileMagic));
+    std::unordered_map<std::string, Location> index;
+    std::vector<uint8_t> value;
+
+    index.reserve(mIndex.size());
+    for (const auto & entry : mIndex)
+    {
+        Location location;
+        value.resize(entry.second.mValueLength);
+        err = ReadAll(mFd.Get(), value.data(), value.size(), entry.second.mValueOffset);
+        SuccessOrExit(err);
+        err = Append(fd.Get(), end, kRecordTypePut, entry.first, value.data(), value.size(), &location);
+        SuccessOrExit(err);
+        index.emplace(entry.first, location);
+    }
+
+    err = InstallFile(fd, name);
+    SuccessOrExit(err);
+
+    ChipLogDetail(DeviceLayer, "Compacted %s from %" PRId64 " to %" PRId64 " bytes", mPath.c_str(), static_cast<int64_t>(mEnd),
+                  static_cast<int64_t>(end));
+
+    mIndex.swap(index);
+    mEnd       = end;
+    mLiveBytes = static_cast<size_t>(end) - sizeof(kFileMagic);
+    mDeadBytes = 0;
+    mCompactions++;
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        unlink(name.c_str());
+    }
+    return err;
+}
+
+void ChipLinuxStorageLog::MaybeCompactLocked()
+{
+    if (mDeadBytes < CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_COMPACTION_THRESHOLD || mDeadBytes <= mLiveBytes)
+    {
+        return;
+    }
+
+    // The update that triggered the compaction is already durable, so a failure here only delays the compaction.
+    CHIP_ERROR err = CompactLocked();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DeviceLayer, "Failed to compact %s: %" CHIP_ERROR_FORMAT, mPath.c_str(), err.Format());
+    }
+}
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
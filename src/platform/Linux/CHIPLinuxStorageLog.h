@@ -0,0 +1,145 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *         This file defines a log-structured key-value store for the Linux
+ *         KeyValueStoreManager.
+ *
+ *         Every update is appended to the storage file as a self-checking
+ *         record and made durable with a single fdatasync(), instead of
+ *         rewriting the whole file as ChipLinuxStorage does. An in-memory
+ *         index maps each key to the location of its latest value.
+ *
+ *         The file is rewritten without the superseded records (compacted)
+ *         once they take up more space than the live ones. Compaction, like
+ *         the creation of the file, goes through a temporary file that is
+ *         renamed over the storage file, so that a crash leaves either the
+ *         old or the new file in place. A record torn by a crash while it
+ *         was being appended is dropped when the file is loaded.
+ *
+ *         A file in the ChipLinuxStorage INI format found at the storage
+ *         path is migrated to the log format on Init(). A file that is in
+ *         neither format, such as a log with a damaged header, is left
+ *         untouched and fails Init().
+ *
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/support/FileDescriptor.h>
+
+#include <mutex>
+#include <string>
+#include <sys/types.h>
+#include <unordered_map>
+#include <vector>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+class ChipLinuxStorageLog
+{
+public:
+    struct Stats
+    {
+        size_t mKeyCount;
+        size_t mLiveBytes;   // Size of the records holding the current values.
+        size_t mDeadBytes;   // Size of the superseded records and of the deletion records.
+        size_t mCompactions; // Number of compactions since Init().
+    };
+
+    ChipLinuxStorageLog() = default;
+
+    ChipLinuxStorageLog(const ChipLinuxStorageLog &)             = delete;
+    ChipLinuxStorageLog & operator=(const ChipLinuxStorageLog &) = delete;
+
+    /**
+     * Loads (or creates) the store in `file`, migrating it if it is a ChipLinuxStorage INI file.
+     *
+     * @retval CHIP_ERROR_INTEGRITY_CHECK_FAILED if `file` is neither a log nor an INI file.
+     */
+    CHIP_ERROR Init(const char * file);
+    void Shutdown();
+
+    /**
+     * Reads the value of `key`, starting at `offset`, into `buf`.
+     *
+     * `outLen` is set to the number of bytes copied into `buf`.
+     *
+     * @retval CHIP_ERROR_KEY_NOT_FOUND      if there is no value for `key`.
+     * @retval CHIP_ERROR_INVALID_ARGUMENT  if `offset` is beyond the end of the value.
+     * @retval CHIP_ERROR_BUFFER_TOO_SMALL  if `buf` is too small for the rest of the value, which was truncated.
+     */
+    CHIP_ERROR ReadValueBin(const char * key, uint8_t * buf, size_t bufSize, size_t & outLen, size_t offset = 0);
+
+    /**
+     * Writes the value of `key`. The value is durable once this returns CHIP_NO_ERROR.
+     */
+    CHIP_ERROR WriteValueBin(const char * key, const uint8_t * data, size_t dataLen);
+
+    /**
+     * Deletes the value of `key`.
+     *
+     * @retval CHIP_ERROR_KEY_NOT_FOUND if there is no value for `key`.
+     */
+    CHIP_ERROR ClearValue(const char * key);
+    CHIP_ERROR ClearAll();
+    bool HasValue(const char * key);
+
+    /**
+     * Rewrites the storage file with only the live records. Done automatically when the dead records take up
+     * more than CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_COMPACTION_THRESHOLD bytes and more than the live ones.
+     */
+    CHIP_ERROR Compact();
+
+    Stats GetStats();
+
+private:
+    struct Location
+    {
+        off_t mValueOffset;
+        uint32_t mValueLength;
+    };
+
+    CHIP_ERROR Load();
+    CHIP_ERROR CreateEmpty();
+    CHIP_ERROR MigrateFromIni();
+    CHIP_ERROR CreateTemporaryFile(FileDescriptor & fd, std::string & name);
+    CHIP_ERROR InstallFile(FileDescriptor & fd, const std::string & name);
+    CHIP_ERROR Append(int fd, off_t & end, uint8_t type, const std::string & key, const uint8_t * value, size_t valueLength,
+                      Location * location);
+    CHIP_ERROR CompactLocked();
+    void MaybeCompactLocked();
+
+    std::mutex mLock;
+    std::string mPath;
+    FileDescriptor mFd;
+    off_t mEnd = 0;
+    std::unordered_map<std::string, Location> mIndex;
+    size_t mLiveBytes   = 0;
+    size_t mDeadBytes   = 0;
+    size_t mCompactions = 0;
+    std::vector<uint8_t> mRecord;
+    bool mInitialized = false;
+};
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
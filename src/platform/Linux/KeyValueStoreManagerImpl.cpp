@@ -44,6 +44,19 @@ CHIP_ERROR KeyValueStoreManagerImpl::_Get(const char * key, void * value, size_t
     // Copy data into value buffer
     VerifyOrReturnError(value != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
 
+#if CHIP_DEVICE_CONFIG_LINUX_KVS_USE_LOG
+    // The log reads partial and offset values directly from the file.
+    CHIP_ERROR err = mStorage.ReadValueBin(key, static_cast<uint8_t *>(value), value_size, read_size, offset_bytes);
+    if (err == CHIP_ERROR_KEY_NOT_FOUND)
+    {
+        return CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND;
+    }
+    if ((err == CHIP_NO_ERROR || err == CHIP_ERROR_BUFFER_TOO_SMALL) && read_bytes_size != nullptr)
+    {
+        *read_bytes_size = read_size;
+    }
+    return err;
+#else
     // On linux read first without a buffer which returns the size, and then
     // use a local buffer to read the entire object, which allows partial and
     // offset reads.
@@ -74,6 +87,7 @@ CHIP_ERROR KeyValueStoreManagerImpl::_Get(const char * key, void * value, size_t
     ::memcpy(value, buf.Get() + offset_bytes, copy_size);
 
     return (value_size < total_size_to_read) ? CHIP_ERROR_BUFFER_TOO_SMALL : CHIP_NO_ERROR;
+#endif // CHIP_DEVICE_CONFIG_LINUX_KVS_USE_LOG
 }
 
 CHIP_ERROR KeyValueStoreManagerImpl::_Put(const char * key, const void * value, size_t value_size)
@@ -83,9 +97,11 @@ CHIP_ERROR KeyValueStoreManagerImpl::_Put(const char * key, const void * value,
     err = mStorage.WriteValueBin(key, reinterpret_cast<const uint8_t *>(value), value_size);
     SuccessOrExit(err);
 
+#if !CHIP_DEVICE_CONFIG_LINUX_KVS_USE_LOG
     // Commit the value to the persistent store.
     err = mStorage.Commit();
     SuccessOrExit(err);
+#endif // !CHIP_DEVICE_CONFIG_LINUX_KVS_USE_LOG
 
 exit:
     return err;
@@ -102,9 +118,11 @@ CHIP_ERROR KeyValueStoreManagerImpl::_Delete(const char * key)
     }
     SuccessOrExit(err);
 
+#if !CHIP_DEVICE_CONFIG_LINUX_KVS_USE_LOG
     // Commit the value to the persistent store.
     err = mStorage.Commit();
     SuccessOrExit(err);
+#endif // !CHIP_DEVICE_CONFIG_LINUX_KVS_USE_LOG
 
 exit:
     return err;
@@ -23,7 +23,9 @@
 
 #pragma once
 
+#include <platform/CHIPDeviceConfig.h>
 #include <platform/Linux/CHIPLinuxStorage.h>
+#include <platform/Linux/CHIPLinuxStorageLog.h>
 
 namespace chip {
 namespace DeviceLayer {
@@ -43,7 +45,11 @@ public:
     CHIP_ERROR _Put(const char * key, const void * value, size_t value_size);
 
 private:
+#if CHIP_DEVICE_CONFIG_LINUX_KVS_USE_LOG
+    DeviceLayer::Internal::ChipLinuxStorageLog mStorage;
+#else
     DeviceLayer::Internal::ChipLinuxStorage mStorage;
+#endif // CHIP_DEVICE_CONFIG_LINUX_KVS_USE_LOG
 
     // ===== Members for internal use by the following friends.
     friend KeyValueStoreManager & KeyValueStoreMgr();
@@ -21,10 +21,21 @@
 
 #include "OTAImageProcessorImpl.h"
 
+#include <lib/support/TypeTraits.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
 #include <sys/stat.h>
+#include <unistd.h>
 
 namespace chip {
 
+OTAImageProcessorImpl::~OTAImageProcessorImpl()
+{
+    StopWriter();
+}
+
 CHIP_ERROR OTAImageProcessorImpl::PrepareDownload()
 {
     if (mImageFile == nullptr)
@@ -59,19 +70,34 @@ CHIP_ERROR OTAImageProcessorImpl::Abort()
 
 CHIP_ERROR OTAImageProcessorImpl::ProcessBlock(ByteSpan & block)
 {
-    if (!mOfs.is_open() || !mOfs.good())
+    VerifyOrReturnError(mWriterState == WriterState::kWriting, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mDownloader != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    // The header is parsed here, and only the payload is handed over to the writer thread. The downloader is told about
+    // failures from a separate event, as it cannot end the download while it is delivering a block.
+    ByteSpan payload = block;
+    if (ProcessHeader(payload) != CHIP_NO_ERROR)
     {
-        return CHIP_ERROR_INTERNAL;
+        ChipLogError(SoftwareUpdate, "Image does not contain a valid header");
+        return DeviceLayer::PlatformMgr().ScheduleWork(HandleInvalidHeader, reinterpret_cast<intptr_t>(this));
     }
 
-    // Store block data for HandleProcessBlock to access
-    CHIP_ERROR err = SetBlock(block);
+    bool canFetchNext = true;
+    CHIP_ERROR err    = QueueWrite(payload, canFetchNext);
     if (err != CHIP_NO_ERROR)
     {
-        ChipLogError(SoftwareUpdate, "Cannot set block data: %" CHIP_ERROR_FORMAT, err.Format());
+        ChipLogError(SoftwareUpdate, "Cannot queue block data: %" CHIP_ERROR_FORMAT, err.Format());
+        return err;
+    }
+
+    mParams.downloadedBytes += payload.size();
+    if (!canFetchNext)
+    {
+        // The writer thread requests the next block once it has written this one
+        return CHIP_NO_ERROR;
     }
 
-    return DeviceLayer::PlatformMgr().ScheduleWork(HandleProcessBlock, reinterpret_cast<intptr_t>(this));
+    return DeviceLayer::PlatformMgr().ScheduleWork(HandleFetchNextData, reinterpret_cast<intptr_t>(this));
 }
 
 bool OTAImageProcessorImpl::IsFirstImageRun()
@@ -120,15 +146,20 @@ void OTAImageProcessorImpl::HandlePrepareDownload(intptr_t context)
         return;
     }
 
+    imageProcessor->StopWriter();
     unlink(imageProcessor->mImageFile);
 
     imageProcessor->mParams.downloadedBytes = 0;
     imageProcessor->mParams.totalFileBytes  = 0;
     imageProcessor->mHeaderParser.Init();
-    imageProcessor->mOfs.open(imageProcessor->mImageFile, std::ofstream::out | std::ofstream::ate | std::ofstream::app);
-    if (!imageProcessor->mOfs.good())
+    imageProcessor->mApplyPending = false;
+
+    CHIP_ERROR err = imageProcessor->StartWriter();
+    if (err != CHIP_NO_ERROR)
     {
-        TEMPORARY_RETURN_IGNORED imageProcessor->mDownloader->OnPreparedForDownload(CHIP_ERROR_OPEN_FAILED);
+        ChipLogError(SoftwareUpdate, "Cannot start image writer: %" CHIP_ERROR_FORMAT, err.Format());
+        imageProcessor->StopWriter();
+        TEMPORARY_RETURN_IGNORED imageProcessor->mDownloader->OnPreparedForDownload(err);
         return;
     }
 
@@ -138,15 +169,30 @@ void OTAImageProcessorImpl::HandlePrepareDownload(intptr_t context)
 void OTAImageProcessorImpl::HandleFinalize(intptr_t context)
 {
     auto * imageProcessor = reinterpret_cast<OTAImageProcessorImpl *>(context);
-    if (imageProcessor == nullptr)
+    if (imageProcessor == nullptr || imageProcessor->mWriterState != WriterState::kWriting)
     {
         return;
     }
 
-    imageProcessor->mOfs.close();
-    TEMPORARY_RETURN_IGNORED imageProcessor->ReleaseBlock();
+    if (imageProcessor->mHeaderParser.IsInitialized() ||
+        imageProcessor->mParams.downloadedBytes != imageProcessor->mParams.totalFileBytes)
+    {
+        ChipLogError(SoftwareUpdate, "OTA image is truncated: %" PRIu64 " of %" PRIu64 " payload bytes received",
+                     imageProcessor->mParams.downloadedBytes, imageProcessor->mParams.totalFileBytes);
+        imageProcessor->StopWriter();
+        unlink(imageProcessor->mImageFile);
+        imageProcessor->mWriterState = WriterState::kFailed;
+        imageProcessor->ReportFailure(CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+        return;
+    }
 
-    ChipLogProgress(SoftwareUpdate, "OTA image downloaded to %s", imageProcessor->mImageFile);
+    // The writer thread verifies the image once it has written the queued blocks, then posts HandleWriterDone
+    {
+        std::lock_guard<std::mutex> lock(imageProcessor->mWriteMutex);
+        imageProcessor->mFinalizeRequested = true;
+    }
+    imageProcessor->mWriteCondition.notify_one();
+    imageProcessor->mWriterState = WriterState::kFinalizing;
 }
 
 void OTAImageProcessorImpl::HandleApply(intptr_t context)
@@ -154,19 +200,20 @@ void OTAImageProcessorImpl::HandleApply(intptr_t context)
     auto * imageProcessor = reinterpret_cast<OTAImageProcessorImpl *>(context);
     VerifyOrReturn(imageProcessor != nullptr);
 
-    OTARequestorInterface * requestor = chip::GetRequestorInstance();
-    VerifyOrReturn(requestor != nullptr);
-
-    // Move the downloaded image to the location where the new image is to be executed from
-    unlink(kImageExecPath);
-    rename(imageProcessor->mImageFile, kImageExecPath);
-    chmod(kImageExecPath, S_IRUSR | S_IWUSR | S_IXUSR | S_IRGRP | S_IXGRP | S_IROTH | S_IXOTH);
-
-    // Shutdown the stack and expect to boot into the new image once the event loop is stopped
-    TEMPORARY_RETURN_IGNORED DeviceLayer::PlatformMgr().ScheduleWork(
-        [](intptr_t) { DeviceLayer::PlatformMgr().HandleServerShuttingDown(); });
-    TEMPORARY_RETURN_IGNORED DeviceLayer::PlatformMgr().ScheduleWork(
-        [](intptr_t) { TEMPORARY_RETURN_IGNORED DeviceLayer::PlatformMgr().StopEventLoopTask(); });
+    switch (imageProcessor->mWriterState)
+    {
+    case WriterState::kComplete:
+        imageProcessor->ApplyImage();
+        break;
+    case WriterState::kFinalizing:
+        // Applied from HandleWriterDone, as soon as the image is verified
+        imageProcessor->mApplyPending = true;
+        break;
+    default:
+        ChipLogError(SoftwareUpdate, "No verified OTA image to apply");
+        imageProcessor->ReportFailure(CHIP_ERROR_INCORRECT_STATE);
+        break;
+    }
 }
 
 void OTAImageProcessorImpl::HandleAbort(intptr_t context)
@@ -177,42 +224,105 @@ void OTAImageProcessorImpl::HandleAbort(intptr_t context)
         return;
     }
 
-    imageProcessor->mOfs.close();
+    imageProcessor->StopWriter();
     unlink(imageProcessor->mImageFile);
-    TEMPORARY_RETURN_IGNORED imageProcessor->ReleaseBlock();
+    imageProcessor->mWriterState = WriterState::kIdle;
 }
 
-void OTAImageProcessorImpl::HandleProcessBlock(intptr_t context)
+void OTAImageProcessorImpl::HandleFetchNextData(intptr_t context)
 {
     auto * imageProcessor = reinterpret_cast<OTAImageProcessorImpl *>(context);
-    if (imageProcessor == nullptr)
+    VerifyOrReturn(imageProcessor != nullptr && imageProcessor->mWriterState == WriterState::kWriting);
+
+    TEMPORARY_RETURN_IGNORED imageProcessor->mDownloader->FetchNextData();
+}
+
+void OTAImageProcessorImpl::HandleInvalidHeader(intptr_t context)
+{
+    auto * imageProcessor = reinterpret_cast<OTAImageProcessorImpl *>(context);
+    VerifyOrReturn(imageProcessor != nullptr && imageProcessor->mWriterState == WriterState::kWriting);
+
+    imageProcessor->mDownloader->EndDownload(CHIP_ERROR_INVALID_FILE_IDENTIFIER);
+}
+
+void OTAImageProcessorImpl::HandleWriterDone(intptr_t context)
+{
+    auto * imageProcessor = reinterpret_cast<OTAImageProcessorImpl *>(context);
+    VerifyOrReturn(imageProcessor != nullptr);
+
+    // The writer thread may have been stopped, and another one started, since it posted this event
+    CHIP_ERROR result;
     {
-        ChipLogError(SoftwareUpdate, "ImageProcessor context is null");
-        return;
+        std::lock_guard<std::mutex> lock(imageProcessor->mWriteMutex);
+        VerifyOrReturn(imageProcessor->mWriterDone);
+        result = imageProcessor->mWriterResult;
     }
-    else if (imageProcessor->mDownloader == nullptr)
+    VerifyOrReturn(imageProcessor->mWriterState == WriterState::kWriting ||
+                   imageProcessor->mWriterState == WriterState::kFinalizing);
+
+    const bool finalizing   = (imageProcessor->mWriterState == WriterState::kFinalizing);
+    imageProcessor->StopWriter();
+
+    if (!finalizing)
     {
-        ChipLogError(SoftwareUpdate, "mDownloader is null");
+        // Only a write failure stops the writer thread before the download is finalized. The downloader aborts the
+        // download, which removes the image file.
+        ChipLogError(SoftwareUpdate, "Cannot write OTA image: %" CHIP_ERROR_FORMAT, result.Format());
+        imageProcessor->mWriterState = WriterState::kFailed;
+        imageProcessor->mDownloader->EndDownload(CHIP_ERROR_WRITE_FAILED);
         return;
     }
 
-    ByteSpan block   = imageProcessor->mBlock;
-    CHIP_ERROR error = imageProcessor->ProcessHeader(block);
-    if (error != CHIP_NO_ERROR)
+    if (result != CHIP_NO_ERROR)
     {
-        ChipLogError(SoftwareUpdate, "Image does not contain a valid header");
-        imageProcessor->mDownloader->EndDownload(CHIP_ERROR_INVALID_FILE_IDENTIFIER);
+        ChipLogError(SoftwareUpdate, "OTA image verification failed: %" CHIP_ERROR_FORMAT, result.Format());
+        unlink(imageProcessor->mImageFile);
+        imageProcessor->mWriterState = WriterState::kFailed;
+        imageProcessor->ReportFailure(result);
         return;
     }
 
-    if (!imageProcessor->mOfs.write(reinterpret_cast<const char *>(block.data()), static_cast<std::streamsize>(block.size())))
+    imageProcessor->mWriterState = WriterState::kComplete;
+    ChipLogProgress(SoftwareUpdate, "OTA image downloaded to %s", imageProcessor->mImageFile);
+
+    if (imageProcessor->mApplyPending)
     {
-        imageProcessor->mDownloader->EndDownload(CHIP_ERROR_WRITE_FAILED);
+        imageProcessor->ApplyImage();
+    }
+}
+
+void OTAImageProcessorImpl::ReportFailure(CHIP_ERROR error)
+{
+    if (mDownloader != nullptr && mDownloader->GetState() == OTADownloader::State::kInProgress)
+    {
+        // The downloader aborts the transfer and reports the failure to the requestor
+        mDownloader->EndDownload(error);
         return;
     }
 
-    imageProcessor->mParams.downloadedBytes += block.size();
-    TEMPORARY_RETURN_IGNORED imageProcessor->mDownloader->FetchNextData();
+    // The transfer has already completed, so the requestor is cancelling the update instead
+    OTARequestorInterface * requestor = chip::GetRequestorInstance();
+    VerifyOrReturn(requestor != nullptr);
+    requestor->CancelImageUpdate();
+}
+
+void OTAImageProcessorImpl::ApplyImage()
+{
+    mApplyPending = false;
+
+    OTARequestorInterface * requestor = chip::GetRequestorInstance();
+    VerifyOrReturn(requestor != nullptr);
+
+    // Move the downloaded image to the location where the new image is to be executed from
+    unlink(kImageExecPath);
+    rename(mImageFile, kImageExecPath);
+    chmod(kImageExecPath, S_IRUSR | S_IWUSR | S_IXUSR | S_IRGRP | S_IXGRP | S_IROTH | S_IXOTH);
+
+    // Shutdown the stack and expect to boot into the new image once the event loop is stopped
+    TEMPORARY_RETURN_IGNORED DeviceLayer::PlatformMgr().ScheduleWork(
+        [](intptr_t) { DeviceLayer::PlatformMgr().HandleServerShuttingDown(); });
+    TEMPORARY_RETURN_IGNORED DeviceLayer::PlatformMgr().ScheduleWork(
+        [](intptr_t) { TEMPORARY_RETURN_IGNORED DeviceLayer::PlatformMgr().StopEventLoopTask(); });
 }
 
 CHIP_ERROR OTAImageProcessorImpl::ProcessHeader(ByteSpan & block)
@@ -227,49 +337,191 @@ CHIP_ERROR OTAImageProcessorImpl::ProcessHeader(ByteSpan & block)
         ReturnErrorOnFailure(error);
 
         mParams.totalFileBytes = header.mPayloadSize;
+
+        // The header digest points to the parser buffer, so it must be copied before the parser is cleared
+        error = SetExpectedDigest(header);
         mHeaderParser.Clear();
+        ReturnErrorOnFailure(error);
     }
 
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR OTAImageProcessorImpl::SetBlock(ByteSpan & block)
+CHIP_ERROR OTAImageProcessorImpl::SetExpectedDigest(const OTAImageHeader & header)
 {
-    if (block.empty())
+    switch (header.mImageDigestType)
     {
-        TEMPORARY_RETURN_IGNORED ReleaseBlock();
-        return CHIP_NO_ERROR;
+    case OTAImageDigestType::kSha256:
+    case OTAImageDigestType::kSha256_128:
+    case OTAImageDigestType::kSha256_120:
+    case OTAImageDigestType::kSha256_96:
+    case OTAImageDigestType::kSha256_64:
+    case OTAImageDigestType::kSha256_32:
+        // Truncated digests are the leading bytes of the SHA-256 digest
+        VerifyOrReturnError(!header.mImageDigest.empty() && header.mImageDigest.size() <= sizeof(mExpectedDigest),
+                            CHIP_ERROR_INVALID_FILE_IDENTIFIER);
+        memcpy(mExpectedDigest, header.mImageDigest.data(), header.mImageDigest.size());
+        mExpectedDigestLength = header.mImageDigest.size();
+        break;
+    default:
+        ChipLogError(SoftwareUpdate, "Image digest type %u is not supported, the image will not be verified",
+                     to_underlying(header.mImageDigestType));
+        mExpectedDigestLength = 0;
+        break;
     }
-    if (mBlock.size() < block.size())
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR OTAImageProcessorImpl::QueueWrite(const ByteSpan & block, bool & canFetchNext)
+{
     {
-        if (!mBlock.empty())
+        std::lock_guard<std::mutex> lock(mWriteMutex);
+
+        if (!block.empty())
         {
-            TEMPORARY_RETURN_IGNORED ReleaseBlock();
+            VerifyOrReturnError(mWriteCount < kWriteQueueDepth, CHIP_ERROR_NO_MEMORY);
+
+            // Slots keep their buffer from one block to the next, so they are only allocated for the first blocks
+            WriteSlot & slot = mWriteSlots[(mWriteHead + mWriteCount) % kWriteQueueDepth];
+            if (slot.buffer.AllocatedSize() < block.size())
+            {
+                slot.buffer.Alloc(block.size());
+                VerifyOrReturnError(slot.buffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+            }
+            memcpy(slot.buffer.Get(), block.data(), block.size());
+            slot.length = block.size();
+            mWriteCount++;
         }
-        uint8_t * mBlock_ptr = static_cast<uint8_t *>(chip::Platform::MemoryAlloc(block.size()));
-        if (mBlock_ptr == nullptr)
+
+        canFetchNext  = (mWriteCount < kWriteQueueDepth);
+        mFetchPending = !canFetchNext;
+    }
+
+    mWriteCondition.notify_one();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR OTAImageProcessorImpl::StartWriter()
+{
+    mFd = open(mImageFile, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+    VerifyOrReturnError(mFd >= 0, CHIP_ERROR_OPEN_FAILED);
+
+    ReturnErrorOnFailure(mDigest.Begin());
+    mExpectedDigestLength = 0;
+    mWriterResult         = CHIP_NO_ERROR;
+    mWriteHead            = 0;
+    mWriteCount           = 0;
+    mFetchPending         = false;
+    mFinalizeRequested    = false;
+    mStopRequested        = false;
+    mWriterDone           = false;
+
+    mWriterThread = std::thread(&OTAImageProcessorImpl::RunWriter, this);
+    mWriterState  = WriterState::kWriting;
+    return CHIP_NO_ERROR;
+}
+
+void OTAImageProcessorImpl::StopWriter()
+{
+    if (mWriterThread.joinable())
+    {
         {
-            return CHIP_ERROR_NO_MEMORY;
+            std::lock_guard<std::mutex> lock(mWriteMutex);
+            mStopRequested = true;
         }
-        mBlock = MutableByteSpan(mBlock_ptr, block.size());
+        mWriteCondition.notify_one();
+        mWriterThread.join();
     }
-    CHIP_ERROR err = CopySpanToMutableSpan(block, mBlock);
-    if (err != CHIP_NO_ERROR)
+
+    if (mFd >= 0)
     {
-        ChipLogError(SoftwareUpdate, "Cannot copy block data: %" CHIP_ERROR_FORMAT, err.Format());
-        return err;
+        close(mFd);
+        mFd = -1;
     }
-    return CHIP_NO_ERROR;
+
+    mDigest.Clear();
+    for (auto & slot : mWriteSlots)
+    {
+        slot.buffer.Free();
+        slot.length = 0;
+    }
+    mWriteHead  = 0;
+    mWriteCount = 0;
+    mWriterDone = false;
+}
+
+void OTAImageProcessorImpl::RunWriter()
+{
+    std::unique_lock<std::mutex> lock(mWriteMutex);
+
+    while (true)
+    {
+        mWriteCondition.wait(lock, [this] { return mStopRequested || mWriteCount > 0 || mFinalizeRequested; });
+        VerifyOrReturn(!mStopRequested);
+
+        if (mWriteCount == 0)
+        {
+            // Finalize requested, and all the blocks are written
+            mWriterResult = VerifyDigest();
+            break;
+        }
+
+        const WriteSlot & slot = mWriteSlots[mWriteHead];
+        lock.unlock();
+        CHIP_ERROR err = WriteBlock(ByteSpan(slot.buffer.Get(), slot.length));
+        lock.lock();
+
+        if (err != CHIP_NO_ERROR)
+        {
+            mWriterResult = err;
+            break;
+        }
+
+        mWriteHead = (mWriteHead + 1) % kWriteQueueDepth;
+        mWriteCount--;
+        if (mFetchPending)
+        {
+            mFetchPending = false;
+            TEMPORARY_RETURN_IGNORED DeviceLayer::PlatformMgr().ScheduleWork(HandleFetchNextData, reinterpret_cast<intptr_t>(this));
+        }
+    }
+
+    mWriterDone = true;
+    TEMPORARY_RETURN_IGNORED DeviceLayer::PlatformMgr().ScheduleWork(HandleWriterDone, reinterpret_cast<intptr_t>(this));
 }
 
-CHIP_ERROR OTAImageProcessorImpl::ReleaseBlock()
+CHIP_ERROR OTAImageProcessorImpl::WriteBlock(const ByteSpan & block)
 {
-    if (mBlock.data() != nullptr)
+    ReturnErrorOnFailure(mDigest.AddData(block));
+
+    const uint8_t * data = block.data();
+    size_t remaining     = block.size();
+    while (remaining > 0)
     {
-        chip::Platform::MemoryFree(mBlock.data());
+        ssize_t written = write(mFd, data, remaining);
+        if (written < 0)
+        {
+            VerifyOrReturnError(errno == EINTR, CHIP_ERROR_POSIX(errno));
+            continue;
+        }
+        data += written;
+        remaining -= static_cast<size_t>(written);
     }
 
-    mBlock = MutableByteSpan();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR OTAImageProcessorImpl::VerifyDigest()
+{
+    uint8_t digestBuffer[Crypto::kSHA256_Hash_Length];
+    MutableByteSpan digest(digestBuffer);
+    ReturnErrorOnFailure(mDigest.Finish(digest));
+
+    // The digest type is not supported, which has already been logged
+    VerifyOrReturnError(mExpectedDigestLength > 0, CHIP_NO_ERROR);
+    VerifyOrReturnError(memcmp(digest.data(), mExpectedDigest, mExpectedDigestLength) == 0, CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+
     return CHIP_NO_ERROR;
 }
 
@@ -19,20 +19,34 @@
 #pragma once
 
 #include <app/clusters/ota-requestor/OTADownloader.h>
+#include <crypto/CHIPCryptoPAL.h>
 #include <lib/core/OTAImageHeader.h>
+#include <lib/support/ScopedMemoryBuffer.h>
 #include <platform/CHIPDeviceLayer.h>
 #include <platform/OTAImageProcessor.h>
 
-#include <fstream>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 namespace chip {
 
 // Full file path to where the new image will be executed from post-download
 static constexpr char kImageExecPath[] = "/tmp/ota.update";
 
+/**
+ * OTA image processor writing the image payload to a file.
+ *
+ * The header is parsed on the Matter thread as blocks arrive, and the payload is handed over to
+ * a writer thread through a bounded queue. The writer thread writes the file and computes the
+ * payload digest as it goes, so that the image is verified as soon as the last block is written.
+ * The next block is only requested from the downloader while the queue has room.
+ */
 class OTAImageProcessorImpl : public OTAImageProcessorInterface
 {
 public:
+    ~OTAImageProcessorImpl() override;
+
     //////////// OTAImageProcessorInterface Implementation ///////////////
     CHIP_ERROR PrepareDownload() override;
     CHIP_ERROR Finalize() override;
@@ -46,30 +60,97 @@ public:
     void SetOTAImageFile(const char * imageFile) { mImageFile = imageFile; }
 
 private:
+    friend class TestLinuxOTAImageProcessor;
+
+    enum class WriterState : uint8_t
+    {
+        kIdle,       ///< No download in progress
+        kWriting,    ///< Download in progress, blocks are queued for the writer thread
+        kFinalizing, ///< All blocks received, the writer thread is writing the last ones and verifying the image
+        kComplete,   ///< The image is written and verified
+        kFailed,     ///< The image could not be written or verified
+    };
+
+    struct WriteSlot
+    {
+        Platform::ScopedMemoryBufferWithSize<uint8_t> buffer;
+        size_t length = 0;
+    };
+
+    static constexpr size_t kWriteQueueDepth = CHIP_DEVICE_CONFIG_OTA_IMAGE_WRITE_QUEUE_DEPTH;
+    static_assert(kWriteQueueDepth > 0, "CHIP_DEVICE_CONFIG_OTA_IMAGE_WRITE_QUEUE_DEPTH must be at least 1");
+
     //////////// Actual handlers for the OTAImageProcessorInterface ///////////////
     static void HandlePrepareDownload(intptr_t context);
     static void HandleFinalize(intptr_t context);
     static void HandleApply(intptr_t context);
     static void HandleAbort(intptr_t context);
-    static void HandleProcessBlock(intptr_t context);
+
+    //////////// Handlers for the writer thread events, run on the Matter thread ///////////////
+    static void HandleFetchNextData(intptr_t context);
+    static void HandleInvalidHeader(intptr_t context);
+    static void HandleWriterDone(intptr_t context);
 
     CHIP_ERROR ProcessHeader(ByteSpan & block);
+    CHIP_ERROR SetExpectedDigest(const OTAImageHeader & header);
+
+    /**
+     * Copy the block to the write queue. Returns whether the queue has room for the next block; if not, the writer thread
+     * requests the next block once it has written one.
+     */
+    CHIP_ERROR QueueWrite(const ByteSpan & block, bool & canFetchNext);
+
+    CHIP_ERROR StartWriter();
+
+    /**
+     * Called on the Matter thread to stop the writer thread, dropping the queued blocks, and close the image file
+     */
+    void StopWriter();
 
     /**
-     * Called to allocate memory for mBlock if necessary and set it to block
+     * Writer thread main loop
      */
-    CHIP_ERROR SetBlock(ByteSpan & block);
+    void RunWriter();
+    CHIP_ERROR WriteBlock(const ByteSpan & block);
+    CHIP_ERROR VerifyDigest();
 
     /**
-     * Called to release allocated memory for mBlock
+     * Report a truncated or unverified image: through the downloader while the transfer is in progress, otherwise by
+     * cancelling the update on the requestor
      */
-    CHIP_ERROR ReleaseBlock();
+    void ReportFailure(CHIP_ERROR error);
+    void ApplyImage();
 
-    std::ofstream mOfs;
-    MutableByteSpan mBlock;
     OTADownloader * mDownloader;
     OTAImageHeaderParser mHeaderParser;
     const char * mImageFile = nullptr;
+    int mFd                 = -1;
+
+    // Only accessed from the Matter thread
+    WriterState mWriterState = WriterState::kIdle;
+    bool mApplyPending       = false;
+
+    std::thread mWriterThread;
+    std::mutex mWriteMutex;
+    std::condition_variable mWriteCondition;
+
+    // Protected by mWriteMutex, except for the content of the slots being written: the writer thread owns the
+    // mWriteCount slots starting at mWriteHead, the Matter thread owns the others
+    WriteSlot mWriteSlots[kWriteQueueDepth];
+    size_t mWriteHead       = 0;
+    size_t mWriteCount      = 0;
+    bool mFetchPending      = false;
+    bool mFinalizeRequested = false;
+    bool mStopRequested     = false;
+    bool mWriterDone        = false;
+
+    // Set on the Matter thread before the first payload byte is queued, then only used by the writer thread
+    Crypto::Hash_SHA256_stream mDigest;
+    uint8_t mExpectedDigest[Crypto::kSHA256_Hash_Length];
+    size_t mExpectedDigestLength = 0;
+
+    // Protected by mWriteMutex, set by the writer thread before it posts HandleWriterDone
+    CHIP_ERROR mWriterResult = CHIP_NO_ERROR;
 };
 
 } // namespace chip
@@ -0,0 +1,371 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test suite for the writer pipeline of
+ *      the Linux OTA image processor.
+ *
+ */
+
+#include <signal.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <app/clusters/ota-requestor/OTADownloader.h>
+#include <app/clusters/ota-requestor/OTARequestorInterface.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/UnitTestUtils.h>
+#include <platform/CHIPDeviceLayer.h>
+#include <platform/Linux/OTAImageProcessorImpl.h> // nogncheck
+#include <platform/TestOnlyCommissionableDataProvider.h>
+
+#include <string>
+
+#if !CHIP_DEVICE_CONFIG_ENABLE_OTA_REQUESTOR
+// The Linux platform only builds the image processor along with the OTA requestor
+#include <platform/Linux/OTAImageProcessorImpl.cpp> // nogncheck
+#endif
+
+using namespace chip::DeviceLayer;
+
+namespace chip {
+
+namespace {
+
+// The Linux platform tests do not link the OTA requestor, which owns the global requestor instance
+OTARequestorInterface * gRequestorInstance = nullptr;
+
+} // namespace
+
+void SetRequestorInstance(OTARequestorInterface * instance)
+{
+    gRequestorInstance = instance;
+}
+
+OTARequestorInterface * GetRequestorInstance()
+{
+    return gRequestorInstance;
+}
+
+namespace {
+
+// Header with a SHA-256 digest of the 12 byte payload "test payload", as in TestOTAImageHeader
+const uint8_t kOtaImage[] = { 0x1e, 0xf1, 0xee, 0x1b, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00,
+                              0x15, 0x25, 0x00, 0xad, 0xde, 0x25, 0x01, 0xef, 0xbe, 0x26, 0x02, 0xff, 0xff, 0xff, 0xff, 0x2c,
+                              0x03, 0x03, 0x31, 0x2e, 0x30, 0x24, 0x04, 0x0c, 0x24, 0x05, 0x01, 0x24, 0x06, 0x02, 0x2c, 0x07,
+                              0x0a, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3a, 0x2f, 0x2f, 0x72, 0x6e, 0x24, 0x08, 0x01, 0x30, 0x09,
+                              0x20, 0x81, 0x3c, 0xa5, 0x28, 0x5c, 0x28, 0xcc, 0xee, 0x5c, 0xab, 0x8b, 0x10, 0xeb, 0xda, 0x9c,
+                              0x90, 0x8f, 0xd6, 0xd7, 0x8e, 0xd9, 0xdc, 0x94, 0xcc, 0x65, 0xea, 0x6c, 0xb6, 0x7a, 0x7f, 0x13,
+                              0xae, 0x18, 0x74, 0x65, 0x73, 0x74, 0x20, 0x70, 0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64 };
+
+constexpr char kPayload[]         = "test payload";
+constexpr size_t kPayloadLength   = sizeof(kPayload) - 1;
+constexpr size_t kPayloadOffset   = sizeof(kOtaImage) - kPayloadLength;
+constexpr uint32_t kWaitTimeoutMs = 5000;
+
+class FakeDownloader : public OTADownloader
+{
+public:
+    CHIP_ERROR BeginPrepareDownload() override { return CHIP_NO_ERROR; }
+
+    CHIP_ERROR OnPreparedForDownload(CHIP_ERROR status) override
+    {
+        mPrepared = true;
+        mState    = (status == CHIP_NO_ERROR) ? State::kInProgress : State::kIdle;
+        return CHIP_NO_ERROR;
+    }
+
+    void OnDownloadTimeout() override {}
+
+    void EndDownload(CHIP_ERROR reason) override
+    {
+        mEndDownloadCount++;
+        mEndDownloadReason = reason;
+        mState             = State::kIdle;
+    }
+
+    CHIP_ERROR FetchNextData() override
+    {
+        mFetchCount++;
+        return CHIP_NO_ERROR;
+    }
+
+    // The BDX downloader completes the transfer once it has acknowledged the last block
+    void CompleteTransfer() { mState = State::kComplete; }
+
+    bool mPrepared                = false;
+    size_t mFetchCount            = 0;
+    int mEndDownloadCount         = 0;
+    CHIP_ERROR mEndDownloadReason = CHIP_NO_ERROR;
+};
+
+class FakeRequestor : public OTARequestorInterface
+{
+public:
+    void HandleAnnounceOTAProvider(
+        app::CommandHandler * commandObj, const app::ConcreteCommandPath & commandPath,
+        const app::Clusters::OtaSoftwareUpdateRequestor::Commands::AnnounceOTAProvider::DecodableType & commandData) override
+    {}
+    void Reset() override {}
+    CHIP_ERROR TriggerImmediateQuery(FabricIndex fabricIndex) override { return CHIP_NO_ERROR; }
+    void TriggerImmediateQueryInternal() override {}
+    void DownloadUpdate() override {}
+    void DownloadUpdateDelayedOnUserConsent() override {}
+    void ApplyUpdate() override {}
+    void NotifyUpdateApplied() override {}
+    CHIP_ERROR GetUpdateStateProgressAttribute(EndpointId endpointId, app::DataModel::Nullable<uint8_t> & progress) override
+    {
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR GetUpdateStateAttribute(EndpointId endpointId, OTAUpdateStateEnum & state) override { return CHIP_NO_ERROR; }
+    OTAUpdateStateEnum GetCurrentUpdateState() override { return OTAUpdateStateEnum::kDownloading; }
+    uint32_t GetTargetVersion() override { return 0; }
+    void CancelImageUpdate() override { mCancelCount++; }
+    CHIP_ERROR ClearDefaultOtaProviderList(FabricIndex fabricIndex) override { return CHIP_NO_ERROR; }
+    void SetCurrentProviderLocation(ProviderLocationType providerLocation) override {}
+    void SetMetadataForProvider(ByteSpan metadataForProvider) override {}
+    void GetProviderLocation(Optional<ProviderLocationType> & providerLocation) override {}
+    CHIP_ERROR AddDefaultOtaProvider(const ProviderLocationType & providerLocation) override { return CHIP_NO_ERROR; }
+    ProviderLocationList::Iterator GetDefaultOTAProviderListIterator() override { return mProviders.Begin(); }
+
+    int mCancelCount = 0;
+
+private:
+    ProviderLocationList mProviders;
+};
+
+} // namespace
+
+class TestLinuxOTAImageProcessor : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite()
+    {
+        ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR);
+
+        static TestOnlyCommissionableDataProvider commissionable_data_provider;
+        SetCommissionableDataProvider(&commissionable_data_provider);
+
+        ASSERT_EQ(PlatformMgr().InitChipStack(), CHIP_NO_ERROR);
+        ASSERT_EQ(PlatformMgr().StartEventLoopTask(), CHIP_NO_ERROR);
+    }
+
+    static void TearDownTestSuite()
+    {
+        TEMPORARY_RETURN_IGNORED PlatformMgr().StopEventLoopTask();
+        PlatformMgr().Shutdown();
+        Platform::MemoryShutdown();
+    }
+
+    void SetUp() override
+    {
+        mImageFile = "/tmp/chip_ota_image_test_" + std::to_string(getpid());
+        unlink(mImageFile.c_str());
+
+        SetRequestorInstance(&mRequestor);
+        mProcessor.SetOTADownloader(&mDownloader);
+        mProcessor.SetOTAImageFile(mImageFile.c_str());
+        mDownloader.SetImageProcessorDelegate(&mProcessor);
+
+        ASSERT_EQ(mProcessor.PrepareDownload(), CHIP_NO_ERROR);
+        ASSERT_TRUE(WaitFor([this] { return mDownloader.mPrepared; }));
+    }
+
+    void TearDown() override
+    {
+        // Events posted for the processor must run before it goes away
+        EXPECT_TRUE(DrainEvents());
+
+        SetRequestorInstance(nullptr);
+        unlink(mImageFile.c_str());
+    }
+
+    // Waits until the events already posted to the Matter thread have run
+    static bool DrainEvents()
+    {
+        bool drained = false;
+        PlatformMgr().LockChipStack();
+        TEMPORARY_RETURN_IGNORED PlatformMgr().ScheduleWork([](intptr_t context) { *reinterpret_cast<bool *>(context) = true; },
+                                                            reinterpret_cast<intptr_t>(&drained));
+        PlatformMgr().UnlockChipStack();
+        return WaitFor([&drained] { return drained; });
+    }
+
+    // Evaluates the condition on the Matter thread state until it holds, or the wait times out
+    template <typename Condition>
+    static bool WaitFor(Condition condition)
+    {
+        for (uint32_t t = 0; t < kWaitTimeoutMs; t++)
+        {
+            PlatformMgr().LockChipStack();
+            bool done = condition();
+            PlatformMgr().UnlockChipStack();
+            VerifyOrReturnValue(!done, true);
+            test_utils::SleepMillis(1);
+        }
+        return false;
+    }
+
+    // Like the downloader, only delivers the next block once the processor has fetched it
+    void ProcessBlocks(const uint8_t * image, size_t length, size_t blockSize)
+    {
+        size_t blockCount = 0;
+        for (size_t offset = 0; offset < length; offset += blockSize, blockCount++)
+        {
+            ASSERT_TRUE(WaitFor([this, blockCount] { return mDownloader.mFetchCount == blockCount; }));
+            ByteSpan block(image + offset, std::min(blockSize, length - offset));
+            PlatformMgr().LockChipStack();
+            EXPECT_EQ(mProcessor.ProcessBlock(block), CHIP_NO_ERROR);
+            PlatformMgr().UnlockChipStack();
+        }
+    }
+
+    bool WriterStateIs(OTAImageProcessorImpl::WriterState state)
+    {
+        return WaitFor([this, state] { return mProcessor.mWriterState == state; });
+    }
+    bool WriterComplete() { return WriterStateIs(OTAImageProcessorImpl::WriterState::kComplete); }
+    bool WriterFailed() { return WriterStateIs(OTAImageProcessorImpl::WriterState::kFailed); }
+
+    bool ImageFileExists() { return access(mImageFile.c_str(), F_OK) == 0; }
+
+    std::string ReadImageFile()
+    {
+        std::string content;
+        FILE * file = fopen(mImageFile.c_str(), "rb");
+        VerifyOrReturnValue(file != nullptr, content);
+
+        char buffer[64];
+        size_t read;
+        while ((read = fread(buffer, 1, sizeof(buffer), file)) > 0)
+        {
+            content.append(buffer, read);
+        }
+        fclose(file);
+        return content;
+    }
+
+    std::string mImageFile;
+    FakeDownloader mDownloader;
+    FakeRequestor mRequestor;
+    OTAImageProcessorImpl mProcessor;
+};
+
+TEST_F(TestLinuxOTAImageProcessor, TestWriteVerifiedImage)
+{
+    // Small blocks split the header across blocks and fill the write queue
+    ProcessBlocks(kOtaImage, sizeof(kOtaImage), 5);
+    mDownloader.CompleteTransfer();
+    EXPECT_EQ(mProcessor.Finalize(), CHIP_NO_ERROR);
+
+    EXPECT_TRUE(WriterComplete());
+    EXPECT_EQ(ReadImageFile(), std::string(kPayload));
+    EXPECT_EQ(mDownloader.mEndDownloadCount, 0);
+    EXPECT_EQ(mRequestor.mCancelCount, 0);
+}
+
+TEST_F(TestLinuxOTAImageProcessor, TestWriteFailureEndsDownload)
+{
+    // Limit the size of the files this process writes, so that the payload cannot be written in full
+    struct rlimit savedLimit;
+    ASSERT_EQ(getrlimit(RLIMIT_FSIZE, &savedLimit), 0);
+    struct rlimit limit = savedLimit;
+    limit.rlim_cur      = kPayloadLength / 2;
+
+    sighandler_t savedHandler = signal(SIGXFSZ, SIG_IGN);
+    ASSERT_EQ(setrlimit(RLIMIT_FSIZE, &limit), 0);
+
+    ProcessBlocks(kOtaImage, sizeof(kOtaImage), kPayloadOffset);
+
+    EXPECT_TRUE(WriterFailed());
+    EXPECT_TRUE(WaitFor([this] { return mDownloader.mEndDownloadCount == 1; }));
+    EXPECT_EQ(mDownloader.mEndDownloadReason, CHIP_ERROR_WRITE_FAILED);
+
+    ASSERT_EQ(setrlimit(RLIMIT_FSIZE, &savedLimit), 0);
+    signal(SIGXFSZ, savedHandler);
+
+    // A block that was already in flight is refused, and the ended download is not asked for more
+    ASSERT_TRUE(DrainEvents());
+    const size_t fetchCount = mDownloader.mFetchCount;
+    ByteSpan block(kOtaImage + kPayloadOffset, kPayloadLength);
+    PlatformMgr().LockChipStack();
+    EXPECT_EQ(mProcessor.ProcessBlock(block), CHIP_ERROR_INCORRECT_STATE);
+    PlatformMgr().UnlockChipStack();
+    ASSERT_TRUE(DrainEvents());
+    EXPECT_EQ(mDownloader.mFetchCount, fetchCount);
+    EXPECT_EQ(mDownloader.mEndDownloadCount, 1);
+}
+
+TEST_F(TestLinuxOTAImageProcessor, TestTruncatedImageEndsDownload)
+{
+    ProcessBlocks(kOtaImage, sizeof(kOtaImage) - 4, 16);
+    EXPECT_EQ(mProcessor.Finalize(), CHIP_NO_ERROR);
+
+    EXPECT_TRUE(WriterFailed());
+    EXPECT_TRUE(WaitFor([this] { return mDownloader.mEndDownloadCount == 1; }));
+    EXPECT_EQ(mDownloader.mEndDownloadReason, CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+    EXPECT_EQ(mRequestor.mCancelCount, 0);
+    EXPECT_FALSE(ImageFileExists());
+
+    // There is no verified image to apply, so the update is cancelled
+    EXPECT_EQ(mProcessor.Apply(), CHIP_NO_ERROR);
+    EXPECT_TRUE(WaitFor([this] { return mRequestor.mCancelCount == 1; }));
+}
+
+TEST_F(TestLinuxOTAImageProcessor, TestDigestMismatchCancelsUpdate)
+{
+    uint8_t image[sizeof(kOtaImage)];
+    memcpy(image, kOtaImage, sizeof(image));
+    image[kPayloadOffset] ^= 0xFF;
+
+    ProcessBlocks(image, sizeof(image), 16);
+    mDownloader.CompleteTransfer();
+    EXPECT_EQ(mProcessor.Finalize(), CHIP_NO_ERROR);
+
+    EXPECT_TRUE(WriterFailed());
+    EXPECT_TRUE(WaitFor([this] { return mRequestor.mCancelCount == 1; }));
+    EXPECT_EQ(mDownloader.mEndDownloadCount, 0);
+    EXPECT_FALSE(ImageFileExists());
+}
+
+TEST_F(TestLinuxOTAImageProcessor, TestDigestMismatchBeforeApply)
+{
+    uint8_t image[sizeof(kOtaImage)];
+    memcpy(image, kOtaImage, sizeof(image));
+    image[sizeof(image) - 1] ^= 0xFF;
+
+    // Apply arrives while the image is being verified, and is dropped once the verification fails
+    ProcessBlocks(image, sizeof(image), 16);
+    PlatformMgr().LockChipStack();
+    EXPECT_EQ(mProcessor.Finalize(), CHIP_NO_ERROR);
+    EXPECT_EQ(mProcessor.Apply(), CHIP_NO_ERROR);
+    PlatformMgr().UnlockChipStack();
+
+    EXPECT_TRUE(WriterFailed());
+    EXPECT_TRUE(WaitFor([this] { return mDownloader.mEndDownloadCount == 1; }));
+    EXPECT_EQ(mDownloader.mEndDownloadReason, CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+    EXPECT_EQ(mRequestor.mCancelCount, 0);
+    EXPECT_FALSE(ImageFileExists());
+}
+
+} // namespace chip
@@ -0,0 +1,309 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test suite for the log-structured
+ *      Linux KVS storage, and compares its write throughput with the
+ *      INI storage.
+ *
+ */
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/CHIPDeviceConfig.h>
+#include <platform/Linux/CHIPLinuxStorage.h>
+#include <platform/Linux/CHIPLinuxStorageLog.h>
+#include <system/SystemClock.h>
+
+#include <string>
+
+using namespace chip;
+using namespace chip::DeviceLayer::Internal;
+
+namespace {
+
+struct TestLinuxStorageLog : public ::testing::Test
+{
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+
+    void SetUp() override
+    {
+        mPath = "/tmp/chip_kvs_log_test_" + std::to_string(getpid());
+        unlink(mPath.c_str());
+    }
+    void TearDown() override { unlink(mPath.c_str()); }
+
+    off_t FileSize()
+    {
+        FILE * file = fopen(mPath.c_str(), "rb");
+        VerifyOrReturnValue(file != nullptr, -1);
+        fseek(file, 0, SEEK_END);
+        off_t size = ftello(file);
+        fclose(file);
+        return size;
+    }
+
+    std::string mPath;
+};
+
+std::string ReadString(ChipLinuxStorageLog & storage, const char * key)
+{
+    char buf[64];
+    size_t len = 0;
+    VerifyOrReturnValue(storage.ReadValueBin(key, reinterpret_cast<uint8_t *>(buf), sizeof(buf), len) == CHIP_NO_ERROR,
+                        "<error>");
+    return std::string(buf, len);
+}
+
+CHIP_ERROR WriteString(ChipLinuxStorageLog & storage, const char * key, const char * value)
+{
+    return storage.WriteValueBin(key, reinterpret_cast<const uint8_t *>(value), strlen(value));
+}
+
+TEST_F(TestLinuxStorageLog, TestReadWriteDelete)
+{
+    ChipLinuxStorageLog storage;
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+
+    EXPECT_EQ(WriteString(storage, "a", "first"), CHIP_NO_ERROR);
+    EXPECT_EQ(WriteString(storage, "b", ""), CHIP_NO_ERROR);
+    EXPECT_EQ(WriteString(storage, "a", "second"), CHIP_NO_ERROR);
+    EXPECT_EQ(ReadString(storage, "a"), "second");
+    EXPECT_EQ(ReadString(storage, "b"), "");
+    EXPECT_TRUE(storage.HasValue("b"));
+
+    // Partial and offset reads.
+    uint8_t buf[4];
+    size_t len = 0;
+    EXPECT_EQ(storage.ReadValueBin("a", buf, 3, len), CHIP_ERROR_BUFFER_TOO_SMALL);
+    EXPECT_EQ(len, 3u);
+    EXPECT_EQ(memcmp(buf, "sec", 3), 0);
+    EXPECT_EQ(storage.ReadValueBin("a", buf, sizeof(buf), len, 3), CHIP_NO_ERROR);
+    EXPECT_EQ(len, 3u);
+    EXPECT_EQ(memcmp(buf, "ond", 3), 0);
+    EXPECT_EQ(storage.ReadValueBin("a", buf, sizeof(buf), len, 7), CHIP_ERROR_INVALID_ARGUMENT);
+
+    EXPECT_EQ(storage.ClearValue("a"), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.ClearValue("a"), CHIP_ERROR_KEY_NOT_FOUND);
+    EXPECT_EQ(storage.ReadValueBin("a", buf, sizeof(buf), len), CHIP_ERROR_KEY_NOT_FOUND);
+    EXPECT_EQ(storage.GetStats().mKeyCount, 1u);
+
+    EXPECT_EQ(storage.ClearAll(), CHIP_NO_ERROR);
+    EXPECT_FALSE(storage.HasValue("b"));
+}
+
+TEST_F(TestLinuxStorageLog, TestRecovery)
+{
+    {
+        ChipLinuxStorageLog storage;
+        ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+        EXPECT_EQ(WriteString(storage, "kept", "value"), CHIP_NO_ERROR);
+        EXPECT_EQ(WriteString(storage, "deleted", "value"), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.ClearValue("deleted"), CHIP_NO_ERROR);
+        EXPECT_EQ(WriteString(storage, "torn", "value"), CHIP_NO_ERROR);
+    }
+
+    // Simulate a crash in the middle of the last append.
+    const off_t size = FileSize();
+    ASSERT_GT(size, 3);
+    ASSERT_EQ(truncate(mPath.c_str(), size - 3), 0);
+
+    {
+        ChipLinuxStorageLog storage;
+        ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+        EXPECT_EQ(ReadString(storage, "kept"), "value");
+        EXPECT_FALSE(storage.HasValue("deleted"));
+        EXPECT_FALSE(storage.HasValue("torn"));
+
+        // The torn record was dropped, so new records are not hidden behind it.
+        EXPECT_EQ(WriteString(storage, "after", "crash"), CHIP_NO_ERROR);
+    }
+
+    // Damaged data is dropped as well.
+    {
+        const off_t damagedSize = FileSize();
+        int fd                  = open(mPath.c_str(), O_WRONLY);
+        ASSERT_GE(fd, 0);
+        EXPECT_EQ(pwrite(fd, "X", 1, damagedSize - 1), 1);
+        close(fd);
+    }
+
+    ChipLinuxStorageLog storage;
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(ReadString(storage, "kept"), "value");
+    EXPECT_FALSE(storage.HasValue("after"));
+}
+
+TEST_F(TestLinuxStorageLog, TestCompaction)
+{
+    ChipLinuxStorageLog storage;
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+
+    uint8_t value[256] = {};
+    for (size_t i = 0; i < 1000; i++)
+    {
+        value[0] = static_cast<uint8_t>(i);
+        ASSERT_EQ(storage.WriteValueBin("counter", value, sizeof(value)), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(WriteString(storage, "other", "value"), CHIP_NO_ERROR);
+
+    // 256 KB were written for a few hundred live bytes: the log was compacted automatically.
+    ChipLinuxStorageLog::Stats stats = storage.GetStats();
+    EXPECT_GT(stats.mCompactions, 0u);
+    EXPECT_LE(stats.mDeadBytes, static_cast<size_t>(CHIP_DEVICE_CONFIG_LINUX_KVS_LOG_COMPACTION_THRESHOLD));
+
+    EXPECT_EQ(storage.Compact(), CHIP_NO_ERROR);
+    stats = storage.GetStats();
+    EXPECT_EQ(stats.mDeadBytes, 0u);
+    EXPECT_EQ(static_cast<size_t>(FileSize()), stats.mLiveBytes + 8);
+
+    storage.Shutdown();
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+    size_t len = 0;
+    EXPECT_EQ(storage.ReadValueBin("counter", value, sizeof(value), len), CHIP_NO_ERROR);
+    EXPECT_EQ(len, sizeof(value));
+    EXPECT_EQ(value[0], static_cast<uint8_t>(999));
+    EXPECT_EQ(ReadString(storage, "other"), "value");
+}
+
+TEST_F(TestLinuxStorageLog, TestMigrationFromIni)
+{
+    {
+        ChipLinuxStorage ini;
+        ASSERT_EQ(ini.Init(mPath.c_str()), CHIP_NO_ERROR);
+        const uint8_t blob[] = { 0, 1, 2, 0xFF };
+        EXPECT_EQ(ini.WriteValueBin("g/fs/c", blob, sizeof(blob)), CHIP_NO_ERROR);
+        EXPECT_EQ(ini.WriteValueBin("key with spaces=", reinterpret_cast<const uint8_t *>("text"), 4), CHIP_NO_ERROR);
+        EXPECT_EQ(ini.Commit(), CHIP_NO_ERROR);
+    }
+
+    ChipLinuxStorageLog storage;
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.GetStats().mKeyCount, 2u);
+    EXPECT_EQ(ReadString(storage, "key with spaces="), "text");
+
+    uint8_t blob[8];
+    size_t len = 0;
+    EXPECT_EQ(storage.ReadValueBin("g/fs/c", blob, sizeof(blob), len), CHIP_NO_ERROR);
+    EXPECT_EQ(len, 4u);
+    EXPECT_EQ(blob[3], 0xFF);
+
+    // The file is now a log and is not migrated again.
+    EXPECT_EQ(WriteString(storage, "new", "value"), CHIP_NO_ERROR);
+    storage.Shutdown();
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.GetStats().mKeyCount, 3u);
+}
+
+TEST_F(TestLinuxStorageLog, TestDamagedHeader)
+{
+    {
+        ChipLinuxStorageLog storage;
+        ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+        EXPECT_EQ(WriteString(storage, "kept", "value"), CHIP_NO_ERROR);
+        EXPECT_EQ(WriteString(storage, "fabric=1", "value"), CHIP_NO_ERROR);
+    }
+    const off_t size = FileSize();
+
+    // A damaged magic must not get the log mistaken for an empty INI file, which would replace it.
+    {
+        int fd = open(mPath.c_str(), O_WRONLY);
+        ASSERT_GE(fd, 0);
+        EXPECT_EQ(pwrite(fd, "[DEFAULT", 8, 0), 8);
+        close(fd);
+    }
+
+    {
+        ChipLinuxStorageLog storage;
+        EXPECT_EQ(storage.Init(mPath.c_str()), CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+        EXPECT_FALSE(storage.HasValue("kept"));
+    }
+    EXPECT_EQ(FileSize(), size);
+
+    // Once the header is repaired, every key is still there.
+    {
+        int fd = open(mPath.c_str(), O_WRONLY);
+        ASSERT_GE(fd, 0);
+        EXPECT_EQ(pwrite(fd, "CHIPKVL1", 8, 0), 8);
+        close(fd);
+    }
+
+    ChipLinuxStorageLog storage;
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(ReadString(storage, "kept"), "value");
+    EXPECT_EQ(ReadString(storage, "fabric=1"), "value");
+}
+
+TEST_F(TestLinuxStorageLog, TestWriteThroughput)
+{
+    // Typical update pattern: a few counters and resumption records rewritten over and over among
+    // a set of mostly static keys (fabrics, certificates, ACLs).
+    constexpr size_t kStaticKeys = 50;
+    constexpr size_t kUpdates    = 200;
+    uint8_t value[400]           = {};
+    char key[32];
+
+    ChipLinuxStorage ini;
+    ASSERT_EQ(ini.Init(mPath.c_str()), CHIP_NO_ERROR);
+    for (size_t i = 0; i < kStaticKeys; i++)
+    {
+        snprintf(key, sizeof(key), "static/%u", static_cast<unsigned>(i));
+        ASSERT_EQ(ini.WriteValueBin(key, value, sizeof(value)), CHIP_NO_ERROR);
+    }
+    ASSERT_EQ(ini.Commit(), CHIP_NO_ERROR);
+
+    System::Clock::Microseconds64 start = System::SystemClock().GetMonotonicMicroseconds64();
+    for (size_t i = 0; i < kUpdates; i++)
+    {
+        snprintf(key, sizeof(key), "counter/%u", static_cast<unsigned>(i % 4));
+        value[0] = static_cast<uint8_t>(i);
+        ASSERT_EQ(ini.WriteValueBin(key, value, 64), CHIP_NO_ERROR);
+        ASSERT_EQ(ini.Commit(), CHIP_NO_ERROR);
+    }
+    System::Clock::Microseconds64 iniDuration = System::SystemClock().GetMonotonicMicroseconds64() - start;
+
+    // Migrates the INI file written above.
+    ChipLinuxStorageLog storage;
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.GetStats().mKeyCount, kStaticKeys + 4);
+
+    start = System::SystemClock().GetMonotonicMicroseconds64();
+    for (size_t i = 0; i < kUpdates; i++)
+    {
+        snprintf(key, sizeof(key), "counter/%u", static_cast<unsigned>(i % 4));
+        value[0] = static_cast<uint8_t>(i);
+        ASSERT_EQ(storage.WriteValueBin(key, value, 64), CHIP_NO_ERROR);
+    }
+    System::Clock::Microseconds64 logDuration = System::SystemClock().GetMonotonicMicroseconds64() - start;
+
+    ChipLogProgress(Test, "%u durable updates with %u other keys: INI %llu us, log %llu us (%u compactions)",
+                    static_cast<unsigned>(kUpdates), static_cast<unsigned>(kStaticKeys),
+                    static_cast<unsigned long long>(iniDuration.count()), static_cast<unsigned long long>(logDuration.count()),
+                    static_cast<unsigned>(storage.GetStats().mCompactions));
+}
+
+} // namespace
@@ -206,6 +206,66 @@ TEST_F(TestPlatformMgr, RunEventLoopStopBeforeSleep)
     PlatformMgr().Shutdown();
 }
 
+// Background work has to be processed without the application starting a background task,
+// which is the case when it runs on the Matter thread, or on the Linux background task pool.
+#if !CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING || CHIP_DEVICE_LAYER_TARGET_LINUX
+
+static std::atomic<int> sBackgroundWorkActive{ 0 };
+static std::atomic<int> sBackgroundWorkMaxActive{ 0 };
+static std::atomic<int> sAfterBackgroundWorkCount{ 0 };
+
+static void AfterBackgroundWork(intptr_t)
+{
+    sAfterBackgroundWorkCount++;
+}
+
+static void BackgroundWork(intptr_t)
+{
+    int active    = ++sBackgroundWorkActive;
+    int maxActive = sBackgroundWorkMaxActive.load();
+    while (active > maxActive && !sBackgroundWorkMaxActive.compare_exchange_weak(maxActive, active))
+    {
+    }
+
+    chip::test_utils::SleepMillis(10);
+    sBackgroundWorkActive--;
+
+    // Hand the result back to the Matter thread, as CASESession does.
+    RETURN_SAFELY_IGNORED PlatformMgr().ScheduleWork(AfterBackgroundWork);
+}
+
+TEST_F(TestPlatformMgr, ScheduleBackgroundWork)
+{
+    constexpr int kWorkCount = 8;
+
+    sBackgroundWorkMaxActive  = 0;
+    sAfterBackgroundWorkCount = 0;
+
+    EXPECT_EQ(PlatformMgr().InitChipStack(), CHIP_NO_ERROR);
+    EXPECT_EQ(PlatformMgr().StartEventLoopTask(), CHIP_NO_ERROR);
+
+    for (int i = 0; i < kWorkCount; i++)
+    {
+        EXPECT_SUCCESS(PlatformMgr().ScheduleBackgroundWork(BackgroundWork));
+    }
+
+    for (size_t t = 0; sAfterBackgroundWorkCount != kWorkCount && t < 5000; t++)
+        chip::test_utils::SleepMillis(1);
+
+    EXPECT_EQ(sAfterBackgroundWorkCount, kWorkCount);
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING && CHIP_DEVICE_CONFIG_BG_TASK_COUNT > 1
+    // Work items are processed in parallel by the background tasks.
+    EXPECT_GT(sBackgroundWorkMaxActive, 1);
+#else
+    EXPECT_EQ(sBackgroundWorkMaxActive, 1);
+#endif
+
+    EXPECT_EQ(PlatformMgr().StopEventLoopTask(), CHIP_NO_ERROR);
+    PlatformMgr().Shutdown();
+}
+
+#endif // !CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING || CHIP_DEVICE_LAYER_TARGET_LINUX
+
 TEST_F(TestPlatformMgr, TryLockChipStack)
 {
     EXPECT_EQ(PlatformMgr().InitChipStack(), CHIP_NO_ERROR);
@@ -114,7 +114,8 @@ CHIP_ERROR BdxTransferDiagnosticLog::OnMessageReceived(Messaging::ExchangeContex
         mTransferProxy.SetPeerNodeId(peerNodeId);
         auto flags(TransferControlFlags::kSenderDrive);
         ReturnLogErrorOnFailure(
-            Responder::PrepareForTransfer(mSystemLayer, kBdxRole, flags, kMaxBdxBlockSize, kBdxTimeout, kBdxPollInterval));
+            Responder::PrepareForTransfer(mSystemLayer, kBdxRole, flags, kMaxBdxBlockSize, kBdxTimeout, kBdxPollInterval,
+                                          CHIP_CONFIG_BDX_WINDOW_SIZE));
     }
 
     return TransferFacilitator::OnMessageReceived(ec, payloadHeader, std::move(payload));
@@ -130,9 +131,10 @@ CHIP_ERROR BdxTransferDiagnosticLog::OnMessageToSend(TransferSession::OutputEven
     bool isStatusReport = msgTypeData.HasMessageType(Protocols::SecureChannel::MsgType::StatusReport);
 
     // All messages sent from the Sender expect a response, except for a StatusReport which would indicate an error and
-    // the end of the transfer.
+    // the end of the transfer. In a windowed transfer, the response may already be expected for a previous acknowledgement.
     Messaging::SendFlags sendFlags;
-    VerifyOrDo(isStatusReport, sendFlags.Set(Messaging::SendMessageFlags::kExpectResponse));
+    VerifyOrDo(isStatusReport || mExchangeCtx->IsResponseExpected(), sendFlags.Set(Messaging::SendMessageFlags::kExpectResponse));
+    VerifyOrDo(!msgTypeData.NoAutoRequestAck, sendFlags.Set(Messaging::SendMessageFlags::kNoAutoRequestAck));
 
     // If there's an error sending the message, close the exchange by calling Reset.
     auto err = mExchangeCtx->SendMessage(msgTypeData.ProtocolId, msgTypeData.MessageType, std::move(event.MsgData), sendFlags);
@@ -51,6 +51,7 @@ CHIP_ERROR BDXTransferProxyDiagnosticLog::Accept()
     acceptData.MaxBlockSize = mTransfer->GetTransferBlockSize();
     acceptData.StartOffset  = mTransfer->GetStartOffset();
     acceptData.Length       = mTransfer->GetTransferLength();
+    acceptData.WindowSize   = mTransfer->GetTransferWindowSize();
 
     return mTransfer->AcceptTransfer(acceptData);
 }
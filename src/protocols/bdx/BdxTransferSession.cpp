@@ -6,8 +6,11 @@
 
 #include <protocols/bdx/BdxTransferSession.h>
 
+#include <lib/core/TLVReader.h>
+#include <lib/core/TLVWriter.h>
 #include <lib/support/BufferReader.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/ScopedMemoryBuffer.h>
 #include <lib/support/TypeTraits.h>
 #include <lib/support/logging/CHIPLogging.h>
 #include <protocols/Protocols.h>
@@ -17,11 +20,82 @@
 #include <system/SystemPacketBuffer.h>
 #include <transport/SessionManager.h>
 
+#include <algorithm>
+#include <string.h>
 #include <type_traits>
 
 namespace {
 constexpr uint8_t kBdxVersion = 0; ///< The version of this implementation of the BDX spec
 
+constexpr uint32_t kWindowSizeTagNum = 1; ///< Tag number of the window size element appended to Init and Accept metadata
+constexpr size_t kMaxWindowSizeElementLength = 8;
+
+constexpr chip::System::Clock::Milliseconds32 kWindowRetransmitTimeout(CHIP_CONFIG_BDX_WINDOW_RETRANSMIT_TIMEOUT);
+
+constexpr chip::TLV::Tag WindowSizeTag()
+{
+    return chip::TLV::ProfileTag(chip::Protocols::BDX::Id.ToFullyQualifiedSpecForm(), kWindowSizeTagNum);
+}
+
+/**
+ * @brief
+ *   Copy the application metadata into a new buffer and append the window size element to it.
+ */
+CHIP_ERROR AppendWindowSize(const uint8_t * metadata, size_t metadataLength, uint8_t windowSize,
+                            chip::Platform::ScopedMemoryBuffer<uint8_t> & buffer, size_t & bufferLength)
+{
+    VerifyOrReturnError(metadataLength <= UINT16_MAX - kMaxWindowSizeElementLength, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(buffer.Alloc(metadataLength + kMaxWindowSizeElementLength), CHIP_ERROR_NO_MEMORY);
+
+    if (metadataLength > 0)
+    {
+        memcpy(buffer.Get(), metadata, metadataLength);
+    }
+
+    chip::TLV::TLVWriter writer;
+    writer.Init(buffer.Get() + metadataLength, kMaxWindowSizeElementLength);
+    ReturnErrorOnFailure(writer.Put(WindowSizeTag(), windowSize));
+    ReturnErrorOnFailure(writer.Finalize());
+
+    bufferLength = metadataLength + writer.GetLengthWritten();
+    return CHIP_NO_ERROR;
+}
+
+/**
+ * @brief
+ *   Find the window size element in received metadata. If it is the last element, it is removed from metadataLength so the
+ *   application only sees its own metadata.
+ *
+ * @return The window size, or 1 if the peer did not propose or choose any (e.g. it does not support windowed transfers).
+ */
+uint8_t ExtractWindowSize(const uint8_t * metadata, size_t & metadataLength)
+{
+    VerifyOrReturnValue(metadata != nullptr && metadataLength > 0, 1);
+
+    chip::TLV::TLVReader reader;
+    reader.Init(metadata, metadataLength);
+
+    uint8_t windowSize  = 1;
+    size_t elementStart = 0;
+    size_t windowStart  = metadataLength;
+    while (reader.Next() == CHIP_NO_ERROR)
+    {
+        if (reader.GetTag() == WindowSizeTag() && reader.Get(windowSize) == CHIP_NO_ERROR)
+        {
+            windowStart = elementStart;
+        }
+        VerifyOrReturnValue(reader.Skip() == CHIP_NO_ERROR, 1);
+        elementStart = reader.GetLengthRead();
+    }
+
+    if (windowStart < metadataLength && elementStart == metadataLength)
+    {
+        metadataLength = windowStart;
+    }
+
+    return std::max<uint8_t>(windowSize, 1);
+}
+
 /**
  * @brief
  *   Allocate a new PacketBuffer and write data from a BDX message struct.
@@ -49,9 +123,10 @@ void PrepareOutgoingMessageEvent(MessageType messageType, chip::bdx::TransferSes
 {
     static_assert(std::is_same<std::underlying_type_t<decltype(messageType)>, uint8_t>::value, "Cast is not safe");
 
-    pendingOutput             = chip::bdx::TransferSession::OutputEventType::kMsgToSend;
-    outputMsgType.ProtocolId  = chip::Protocols::MessageTypeTraits<MessageType>::ProtocolId();
-    outputMsgType.MessageType = static_cast<uint8_t>(messageType);
+    pendingOutput                  = chip::bdx::TransferSession::OutputEventType::kMsgToSend;
+    outputMsgType.ProtocolId       = chip::Protocols::MessageTypeTraits<MessageType>::ProtocolId();
+    outputMsgType.MessageType      = static_cast<uint8_t>(messageType);
+    outputMsgType.NoAutoRequestAck = false;
 }
 
 } // anonymous namespace
@@ -82,6 +157,17 @@ void TransferSession::PollOutput(OutputEvent & event, System::Clock::Timestamp c
         return;
     }
 
+    if (mStatusReportDeferred && mPendingOutput == OutputEventType::kNone)
+    {
+        mStatusReportDeferred = false;
+        PrepareStatusReport(mStatusReportData.statusCode);
+    }
+
+    if (IsWindowed() && mPendingOutput == OutputEventType::kNone)
+    {
+        PrepareWindowOutput(curTime);
+    }
+
     switch (mPendingOutput)
     {
     case OutputEventType::kNone:
@@ -94,8 +180,14 @@ void TransferSession::PollOutput(OutputEvent & event, System::Clock::Timestamp c
         event = OutputEvent::StatusReportEvent(OutputEventType::kStatusReceived, mStatusReportData);
         break;
     case OutputEventType::kMsgToSend:
-        event             = OutputEvent::MsgToSendEvent(mMsgTypeData, std::move(mPendingMsgHandle));
-        mTimeoutStartTime = curTime;
+        event = OutputEvent::MsgToSendEvent(mMsgTypeData, std::move(mPendingMsgHandle));
+        // Retransmissions must not postpone the timeout, or a transfer with an unresponsive peer would never end.
+        if (!mIsRetransmission)
+        {
+            mTimeoutStartTime = curTime;
+        }
+        mWindowTimerStart = curTime;
+        mIsRetransmission = false;
         break;
     case OutputEventType::kInitReceived:
         event = OutputEvent::TransferInitEvent(mTransferRequestData, std::move(mPendingMsgHandle));
@@ -142,15 +234,25 @@ void TransferSession::GetNextAction(OutputEvent & event)
 CHIP_ERROR TransferSession::StartTransfer(TransferRole role, const TransferInitData & initData, System::Clock::Timeout timeout)
 {
     VerifyOrReturnError(mState == TransferState::kUnitialized, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(initData.MaxWindowSize <= kMaxWindowSize, CHIP_ERROR_INVALID_ARGUMENT);
 
     mRole    = role;
     mTimeout = timeout;
 
     // Set transfer parameters. They may be overridden later by an Accept message
-    mSuppportedXferOpts    = initData.TransferCtlFlags;
-    mMaxSupportedBlockSize = initData.MaxBlockSize;
-    mStartOffset           = initData.StartOffset;
-    mTransferLength        = initData.Length;
+    mSuppportedXferOpts     = initData.TransferCtlFlags;
+    mMaxSupportedBlockSize  = initData.MaxBlockSize;
+    mMaxSupportedWindowSize = std::max<uint8_t>(initData.MaxWindowSize, 1);
+    mStartOffset            = initData.StartOffset;
+    mTransferLength         = initData.Length;
+
+    Platform::ScopedMemoryBuffer<uint8_t> metadata;
+    size_t metadataLength = initData.MetadataLength;
+    if (mMaxSupportedWindowSize > 1)
+    {
+        ReturnErrorOnFailure(
+            AppendWindowSize(initData.Metadata, initData.MetadataLength, mMaxSupportedWindowSize, metadata, metadataLength));
+    }
 
     // Prepare TransferInit message
     TransferInit initMsg;
@@ -161,8 +263,8 @@ CHIP_ERROR TransferSession::StartTransfer(TransferRole role, const TransferInitD
     initMsg.MaxLength          = mTransferLength;
     initMsg.FileDesignator     = initData.FileDesignator;
     initMsg.FileDesLength      = initData.FileDesLength;
-    initMsg.Metadata           = initData.Metadata;
-    initMsg.MetadataLength     = initData.MetadataLength;
+    initMsg.Metadata           = metadata ? metadata.Get() : initData.Metadata;
+    initMsg.MetadataLength     = metadataLength;
 
     ReturnErrorOnFailure(WriteToPacketBuffer(initMsg, mPendingMsgHandle));
 
@@ -182,15 +284,17 @@ CHIP_ERROR TransferSession::StartTransfer(TransferRole role, const TransferInitD
 }
 
 CHIP_ERROR TransferSession::WaitForTransfer(TransferRole role, BitFlags<TransferControlFlags> xferControlOpts,
-                                            uint16_t maxBlockSize, System::Clock::Timeout timeout)
+                                            uint16_t maxBlockSize, System::Clock::Timeout timeout, uint8_t maxWindowSize)
 {
     VerifyOrReturnError(mState == TransferState::kUnitialized, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(maxWindowSize <= kMaxWindowSize, CHIP_ERROR_INVALID_ARGUMENT);
 
     // Used to determine compatibility with any future TransferInit parameters
-    mRole                  = role;
-    mTimeout               = timeout;
-    mSuppportedXferOpts    = xferControlOpts;
-    mMaxSupportedBlockSize = maxBlockSize;
+    mRole                   = role;
+    mTimeout                = timeout;
+    mSuppportedXferOpts     = xferControlOpts;
+    mMaxSupportedBlockSize  = maxBlockSize;
+    mMaxSupportedWindowSize = std::max<uint8_t>(maxWindowSize, 1);
 
     mState = TransferState::kAwaitingInitMsg;
 
@@ -211,7 +315,23 @@ CHIP_ERROR TransferSession::AcceptTransfer(const TransferAcceptData & acceptData
     VerifyOrReturnError(proposedControlOpts.Has(acceptData.ControlMode), CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(acceptData.MaxBlockSize <= mTransferRequestData.MaxBlockSize, CHIP_ERROR_INVALID_ARGUMENT);
 
+    // The window can't be larger than what either side supports. Windowed transfers only apply to synchronous modes.
+    const uint8_t windowSize = std::max<uint8_t>(acceptData.WindowSize, 1);
+    VerifyOrReturnError(windowSize <= std::min(mMaxSupportedWindowSize, mTransferRequestData.MaxWindowSize),
+                        CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(windowSize == 1 || acceptData.ControlMode != TransferControlFlags::kAsync, CHIP_ERROR_INVALID_ARGUMENT);
+
+    Platform::ScopedMemoryBuffer<uint8_t> metadata;
+    size_t metadataLength = acceptData.MetadataLength;
+    if (windowSize > 1)
+    {
+        ReturnErrorOnFailure(
+            AppendWindowSize(acceptData.Metadata, acceptData.MetadataLength, windowSize, metadata, metadataLength));
+    }
+    const uint8_t * metadataData = metadata ? metadata.Get() : acceptData.Metadata;
+
     mTransferMaxBlockSize = acceptData.MaxBlockSize;
+    mTransferWindowSize   = windowSize;
 
     if (mRole == TransferRole::kSender)
     {
@@ -224,8 +344,8 @@ CHIP_ERROR TransferSession::AcceptTransfer(const TransferAcceptData & acceptData
         acceptMsg.MaxBlockSize   = acceptData.MaxBlockSize;
         acceptMsg.StartOffset    = acceptData.StartOffset;
         acceptMsg.Length         = acceptData.Length;
-        acceptMsg.Metadata       = acceptData.Metadata;
-        acceptMsg.MetadataLength = acceptData.MetadataLength;
+        acceptMsg.Metadata       = metadataData;
+        acceptMsg.MetadataLength = metadataLength;
 
         ReturnErrorOnFailure(WriteToPacketBuffer(acceptMsg, mPendingMsgHandle));
         msgType = MessageType::ReceiveAccept;
@@ -241,8 +361,8 @@ CHIP_ERROR TransferSession::AcceptTransfer(const TransferAcceptData & acceptData
         acceptMsg.TransferCtlFlags.Set(acceptData.ControlMode);
         acceptMsg.Version        = mTransferVersion;
         acceptMsg.MaxBlockSize   = acceptData.MaxBlockSize;
-        acceptMsg.Metadata       = acceptData.Metadata;
-        acceptMsg.MetadataLength = acceptData.MetadataLength;
+        acceptMsg.Metadata       = metadataData;
+        acceptMsg.MetadataLength = metadataLength;
 
         ReturnErrorOnFailure(WriteToPacketBuffer(acceptMsg, mPendingMsgHandle));
         msgType = MessageType::SendAccept;
@@ -261,6 +381,11 @@ CHIP_ERROR TransferSession::AcceptTransfer(const TransferAcceptData & acceptData
         mAwaitingResponse = true;
     }
 
+    if (IsWindowed())
+    {
+        StartWindow();
+    }
+
     PrepareOutgoingMessageEvent(msgType, mPendingOutput, mMsgTypeData);
 
     return CHIP_NO_ERROR;
@@ -284,6 +409,13 @@ CHIP_ERROR TransferSession::PrepareBlockQuery()
     VerifyOrReturnError(mState == TransferState::kTransferInProgress, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mRole == TransferRole::kReceiver, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mPendingOutput == OutputEventType::kNone, CHIP_ERROR_INCORRECT_STATE);
+
+    if (IsWindowed())
+    {
+        VerifyOrReturnError(mControlMode == TransferControlFlags::kReceiverDrive, CHIP_ERROR_INCORRECT_STATE);
+        return PrepareWindowCredit();
+    }
+
     VerifyOrReturnError(!mAwaitingResponse, CHIP_ERROR_INCORRECT_STATE);
 
     BlockQuery queryMsg;
@@ -307,6 +439,8 @@ CHIP_ERROR TransferSession::PrepareBlockQueryWithSkip(const uint64_t & bytesToSk
     VerifyOrReturnError(mRole == TransferRole::kReceiver, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mPendingOutput == OutputEventType::kNone, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(!mAwaitingResponse, CHIP_ERROR_INCORRECT_STATE);
+    // Blocks already requested in a windowed transfer may still be in flight, they would be received for the wrong offsets.
+    VerifyOrReturnError(!IsWindowed() || !mCreditSent, CHIP_ERROR_INCORRECT_STATE);
 
     BlockQueryWithSkip queryMsg;
     queryMsg.BlockCounter = mNextQueryNum;
@@ -317,6 +451,15 @@ CHIP_ERROR TransferSession::PrepareBlockQueryWithSkip(const uint64_t & bytesToSk
     mAwaitingResponse = true;
     mLastQueryNum     = mNextQueryNum++;
 
+    if (IsWindowed())
+    {
+        // The skip query is sent reliably, and grants the first window like a BlockQuery.
+        mNextQueryNum        = mLastQueryNum;
+        mWindowEnd           = mLastQueryNum + mTransferWindowSize;
+        mCreditSent          = true;
+        mAwaitingApplication = false;
+    }
+
     PrepareOutgoingMessageEvent(msgType, mPendingOutput, mMsgTypeData);
 
     return CHIP_NO_ERROR;
@@ -327,7 +470,15 @@ CHIP_ERROR TransferSession::PrepareBlock(const BlockData & inData)
     VerifyOrReturnError(mState == TransferState::kTransferInProgress, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mRole == TransferRole::kSender, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mPendingOutput == OutputEventType::kNone, CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrReturnError(!mAwaitingResponse, CHIP_ERROR_INCORRECT_STATE);
+    if (IsWindowed())
+    {
+        // The block must fit in the window granted by the receiver
+        VerifyOrReturnError(mNextBlockNum < mWindowEnd, CHIP_ERROR_INCORRECT_STATE);
+    }
+    else
+    {
+        VerifyOrReturnError(!mAwaitingResponse, CHIP_ERROR_INCORRECT_STATE);
+    }
 
     // Verify non-zero data is provided and is no longer than MaxBlockSize (BlockEOF may contain 0 length data)
     VerifyOrReturnError((inData.Data != nullptr) && (inData.Length <= mTransferMaxBlockSize), CHIP_ERROR_INVALID_ARGUMENT);
@@ -341,6 +492,19 @@ CHIP_ERROR TransferSession::PrepareBlock(const BlockData & inData)
 
     const MessageType msgType = inData.IsEof ? MessageType::BlockEOF : MessageType::Block;
 
+    if (IsWindowed())
+    {
+        // Keep a copy of the block until it is acknowledged, in case it needs to be sent again
+        WindowSlot & slot = mWindowSlots[mNextBlockNum % mTransferWindowSize];
+        slot.msg          = mPendingMsgHandle.CloneData();
+        slot.isEof        = inData.IsEof;
+        if (slot.msg.IsNull())
+        {
+            mPendingMsgHandle = nullptr;
+            return CHIP_ERROR_NO_MEMORY;
+        }
+    }
+
     if (msgType == MessageType::BlockEOF)
     {
 #if CHIP_AUTOMATION_LOGGING
@@ -355,6 +519,13 @@ CHIP_ERROR TransferSession::PrepareBlock(const BlockData & inData)
 
     PrepareOutgoingMessageEvent(msgType, mPendingOutput, mMsgTypeData);
 
+    if (IsWindowed())
+    {
+        mMsgTypeData.NoAutoRequestAck = true;
+        mAwaitingApplication          = false;
+        UpdateWindowAwaitingResponse();
+    }
+
     return CHIP_NO_ERROR;
 }
 
@@ -365,6 +536,11 @@ CHIP_ERROR TransferSession::PrepareBlockAck()
                         CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mPendingOutput == OutputEventType::kNone, CHIP_ERROR_INCORRECT_STATE);
 
+    if (IsWindowed() && mState == TransferState::kTransferInProgress && mControlMode == TransferControlFlags::kSenderDrive)
+    {
+        return PrepareWindowCredit();
+    }
+
     CounterMessage ackMsg;
     ackMsg.BlockCounter       = mLastBlockNum;
     const MessageType msgType = (mState == TransferState::kReceivedEOF) ? MessageType::BlockAckEOF : MessageType::BlockAck;
@@ -393,6 +569,9 @@ CHIP_ERROR TransferSession::PrepareBlockAck()
 
     PrepareOutgoingMessageEvent(msgType, mPendingOutput, mMsgTypeData);
 
+    // In a windowed Receiver Drive transfer, a BlockAck only resets the sender's timeout; it is not retransmitted.
+    mMsgTypeData.NoAutoRequestAck = IsWindowed() && (msgType == MessageType::BlockAck);
+
     return CHIP_NO_ERROR;
 }
 
@@ -412,11 +591,13 @@ void TransferSession::Reset()
     mPendingOutput = OutputEventType::kNone;
     mState         = TransferState::kUnitialized;
     mSuppportedXferOpts.ClearAll();
-    mTransferVersion       = 0;
-    mMaxSupportedBlockSize = 0;
-    mStartOffset           = 0;
-    mTransferLength        = 0;
-    mTransferMaxBlockSize  = 0;
+    mTransferVersion        = 0;
+    mMaxSupportedBlockSize  = 0;
+    mMaxSupportedWindowSize = 1;
+    mStartOffset            = 0;
+    mTransferLength         = 0;
+    mTransferMaxBlockSize   = 0;
+    mTransferWindowSize     = 1;
 
     mPendingMsgHandle = nullptr;
 
@@ -430,6 +611,20 @@ void TransferSession::Reset()
     mTimeoutStartTime       = System::Clock::kZero;
     mShouldInitTimeoutStart = true;
     mAwaitingResponse       = false;
+
+    ReleaseWindowSlots();
+    mWindowStart         = 0;
+    mWindowEnd           = 0;
+    mRetransmitNum       = 0;
+    mRetransmitEnd       = 0;
+    mWindowTimerStart    = System::Clock::kZero;
+    mAwaitingApplication = false;
+    mCreditSent          = false;
+    mResendCredit        = false;
+    mWindowProgressed    = false;
+    mIsRetransmission    = false;
+
+    mStatusReportDeferred = false;
 }
 
 CHIP_ERROR TransferSession::HandleMessageReceived(const PayloadHeader & payloadHeader, System::PacketBufferHandle msg,
@@ -439,9 +634,14 @@ CHIP_ERROR TransferSession::HandleMessageReceived(const PayloadHeader & payloadH
 
     if (payloadHeader.HasProtocol(Protocols::BDX::Id))
     {
+        mWindowProgressed = false;
         ReturnErrorOnFailure(HandleBdxMessage(payloadHeader, std::move(msg)));
 
         mTimeoutStartTime = curTime;
+        if (mWindowProgressed)
+        {
+            mWindowTimerStart = curTime;
+        }
     }
     else if (payloadHeader.HasMessageType(Protocols::SecureChannel::MsgType::StatusReport))
     {
@@ -459,10 +659,13 @@ CHIP_ERROR TransferSession::HandleMessageReceived(const PayloadHeader & payloadH
 CHIP_ERROR TransferSession::HandleBdxMessage(const PayloadHeader & header, System::PacketBufferHandle msg)
 {
     VerifyOrReturnError(!msg.IsNull(), CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrReturnError(mPendingOutput == OutputEventType::kNone, CHIP_ERROR_INCORRECT_STATE);
 
     const MessageType msgType = static_cast<MessageType>(header.GetMessageType());
 
+    // Windowed transfers may receive blocks and acknowledgements while an event is still pending. They only update the window,
+    // an error found in one of them is reported once the pending event was polled, see PrepareStatusReport().
+    VerifyOrReturnError(mPendingOutput == OutputEventType::kNone || IsWindowedBlockMessage(msgType), CHIP_ERROR_INCORRECT_STATE);
+
     switch (msgType)
     {
     case MessageType::SendInit:
@@ -552,8 +755,11 @@ void TransferSession::HandleTransferInit(MessageType msgType, System::PacketBuff
     VerifyOrReturn(err == CHIP_NO_ERROR, PrepareStatusReport(StatusCode::kBadMessageContents));
 
     ResolveTransferControlOptions(transferInit.TransferCtlOptions);
+    const uint8_t proposedWindowSize = ExtractWindowSize(transferInit.Metadata, transferInit.MetadataLength);
+
     mTransferVersion      = std::min(kBdxVersion, transferInit.Version);
     mTransferMaxBlockSize = std::min(mMaxSupportedBlockSize, transferInit.MaxBlockSize);
+    mTransferWindowSize   = std::min(mMaxSupportedWindowSize, proposedWindowSize);
 
     // Accept for now, they may be changed or rejected by the peer if this is a ReceiveInit
     mStartOffset    = transferInit.StartOffset;
@@ -568,6 +774,7 @@ void TransferSession::HandleTransferInit(MessageType msgType, System::PacketBuff
     mTransferRequestData.FileDesLength    = transferInit.FileDesLength;
     mTransferRequestData.Metadata         = transferInit.Metadata;
     mTransferRequestData.MetadataLength   = transferInit.MetadataLength;
+    mTransferRequestData.MaxWindowSize    = proposedWindowSize;
 
     mPendingMsgHandle = std::move(msgData);
     mPendingOutput    = OutputEventType::kInitReceived;
@@ -595,7 +802,12 @@ void TransferSession::HandleReceiveAccept(System::PacketBufferHandle msgData)
     // rather than adopting it unconditionally.
     VerifyOrReturn(rcvAcceptMsg.MaxBlockSize <= mMaxSupportedBlockSize, PrepareStatusReport(StatusCode::kBadMessageContents));
 
+    // Likewise, the chosen window size can't be larger than the proposed one
+    const uint8_t windowSize = ExtractWindowSize(rcvAcceptMsg.Metadata, rcvAcceptMsg.MetadataLength);
+    VerifyOrReturn(windowSize <= mMaxSupportedWindowSize, PrepareStatusReport(StatusCode::kBadMessageContents));
+
     mTransferMaxBlockSize = rcvAcceptMsg.MaxBlockSize;
+    mTransferWindowSize   = windowSize;
     mStartOffset          = rcvAcceptMsg.StartOffset;
     mTransferLength       = rcvAcceptMsg.Length;
 
@@ -607,6 +819,7 @@ void TransferSession::HandleReceiveAccept(System::PacketBufferHandle msgData)
     mTransferAcceptData.Length         = rcvAcceptMsg.Length;
     mTransferAcceptData.Metadata       = rcvAcceptMsg.Metadata;
     mTransferAcceptData.MetadataLength = rcvAcceptMsg.MetadataLength;
+    mTransferAcceptData.WindowSize     = windowSize;
 
     mPendingMsgHandle = std::move(msgData);
     mPendingOutput    = OutputEventType::kAcceptReceived;
@@ -614,6 +827,11 @@ void TransferSession::HandleReceiveAccept(System::PacketBufferHandle msgData)
     mAwaitingResponse = (mControlMode == TransferControlFlags::kSenderDrive);
     mState            = TransferState::kTransferInProgress;
 
+    if (IsWindowed())
+    {
+        StartWindow();
+    }
+
 #if CHIP_AUTOMATION_LOGGING
     rcvAcceptMsg.LogMessage(MessageType::ReceiveAccept);
 #endif // CHIP_AUTOMATION_LOGGING
@@ -634,9 +852,13 @@ void TransferSession::HandleSendAccept(System::PacketBufferHandle msgData)
     // Per the BDX spec, the chosen Max Block Size SHALL be <= the proposed Max Block Size. Validate the received value here too.
     VerifyOrReturn(sendAcceptMsg.MaxBlockSize <= mMaxSupportedBlockSize, PrepareStatusReport(StatusCode::kBadMessageContents));
 
+    const uint8_t windowSize = ExtractWindowSize(sendAcceptMsg.Metadata, sendAcceptMsg.MetadataLength);
+    VerifyOrReturn(windowSize <= mMaxSupportedWindowSize, PrepareStatusReport(StatusCode::kBadMessageContents));
+
     // Note: if VerifyProposedMode() returned with no error, then mControlMode must match the proposed mode in the SendAccept
     // message
     mTransferMaxBlockSize = sendAcceptMsg.MaxBlockSize;
+    mTransferWindowSize   = windowSize;
 
     mTransferAcceptData.ControlMode    = mControlMode;
     mTransferAcceptData.MaxBlockSize   = sendAcceptMsg.MaxBlockSize;
@@ -644,6 +866,7 @@ void TransferSession::HandleSendAccept(System::PacketBufferHandle msgData)
     mTransferAcceptData.Length         = mTransferLength; // Not included in SendAccept msg, so use member
     mTransferAcceptData.Metadata       = sendAcceptMsg.Metadata;
     mTransferAcceptData.MetadataLength = sendAcceptMsg.MetadataLength;
+    mTransferAcceptData.WindowSize     = windowSize;
 
     mPendingMsgHandle = std::move(msgData);
     mPendingOutput    = OutputEventType::kAcceptReceived;
@@ -651,6 +874,11 @@ void TransferSession::HandleSendAccept(System::PacketBufferHandle msgData)
     mAwaitingResponse = (mControlMode == TransferControlFlags::kReceiverDrive);
     mState            = TransferState::kTransferInProgress;
 
+    if (IsWindowed())
+    {
+        StartWindow();
+    }
+
 #if CHIP_AUTOMATION_LOGGING
     sendAcceptMsg.LogMessage(MessageType::SendAccept);
 #endif // CHIP_AUTOMATION_LOGGING
@@ -659,6 +887,23 @@ void TransferSession::HandleSendAccept(System::PacketBufferHandle msgData)
 void TransferSession::HandleBlockQuery(System::PacketBufferHandle msgData)
 {
     VerifyOrReturn(mRole == TransferRole::kSender, PrepareStatusReport(StatusCode::kUnexpectedMessage));
+
+    if (IsWindowed())
+    {
+        // Acknowledgements resent by the receiver may arrive after the end of the transfer
+        VerifyOrReturn(mState != TransferState::kTransferDone);
+        VerifyOrReturn((mState == TransferState::kTransferInProgress) || (mState == TransferState::kAwaitingEOFAck),
+                       PrepareStatusReport(StatusCode::kUnexpectedMessage));
+        VerifyOrReturn(mControlMode == TransferControlFlags::kReceiverDrive, PrepareStatusReport(StatusCode::kUnexpectedMessage));
+
+        BlockQuery query;
+        const CHIP_ERROR err = query.Parse(std::move(msgData));
+        VerifyOrReturn(err == CHIP_NO_ERROR, PrepareStatusReport(StatusCode::kBadMessageContents));
+
+        HandleWindowCredit(query.BlockCounter);
+        return;
+    }
+
     VerifyOrReturn(mState == TransferState::kTransferInProgress, PrepareStatusReport(StatusCode::kUnexpectedMessage));
     VerifyOrReturn(mAwaitingResponse, PrepareStatusReport(StatusCode::kUnexpectedMessage));
 
@@ -686,6 +931,14 @@ void TransferSession::HandleBlockQueryWithSkip(System::PacketBufferHandle msgDat
 
     VerifyOrReturn(query.BlockCounter == mNextBlockNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
 
+    if (IsWindowed())
+    {
+        // Only the first query may skip data, see PrepareBlockQueryWithSkip()
+        VerifyOrReturn(mWindowStart == mNextBlockNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
+        HandleWindowCredit(query.BlockCounter);
+        mAwaitingApplication = true;
+    }
+
     mPendingOutput = OutputEventType::kQueryWithSkipReceived;
 
     mAwaitingResponse        = false;
@@ -696,6 +949,11 @@ void TransferSession::HandleBlockQueryWithSkip(System::PacketBufferHandle msgDat
 void TransferSession::HandleBlock(System::PacketBufferHandle msgData)
 {
     VerifyOrReturn(mRole == TransferRole::kReceiver, PrepareStatusReport(StatusCode::kUnexpectedMessage));
+    if (IsWindowed())
+    {
+        HandleWindowBlock(std::move(msgData), false /* isEof */);
+        return;
+    }
     VerifyOrReturn(mState == TransferState::kTransferInProgress, PrepareStatusReport(StatusCode::kUnexpectedMessage));
     VerifyOrReturn(mAwaitingResponse, PrepareStatusReport(StatusCode::kUnexpectedMessage));
 
@@ -730,6 +988,11 @@ void TransferSession::HandleBlock(System::PacketBufferHandle msgData)
 void TransferSession::HandleBlockEOF(System::PacketBufferHandle msgData)
 {
     VerifyOrReturn(mRole == TransferRole::kReceiver, PrepareStatusReport(StatusCode::kUnexpectedMessage));
+    if (IsWindowed())
+    {
+        HandleWindowBlock(std::move(msgData), true /* isEof */);
+        return;
+    }
     VerifyOrReturn(mState == TransferState::kTransferInProgress, PrepareStatusReport(StatusCode::kUnexpectedMessage));
     VerifyOrReturn(mAwaitingResponse, PrepareStatusReport(StatusCode::kUnexpectedMessage));
 
@@ -762,6 +1025,26 @@ void TransferSession::HandleBlockEOF(System::PacketBufferHandle msgData)
 void TransferSession::HandleBlockAck(System::PacketBufferHandle msgData)
 {
     VerifyOrReturn(mRole == TransferRole::kSender, PrepareStatusReport(StatusCode::kUnexpectedMessage));
+
+    if (IsWindowed())
+    {
+        // Acknowledgements resent by the receiver may arrive after the end of the transfer
+        VerifyOrReturn(mState != TransferState::kTransferDone);
+        VerifyOrReturn((mState == TransferState::kTransferInProgress) || (mState == TransferState::kAwaitingEOFAck),
+                       PrepareStatusReport(StatusCode::kUnexpectedMessage));
+
+        BlockAck ackMsg;
+        const CHIP_ERROR err = ackMsg.Parse(std::move(msgData));
+        VerifyOrReturn(err == CHIP_NO_ERROR, PrepareStatusReport(StatusCode::kBadMessageContents));
+
+        // In Receiver Drive, BlockQuery messages carry the acknowledgements and a BlockAck only resets the timeout.
+        if (mControlMode == TransferControlFlags::kSenderDrive)
+        {
+            HandleWindowCredit(ackMsg.BlockCounter + 1);
+        }
+        return;
+    }
+
     VerifyOrReturn(mState == TransferState::kTransferInProgress, PrepareStatusReport(StatusCode::kUnexpectedMessage));
     VerifyOrReturn(mAwaitingResponse, PrepareStatusReport(StatusCode::kUnexpectedMessage));
 
@@ -791,6 +1074,7 @@ void TransferSession::HandleBlockAckEOF(System::PacketBufferHandle msgData)
     mPendingOutput = OutputEventType::kAckEOFReceived;
 
     mAwaitingResponse = false;
+    ReleaseWindowSlots();
 
     mState = TransferState::kTransferDone;
 
@@ -799,6 +1083,260 @@ void TransferSession::HandleBlockAckEOF(System::PacketBufferHandle msgData)
 #endif // CHIP_AUTOMATION_LOGGING
 }
 
+bool TransferSession::IsWindowedBlockMessage(MessageType msgType) const
+{
+    VerifyOrReturnValue(IsWindowed(), false);
+    VerifyOrReturnValue((mState == TransferState::kTransferInProgress) || (mState == TransferState::kAwaitingEOFAck) ||
+                            (mState == TransferState::kReceivedEOF) || (mState == TransferState::kTransferDone),
+                        false);
+
+    return (msgType == MessageType::Block) || (msgType == MessageType::BlockEOF) || (msgType == MessageType::BlockQuery) ||
+        (msgType == MessageType::BlockAck);
+}
+
+void TransferSession::StartWindow()
+{
+    const bool senderDrive = (mControlMode == TransferControlFlags::kSenderDrive);
+
+    // In Sender Drive, the Accept message implicitly grants the first window. In Receiver Drive, the first BlockQuery does.
+    mWindowStart = 0;
+    mWindowEnd   = senderDrive ? mTransferWindowSize : 0;
+
+    // The driving side starts the transfer, with its first Block (sender) or BlockQuery (receiver)
+    mAwaitingApplication = ((mRole == TransferRole::kSender) == senderDrive);
+
+    UpdateWindowAwaitingResponse();
+}
+
+void TransferSession::HandleWindowCredit(uint32_t nextBlockNum)
+{
+    // Ignore acknowledgements older than the last one, they were delayed or resent
+    VerifyOrReturn(nextBlockNum >= mWindowStart);
+    VerifyOrReturn(nextBlockNum <= mNextBlockNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
+
+    const uint32_t windowEnd = nextBlockNum + mTransferWindowSize;
+    mWindowProgressed        = (nextBlockNum > mWindowStart) || (windowEnd > mWindowEnd);
+
+    // Blocks before nextBlockNum were received, they will not be sent again
+    for (; mWindowStart < nextBlockNum; mWindowStart++)
+    {
+        mWindowSlots[mWindowStart % mTransferWindowSize].msg = nullptr;
+    }
+    mWindowEnd    = std::max(mWindowEnd, windowEnd);
+    mLastQueryNum = nextBlockNum;
+
+    UpdateWindowAwaitingResponse();
+}
+
+void TransferSession::HandleWindowBlock(System::PacketBufferHandle msgData, bool isEof)
+{
+    // Blocks resent by the sender may arrive after the last one was delivered
+    VerifyOrReturn((mState != TransferState::kReceivedEOF) && (mState != TransferState::kTransferDone));
+    VerifyOrReturn(mState == TransferState::kTransferInProgress, PrepareStatusReport(StatusCode::kUnexpectedMessage));
+
+    DataBlock blockMsg;
+    const CHIP_ERROR err = blockMsg.Parse(msgData.Retain());
+    VerifyOrReturn(err == CHIP_NO_ERROR, PrepareStatusReport(StatusCode::kBadMessageContents));
+
+    if (blockMsg.BlockCounter < mWindowStart)
+    {
+        // Already delivered: the sender probably did not get the last acknowledgement
+        mResendCredit = mCreditSent;
+        return;
+    }
+
+    VerifyOrReturn(blockMsg.BlockCounter < mWindowEnd, PrepareStatusReport(StatusCode::kBadBlockCounter));
+    VerifyOrReturn((isEof || blockMsg.DataLength > 0) && (blockMsg.DataLength <= mTransferMaxBlockSize),
+                   PrepareStatusReport(StatusCode::kBadMessageContents));
+
+    // Blocks are buffered until the application handled the previous ones, see PrepareWindowBlockDelivery()
+    WindowSlot & slot = mWindowSlots[blockMsg.BlockCounter % mTransferWindowSize];
+    VerifyOrReturn(slot.msg.IsNull());
+
+    slot.msg          = std::move(msgData);
+    slot.isEof        = isEof;
+    mWindowProgressed = true;
+
+    UpdateWindowAwaitingResponse();
+}
+
+CHIP_ERROR TransferSession::PrepareWindowCredit()
+{
+    // The application acknowledges the last delivered block, or starts a Receiver Drive transfer
+    VerifyOrReturnError(mAwaitingApplication, CHIP_ERROR_INCORRECT_STATE);
+
+    const uint32_t previousQueryNum = mNextQueryNum;
+    mNextQueryNum                   = mWindowStart;
+    CHIP_ERROR err                  = WriteWindowCredit();
+    if (err != CHIP_NO_ERROR)
+    {
+        mNextQueryNum = previousQueryNum;
+        return err;
+    }
+
+    // The first acknowledgement is sent reliably: a receiver that does not poll periodically can't resend it, and the sender
+    // has nothing to resend either until it is received.
+    mMsgTypeData.NoAutoRequestAck = mCreditSent;
+
+    mLastQueryNum        = mNextQueryNum;
+    mWindowEnd           = mWindowStart + mTransferWindowSize;
+    mAwaitingApplication = false;
+    mCreditSent          = true;
+
+    UpdateWindowAwaitingResponse();
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR TransferSession::WriteWindowCredit()
+{
+    // BlockQuery(N) and BlockAck(N - 1) both acknowledge the blocks before N, and allow the blocks up to N + window size - 1
+    CounterMessage creditMsg;
+    MessageType msgType;
+    if (mControlMode == TransferControlFlags::kReceiverDrive)
+    {
+        creditMsg.BlockCounter = mNextQueryNum;
+        msgType                = MessageType::BlockQuery;
+    }
+    else
+    {
+        creditMsg.BlockCounter = mNextQueryNum - 1;
+        msgType                = MessageType::BlockAck;
+    }
+
+    ReturnErrorOnFailure(WriteToPacketBuffer(creditMsg, mPendingMsgHandle));
+
+    PrepareOutgoingMessageEvent(msgType, mPendingOutput, mMsgTypeData);
+    mMsgTypeData.NoAutoRequestAck = true;
+
+    return CHIP_NO_ERROR;
+}
+
+void TransferSession::PrepareWindowOutput(System::Clock::Timestamp curTime)
+{
+    const bool retransmitTimerExpired = (curTime - mWindowTimerStart) >= kWindowRetransmitTimeout;
+
+    if (mRole == TransferRole::kSender)
+    {
+        VerifyOrReturn((mState == TransferState::kTransferInProgress) || (mState == TransferState::kAwaitingEOFAck));
+
+        // Without acknowledgement for a while, go back to the oldest unacknowledged block and send all of them again
+        if ((mWindowStart < mNextBlockNum) && (mRetransmitNum >= mRetransmitEnd) && retransmitTimerExpired)
+        {
+            mRetransmitNum = mWindowStart;
+            mRetransmitEnd = mNextBlockNum;
+        }
+
+        mRetransmitNum = std::max(mRetransmitNum, mWindowStart);
+        if (mRetransmitNum < mRetransmitEnd)
+        {
+            const WindowSlot & slot = mWindowSlots[mRetransmitNum % mTransferWindowSize];
+            mPendingMsgHandle       = slot.msg.CloneData();
+            VerifyOrReturn(!mPendingMsgHandle.IsNull()); // Try again at the next poll
+
+            mRetransmitNum++;
+            PrepareOutgoingMessageEvent(slot.isEof ? MessageType::BlockEOF : MessageType::Block, mPendingOutput, mMsgTypeData);
+            mMsgTypeData.NoAutoRequestAck = true;
+            mIsRetransmission             = true;
+            return;
+        }
+
+        // Ask the application for one block at a time, as long as the receiver allows more
+        if ((mState == TransferState::kTransferInProgress) && !mAwaitingApplication && (mNextBlockNum < mWindowEnd))
+        {
+            mPendingOutput       = (mControlMode == TransferControlFlags::kReceiverDrive) ? OutputEventType::kQueryReceived
+                                                                                           : OutputEventType::kAckReceived;
+            mAwaitingApplication = true;
+            UpdateWindowAwaitingResponse();
+        }
+        return;
+    }
+
+    VerifyOrReturn(mState == TransferState::kTransferInProgress);
+
+    if (!mAwaitingApplication && !mWindowSlots[mWindowStart % mTransferWindowSize].msg.IsNull())
+    {
+        PrepareWindowBlockDelivery();
+        return;
+    }
+
+    // Send the last acknowledgement again if the sender keeps resending delivered blocks, or if a block is missing for a while
+    if (mResendCredit || (mCreditSent && mAwaitingResponse && retransmitTimerExpired))
+    {
+        mResendCredit = false;
+        if (WriteWindowCredit() == CHIP_NO_ERROR)
+        {
+            mIsRetransmission = true;
+        }
+    }
+}
+
+void TransferSession::PrepareWindowBlockDelivery()
+{
+    WindowSlot & slot = mWindowSlots[mWindowStart % mTransferWindowSize];
+
+    // The block was validated when received, except for the total length which depends on the blocks before it
+    DataBlock blockMsg;
+    const CHIP_ERROR err = blockMsg.Parse(slot.msg.Retain());
+    VerifyOrReturn(err == CHIP_NO_ERROR, PrepareStatusReport(StatusCode::kBadMessageContents));
+
+    if (!slot.isEof && IsTransferLengthDefinite())
+    {
+        VerifyOrReturn(mNumBytesProcessed + blockMsg.DataLength <= mTransferLength,
+                       PrepareStatusReport(StatusCode::kLengthMismatch));
+    }
+
+    mBlockEventData.Data         = blockMsg.Data;
+    mBlockEventData.Length       = blockMsg.DataLength;
+    mBlockEventData.IsEof        = slot.isEof;
+    mBlockEventData.BlockCounter = blockMsg.BlockCounter;
+
+    mPendingMsgHandle = std::move(slot.msg);
+    mPendingOutput    = OutputEventType::kBlockReceived;
+
+    mNumBytesProcessed += blockMsg.DataLength;
+    mLastBlockNum = blockMsg.BlockCounter;
+    mWindowStart++;
+
+    // The next block is only delivered once the application acknowledged this one
+    mAwaitingApplication = true;
+
+    if (slot.isEof)
+    {
+        mState = TransferState::kReceivedEOF;
+#if CHIP_AUTOMATION_LOGGING
+        blockMsg.LogMessage(MessageType::BlockEOF);
+#endif // CHIP_AUTOMATION_LOGGING
+    }
+
+    UpdateWindowAwaitingResponse();
+}
+
+void TransferSession::UpdateWindowAwaitingResponse()
+{
+    if (mRole == TransferRole::kSender)
+    {
+        // Waiting for blocks to be acknowledged, or for the receiver to allow more blocks
+        mAwaitingResponse = (mState == TransferState::kAwaitingEOFAck) || (mWindowStart < mNextBlockNum) ||
+            ((mState == TransferState::kTransferInProgress) && !mAwaitingApplication && (mNextBlockNum >= mWindowEnd));
+    }
+    else
+    {
+        // Waiting for a block that was allowed but not received yet
+        mAwaitingResponse = (mState == TransferState::kTransferInProgress) && !mAwaitingApplication &&
+            (mWindowStart < mWindowEnd) && mWindowSlots[mWindowStart % mTransferWindowSize].msg.IsNull();
+    }
+}
+
+void TransferSession::ReleaseWindowSlots()
+{
+    for (auto & slot : mWindowSlots)
+    {
+        slot.msg   = nullptr;
+        slot.isEof = false;
+    }
+}
+
 void TransferSession::ResolveTransferControlOptions(const BitFlags<TransferControlFlags> & proposed)
 {
     // Must specify at least one synchronous option
@@ -871,6 +1409,15 @@ void TransferSession::PrepareStatusReport(StatusCode code)
 {
     mStatusReportData.statusCode = code;
 
+    // Don't replace the pending event or its message, PollOutput() prepares the StatusReport after it
+    if (mPendingOutput != OutputEventType::kNone)
+    {
+        mStatusReportDeferred = true;
+        mState                = TransferState::kErrorState;
+        mAwaitingResponse     = false;
+        return;
+    }
+
     Protocols::SecureChannel::StatusReport report(Protocols::SecureChannel::GeneralStatusCode::kFailure, Protocols::BDX::Id,
                                                   to_underlying(code));
     size_t msgSize = report.Size();
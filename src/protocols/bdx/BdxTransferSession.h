@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <lib/core/CHIPConfig.h>
 #include <lib/core/CHIPError.h>
 #include <protocols/bdx/BdxMessages.h>
 #include <system/SystemClock.h>
@@ -24,6 +25,23 @@ enum class TransferRole : uint8_t
     kSender   = 1,
 };
 
+/**
+ * Windowed transfers:
+ *
+ *   When both peers support it (TransferInitData::MaxWindowSize and the maxWindowSize argument of WaitForTransfer() greater than
+ *   1), the responder may accept a window size W greater than 1. The driving peer's BlockQuery(N) (Receiver Drive) or
+ *   BlockAck(N - 1) (Sender Drive) then acknowledges all blocks before N and allows the sender to send blocks up to N + W - 1
+ *   without waiting. The window size is carried as a BDX profile-specific TLV element appended to the metadata of the Init and
+ *   Accept messages, so peers that do not support windowed transfers ignore it and fall back to lock-step transfers. The element
+ *   is stripped from the Metadata reported to the application.
+ *
+ *   The application API is unchanged: the sender gets one kQueryReceived (Receiver Drive) or kAckReceived (Sender Drive) event
+ *   per block it may send, and the receiver gets one kBlockReceived event at a time, in order, and calls PrepareBlockQuery() or
+ *   PrepareBlockAck() once the block has been handled. Blocks and acknowledgements are sent with
+ *   MessageTypeData::NoAutoRequestAck set; lost messages are recovered by the TransferSession, which resends unacknowledged blocks
+ *   (go-back-N) or the last acknowledgement after CHIP_CONFIG_BDX_WINDOW_RETRANSMIT_TIMEOUT without progress. PollOutput() should
+ *   therefore be called until it returns kNone after every event, and periodically during the transfer.
+ */
 class DLL_EXPORT TransferSession
 {
 public:
@@ -57,6 +75,9 @@ public:
         // Additional metadata (optional, TLV format)
         const uint8_t * Metadata = nullptr;
         size_t MetadataLength    = 0;
+
+        // Largest number of outstanding blocks supported, 1 for a lock-step transfer
+        uint8_t MaxWindowSize = 1;
     };
 
     struct TransferAcceptData
@@ -70,6 +91,9 @@ public:
         // Additional metadata (optional, TLV format)
         const uint8_t * Metadata = nullptr;
         size_t MetadataLength    = 0;
+
+        // Chosen number of outstanding blocks, 1 (or 0) for a lock-step transfer
+        uint8_t WindowSize = 1;
     };
 
     struct StatusReportData
@@ -89,8 +113,11 @@ public:
     {
         Protocols::Id ProtocolId; // Should only ever be SecureChannel or BDX
         uint8_t MessageType;
+        // The message is retransmitted by the TransferSession itself if lost, and must be sent without requesting an MRP ack
+        // (only one message awaiting an ack may be outstanding on an exchange).
+        bool NoAutoRequestAck;
 
-        MessageTypeData() : ProtocolId(Protocols::NotSpecified), MessageType(0) {}
+        MessageTypeData() : ProtocolId(Protocols::NotSpecified), MessageType(0), NoAutoRequestAck(false) {}
 
         bool HasProtocol(Protocols::Id protocol) const { return ProtocolId == protocol; }
         bool HasMessageType(uint8_t type) const { return MessageType == type; }
@@ -212,12 +239,13 @@ public:
      * @param xferControlOpts Indicates all supported control modes. Used to respond to a TransferInit message
      * @param maxBlockSize    The max Block size that this object supports.
      * @param timeout         The amount of time to wait for a response before considering the transfer failed
+     * @param maxWindowSize   The max number of outstanding blocks that this object supports, 1 for lock-step transfers only.
      *
      * @return CHIP_ERROR Result of initialization. May also indicate if the TransferSession object is unable to handle this
      *                    request.
      */
     CHIP_ERROR WaitForTransfer(TransferRole role, BitFlags<TransferControlFlags> xferControlOpts, uint16_t maxBlockSize,
-                               System::Clock::Timeout timeout);
+                               System::Clock::Timeout timeout, uint8_t maxWindowSize = 1);
 
     /**
      * @brief
@@ -254,6 +282,9 @@ public:
      * @brief
      *   Prepare a BlockQueryWithSkip message. The Block counter will be populated automatically.
      *
+     *   In a windowed transfer, this is only allowed for the first query: blocks already requested would otherwise be received
+     *   for the wrong offsets.
+     *
      * @param bytesToSkip Number of bytes to seek skip
      *
      * @return CHIP_ERROR The result of the preparation of a BlockQueryWithSkip message. May also indicate if the TransferSession
@@ -318,6 +349,7 @@ public:
     uint64_t GetStartOffset() const { return mStartOffset; }
     uint64_t GetTransferLength() const { return mTransferLength; }
     uint16_t GetTransferBlockSize() const { return mTransferMaxBlockSize; }
+    uint8_t GetTransferWindowSize() const { return mTransferWindowSize; }
     uint32_t GetNextBlockNum() const { return mNextBlockNum; }
     uint32_t GetNextQueryNum() const { return mNextQueryNum; }
     uint32_t GetLastBlockNum() const { return mLastBlockNum; }
@@ -374,6 +406,19 @@ private:
     void PrepareStatusReport(StatusCode code);
     bool IsTransferLengthDefinite() const;
 
+    // Windowed transfer helpers, only used when mTransferWindowSize > 1
+    bool IsWindowed() const { return mTransferWindowSize > 1; }
+    bool IsWindowedBlockMessage(MessageType msgType) const;
+    void StartWindow();
+    void HandleWindowCredit(uint32_t nextBlockNum);
+    void HandleWindowBlock(System::PacketBufferHandle msgData, bool isEof);
+    CHIP_ERROR PrepareWindowCredit();
+    CHIP_ERROR WriteWindowCredit();
+    void PrepareWindowOutput(System::Clock::Timestamp curTime);
+    void PrepareWindowBlockDelivery();
+    void UpdateWindowAwaitingResponse();
+    void ReleaseWindowSlots();
+
     OutputEventType mPendingOutput = OutputEventType::kNone;
     TransferState mState           = TransferState::kUnitialized;
     TransferRole mRole;
@@ -381,6 +426,7 @@ private:
     // Indicate supported options pre- transfer accept
     BitFlags<TransferControlFlags> mSuppportedXferOpts;
     uint16_t mMaxSupportedBlockSize = 0;
+    uint8_t mMaxSupportedWindowSize = 1;
 
     // Used to govern transfer once it has been accepted
     TransferControlFlags mControlMode;
@@ -388,6 +434,7 @@ private:
     uint64_t mStartOffset          = 0; ///< 0 represents no offset
     uint64_t mTransferLength       = 0; ///< 0 represents indefinite length
     uint16_t mTransferMaxBlockSize = 0;
+    uint8_t mTransferWindowSize    = 1;
 
     // Used to store event data before it is emitted via PollOutput()
     System::PacketBufferHandle mPendingMsgHandle;
@@ -409,6 +456,36 @@ private:
     System::Clock::Timestamp mTimeoutStartTime = System::Clock::kZero;
     bool mShouldInitTimeoutStart               = true;
     bool mAwaitingResponse                     = false;
+
+    // Windowed transfer state. A slot holds the Block message with counter N at index N % mTransferWindowSize: sent but not
+    // acknowledged yet by the receiver (sender role), or received but not delivered to the application yet (receiver role).
+    static constexpr uint8_t kMaxWindowSize = CHIP_CONFIG_BDX_MAX_WINDOW_SIZE;
+    static_assert(kMaxWindowSize >= 1, "CHIP_CONFIG_BDX_MAX_WINDOW_SIZE must be at least 1");
+
+    struct WindowSlot
+    {
+        System::PacketBufferHandle msg;
+        bool isEof = false;
+    };
+
+    WindowSlot mWindowSlots[kMaxWindowSize];
+
+    // Sender: oldest unacknowledged block. Receiver: next block to deliver to the application.
+    uint32_t mWindowStart = 0;
+    // First block counter the sender is not allowed to send yet
+    uint32_t mWindowEnd = 0;
+    // Sender: blocks in [mRetransmitNum, mRetransmitEnd) are waiting to be resent
+    uint32_t mRetransmitNum = 0;
+    uint32_t mRetransmitEnd = 0;
+
+    System::Clock::Timestamp mWindowTimerStart = System::Clock::kZero;
+    bool mAwaitingApplication                  = false; ///< The application has been asked for the next block or acknowledgement
+    bool mCreditSent                           = false; ///< Receiver: a BlockQuery or BlockAck was sent, and may be resent
+    bool mResendCredit                         = false;
+    bool mWindowProgressed                     = false;
+    bool mIsRetransmission                     = false;
+
+    bool mStatusReportDeferred = false; ///< An error was found while an event was pending, see PrepareStatusReport()
 };
 
 } // namespace bdx
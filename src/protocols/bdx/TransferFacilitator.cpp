@@ -70,6 +70,12 @@ CHIP_ERROR TransferFacilitator::OnMessageReceived(chip::Messaging::ExchangeConte
     // transfer is finished.
     mExchangeCtx->WillSendMessage();
 
+    // Windowed transfers keep several messages in flight, handle them as they come rather than at the poll frequency.
+    if (mTransfer.GetTransferWindowSize() > 1)
+    {
+        ScheduleImmediatePoll();
+    }
+
     return err;
 }
 
@@ -90,10 +96,14 @@ void TransferFacilitator::PollForOutput()
 {
     TransferSession::OutputEvent outEvent;
     mTransfer.PollOutput(outEvent, System::SystemClock().GetMonotonicTimestamp());
+    const bool pollAgain =
+        (outEvent.EventType != TransferSession::OutputEventType::kNone) && (mTransfer.GetTransferWindowSize() > 1);
     HandleTransferSessionOutput(outEvent);
 
     VerifyOrReturn(mSystemLayer != nullptr, ChipLogError(BDX, "%s mSystemLayer is null", __FUNCTION__));
-    TEMPORARY_RETURN_IGNORED mSystemLayer->StartTimer(mPollFreq, PollTimerHandler, this);
+    // A windowed transfer may have more blocks or acknowledgements to send right away
+    TEMPORARY_RETURN_IGNORED mSystemLayer->StartTimer(pollAgain ? System::Clock::Timeout(kImmediatePollDelay) : mPollFreq,
+                                                      PollTimerHandler, this);
 }
 
 void TransferFacilitator::ScheduleImmediatePoll()
@@ -103,14 +113,15 @@ void TransferFacilitator::ScheduleImmediatePoll()
 }
 
 CHIP_ERROR Responder::PrepareForTransfer(System::Layer * layer, TransferRole role, BitFlags<TransferControlFlags> xferControlOpts,
-                                         uint16_t maxBlockSize, System::Clock::Timeout timeout, System::Clock::Timeout pollFreq)
+                                         uint16_t maxBlockSize, System::Clock::Timeout timeout, System::Clock::Timeout pollFreq,
+                                         uint8_t maxWindowSize)
 {
     VerifyOrReturnError(layer != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
 
     mPollFreq    = pollFreq;
     mSystemLayer = layer;
 
-    ReturnErrorOnFailure(mTransfer.WaitForTransfer(role, xferControlOpts, maxBlockSize, timeout));
+    ReturnErrorOnFailure(mTransfer.WaitForTransfer(role, xferControlOpts, maxBlockSize, timeout, maxWindowSize));
 
     ChipLogProgress(BDX, "Start polling for messages");
     return mSystemLayer->StartTimer(mPollFreq, PollTimerHandler, this);
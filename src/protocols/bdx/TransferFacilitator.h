@@ -38,7 +38,8 @@ namespace bdx {
  *
  * This class does not define any methods for beginning a transfer or initializing the underlying TransferSession object (see
  * Initiator and Responder below).
- * This class contains a repeating timer which regurlaly polls the TransferSession state machine.
+ * This class contains a repeating timer which regurlaly polls the TransferSession state machine. In windowed transfers (see
+ * TransferSession), it polls again right away after each message received and each output event.
  * A CHIP node may have many TransferFacilitator instances but only one TransferFacilitator should be used for each BDX transfer.
  */
 class TransferFacilitator : public Messaging::ExchangeDelegate, public Messaging::UnsolicitedMessageHandler
@@ -121,10 +122,12 @@ public:
      * @param[in] maxBlockSize    The supported maximum size of BDX Block data
      * @param[in] timeout         The chosen timeout delay for the BDX transfer
      * @param[in] pollFreq        The period for the TransferSession poll timer
+     * @param[in] maxWindowSize   The supported maximum number of outstanding blocks, 1 for lock-step transfers only
      */
     CHIP_ERROR PrepareForTransfer(System::Layer * layer, TransferRole role, BitFlags<TransferControlFlags> xferControlOpts,
                                   uint16_t maxBlockSize, System::Clock::Timeout timeout,
-                                  System::Clock::Timeout pollFreq = TransferFacilitator::kDefaultPollFreq);
+                                  System::Clock::Timeout pollFreq = TransferFacilitator::kDefaultPollFreq,
+                                  uint8_t maxWindowSize           = 1);
 };
 
 /**
@@ -0,0 +1,532 @@
+#include <string.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/core/TLV.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <protocols/Protocols.h>
+#include <protocols/bdx/BdxMessages.h>
+#include <protocols/bdx/BdxTransferSession.h>
+#include <protocols/secure_channel/Constants.h>
+#include <system/SystemClock.h>
+#include <system/SystemPacketBuffer.h>
+
+#include <algorithm>
+#include <initializer_list>
+#include <vector>
+
+using namespace ::chip;
+using namespace ::chip::bdx;
+using namespace ::chip::System::Clock::Literals;
+
+namespace {
+
+using OutputEventType = TransferSession::OutputEventType;
+
+constexpr System::Clock::Timeout kTransferTimeout = System::Clock::Seconds16(30);
+constexpr uint16_t kBlockSize                     = 64;
+
+/**
+ * Two TransferSession objects connected by a simulated link with a fixed one-way latency, and the minimal application logic of
+ * a BDX sender and receiver. Time is virtual and only advances when nothing else can happen.
+ */
+class WindowedTransferLoopback
+{
+public:
+    WindowedTransferLoopback(TransferControlFlags controlMode, uint8_t windowSize, System::Clock::Milliseconds64 latency,
+                             uint32_t dropEveryNth = 0) :
+        mControlMode(controlMode),
+        mWindowSize(windowSize), mLatency(latency), mDropEveryNth(dropEveryNth)
+    {
+        mData.resize(40 * kBlockSize + kBlockSize / 2);
+        for (size_t i = 0; i < mData.size(); i++)
+        {
+            mData[i] = static_cast<uint8_t>(i * 7 + 3);
+        }
+    }
+
+    // The receiver initiates Receiver Drive transfers (as an OTA requestor does), the sender initiates Sender Drive ones (as a
+    // node sending diagnostic logs does).
+    CHIP_ERROR Start()
+    {
+        const bool receiverDrive    = (mControlMode == TransferControlFlags::kReceiverDrive);
+        TransferSession & initiator = receiverDrive ? mReceiver : mSender;
+        TransferSession & responder = receiverDrive ? mSender : mReceiver;
+
+        const TransferRole responderRole = receiverDrive ? TransferRole::kSender : TransferRole::kReceiver;
+        ReturnErrorOnFailure(responder.WaitForTransfer(responderRole, mControlMode, kBlockSize, kTransferTimeout, mWindowSize));
+
+        TransferSession::TransferInitData initData;
+        initData.TransferCtlFlags = mControlMode;
+        initData.MaxBlockSize     = kBlockSize;
+        initData.Length           = receiverDrive ? 0 : mData.size();
+        initData.FileDesignator   = reinterpret_cast<const uint8_t *>("file");
+        initData.FileDesLength    = 4;
+        initData.MaxWindowSize    = mWindowSize;
+        return initiator.StartTransfer(receiverDrive ? TransferRole::kReceiver : TransferRole::kSender, initData, kTransferTimeout);
+    }
+
+    // Runs until the transfer ends, or fails after the given (virtual) time.
+    bool Run(System::Clock::Milliseconds64 limit = System::Clock::Milliseconds64(120000))
+    {
+        while (!mFailed && !(mSenderDone && mReceiverDone) && mNow < System::Clock::Timestamp(limit))
+        {
+            PollAll();
+            if (!DeliverDue())
+            {
+                mNow += 1_ms64;
+            }
+        }
+        return !mFailed && mSenderDone && mReceiverDone;
+    }
+
+    System::Clock::Timestamp Now() const { return mNow; }
+    const std::vector<uint8_t> & SentData() const { return mData; }
+    const std::vector<uint8_t> & ReceivedData() const { return mReceived; }
+    uint32_t DroppedCount() const { return mDropped; }
+    TransferSession & Sender() { return mSender; }
+    TransferSession & Receiver() { return mReceiver; }
+
+private:
+    struct InFlightMessage
+    {
+        System::Clock::Timestamp deliverAt;
+        TransferSession * destination;
+        TransferSession::MessageTypeData typeData;
+        System::PacketBufferHandle msg;
+    };
+
+    void PollAll()
+    {
+        TransferSession::OutputEvent event;
+        do
+        {
+            mSender.PollOutput(event, mNow);
+            HandleSenderEvent(event);
+        } while (!mFailed && event.EventType != OutputEventType::kNone);
+
+        do
+        {
+            mReceiver.PollOutput(event, mNow);
+            HandleReceiverEvent(event);
+        } while (!mFailed && event.EventType != OutputEventType::kNone);
+    }
+
+    bool DeliverDue()
+    {
+        bool delivered = false;
+        for (size_t i = 0; i < mInFlight.size();)
+        {
+            if (mInFlight[i].deliverAt > mNow)
+            {
+                i++;
+                continue;
+            }
+
+            InFlightMessage message = std::move(mInFlight[i]);
+            mInFlight.erase(mInFlight.begin() + static_cast<std::ptrdiff_t>(i));
+
+            PayloadHeader payloadHeader;
+            payloadHeader.SetMessageType(message.typeData.ProtocolId, message.typeData.MessageType);
+            CHIP_ERROR err = message.destination->HandleMessageReceived(payloadHeader, std::move(message.msg), mNow);
+            Check(err);
+            delivered = true;
+        }
+        return delivered;
+    }
+
+    void Send(TransferSession & destination, TransferSession::OutputEvent & event)
+    {
+        // Only messages sent without MRP can be lost, MRP takes care of the others
+        if (mDropEveryNth > 0 && event.msgTypeData.NoAutoRequestAck && (++mUnreliableCount % mDropEveryNth) == 0)
+        {
+            mDropped++;
+            return;
+        }
+
+        mInFlight.push_back({ mNow + mLatency, &destination, event.msgTypeData, std::move(event.MsgData) });
+    }
+
+    void AcceptIfResponder(TransferSession & session, bool isReceiver)
+    {
+        TransferSession::TransferAcceptData acceptData;
+        acceptData.ControlMode  = mControlMode;
+        acceptData.MaxBlockSize = session.GetTransferBlockSize();
+        acceptData.StartOffset  = session.GetStartOffset();
+        acceptData.Length       = isReceiver ? session.GetTransferLength() : mData.size();
+        acceptData.WindowSize   = session.GetTransferWindowSize();
+        Check(session.AcceptTransfer(acceptData));
+    }
+
+    void SendNextBlock()
+    {
+        const size_t length = std::min<size_t>(kBlockSize, mData.size() - mSentOffset);
+
+        TransferSession::BlockData blockData;
+        blockData.Data   = mData.data() + mSentOffset;
+        blockData.Length = length;
+        blockData.IsEof  = (mSentOffset + length == mData.size());
+        Check(mSender.PrepareBlock(blockData));
+        mSentOffset += length;
+    }
+
+    void HandleSenderEvent(TransferSession::OutputEvent & event)
+    {
+        switch (event.EventType)
+        {
+        case OutputEventType::kMsgToSend:
+            Send(mReceiver, event);
+            break;
+        case OutputEventType::kInitReceived:
+            AcceptIfResponder(mSender, false);
+            break;
+        case OutputEventType::kAcceptReceived:
+            // Sender Drive: the Accept message allows the first block
+            SendNextBlock();
+            break;
+        case OutputEventType::kQueryReceived:
+        case OutputEventType::kAckReceived:
+            SendNextBlock();
+            break;
+        case OutputEventType::kAckEOFReceived:
+            mSenderDone = true;
+            break;
+        case OutputEventType::kNone:
+            break;
+        default:
+            ChipLogError(BDX, "Unexpected sender event %s", TransferSession::OutputEvent::TypeToString(event.EventType));
+            mFailed = true;
+            break;
+        }
+    }
+
+    void HandleReceiverEvent(TransferSession::OutputEvent & event)
+    {
+        switch (event.EventType)
+        {
+        case OutputEventType::kMsgToSend:
+            Send(mSender, event);
+            if (event.msgTypeData.HasMessageType(MessageType::BlockAckEOF))
+            {
+                mReceiverDone = true;
+            }
+            break;
+        case OutputEventType::kInitReceived:
+            AcceptIfResponder(mReceiver, true);
+            break;
+        case OutputEventType::kAcceptReceived:
+            Check(mReceiver.PrepareBlockQuery());
+            break;
+        case OutputEventType::kBlockReceived:
+            mReceived.insert(mReceived.end(), event.blockdata.Data, event.blockdata.Data + event.blockdata.Length);
+            if (!event.blockdata.IsEof && mControlMode == TransferControlFlags::kReceiverDrive)
+            {
+                Check(mReceiver.PrepareBlockQuery());
+            }
+            else
+            {
+                Check(mReceiver.PrepareBlockAck());
+            }
+            break;
+        case OutputEventType::kNone:
+            break;
+        default:
+            ChipLogError(BDX, "Unexpected receiver event %s", TransferSession::OutputEvent::TypeToString(event.EventType));
+            mFailed = true;
+            break;
+        }
+    }
+
+    void Check(CHIP_ERROR err)
+    {
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(BDX, "Unexpected error %" CHIP_ERROR_FORMAT, err.Format());
+            mFailed = true;
+        }
+    }
+
+    TransferControlFlags mControlMode;
+    uint8_t mWindowSize;
+    System::Clock::Milliseconds64 mLatency;
+    uint32_t mDropEveryNth;
+
+    TransferSession mSender;
+    TransferSession mReceiver;
+
+    std::vector<InFlightMessage> mInFlight;
+    System::Clock::Timestamp mNow = System::Clock::kZero;
+
+    std::vector<uint8_t> mData;
+    std::vector<uint8_t> mReceived;
+    size_t mSentOffset        = 0;
+    uint32_t mUnreliableCount = 0;
+    uint32_t mDropped         = 0;
+    bool mSenderDone          = false;
+    bool mReceiverDone        = false;
+    bool mFailed              = false;
+};
+
+struct TestBdxWindowedTransfer : public ::testing::Test
+{
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+void PassMessage(TransferSession & from, TransferSession & to, TransferSession::OutputEvent & event)
+{
+    from.PollOutput(event, System::Clock::kZero);
+    ASSERT_EQ(event.EventType, OutputEventType::kMsgToSend);
+
+    PayloadHeader payloadHeader;
+    payloadHeader.SetMessageType(event.msgTypeData.ProtocolId, event.msgTypeData.MessageType);
+    EXPECT_EQ(to.HandleMessageReceived(payloadHeader, std::move(event.MsgData), System::Clock::kZero), CHIP_NO_ERROR);
+    to.PollOutput(event, System::Clock::kZero);
+}
+
+TEST_F(TestBdxWindowedTransfer, NegotiatesWindowSize)
+{
+    TransferSession initiator;
+    TransferSession responder;
+    TransferSession::OutputEvent event;
+
+    // Application metadata must reach the peer unchanged, the window size element is removed from it
+    uint8_t metadata[32];
+    TLV::TLVWriter writer;
+    TLV::TLVType outerType;
+    writer.Init(metadata);
+    ASSERT_EQ(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outerType), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.PutString(TLV::ContextTag(1), "metadata"), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.EndContainer(outerType), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+
+    ASSERT_EQ(
+        responder.WaitForTransfer(TransferRole::kSender, TransferControlFlags::kReceiverDrive, kBlockSize, kTransferTimeout, 8),
+        CHIP_NO_ERROR);
+
+    TransferSession::TransferInitData initData;
+    initData.TransferCtlFlags = TransferControlFlags::kReceiverDrive;
+    initData.MaxBlockSize     = kBlockSize;
+    initData.Metadata         = metadata;
+    initData.MetadataLength   = writer.GetLengthWritten();
+    initData.MaxWindowSize    = 4;
+    ASSERT_EQ(initiator.StartTransfer(TransferRole::kReceiver, initData, kTransferTimeout), CHIP_NO_ERROR);
+
+    PassMessage(initiator, responder, event);
+    ASSERT_EQ(event.EventType, OutputEventType::kInitReceived);
+    EXPECT_EQ(event.transferInitData.MaxWindowSize, 4);
+    ASSERT_EQ(event.transferInitData.MetadataLength, initData.MetadataLength);
+    EXPECT_EQ(memcmp(event.transferInitData.Metadata, metadata, initData.MetadataLength), 0);
+    EXPECT_EQ(responder.GetTransferWindowSize(), 4);
+
+    // The window can't be larger than the proposed one
+    TransferSession::TransferAcceptData acceptData;
+    acceptData.ControlMode  = TransferControlFlags::kReceiverDrive;
+    acceptData.MaxBlockSize = kBlockSize;
+    acceptData.WindowSize   = 5;
+    EXPECT_EQ(responder.AcceptTransfer(acceptData), CHIP_ERROR_INVALID_ARGUMENT);
+
+    acceptData.WindowSize = 3;
+    ASSERT_EQ(responder.AcceptTransfer(acceptData), CHIP_NO_ERROR);
+    EXPECT_EQ(responder.GetTransferWindowSize(), 3);
+
+    PassMessage(responder, initiator, event);
+    ASSERT_EQ(event.EventType, OutputEventType::kAcceptReceived);
+    EXPECT_EQ(event.transferAcceptData.WindowSize, 3);
+    EXPECT_EQ(event.transferAcceptData.MetadataLength, 0u);
+    EXPECT_EQ(initiator.GetTransferWindowSize(), 3);
+
+    // The first BlockQuery is sent reliably, and allows 3 blocks
+    ASSERT_EQ(initiator.PrepareBlockQuery(), CHIP_NO_ERROR);
+    initiator.PollOutput(event, System::Clock::kZero);
+    ASSERT_EQ(event.EventType, OutputEventType::kMsgToSend);
+    EXPECT_FALSE(event.msgTypeData.NoAutoRequestAck);
+
+    PayloadHeader payloadHeader;
+    payloadHeader.SetMessageType(event.msgTypeData.ProtocolId, event.msgTypeData.MessageType);
+    ASSERT_EQ(responder.HandleMessageReceived(payloadHeader, std::move(event.MsgData), System::Clock::kZero), CHIP_NO_ERROR);
+
+    uint8_t blockData[kBlockSize] = {};
+    TransferSession::BlockData block;
+    block.Data   = blockData;
+    block.Length = sizeof(blockData);
+    for (int i = 0; i < 3; i++)
+    {
+        responder.PollOutput(event, System::Clock::kZero);
+        ASSERT_EQ(event.EventType, OutputEventType::kQueryReceived);
+        ASSERT_EQ(responder.PrepareBlock(block), CHIP_NO_ERROR);
+        responder.PollOutput(event, System::Clock::kZero);
+        ASSERT_EQ(event.EventType, OutputEventType::kMsgToSend);
+        EXPECT_TRUE(event.msgTypeData.NoAutoRequestAck);
+    }
+
+    // The window is full until the receiver acknowledges a block
+    responder.PollOutput(event, System::Clock::kZero);
+    EXPECT_EQ(event.EventType, OutputEventType::kNone);
+    EXPECT_EQ(responder.PrepareBlock(block), CHIP_ERROR_INCORRECT_STATE);
+}
+
+TEST_F(TestBdxWindowedTransfer, FallsBackToLockStep)
+{
+    TransferSession initiator;
+    TransferSession responder;
+    TransferSession::OutputEvent event;
+
+    // A responder that does not support windowed transfers ignores the proposal
+    ASSERT_EQ(responder.WaitForTransfer(TransferRole::kReceiver, TransferControlFlags::kSenderDrive, kBlockSize, kTransferTimeout),
+              CHIP_NO_ERROR);
+
+    TransferSession::TransferInitData initData;
+    initData.TransferCtlFlags = TransferControlFlags::kSenderDrive;
+    initData.MaxBlockSize     = kBlockSize;
+    initData.MaxWindowSize    = 8;
+    ASSERT_EQ(initiator.StartTransfer(TransferRole::kSender, initData, kTransferTimeout), CHIP_NO_ERROR);
+
+    PassMessage(initiator, responder, event);
+    ASSERT_EQ(event.EventType, OutputEventType::kInitReceived);
+    EXPECT_EQ(responder.GetTransferWindowSize(), 1);
+
+    TransferSession::TransferAcceptData acceptData;
+    acceptData.ControlMode  = TransferControlFlags::kSenderDrive;
+    acceptData.MaxBlockSize = kBlockSize;
+    acceptData.WindowSize   = 2;
+    EXPECT_EQ(responder.AcceptTransfer(acceptData), CHIP_ERROR_INVALID_ARGUMENT);
+
+    acceptData.WindowSize = 1;
+    ASSERT_EQ(responder.AcceptTransfer(acceptData), CHIP_NO_ERROR);
+    PassMessage(responder, initiator, event);
+    ASSERT_EQ(event.EventType, OutputEventType::kAcceptReceived);
+    EXPECT_EQ(event.transferAcceptData.WindowSize, 1);
+    EXPECT_EQ(initiator.GetTransferWindowSize(), 1);
+
+    // Proposing more than the supported maximum is an error
+    TransferSession other;
+    initData.MaxWindowSize = CHIP_CONFIG_BDX_MAX_WINDOW_SIZE + 1;
+    EXPECT_EQ(other.StartTransfer(TransferRole::kSender, initData, kTransferTimeout), CHIP_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(TestBdxWindowedTransfer, ErrorsDoNotReplacePendingOutput)
+{
+    TransferSession receiver;
+    TransferSession sender;
+    TransferSession::OutputEvent event;
+
+    ASSERT_EQ(sender.WaitForTransfer(TransferRole::kSender, TransferControlFlags::kReceiverDrive, kBlockSize, kTransferTimeout, 4),
+              CHIP_NO_ERROR);
+
+    TransferSession::TransferInitData initData;
+    initData.TransferCtlFlags = TransferControlFlags::kReceiverDrive;
+    initData.MaxBlockSize     = kBlockSize;
+    initData.MaxWindowSize    = 4;
+    ASSERT_EQ(receiver.StartTransfer(TransferRole::kReceiver, initData, kTransferTimeout), CHIP_NO_ERROR);
+
+    PassMessage(receiver, sender, event);
+    ASSERT_EQ(event.EventType, OutputEventType::kInitReceived);
+
+    TransferSession::TransferAcceptData acceptData;
+    acceptData.ControlMode  = TransferControlFlags::kReceiverDrive;
+    acceptData.MaxBlockSize = kBlockSize;
+    acceptData.WindowSize   = 4;
+    ASSERT_EQ(sender.AcceptTransfer(acceptData), CHIP_NO_ERROR);
+    PassMessage(sender, receiver, event);
+    ASSERT_EQ(event.EventType, OutputEventType::kAcceptReceived);
+
+    // The first BlockQuery is pending when a block outside of the window it allows is received
+    ASSERT_EQ(receiver.PrepareBlockQuery(), CHIP_NO_ERROR);
+
+    uint8_t blockData[kBlockSize] = {};
+    DataBlock block;
+    block.BlockCounter = 10;
+    block.Data         = blockData;
+    block.DataLength   = sizeof(blockData);
+
+    const size_t msgSize = block.MessageSize();
+    Encoding::LittleEndian::PacketBufferWriter bbuf(System::PacketBufferHandle::New(msgSize));
+    ASSERT_FALSE(bbuf.IsNull());
+    block.WriteToBuffer(bbuf);
+    System::PacketBufferHandle msg = bbuf.Finalize();
+    ASSERT_FALSE(msg.IsNull());
+
+    PayloadHeader payloadHeader;
+    payloadHeader.SetMessageType(MessageType::Block);
+    EXPECT_EQ(receiver.HandleMessageReceived(payloadHeader, std::move(msg), System::Clock::kZero), CHIP_NO_ERROR);
+
+    // The BlockQuery is still sent, then the error is reported
+    receiver.PollOutput(event, System::Clock::kZero);
+    ASSERT_EQ(event.EventType, OutputEventType::kMsgToSend);
+    EXPECT_TRUE(event.msgTypeData.HasMessageType(MessageType::BlockQuery));
+    EXPECT_FALSE(event.MsgData.IsNull());
+
+    receiver.PollOutput(event, System::Clock::kZero);
+    ASSERT_EQ(event.EventType, OutputEventType::kMsgToSend);
+    EXPECT_TRUE(event.msgTypeData.HasMessageType(Protocols::SecureChannel::MsgType::StatusReport));
+
+    receiver.PollOutput(event, System::Clock::kZero);
+    ASSERT_EQ(event.EventType, OutputEventType::kInternalError);
+    EXPECT_EQ(event.statusData.statusCode, StatusCode::kBadBlockCounter);
+}
+
+TEST_F(TestBdxWindowedTransfer, TransfersAllData)
+{
+    for (auto controlMode : { TransferControlFlags::kReceiverDrive, TransferControlFlags::kSenderDrive })
+    {
+        for (uint8_t windowSize : std::initializer_list<uint8_t>{ 1, 2, 5 })
+        {
+            WindowedTransferLoopback loopback(controlMode, windowSize, 10_ms64);
+            ASSERT_EQ(loopback.Start(), CHIP_NO_ERROR);
+            ASSERT_TRUE(loopback.Run());
+            EXPECT_EQ(loopback.ReceivedData(), loopback.SentData());
+            EXPECT_EQ(loopback.Sender().GetTransferWindowSize(), windowSize);
+            EXPECT_EQ(loopback.Receiver().GetTransferWindowSize(), windowSize);
+        }
+    }
+}
+
+TEST_F(TestBdxWindowedTransfer, RecoversLostMessages)
+{
+    for (auto controlMode : { TransferControlFlags::kReceiverDrive, TransferControlFlags::kSenderDrive })
+    {
+        for (uint32_t dropEveryNth : { 3u, 7u })
+        {
+            WindowedTransferLoopback loopback(controlMode, 4, 10_ms64, dropEveryNth);
+            ASSERT_EQ(loopback.Start(), CHIP_NO_ERROR);
+            ASSERT_TRUE(loopback.Run());
+            EXPECT_GT(loopback.DroppedCount(), 0u);
+            EXPECT_EQ(loopback.ReceivedData(), loopback.SentData());
+        }
+    }
+}
+
+TEST_F(TestBdxWindowedTransfer, LargerWindowsAreFaster)
+{
+    // With a 50ms one-way latency, a lock-step transfer is limited to one block per 100ms round trip
+    for (auto controlMode : { TransferControlFlags::kReceiverDrive, TransferControlFlags::kSenderDrive })
+    {
+        System::Clock::Timestamp previousDuration = System::Clock::kZero;
+        for (uint8_t windowSize : std::initializer_list<uint8_t>{ 1, 2, 4, 8 })
+        {
+            WindowedTransferLoopback loopback(controlMode, windowSize, 50_ms64);
+            ASSERT_EQ(loopback.Start(), CHIP_NO_ERROR);
+            ASSERT_TRUE(loopback.Run());
+            EXPECT_EQ(loopback.ReceivedData(), loopback.SentData());
+
+            const System::Clock::Timestamp duration = loopback.Now();
+            ChipLogProgress(BDX, "%s drive, window size %u: %u bytes in %" PRIu64 " ms",
+                            controlMode == TransferControlFlags::kReceiverDrive ? "Receiver" : "Sender", windowSize,
+                            static_cast<unsigned>(loopback.SentData().size()), duration.count());
+
+            if (previousDuration != System::Clock::kZero)
+            {
+                // Doubling the window should almost halve the transfer time, apart from the fixed cost of the negotiation
+                EXPECT_LT(duration.count() * 3, previousDuration.count() * 2);
+            }
+            previousDuration = duration;
+        }
+    }
+}
+
+} // namespace
@@ -2012,6 +2012,10 @@ CHIP_ERROR CASESession::HandleSigma3a(System::PacketBufferHandle && msg)
             SuccessOrExit(err = signedDataTlvReader.ExitContainer(containerType));
         }
 
+        // The cache is only accessed here and in HandleSigma3c, on the Matter thread.
+        data.validContext.mSkipSignatureVerification = mFabricsTable->GetVerifiedCertificateChainCache().Contains(
+            mFabricIndex, data.initiatorNOC, data.initiatorICAC, data.fabricRCAC);
+
         SuccessOrExit(err = helper->ScheduleWork());
         mHandleSigma3Helper = helper;
         mExchangeCtxt.Value()->WillSendMessage();
@@ -2122,6 +2126,12 @@ CHIP_ERROR CASESession::HandleSigma3c(HandleSigma3Data & data, CHIP_ERROR status
 
     SuccessOrExit(err = status);
 
+    if (!data.validContext.mSkipSignatureVerification)
+    {
+        mFabricsTable->GetVerifiedCertificateChainCache().Add(mFabricIndex, data.initiatorNOC, data.initiatorICAC,
+                                                              data.fabricRCAC);
+    }
+
     mPeerNodeId = data.initiatorNodeId;
 
     {
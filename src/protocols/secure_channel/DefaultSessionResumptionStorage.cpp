@@ -20,11 +20,19 @@
 #include <lib/support/Base64.h>
 #include <lib/support/SafeInt.h>
 
+#include <algorithm>
+
 namespace chip {
 
 CHIP_ERROR DefaultSessionResumptionStorage::FindByScopedNodeId(const ScopedNodeId & node, ResumptionIdStorage & resumptionId,
                                                                Crypto::P256ECDHDerivedSecret & sharedSecret, CATValues & peerCATs)
 {
+    // Nodes missing from the index have no state to load.  If the index cannot be loaded, fall back to the state table.
+    if (LoadIndexCache() == CHIP_NO_ERROR)
+    {
+        VerifyOrReturnError(FindIndexCacheEntry(node) != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+    }
+
     ReturnErrorOnFailure(LoadState(node, resumptionId, sharedSecret, peerCATs));
     return CHIP_NO_ERROR;
 }
@@ -42,6 +50,14 @@ CHIP_ERROR DefaultSessionResumptionStorage::FindByResumptionId(ConstResumptionId
 
 CHIP_ERROR DefaultSessionResumptionStorage::FindNodeByResumptionId(ConstResumptionIdView resumptionId, ScopedNodeId & node)
 {
+    if (LoadIndexCache() == CHIP_NO_ERROR)
+    {
+        const IndexCacheEntry * entry = FindIndexCacheEntry(resumptionId);
+        VerifyOrReturnError(entry != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+        node = entry->mNode;
+        return CHIP_NO_ERROR;
+    }
+
     ReturnErrorOnFailure(LoadLink(resumptionId, node));
     return CHIP_NO_ERROR;
 }
@@ -49,70 +65,139 @@ CHIP_ERROR DefaultSessionResumptionStorage::FindNodeByResumptionId(ConstResumpti
 CHIP_ERROR DefaultSessionResumptionStorage::Save(const ScopedNodeId & node, ConstResumptionIdView resumptionId,
                                                  const Crypto::P256ECDHDerivedSecret & sharedSecret, const CATValues & peerCATs)
 {
-    SessionIndex index;
-    ReturnErrorOnFailure(LoadIndex(index));
+    ReturnErrorOnFailure(LoadIndexCache());
 
-    for (size_t i = 0; i < index.mSize; ++i)
+    IndexCacheEntry * entry = FindIndexCacheEntry(node);
+    if (entry != nullptr)
     {
-        if (index.mNodes[i] == node)
+        // Node already exists in the index.  Save in place; the index itself does not change.
+        //
+        // This follows the approach in Delete.  Removal of the old
+        // resumption-id-keyed link is best effort.  If the resumption ID
+        // for the key is unknown, the entry in the link table will be leaked.
+        if (!entry->mHasResumptionId)
+        {
+            ChipLogError(SecureChannel,
+                         "Unknown resumption ID; unable to fully delete session resumption record for node " ChipLogFormatX64,
+                         ChipLogValueX64(node.GetNodeId()));
+        }
+        else
         {
-            // Node already exists in the index.  Save in place.
-            CHIP_ERROR err = CHIP_NO_ERROR;
-            ResumptionIdStorage oldResumptionId;
-            Crypto::P256ECDHDerivedSecret oldSharedSecret;
-            CATValues oldPeerCATs;
-            // This follows the approach in Delete.  Removal of the old
-            // resumption-id-keyed link is best effort.  If we cannot load
-            // state to lookup the resumption ID for the key, the entry in
-            // the link table will be leaked.
-            err = LoadState(node, oldResumptionId, oldSharedSecret, oldPeerCATs);
+            CHIP_ERROR err = DeleteLink(entry->mResumptionId);
             if (err != CHIP_NO_ERROR)
             {
                 ChipLogError(SecureChannel,
-                             "LoadState failed; unable to fully delete session resumption record for node " ChipLogFormatX64
+                             "DeleteLink failed; unable to fully delete session resumption record for node " ChipLogFormatX64
                              ": %" CHIP_ERROR_FORMAT,
                              ChipLogValueX64(node.GetNodeId()), err.Format());
             }
-            else
-            {
-                err = DeleteLink(oldResumptionId);
-                if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(SecureChannel,
-                                 "DeleteLink failed; unable to fully delete session resumption record for node " ChipLogFormatX64
-                                 ": %" CHIP_ERROR_FORMAT,
-                                 ChipLogValueX64(node.GetNodeId()), err.Format());
-                }
-            }
-            ReturnErrorOnFailure(SaveState(node, resumptionId, sharedSecret, peerCATs));
-            ReturnErrorOnFailure(SaveLink(resumptionId, node));
-            return CHIP_NO_ERROR;
         }
+        ReturnErrorOnFailure(SaveState(node, resumptionId, sharedSecret, peerCATs));
+        ReturnErrorOnFailure(SaveLink(resumptionId, node));
+
+        std::copy(resumptionId.begin(), resumptionId.end(), entry->mResumptionId.begin());
+        entry->mHasResumptionId = true;
+        return CHIP_NO_ERROR;
     }
 
     // Constant product inside a CHIPConfig.h macro; cannot widen at the use site.
     // NOLINTNEXTLINE(bugprone-implicit-widening-of-multiplication-result)
-    if (index.mSize == CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE)
+    bool evicted = (mIndexCacheSize == CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE);
+    if (evicted)
     {
         // TODO: implement LRU for resumption
-        ReturnErrorOnFailure(Delete(index.mNodes[0]));
-        ReturnErrorOnFailure(LoadIndex(index));
+        DeleteRecords(mIndexCache[0].mNode);
+        RemoveIndexCacheEntry(0);
+    }
+
+    CHIP_ERROR err = SaveState(node, resumptionId, sharedSecret, peerCATs);
+    if (err == CHIP_NO_ERROR)
+    {
+        err = SaveLink(resumptionId, node);
     }
 
-    ReturnErrorOnFailure(SaveState(node, resumptionId, sharedSecret, peerCATs));
-    ReturnErrorOnFailure(SaveLink(resumptionId, node));
+    if (err == CHIP_NO_ERROR)
+    {
+        entry        = &mIndexCache[mIndexCacheSize++];
+        entry->mNode = node;
+        std::copy(resumptionId.begin(), resumptionId.end(), entry->mResumptionId.begin());
+        entry->mHasResumptionId = true;
+    }
 
-    index.mNodes[index.mSize++] = node;
-    ReturnErrorOnFailure(SaveIndex(index));
+    // The eviction and the insertion are persisted with a single write of the index.
+    if (err == CHIP_NO_ERROR || evicted)
+    {
+        CHIP_ERROR saveErr = SaveIndexCache();
+        err                = (err == CHIP_NO_ERROR) ? saveErr : err;
+    }
 
-    return CHIP_NO_ERROR;
+    return err;
 }
 
 CHIP_ERROR DefaultSessionResumptionStorage::Delete(const ScopedNodeId & node)
 {
-    SessionIndex index;
-    ReturnErrorOnFailure(LoadIndex(index));
+    ReturnErrorOnFailure(LoadIndexCache());
+
+    DeleteRecords(node);
+
+    const IndexCacheEntry * entry = FindIndexCacheEntry(node);
+    if (entry != nullptr)
+    {
+        RemoveIndexCacheEntry(static_cast<size_t>(entry - mIndexCache));
+        CHIP_ERROR err = SaveIndexCache();
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(SecureChannel, "Unable to save session resumption index: %" CHIP_ERROR_FORMAT, err.Format());
+        }
+    }
+    else
+    {
+        ChipLogError(SecureChannel, "Unable to find session resumption state for node in index " ChipLogFormatX64,
+                     ChipLogValueX64(node.GetNodeId()));
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR DefaultSessionResumptionStorage::DeleteAll(FabricIndex fabricIndex)
+{
+    CHIP_ERROR stickyErr = CHIP_NO_ERROR;
+    ReturnErrorOnFailure(LoadIndexCache());
+
+    size_t kept = 0;
+    for (size_t i = 0; i < mIndexCacheSize; ++i)
+    {
+        if (mIndexCache[i].mNode.GetFabricIndex() == fabricIndex)
+        {
+            CHIP_ERROR err = DeleteFabricRecords(mIndexCache[i].mNode);
+            stickyErr      = stickyErr == CHIP_NO_ERROR ? err : stickyErr;
+            if (err == CHIP_NO_ERROR)
+            {
+                continue;
+            }
+        }
+        mIndexCache[kept++] = mIndexCache[i];
+    }
 
+    if (kept != mIndexCacheSize)
+    {
+        mIndexCacheSize = kept;
+        CHIP_ERROR err  = SaveIndexCache();
+        stickyErr       = stickyErr == CHIP_NO_ERROR ? err : stickyErr;
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(
+                SecureChannel,
+                "Session resumption cache is in an inconsistent state!  "
+                "Unable to save session resumption index during attempted deletion of fabric index %u: %" CHIP_ERROR_FORMAT,
+                fabricIndex, err.Format());
+        }
+    }
+    return stickyErr;
+}
+
+void DefaultSessionResumptionStorage::DeleteRecords(const ScopedNodeId & node)
+{
     ResumptionIdStorage resumptionId;
     Crypto::P256ECDHDerivedSecret sharedSecret;
     CATValues peerCATs;
@@ -141,119 +226,120 @@ CHIP_ERROR DefaultSessionResumptionStorage::Delete(const ScopedNodeId & node)
         ChipLogError(SecureChannel, "Unable to delete session resumption state for node " ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
                      ChipLogValueX64(node.GetNodeId()), err.Format());
     }
+}
 
-    bool found = false;
-    for (size_t i = 0; i < index.mSize; ++i)
+CHIP_ERROR DefaultSessionResumptionStorage::DeleteFabricRecords(const ScopedNodeId & node)
+{
+    const FabricIndex fabricIndex = node.GetFabricIndex();
+    ResumptionIdStorage resumptionId;
+    Crypto::P256ECDHDerivedSecret sharedSecret;
+    CATValues peerCATs;
+
+    CHIP_ERROR err = LoadState(node, resumptionId, sharedSecret, peerCATs);
+    if (err != CHIP_NO_ERROR)
     {
-        if (found)
-        {
-            // index.mSize was decreased by 1 when found was set to true.
-            // So the (i+1)th element isn't out of bounds.
-            index.mNodes[i] = index.mNodes[i + 1];
-        }
-        else
-        {
-            if (index.mNodes[i] == node)
-            {
-                found = true;
-                if (i + 1 < index.mSize)
-                {
-                    index.mNodes[i] = index.mNodes[i + 1];
-                }
-                index.mSize -= 1;
-            }
-        }
+        ChipLogError(SecureChannel,
+                     "Session resumption cache deletion partially failed for fabric index %u, "
+                     "unable to load node state: %" CHIP_ERROR_FORMAT,
+                     fabricIndex, err.Format());
+        return err;
     }
-
-    if (found)
+    err = DeleteLink(resumptionId);
+    if (err != CHIP_NO_ERROR)
     {
-        err = SaveIndex(index);
-        if (err != CHIP_NO_ERROR)
-        {
-            ChipLogError(SecureChannel, "Unable to save session resumption index: %" CHIP_ERROR_FORMAT, err.Format());
-        }
+        ChipLogError(SecureChannel,
+                     "Session resumption cache deletion partially failed for fabric index %u, "
+                     "unable to delete node link: %" CHIP_ERROR_FORMAT,
+                     fabricIndex, err.Format());
+        return err;
     }
-    else
+    err = DeleteState(node);
+    if (err != CHIP_NO_ERROR)
     {
         ChipLogError(SecureChannel,
-                     "Unable to find session resumption state for node in index" ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
-                     ChipLogValueX64(node.GetNodeId()), err.Format());
+                     "Session resumption cache is in an inconsistent state!  "
+                     "Unable to delete node state during attempted deletion of fabric index %u: %" CHIP_ERROR_FORMAT,
+                     fabricIndex, err.Format());
+        return err;
     }
-
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR DefaultSessionResumptionStorage::DeleteAll(FabricIndex fabricIndex)
+CHIP_ERROR DefaultSessionResumptionStorage::LoadIndexCache()
 {
-    CHIP_ERROR stickyErr = CHIP_NO_ERROR;
-    size_t found         = 0;
+    VerifyOrReturnError(!mIndexCacheLoaded, CHIP_NO_ERROR);
+
     SessionIndex index;
     ReturnErrorOnFailure(LoadIndex(index));
-    size_t initialSize = index.mSize;
-    for (size_t i = 0; i < initialSize; ++i)
+    VerifyOrReturnError(index.mSize <= MATTER_ARRAY_SIZE(mIndexCache), CHIP_ERROR_INTERNAL);
+
+    for (size_t i = 0; i < index.mSize; ++i)
     {
-        CHIP_ERROR err = CHIP_NO_ERROR;
-        size_t cur     = i - found;
-        size_t remain  = initialSize - i;
-        ResumptionIdStorage resumptionId;
+        IndexCacheEntry & entry = mIndexCache[i];
         Crypto::P256ECDHDerivedSecret sharedSecret;
         CATValues peerCATs;
-        if (index.mNodes[cur].GetFabricIndex() != fabricIndex)
-        {
-            continue;
-        }
-        err       = LoadState(index.mNodes[cur], resumptionId, sharedSecret, peerCATs);
-        stickyErr = stickyErr == CHIP_NO_ERROR ? err : stickyErr;
-        if (err != CHIP_NO_ERROR)
-        {
-            ChipLogError(SecureChannel,
-                         "Session resumption cache deletion partially failed for fabric index %u, "
-                         "unable to load node state: %" CHIP_ERROR_FORMAT,
-                         fabricIndex, err.Format());
-            continue;
-        }
-        err       = DeleteLink(resumptionId);
-        stickyErr = stickyErr == CHIP_NO_ERROR ? err : stickyErr;
-        if (err != CHIP_NO_ERROR)
-        {
-            ChipLogError(SecureChannel,
-                         "Session resumption cache deletion partially failed for fabric index %u, "
-                         "unable to delete node link: %" CHIP_ERROR_FORMAT,
-                         fabricIndex, err.Format());
-            continue;
-        }
-        err       = DeleteState(index.mNodes[cur]);
-        stickyErr = stickyErr == CHIP_NO_ERROR ? err : stickyErr;
-        if (err != CHIP_NO_ERROR)
-        {
-            ChipLogError(SecureChannel,
-                         "Session resumption cache is in an inconsistent state!  "
-                         "Unable to delete node state during attempted deletion of fabric index %u: %" CHIP_ERROR_FORMAT,
-                         fabricIndex, err.Format());
-            continue;
-        }
-        ++found;
-        --remain;
-        if (remain)
+        entry.mNode            = index.mNodes[i];
+        entry.mHasResumptionId = (LoadState(entry.mNode, entry.mResumptionId, sharedSecret, peerCATs) == CHIP_NO_ERROR);
+    }
+
+    mIndexCacheSize   = index.mSize;
+    mIndexCacheLoaded = true;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR DefaultSessionResumptionStorage::SaveIndexCache()
+{
+    SessionIndex index;
+    index.mSize = mIndexCacheSize;
+    for (size_t i = 0; i < mIndexCacheSize; ++i)
+    {
+        index.mNodes[i] = mIndexCache[i].mNode;
+    }
+
+    CHIP_ERROR err = SaveIndex(index);
+    if (err != CHIP_NO_ERROR)
+    {
+        // Reload from the backend on next use, so that the cache does not diverge from the persisted index.
+        InvalidateIndexCache();
+    }
+    return err;
+}
+
+DefaultSessionResumptionStorage::IndexCacheEntry * DefaultSessionResumptionStorage::FindIndexCacheEntry(const ScopedNodeId & node)
+{
+    for (size_t i = 0; i < mIndexCacheSize; ++i)
+    {
+        if (mIndexCache[i].mNode == node)
         {
-            memmove(&index.mNodes[cur], &index.mNodes[cur + 1], remain * sizeof(index.mNodes[0]));
+            return &mIndexCache[i];
         }
     }
-    if (found)
+    return nullptr;
+}
+
+DefaultSessionResumptionStorage::IndexCacheEntry *
+DefaultSessionResumptionStorage::FindIndexCacheEntry(ConstResumptionIdView resumptionId)
+{
+    for (size_t i = 0; i < mIndexCacheSize; ++i)
     {
-        index.mSize -= found;
-        CHIP_ERROR err = SaveIndex(index);
-        stickyErr      = stickyErr == CHIP_NO_ERROR ? err : stickyErr;
-        if (err != CHIP_NO_ERROR)
+        IndexCacheEntry & entry = mIndexCache[i];
+        if (entry.mHasResumptionId &&
+            std::equal(entry.mResumptionId.begin(), entry.mResumptionId.end(), resumptionId.begin(), resumptionId.end()))
         {
-            ChipLogError(
-                SecureChannel,
-                "Session resumption cache is in an inconsistent state!  "
-                "Unable to save session resumption index during attempted deletion of fabric index %u: %" CHIP_ERROR_FORMAT,
-                fabricIndex, err.Format());
+            return &entry;
         }
     }
-    return stickyErr;
+    return nullptr;
+}
+
+void DefaultSessionResumptionStorage::RemoveIndexCacheEntry(size_t index)
+{
+    VerifyOrReturn(index < mIndexCacheSize);
+    for (size_t i = index + 1; i < mIndexCacheSize; ++i)
+    {
+        mIndexCache[i - 1] = mIndexCache[i];
+    }
+    mIndexCacheSize--;
 }
 
 } // namespace chip
@@ -29,6 +29,11 @@ namespace chip {
  *   The implementation saves 2 maps:
  *     * <FabricIndex, PeerNodeId>   => <ResumptionId, ShareSecret, PeerCATs>
  *     * <ResumptionId>              => <FabricIndex, PeerNodeId>
+ *
+ *   The index of stored nodes, together with the resumption ID of each node, is also kept in RAM. It is loaded from the
+ *   backend on first use and updated in write-through fashion, so lookups by ResumptionId and in-place updates of a node's
+ *   record do not need to read the index or the link table, and the index is only written when the set of stored nodes
+ *   changes.
  */
 class DefaultSessionResumptionStorage : public SessionResumptionStorage
 {
@@ -66,6 +71,34 @@ protected:
     CHIP_ERROR virtual LoadState(const ScopedNodeId & node, ResumptionIdStorage & resumptionId,
                                  Crypto::P256ECDHDerivedSecret & sharedSecret, CATValues & peerCATs)             = 0;
     CHIP_ERROR virtual DeleteState(const ScopedNodeId & node)                                                    = 0;
+
+    /**
+     * Drops the in-memory copy of the index, so that it is loaded again from the backend on next use. Must be called by
+     * subclasses whenever the backend is changed underneath this object.
+     */
+    void InvalidateIndexCache() { mIndexCacheLoaded = false; }
+
+private:
+    struct IndexCacheEntry
+    {
+        ScopedNodeId mNode;
+        ResumptionIdStorage mResumptionId;
+        // False if the state of a node listed in the persisted index could not be loaded.
+        bool mHasResumptionId;
+    };
+
+    CHIP_ERROR LoadIndexCache();
+    CHIP_ERROR SaveIndexCache();
+    IndexCacheEntry * FindIndexCacheEntry(const ScopedNodeId & node);
+    IndexCacheEntry * FindIndexCacheEntry(ConstResumptionIdView resumptionId);
+    void RemoveIndexCacheEntry(size_t index);
+
+    void DeleteRecords(const ScopedNodeId & node);
+    CHIP_ERROR DeleteFabricRecords(const ScopedNodeId & node);
+
+    IndexCacheEntry mIndexCache[CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE];
+    size_t mIndexCacheSize = 0;
+    bool mIndexCacheLoaded = false;
 };
 
 } // namespace chip
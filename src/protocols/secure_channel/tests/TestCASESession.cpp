@@ -643,6 +643,121 @@ TEST_F(TestCASESession, ClientReceivesBusyTest)
     gPairingServer.Shutdown();
 }
 
+// Hands each incoming Sigma1 to its own responder session, so that several handshakes can be in
+// progress at the same time (CASEServer handles a single one).
+class ConcurrentCASEResponder : public UnsolicitedMessageHandler
+{
+public:
+    static constexpr size_t kMaxSessions = CHIP_CONFIG_UNAUTHENTICATED_CONNECTION_POOL_SIZE;
+
+    CHIP_ERROR OnUnsolicitedMessageReceived(const PayloadHeader & payloadHeader, ExchangeDelegate *& newDelegate) override
+    {
+        VerifyOrReturnError(mNextSession < mSessionCount, CHIP_ERROR_NO_MEMORY);
+        newDelegate = mSessions[mNextSession++];
+        return CHIP_NO_ERROR;
+    }
+
+    void SetSessions(CASESession ** sessions, size_t count)
+    {
+        mSessions     = sessions;
+        mSessionCount = count;
+        mNextSession  = 0;
+    }
+
+private:
+    CASESession ** mSessions = nullptr;
+    size_t mSessionCount     = 0;
+    size_t mNextSession      = 0;
+};
+
+// Establishes many CASE sessions against a local responder, with as many handshakes in flight at
+// once as the unauthenticated session pool allows, and logs the resulting handshake rate.
+TEST_F(TestCASESession, ConcurrentHandshakesLoadTest)
+{
+    constexpr size_t kHandshakeCount = 200;
+    // Each handshake uses an unauthenticated session on both the initiator and responder sides.
+    constexpr size_t kConcurrentHandshakes = ConcurrentCASEResponder::kMaxSessions / 2;
+    static_assert(kConcurrentHandshakes > 0, "Not enough unauthenticated sessions for a handshake");
+
+    TemporarySessionManager sessionManager(*this);
+    ConcurrentCASEResponder responder;
+    EXPECT_EQ(GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::CASE_Sigma1,
+                                                                            &responder),
+              CHIP_NO_ERROR);
+
+    size_t numStarted                    = 0;
+    size_t numEstablished                = 0;
+    const System::Clock::Timestamp start = System::SystemClock().GetMonotonicTimestamp();
+
+    while (numStarted < kHandshakeCount)
+    {
+        TestCASESecurePairingDelegate delegatesInitiator[kConcurrentHandshakes];
+        TestCASESecurePairingDelegate delegatesResponder[kConcurrentHandshakes];
+        Platform::UniquePtr<CASESession> pairingsInitiator[kConcurrentHandshakes];
+        Platform::UniquePtr<CASESession> pairingsResponder[kConcurrentHandshakes];
+        CASESession * responderSessions[kConcurrentHandshakes];
+
+        for (size_t i = 0; i < kConcurrentHandshakes; i++)
+        {
+            pairingsInitiator[i] = Platform::MakeUnique<CASESession>();
+            pairingsResponder[i] = Platform::MakeUnique<CASESession>();
+            ASSERT_TRUE(pairingsInitiator[i] && pairingsResponder[i]);
+
+            pairingsResponder[i]->SetGroupDataProvider(&gDeviceGroupDataProvider);
+            EXPECT_SUCCESS(pairingsResponder[i]->PrepareForSessionEstablishment(
+                sessionManager, &gDeviceFabrics, nullptr, nullptr, &delegatesResponder[i], ScopedNodeId(),
+                Optional<ReliableMessageProtocolConfig>::Missing()));
+            responderSessions[i] = pairingsResponder[i].get();
+        }
+        responder.SetSessions(responderSessions, kConcurrentHandshakes);
+
+        for (size_t i = 0; i < kConcurrentHandshakes; i++)
+        {
+            pairingsInitiator[i]->SetGroupDataProvider(&gCommissionerGroupDataProvider);
+            ExchangeContext * contextInitiator = NewUnauthenticatedExchangeToBob(pairingsInitiator[i].get());
+            EXPECT_SUCCESS(pairingsInitiator[i]->EstablishSession(
+                sessionManager, &gCommissionerFabrics, ScopedNodeId{ Node01_01, gCommissionerFabricIndex }, contextInitiator,
+                nullptr, nullptr, &delegatesInitiator[i], Optional<ReliableMessageProtocolConfig>::Missing()));
+            numStarted++;
+        }
+
+        // Background work may complete on other threads, keep servicing events until all handshakes are done.
+        auto isDone = [&]() {
+            for (size_t i = 0; i < kConcurrentHandshakes; i++)
+            {
+                if (delegatesInitiator[i].mNumPairingComplete + delegatesInitiator[i].mNumPairingErrors == 0 ||
+                    delegatesResponder[i].mNumPairingComplete + delegatesResponder[i].mNumPairingErrors == 0)
+                {
+                    return false;
+                }
+            }
+            return true;
+        };
+        for (size_t round = 0; round < 1000 && !isDone(); round++)
+        {
+            ServiceEvents();
+        }
+
+        for (size_t i = 0; i < kConcurrentHandshakes; i++)
+        {
+            EXPECT_EQ(delegatesInitiator[i].mNumPairingErrors, 0u);
+            EXPECT_EQ(delegatesResponder[i].mNumPairingErrors, 0u);
+            EXPECT_EQ(delegatesResponder[i].mNumPairingComplete, 1u);
+            numEstablished += delegatesInitiator[i].mNumPairingComplete;
+        }
+    }
+
+    const System::Clock::Milliseconds64 elapsed = System::SystemClock().GetMonotonicTimestamp() - start;
+    EXPECT_EQ(numEstablished, numStarted);
+    ChipLogProgress(SecureChannel, "Established %u CASE sessions, %u at a time, in %u ms (%u handshakes/s)",
+                    static_cast<unsigned>(numEstablished), static_cast<unsigned>(kConcurrentHandshakes),
+                    static_cast<unsigned>(elapsed.count()),
+                    static_cast<unsigned>(elapsed.count() > 0 ? numEstablished * 1000 / elapsed.count() : 0));
+
+    EXPECT_EQ(GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::CASE_Sigma1),
+              CHIP_NO_ERROR);
+}
+
 #if CHIP_WITH_NLFAULTINJECTION
 
 /* This tests that Corrupting Signature during a CASE Handshake will lead to CASE Failing and to the Correct Error returned.
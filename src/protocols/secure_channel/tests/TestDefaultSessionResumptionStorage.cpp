@@ -19,6 +19,7 @@
 
 #include <lib/core/StringBuilderAdapters.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
 #include <lib/support/TestPersistentStorageDelegate.h>
 #include <lib/support/tests/ExtraPwTestMacros.h>
 
@@ -26,6 +27,38 @@
 // Use SimpleSessionResumptionStorage, which extends it, to test.
 #include <protocols/secure_channel/SimpleSessionResumptionStorage.h>
 
+#include <string.h>
+
+namespace {
+
+// Counts accesses to the session resumption index key.
+class IndexAccessCountingStorage : public chip::TestPersistentStorageDelegate
+{
+public:
+    CHIP_ERROR SyncGetKeyValue(const char * key, void * buffer, uint16_t & size) override
+    {
+        mIndexReads += IsIndexKey(key) ? 1 : 0;
+        return TestPersistentStorageDelegate::SyncGetKeyValue(key, buffer, size);
+    }
+
+    CHIP_ERROR SyncSetKeyValue(const char * key, const void * value, uint16_t size) override
+    {
+        mIndexWrites += IsIndexKey(key) ? 1 : 0;
+        return TestPersistentStorageDelegate::SyncSetKeyValue(key, value, size);
+    }
+
+    size_t mIndexReads  = 0;
+    size_t mIndexWrites = 0;
+
+private:
+    static bool IsIndexKey(const char * key)
+    {
+        return strcmp(key, chip::DefaultStorageKeyAllocator::SessionResumptionIndex().KeyName()) == 0;
+    }
+};
+
+} // namespace
+
 TEST(TestDefaultSessionResumptionStorage, TestSave)
 {
     chip::SimpleSessionResumptionStorage sessionStorage;
@@ -393,3 +426,72 @@ TEST(TestDefaultSessionResumptionStorage, TestDeleteAll)
         }
     }
 }
+
+TEST(TestDefaultSessionResumptionStorage, TestResumeSaveCycles)
+{
+    chip::SimpleSessionResumptionStorage sessionStorage;
+    IndexAccessCountingStorage storage;
+    EXPECT_SUCCESS(sessionStorage.Init(&storage));
+    chip::Crypto::P256ECDHDerivedSecret sharedSecret;
+    EXPECT_SUCCESS(sharedSecret.SetLength(sharedSecret.Capacity()));
+    EXPECT_EQ(chip::Crypto::DRBG_get_bytes(sharedSecret.Bytes(), sharedSecret.Length()), CHIP_NO_ERROR);
+
+    constexpr uint32_t kNodeCount = CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE;
+    constexpr uint32_t kCycles    = 5000;
+
+    auto makeResumptionId = [](uint32_t cycle) {
+        chip::SessionResumptionStorage::ResumptionIdStorage resumptionId = {};
+        memcpy(resumptionId.data(), &cycle, sizeof(cycle));
+        return resumptionId;
+    };
+    auto makeNode = [](uint32_t i) {
+        return chip::ScopedNodeId(static_cast<chip::NodeId>(i + 1), static_cast<chip::FabricIndex>(i % 5 + 1));
+    };
+
+    // Fill storage, using the first kNodeCount resumption IDs.
+    for (uint32_t cycle = 0; cycle < kNodeCount; ++cycle)
+    {
+        const auto resumptionId = makeResumptionId(cycle);
+        EXPECT_EQ(sessionStorage.Save(makeNode(cycle), resumptionId, sharedSecret, chip::CATValues{}), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(storage.mIndexReads, 1u);
+
+    // Repeatedly resume each node and save a new resumption ID for it, as a responder would.
+    storage.mIndexReads  = 0;
+    storage.mIndexWrites = 0;
+    for (uint32_t cycle = kNodeCount; cycle < kCycles; ++cycle)
+    {
+        const chip::ScopedNodeId node = makeNode(cycle % kNodeCount);
+        const auto previousId         = makeResumptionId(cycle - kNodeCount);
+        const auto nextId             = makeResumptionId(cycle);
+
+        chip::ScopedNodeId outNode;
+        chip::Crypto::P256ECDHDerivedSecret outSharedSecret;
+        chip::CATValues outCats;
+        EXPECT_EQ(sessionStorage.FindByResumptionId(previousId, outNode, outSharedSecret, outCats), CHIP_NO_ERROR);
+        EXPECT_EQ(outNode, node);
+
+        EXPECT_EQ(sessionStorage.Save(node, nextId, sharedSecret, chip::CATValues{}), CHIP_NO_ERROR);
+        EXPECT_NE(sessionStorage.FindByResumptionId(previousId, outNode, outSharedSecret, outCats), CHIP_NO_ERROR);
+    }
+
+    // In-place updates neither read nor rewrite the index.
+    EXPECT_EQ(storage.mIndexReads, 0u);
+    EXPECT_EQ(storage.mIndexWrites, 0u);
+
+    // Only the index and one state and link entry per node are left in storage.
+    EXPECT_EQ(storage.GetNumKeys(), 1u + 2u * kNodeCount);
+
+    // A fresh instance loads the same index from storage.
+    chip::SimpleSessionResumptionStorage reloadedStorage;
+    EXPECT_SUCCESS(reloadedStorage.Init(&storage));
+    for (uint32_t cycle = kCycles - kNodeCount; cycle < kCycles; ++cycle)
+    {
+        const auto resumptionId = makeResumptionId(cycle);
+        chip::ScopedNodeId outNode;
+        chip::Crypto::P256ECDHDerivedSecret outSharedSecret;
+        chip::CATValues outCats;
+        EXPECT_EQ(reloadedStorage.FindByResumptionId(resumptionId, outNode, outSharedSecret, outCats), CHIP_NO_ERROR);
+        EXPECT_EQ(outNode, makeNode(cycle % kNodeCount));
+    }
+}
@@ -531,6 +531,34 @@ struct LwIPEvent;
 #define CHIP_SYSTEM_CONFIG_NUM_TIMERS 32
 #endif /* CHIP_SYSTEM_CONFIG_NUM_TIMERS */
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_TIMER_LIST_USE_HEAP
+ *
+ *  @brief
+ *      Store the timers of a System::TimerList in an intrusive pairing heap instead of a sorted linked list.
+ *
+ *      Adding a timer to a sorted list is linear in the number of pending timers, which becomes noticeable on devices
+ *      (e.g. controllers) that keep hundreds of timers running. With the heap, adding a timer is constant time and
+ *      removing one is logarithmic (amortized), at the cost of four extra pointers and a sequence number per timer, and
+ *      of CHIP_SYSTEM_CONFIG_TIMER_LIST_HASH_BUCKETS pointers per list.
+ *      Timers expiring at the same time still fire in the order they were added.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_TIMER_LIST_USE_HEAP
+#define CHIP_SYSTEM_CONFIG_TIMER_LIST_USE_HEAP 0
+#endif /* CHIP_SYSTEM_CONFIG_TIMER_LIST_USE_HEAP */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_TIMER_LIST_HASH_BUCKETS
+ *
+ *  @brief
+ *      When CHIP_SYSTEM_CONFIG_TIMER_LIST_USE_HEAP is enabled, the number of hash buckets each System::TimerList
+ *      uses to find timers by callback and application state (e.g. when a timer is cancelled or restarted).
+ *      Must be a power of two.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_TIMER_LIST_HASH_BUCKETS
+#define CHIP_SYSTEM_CONFIG_TIMER_LIST_HASH_BUCKETS 128
+#endif /* CHIP_SYSTEM_CONFIG_TIMER_LIST_HASH_BUCKETS */
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_THREAD_LOCAL_STORAGE
  *
@@ -0,0 +1,289 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements Layer using epoll().
+ */
+
+#include <lib/support/CodeUtils.h>
+#include <platform/LockTracker.h>
+#include <system/SystemLayerImplEpoll.h>
+
+#include <algorithm>
+#include <errno.h>
+#include <limits>
+#include <unistd.h>
+
+// Choose an approximation of PTHREAD_NULL if pthread.h doesn't define one.
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING && !defined(PTHREAD_NULL)
+#define PTHREAD_NULL 0
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING && !defined(PTHREAD_NULL)
+
+namespace chip {
+namespace System {
+
+namespace {
+
+// Each registered descriptor carries its socket watch index and its fd, so that events for a watch that was released
+// (and possibly reused for another fd) by an earlier callback of the same pass can be told apart.
+constexpr uint32_t kWakeEventIndex = std::numeric_limits<uint32_t>::max();
+
+uint64_t EventData(uint32_t index, int fd)
+{
+    return (static_cast<uint64_t>(index) << 32) | static_cast<uint32_t>(fd);
+}
+
+uint32_t EventIndex(const epoll_event & event)
+{
+    return static_cast<uint32_t>(event.data.u64 >> 32);
+}
+
+int EventFd(const epoll_event & event)
+{
+    return static_cast<int>(static_cast<uint32_t>(event.data.u64));
+}
+
+int TimevalToEpollTimeout(const timeval & tv)
+{
+    // Round up, so that the loop does not wake up (and spin) just before a timer expires.
+    int64_t milliseconds = static_cast<int64_t>(tv.tv_sec) * 1000 + (static_cast<int64_t>(tv.tv_usec) + 999) / 1000;
+    return static_cast<int>(std::min<int64_t>(milliseconds, std::numeric_limits<int>::max()));
+}
+
+} // namespace
+
+CriticalFailure LayerImplEpoll::Init()
+{
+    ReturnErrorOnFailure(LayerImplSelect::Init());
+
+    mEpollFd       = epoll_create1(EPOLL_CLOEXEC);
+    CHIP_ERROR err = (mEpollFd < 0) ? CHIP_ERROR_POSIX(errno) : CHIP_NO_ERROR;
+
+    if (err == CHIP_NO_ERROR)
+    {
+        epoll_event event = {};
+        event.events      = EPOLLIN;
+        event.data.u64    = EventData(kWakeEventIndex, mWakeEvent.GetReadFD());
+        if (epoll_ctl(mEpollFd, EPOLL_CTL_ADD, mWakeEvent.GetReadFD(), &event) != 0)
+        {
+            err = CHIP_ERROR_POSIX(errno);
+        }
+    }
+
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(chipSystemLayer, "Failed to set up epoll: %" CHIP_ERROR_FORMAT, err.Format());
+        Shutdown();
+    }
+    return err;
+}
+
+void LayerImplEpoll::Shutdown()
+{
+    if (mEpollFd != kInvalidFd)
+    {
+        close(mEpollFd);
+        mEpollFd = kInvalidFd;
+    }
+    mEventCount = 0;
+
+    LayerImplSelect::Shutdown();
+}
+
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS
+CHIP_ERROR LayerImplEpoll::UpdateInterest(const SocketWatch & watch)
+{
+    epoll_event event = {};
+    event.events      = (watch.mPendingIO.Has(SocketEventFlags::kRead) ? EPOLLIN : 0u) |
+        (watch.mPendingIO.Has(SocketEventFlags::kWrite) ? EPOLLOUT : 0u);
+    event.data.u64 = EventData(static_cast<uint32_t>(&watch - mSocketWatchPool), watch.mFD);
+
+    if (event.events == 0)
+    {
+        // Nothing to wait for anymore; the fd may never have been registered.
+        VerifyOrReturnError(epoll_ctl(mEpollFd, EPOLL_CTL_DEL, watch.mFD, nullptr) == 0 || errno == ENOENT,
+                            CHIP_ERROR_POSIX(errno));
+        return CHIP_NO_ERROR;
+    }
+
+    if (epoll_ctl(mEpollFd, EPOLL_CTL_MOD, watch.mFD, &event) == 0)
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    // First request on this socket: register it.
+    VerifyOrReturnError(errno == ENOENT, CHIP_ERROR_POSIX(errno));
+    VerifyOrReturnError(epoll_ctl(mEpollFd, EPOLL_CTL_ADD, watch.mFD, &event) == 0, CHIP_ERROR_POSIX(errno));
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::RequestCallbackOnPendingRead(SocketWatchToken token)
+{
+    ReturnErrorOnFailure(LayerImplSelect::RequestCallbackOnPendingRead(token));
+    return UpdateInterest(*reinterpret_cast<SocketWatch *>(token));
+}
+
+CHIP_ERROR LayerImplEpoll::RequestCallbackOnPendingWrite(SocketWatchToken token)
+{
+    ReturnErrorOnFailure(LayerImplSelect::RequestCallbackOnPendingWrite(token));
+    return UpdateInterest(*reinterpret_cast<SocketWatch *>(token));
+}
+
+CHIP_ERROR LayerImplEpoll::ClearCallbackOnPendingRead(SocketWatchToken token)
+{
+    ReturnErrorOnFailure(LayerImplSelect::ClearCallbackOnPendingRead(token));
+    return UpdateInterest(*reinterpret_cast<SocketWatch *>(token));
+}
+
+CHIP_ERROR LayerImplEpoll::ClearCallbackOnPendingWrite(SocketWatchToken token)
+{
+    ReturnErrorOnFailure(LayerImplSelect::ClearCallbackOnPendingWrite(token));
+    return UpdateInterest(*reinterpret_cast<SocketWatch *>(token));
+}
+
+CHIP_ERROR LayerImplEpoll::StopWatchingSocket(SocketWatchToken * tokenInOut)
+{
+    VerifyOrReturnError(tokenInOut != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(*tokenInOut);
+    if (watch != nullptr && watch->mFD >= 0)
+    {
+        // The socket is usually closed right after this, which would also unregister it, unless the fd was duplicated.
+        (void) epoll_ctl(mEpollFd, EPOLL_CTL_DEL, watch->mFD, nullptr);
+    }
+
+    return LayerImplSelect::StopWatchingSocket(tokenInOut);
+}
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
+
+void LayerImplEpoll::PrepareEvents()
+{
+    assertChipStackLockedByCurrentThread();
+
+    Clock::ToTimeval(PrepareTimersAndLoopHandlers(), mNextTimeout);
+
+    // Only EventSources use the fd sets; they are usually empty.
+    mMaxFd = -1;
+
+    // NOLINTBEGIN(clang-analyzer-security.insecureAPI.bzero)
+    FD_ZERO(&mSelected.mReadSet);
+    FD_ZERO(&mSelected.mWriteSet);
+    FD_ZERO(&mSelected.mErrorSet);
+    // NOLINTEND(clang-analyzer-security.insecureAPI.bzero)
+
+    for (auto & source : mSources)
+    {
+        source.PrepareEvents(mMaxFd, mSelected.mReadSet, mSelected.mWriteSet, mSelected.mErrorSet, mNextTimeout);
+    }
+}
+
+void LayerImplEpoll::WaitForEvents()
+{
+    mEventCount = 0;
+
+    if (mMaxFd < 0)
+    {
+        mSelectResult = epoll_wait(mEpollFd, mEvents, static_cast<int>(kMaxEvents), TimevalToEpollTimeout(mNextTimeout));
+        mEventCount   = std::max(mSelectResult, 0);
+        return;
+    }
+
+    // Some EventSources want descriptors select()ed: wait on them and on the epoll descriptor, which becomes readable
+    // when any of the watched sockets is ready.
+    FD_SET(mEpollFd, &mSelected.mReadSet);
+    mSelectResult = select(std::max(mMaxFd, mEpollFd) + 1, &mSelected.mReadSet, &mSelected.mWriteSet, &mSelected.mErrorSet,
+                           &mNextTimeout);
+    if (mSelectResult > 0 && FD_ISSET(mEpollFd, &mSelected.mReadSet))
+    {
+        mEventCount = std::max(epoll_wait(mEpollFd, mEvents, static_cast<int>(kMaxEvents), 0), 0);
+    }
+}
+
+void LayerImplEpoll::HandleEvents()
+{
+    assertChipStackLockedByCurrentThread();
+
+    if (!IsSelectResultValid())
+    {
+        VerifyOrReturn(errno != EINTR); // EINTR is not really an error (and we don't use it for signal handling)
+        ChipLogError(DeviceLayer, "Epoll wait failed: %" CHIP_ERROR_FORMAT, CHIP_ERROR_POSIX(errno).Format());
+        return;
+    }
+
+    for (int i = 0; i < mEventCount; i++)
+    {
+        if (EventIndex(mEvents[i]) == kWakeEventIndex)
+        {
+            mWakeEvent.Confirm();
+        }
+    }
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleSelectThread = pthread_self();
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    HandleExpiredTimers();
+
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS
+    for (int i = 0; i < mEventCount; i++)
+    {
+        const epoll_event & event = mEvents[i];
+        const uint32_t index      = EventIndex(event);
+        if (index >= kSocketWatchMax)
+        {
+            continue;
+        }
+
+        // Callbacks may have stopped watching this socket, or any other, since the events were collected.
+        SocketWatch & w = mSocketWatchPool[index];
+        if (w.mFD != EventFd(event) || w.mCallback == nullptr)
+        {
+            continue;
+        }
+
+        // As with select(), errors and hang-ups are reported as readiness for the requested operations.
+        SocketEvents events;
+        if ((event.events & (EPOLLIN | EPOLLERR | EPOLLHUP)) && w.mPendingIO.Has(SocketEventFlags::kRead))
+        {
+            events.Set(SocketEventFlags::kRead);
+        }
+        if ((event.events & (EPOLLOUT | EPOLLERR | EPOLLHUP)) && w.mPendingIO.Has(SocketEventFlags::kWrite))
+        {
+            events.Set(SocketEventFlags::kWrite);
+        }
+        if (events.HasAny())
+        {
+            w.mCallback(events, w.mCallbackData);
+        }
+    }
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
+
+    for (auto & source : mSources)
+    {
+        source.ProcessEvents(mSelected.mReadSet, mSelected.mWriteSet, mSelected.mErrorSet);
+    }
+
+    HandleLoopHandlers();
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleSelectThread = PTHREAD_NULL;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+}
+
+} // namespace System
+} // namespace chip
@@ -0,0 +1,85 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file declares an implementation of System::Layer using epoll().
+ */
+
+#pragma once
+
+#include <system/SystemConfig.h>
+
+#include <sys/epoll.h>
+
+#include <system/SystemLayerImplSelect.h>
+
+namespace chip {
+namespace System {
+
+/**
+ * A System::Layer for Linux that waits for socket events with epoll() instead of select().
+ *
+ * Watched sockets are registered with the kernel once, when callbacks are requested or cleared, so a wakeup costs
+ * O(ready sockets) rather than O(highest fd) and descriptors are not limited by FD_SETSIZE. Sockets are watched in
+ * level-triggered mode, matching the select() semantics that socket callbacks expect.
+ *
+ * Timers, EventLoopHandlers and the wake event are handled as in LayerImplSelect. EventSources keep their fd_set based
+ * interface: when some of them contribute descriptors, the loop select()s on those descriptors and the epoll
+ * descriptor, which stays small regardless of the number of watched sockets.
+ */
+class LayerImplEpoll : public LayerImplSelect
+{
+public:
+    LayerImplEpoll() = default;
+
+    // Layer overrides.
+    CriticalFailure Init() override;
+    void Shutdown() override;
+
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS
+    // LayerSocket overrides.
+    CHIP_ERROR RequestCallbackOnPendingRead(SocketWatchToken token) override;
+    CHIP_ERROR RequestCallbackOnPendingWrite(SocketWatchToken token) override;
+    CHIP_ERROR ClearCallbackOnPendingRead(SocketWatchToken token) override;
+    CHIP_ERROR ClearCallbackOnPendingWrite(SocketWatchToken token) override;
+    CHIP_ERROR StopWatchingSocket(SocketWatchToken * tokenInOut) override;
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
+
+    // LayerSelectLoop overrides.
+    void PrepareEvents() override;
+    void WaitForEvents() override;
+    void HandleEvents() override;
+
+private:
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS
+    static constexpr size_t kMaxEvents = kSocketWatchMax + 1;
+
+    CHIP_ERROR UpdateInterest(const SocketWatch & watch);
+#else
+    static constexpr size_t kMaxEvents = 1;
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
+
+    int mEpollFd = kInvalidFd;
+    epoll_event mEvents[kMaxEvents];
+    int mEventCount = 0;
+};
+
+using LayerImpl = LayerImplEpoll;
+
+} // namespace System
+} // namespace chip
@@ -203,13 +203,7 @@ bool LayerImplSelect::IsTimerActive(TimerCompleteCallback onComplete, void * app
     if (!timerIsActive)
     {
         // check if the timer is in the mExpiredTimers list about to be fired.
-        for (TimerList::Node * timer = mExpiredTimers.Earliest(); timer != nullptr; timer = timer->mNextTimer)
-        {
-            if (timer->GetCallback().GetOnComplete() == onComplete && timer->GetCallback().GetAppState() == appState)
-            {
-                return true;
-            }
-        }
+        timerIsActive = (mExpiredTimers.Find(onComplete, appState) != nullptr);
     }
 
     return timerIsActive;
@@ -550,33 +544,7 @@ void LayerImplSelect::PrepareEvents()
 {
     assertChipStackLockedByCurrentThread();
 
-    const Clock::Timestamp currentTime = SystemClock().GetMonotonicTimestamp();
-    Clock::Timestamp awakenTime        = currentTime + kDefaultMinSleepPeriod;
-
-    TimerList::Node * timer = mTimerList.Earliest();
-    if (timer)
-    {
-        awakenTime = std::min(awakenTime, timer->AwakenTime());
-    }
-
-    // Activate added EventLoopHandlers and call PrepareEvents on active handlers.
-    auto loopIter = mLoopHandlers.begin();
-    while (loopIter != mLoopHandlers.end())
-    {
-        auto & loop = *loopIter++; // advance before calling out, in case a list modification clobbers the `next` pointer
-        switch (auto & state = LoopHandlerState(loop))
-        {
-        case kLoopHandlerPending:
-            state = kLoopHandlerActive;
-            [[fallthrough]];
-        case kLoopHandlerActive:
-            awakenTime = std::min(awakenTime, loop.PrepareEvents(currentTime));
-            break;
-        }
-    }
-
-    const Clock::Timestamp sleepTime = (awakenTime > currentTime) ? (awakenTime - currentTime) : Clock::kZero;
-    Clock::ToTimeval(sleepTime, mNextTimeout);
+    Clock::ToTimeval(PrepareTimersAndLoopHandlers(), mNextTimeout);
 
     mMaxFd = -1;
 
@@ -620,6 +588,36 @@ void LayerImplSelect::PrepareEvents()
 #endif
 }
 
+Clock::Timeout LayerImplSelect::PrepareTimersAndLoopHandlers()
+{
+    const Clock::Timestamp currentTime = SystemClock().GetMonotonicTimestamp();
+    Clock::Timestamp awakenTime        = currentTime + kDefaultMinSleepPeriod;
+
+    TimerList::Node * timer = mTimerList.Earliest();
+    if (timer)
+    {
+        awakenTime = std::min(awakenTime, timer->AwakenTime());
+    }
+
+    // Activate added EventLoopHandlers and call PrepareEvents on active handlers.
+    auto loopIter = mLoopHandlers.begin();
+    while (loopIter != mLoopHandlers.end())
+    {
+        auto & loop = *loopIter++; // advance before calling out, in case a list modification clobbers the `next` pointer
+        switch (auto & state = LoopHandlerState(loop))
+        {
+        case kLoopHandlerPending:
+            state = kLoopHandlerActive;
+            [[fallthrough]];
+        case kLoopHandlerActive:
+            awakenTime = std::min(awakenTime, loop.PrepareEvents(currentTime));
+            break;
+        }
+    }
+
+    return (awakenTime > currentTime) ? (awakenTime - currentTime) : Clock::kZero;
+}
+
 void LayerImplSelect::WaitForEvents()
 {
     mSelectResult = select(mMaxFd + 1, &mSelected.mReadSet, &mSelected.mWriteSet, &mSelected.mErrorSet, &mNextTimeout);
@@ -647,15 +645,7 @@ void LayerImplSelect::HandleEvents()
     mHandleSelectThread = pthread_self();
 #endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
 
-    // Obtain the list of currently expired timers. Any new timers added by timer callback are NOT handled on this pass,
-    // since that could result in infinite handling of new timers blocking any other progress.
-    VerifyOrDieWithMsg(mExpiredTimers.Empty(), DeviceLayer, "Re-entry into HandleEvents from a timer callback?");
-    mExpiredTimers          = mTimerList.ExtractEarlier(Clock::Timeout(1) + SystemClock().GetMonotonicTimestamp());
-    TimerList::Node * timer = nullptr;
-    while ((timer = mExpiredTimers.PopEarliest()) != nullptr)
-    {
-        mTimerPool.Invoke(timer);
-    }
+    HandleExpiredTimers();
 
 #if CHIP_SYSTEM_CONFIG_USE_SOCKETS
     // Process socket events, if any
@@ -683,6 +673,28 @@ void LayerImplSelect::HandleEvents()
         }
     }
 
+    HandleLoopHandlers();
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleSelectThread = PTHREAD_NULL;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+}
+
+void LayerImplSelect::HandleExpiredTimers()
+{
+    // Obtain the list of currently expired timers. Any new timers added by timer callback are NOT handled on this pass,
+    // since that could result in infinite handling of new timers blocking any other progress.
+    VerifyOrDieWithMsg(mExpiredTimers.Empty(), DeviceLayer, "Re-entry into HandleEvents from a timer callback?");
+    mTimerList.ExtractEarlier(Clock::Timeout(1) + SystemClock().GetMonotonicTimestamp(), mExpiredTimers);
+    TimerList::Node * timer = nullptr;
+    while ((timer = mExpiredTimers.PopEarliest()) != nullptr)
+    {
+        mTimerPool.Invoke(timer);
+    }
+}
+
+void LayerImplSelect::HandleLoopHandlers()
+{
     // Call HandleEvents for active loop handlers
     auto loopIter = mLoopHandlers.begin();
     while (loopIter != mLoopHandlers.end())
@@ -693,10 +705,6 @@ void LayerImplSelect::HandleEvents()
             loop.HandleEvents();
         }
     }
-
-#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
-    mHandleSelectThread = PTHREAD_NULL;
-#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
 }
 
 #if CHIP_SYSTEM_CONFIG_USE_LIBEV
@@ -206,6 +206,22 @@ public:
     void EventSourceClear();
 
 protected:
+    /**
+     * Activates pending EventLoopHandlers and returns how long the event loop may sleep before the next timer or
+     * EventLoopHandler needs to be serviced.
+     */
+    Clock::Timeout PrepareTimersAndLoopHandlers();
+
+    /**
+     * Invokes the timers that have expired. Timers started by these callbacks are handled on the next pass.
+     */
+    void HandleExpiredTimers();
+
+    /**
+     * Calls HandleEvents() on the active EventLoopHandlers.
+     */
+    void HandleLoopHandlers();
+
     IntrusiveList<EventSource> mSources;
 #if CHIP_SYSTEM_CONFIG_USE_SOCKETS
     static SocketEvents SocketEventsFromFDs(int socket, const fd_set & readfds, const fd_set & writefds, const fd_set & exceptfds);
@@ -265,7 +281,9 @@ protected:
 #endif
 };
 
+#if !CHIP_SYSTEM_CONFIG_USE_EPOLL
 using LayerImpl = LayerImplSelect;
+#endif // !CHIP_SYSTEM_CONFIG_USE_EPOLL
 
 } // namespace System
 } // namespace chip
@@ -88,13 +88,7 @@ bool LayerImplZephyr::IsTimerActive(TimerCompleteCallback onComplete, void * app
     if (!timerIsActive)
     {
         // check if the timer is in the mExpiredTimers list about to be fired.
-        for (TimerList::Node * timer = mExpiredTimers.Earliest(); timer != nullptr; timer = timer->mNextTimer)
-        {
-            if (timer->GetCallback().GetOnComplete() == onComplete && timer->GetCallback().GetAppState() == appState)
-            {
-                return true;
-            }
-        }
+        timerIsActive = (mExpiredTimers.Find(onComplete, appState) != nullptr);
     }
 
     return timerIsActive;
@@ -214,8 +208,8 @@ CHIP_ERROR LayerImplZephyr::HandlePlatformTimer()
     // Obtain the list of currently expired timers. Any new timers added by timer callback are NOT handled on this pass,
     // since that could result in infinite handling of new timers blocking any other progress.
     VerifyOrDieWithMsg(mExpiredTimers.Empty(), DeviceLayer, "Re-entry into HandleEvents from a timer callback?");
-    Clock::Timestamp now    = SystemClock().GetMonotonicTimestamp();
-    mExpiredTimers          = mTimerList.ExtractEarlier(Clock::Timeout(1) + now);
+    Clock::Timestamp now = SystemClock().GetMonotonicTimestamp();
+    mTimerList.ExtractEarlier(Clock::Timeout(1) + now, mExpiredTimers);
     TimerList::Node * timer = nullptr;
     while ((timer = mExpiredTimers.PopEarliest()) != nullptr)
     {
@@ -35,9 +35,222 @@
 
 #include <lib/support/CodeUtils.h>
 
+#include <utility>
+
 namespace chip {
 namespace System {
 
+#if CHIP_SYSTEM_CONFIG_TIMER_LIST_USE_HEAP
+
+bool TimerList::IsOrderedBefore(const Node * a, const Node * b)
+{
+    if (a->AwakenTime() != b->AwakenTime())
+    {
+        return a->AwakenTime() < b->AwakenTime();
+    }
+    return a->mSequence < b->mSequence;
+}
+
+TimerList::Node * TimerList::Meld(Node * a, Node * b)
+{
+    // Both arguments are roots without siblings; the later one becomes the first child of the earlier one.
+    if (IsOrderedBefore(b, a))
+    {
+        std::swap(a, b);
+    }
+    b->mNextTimer = a->mFirstChild;
+    if (b->mNextTimer != nullptr)
+    {
+        b->mNextTimer->mPrevious = b;
+    }
+    b->mPrevious   = a;
+    a->mFirstChild = b;
+    return a;
+}
+
+TimerList::Node * TimerList::MergePairs(Node * first)
+{
+    // First pass: meld siblings pairwise, left to right, stacking the results in reverse order.
+    Node * paired = nullptr;
+    while (first != nullptr)
+    {
+        Node * a = first;
+        Node * b = a->mNextTimer;
+        first    = (b != nullptr) ? b->mNextTimer : nullptr;
+
+        a->mNextTimer = a->mPrevious = nullptr;
+        if (b != nullptr)
+        {
+            b->mNextTimer = b->mPrevious = nullptr;
+            a             = Meld(a, b);
+        }
+        a->mNextTimer = paired;
+        paired        = a;
+    }
+
+    // Second pass: meld the pairs right to left into a single tree.
+    Node * root = nullptr;
+    while (paired != nullptr)
+    {
+        Node * next        = paired->mNextTimer;
+        paired->mNextTimer = nullptr;
+        root               = (root != nullptr) ? Meld(root, paired) : paired;
+        paired             = next;
+    }
+    return root;
+}
+
+size_t TimerList::BucketIndex(TimerCompleteCallback aOnComplete, void * aAppState)
+{
+    static_assert((CHIP_SYSTEM_CONFIG_TIMER_LIST_HASH_BUCKETS & (CHIP_SYSTEM_CONFIG_TIMER_LIST_HASH_BUCKETS - 1)) == 0,
+                  "CHIP_SYSTEM_CONFIG_TIMER_LIST_HASH_BUCKETS must be a power of two");
+
+    uintptr_t hash = reinterpret_cast<uintptr_t>(aAppState) ^ (reinterpret_cast<uintptr_t>(aOnComplete) * 31);
+    hash ^= hash >> 16;
+    hash ^= hash >> 5;
+    return static_cast<size_t>(hash & (CHIP_SYSTEM_CONFIG_TIMER_LIST_HASH_BUCKETS - 1));
+}
+
+bool TimerList::Contains(const Node * node) const
+{
+    // Nodes carry no reference to their list, but a node in this list is in the bucket of its callback.
+    for (const Node * timer = mBuckets[BucketIndex(node->GetCallback().GetOnComplete(), node->GetCallback().GetAppState())];
+         timer != nullptr; timer = timer->mNextInBucket)
+    {
+        if (timer == node)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+TimerList::Node * TimerList::Add(TimerList::Node * add)
+{
+    VerifyOrDie(add != mEarliestTimer);
+    add->mFirstChild = nullptr;
+    add->mNextTimer  = nullptr;
+    add->mPrevious   = nullptr;
+    add->mSequence   = mNextSequence++;
+    mEarliestTimer   = (mEarliestTimer == nullptr) ? add : Meld(mEarliestTimer, add);
+
+    Node *& bucket         = mBuckets[BucketIndex(add->GetCallback().GetOnComplete(), add->GetCallback().GetAppState())];
+    add->mNextInBucket     = bucket;
+    add->mPreviousInBucket = nullptr;
+    if (bucket != nullptr)
+    {
+        bucket->mPreviousInBucket = add;
+    }
+    bucket = add;
+
+    return mEarliestTimer;
+}
+
+TimerList::Node * TimerList::Remove(TimerList::Node * remove)
+{
+    // The timer may be in another list, e.g. the expired timers of a system layer: its links must not be followed then.
+    if (mEarliestTimer == nullptr || remove == nullptr || !Contains(remove))
+    {
+        return mEarliestTimer;
+    }
+
+    if (remove == mEarliestTimer)
+    {
+        mEarliestTimer = MergePairs(remove->mFirstChild);
+    }
+    else
+    {
+        // Detach the subtree rooted at `remove`, then meld its children back into the heap.
+        if (remove->mPrevious->mFirstChild == remove)
+        {
+            remove->mPrevious->mFirstChild = remove->mNextTimer;
+        }
+        else
+        {
+            remove->mPrevious->mNextTimer = remove->mNextTimer;
+        }
+        if (remove->mNextTimer != nullptr)
+        {
+            remove->mNextTimer->mPrevious = remove->mPrevious;
+        }
+
+        Node * children = MergePairs(remove->mFirstChild);
+        if (children != nullptr)
+        {
+            mEarliestTimer = Meld(mEarliestTimer, children);
+        }
+    }
+
+    if (remove->mPreviousInBucket != nullptr)
+    {
+        remove->mPreviousInBucket->mNextInBucket = remove->mNextInBucket;
+    }
+    else
+    {
+        mBuckets[BucketIndex(remove->GetCallback().GetOnComplete(), remove->GetCallback().GetAppState())] = remove->mNextInBucket;
+    }
+    if (remove->mNextInBucket != nullptr)
+    {
+        remove->mNextInBucket->mPreviousInBucket = remove->mPreviousInBucket;
+    }
+
+    remove->mFirstChild   = remove->mNextTimer = remove->mPrevious = nullptr;
+    remove->mNextInBucket = remove->mPreviousInBucket = nullptr;
+    return mEarliestTimer;
+}
+
+TimerList::Node * TimerList::Remove(TimerCompleteCallback aOnComplete, void * aAppState)
+{
+    TimerList::Node * timer = Find(aOnComplete, aAppState);
+    Remove(timer);
+    return timer;
+}
+
+TimerList::Node * TimerList::PopEarliest()
+{
+    TimerList::Node * earliest = mEarliestTimer;
+    Remove(earliest);
+    return earliest;
+}
+
+TimerList::Node * TimerList::PopIfEarlier(Clock::Timestamp t)
+{
+    if ((mEarliestTimer == nullptr) || !(mEarliestTimer->AwakenTime() < t))
+    {
+        return nullptr;
+    }
+    return PopEarliest();
+}
+
+void TimerList::ExtractEarlier(Clock::Timestamp t, TimerList & expired)
+{
+    VerifyOrDie(expired.Empty());
+
+    // Timers are moved in order, so `expired` keeps them in the same relative order.
+    TimerList::Node * timer;
+    while ((timer = PopIfEarlier(t)) != nullptr)
+    {
+        expired.Add(timer);
+    }
+}
+
+TimerList::Node * TimerList::Find(TimerCompleteCallback aOnComplete, void * aAppState) const
+{
+    // Keep the earliest match, so that the result is the same as with a sorted list.
+    TimerList::Node * found = nullptr;
+    for (TimerList::Node * timer = mBuckets[BucketIndex(aOnComplete, aAppState)]; timer != nullptr; timer = timer->mNextInBucket)
+    {
+        if (timer->GetCallback().GetOnComplete() == aOnComplete && timer->GetCallback().GetAppState() == aAppState &&
+            (found == nullptr || IsOrderedBefore(timer, found)))
+        {
+            found = timer;
+        }
+    }
+    return found;
+}
+
+#else // CHIP_SYSTEM_CONFIG_TIMER_LIST_USE_HEAP
+
 TimerList::Node * TimerList::Add(TimerList::Node * add)
 {
     VerifyOrDie(add != mEarliestTimer);
@@ -71,7 +284,8 @@ TimerList::Node * TimerList::Remove(TimerList::Node * remove)
     {
         if (remove == mEarliestTimer)
         {
-            mEarliestTimer = remove->mNextTimer;
+            mEarliestTimer     = remove->mNextTimer;
+            remove->mNextTimer = nullptr;
         }
         else
         {
@@ -82,14 +296,14 @@ TimerList::Node * TimerList::Remove(TimerList::Node * remove)
                 if (remove == lTimer->mNextTimer)
                 {
                     lTimer->mNextTimer = remove->mNextTimer;
+                    // Only unlink timers of this list: a timer in another list keeps its place there.
+                    remove->mNextTimer = nullptr;
                     break;
                 }
 
                 lTimer = lTimer->mNextTimer;
             }
         }
-
-        remove->mNextTimer = nullptr;
     }
     return mEarliestTimer;
 }
@@ -141,14 +355,14 @@ TimerList::Node * TimerList::PopIfEarlier(Clock::Timestamp t)
     return earliest;
 }
 
-TimerList TimerList::ExtractEarlier(Clock::Timestamp t)
+void TimerList::ExtractEarlier(Clock::Timestamp t, TimerList & expired)
 {
-    TimerList out;
+    VerifyOrDie(expired.Empty());
 
     if ((mEarliestTimer != nullptr) && (mEarliestTimer->AwakenTime() < t))
     {
-        out.mEarliestTimer    = mEarliestTimer;
-        TimerList::Node * end = mEarliestTimer;
+        expired.mEarliestTimer = mEarliestTimer;
+        TimerList::Node * end  = mEarliestTimer;
         while ((end->mNextTimer != nullptr) && (end->mNextTimer->AwakenTime() < t))
         {
             end = end->mNextTimer;
@@ -156,25 +370,39 @@ TimerList TimerList::ExtractEarlier(Clock::Timestamp t)
         mEarliestTimer  = end->mNextTimer;
         end->mNextTimer = nullptr;
     }
-
-    return out;
 }
 
-Clock::Timeout TimerList::GetRemainingTime(TimerCompleteCallback aOnComplete, void * aAppState)
+TimerList::Node * TimerList::Find(TimerCompleteCallback aOnComplete, void * aAppState) const
 {
     for (TimerList::Node * timer = mEarliestTimer; timer != nullptr; timer = timer->mNextTimer)
     {
         if (timer->GetCallback().GetOnComplete() == aOnComplete && timer->GetCallback().GetAppState() == aAppState)
         {
-            Clock::Timestamp currentTime = SystemClock().GetMonotonicTimestamp();
-
-            if (currentTime < timer->AwakenTime())
-            {
-                return Clock::Timeout(timer->AwakenTime() - currentTime);
-            }
-            return Clock::kZero;
+            return timer;
         }
     }
+    return nullptr;
+}
+
+#endif // CHIP_SYSTEM_CONFIG_TIMER_LIST_USE_HEAP
+
+TimerList TimerList::ExtractEarlier(Clock::Timestamp t)
+{
+    TimerList out;
+    ExtractEarlier(t, out);
+    return out;
+}
+
+Clock::Timeout TimerList::GetRemainingTime(TimerCompleteCallback aOnComplete, void * aAppState)
+{
+    TimerList::Node * timer = Find(aOnComplete, aAppState);
+    VerifyOrReturnValue(timer != nullptr, Clock::kZero);
+
+    Clock::Timestamp currentTime = SystemClock().GetMonotonicTimestamp();
+    if (currentTime < timer->AwakenTime())
+    {
+        return Clock::Timeout(timer->AwakenTime() - currentTime);
+    }
     return Clock::kZero;
 }
 
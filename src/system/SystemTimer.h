@@ -36,6 +36,8 @@
 #include <system/SystemLayer.h>
 #include <system/SystemStats.h>
 
+#include <string.h>
+
 #if CHIP_SYSTEM_CONFIG_USE_DISPATCH
 #include <dispatch/dispatch.h>
 #endif
@@ -105,6 +107,11 @@ private:
 
 /**
  * List of `Timer`s ordered by expiration time.
+ *
+ * Timers with the same expiration time are ordered by the time they were added. When
+ * CHIP_SYSTEM_CONFIG_TIMER_LIST_USE_HEAP is enabled, the timers are kept in an intrusive pairing heap rather than
+ * a sorted linked list, and are also hashed by callback so that they can be found without walking the heap; the
+ * observable ordering is the same.
  */
 class TimerList
 {
@@ -115,6 +122,20 @@ public:
         Node(Layer & systemLayer, System::Clock::Timestamp awakenTime, TimerCompleteCallback onComplete, void * appState) :
             TimerData(systemLayer, awakenTime, onComplete, appState), mNextTimer(nullptr)
         {}
+
+    private:
+        friend class TimerList;
+
+#if CHIP_SYSTEM_CONFIG_TIMER_LIST_USE_HEAP
+        // Heap links: mNextTimer is the next sibling, mPrevious is either the previous sibling or, for a first
+        // child, the parent.
+        Node * mFirstChild = nullptr;
+        Node * mPrevious   = nullptr;
+        // Links in the hash bucket of the timer's callback, used to find timers by callback.
+        Node * mNextInBucket     = nullptr;
+        Node * mPreviousInBucket = nullptr;
+        uint64_t mSequence       = 0;
+#endif // CHIP_SYSTEM_CONFIG_TIMER_LIST_USE_HEAP
         Node * mNextTimer;
     };
 
@@ -129,7 +150,8 @@ public:
     Node * Add(Node * timer);
 
     /**
-     * Remove the given timer from the list, if present. It is not an error for the timer not to be present.
+     * Remove the given timer from the list, if present. It is not an error for the timer not to be present, including when
+     * it is in another list.
      *
      * @return  The new earliest timer in the list, or nullptr if the list is empty.
      */
@@ -173,10 +195,31 @@ public:
      */
     TimerList ExtractEarlier(Clock::Timestamp t);
 
+    /**
+     * Move all timers that expire before the given time @a t to @a expired, which must be empty.
+     *
+     * Unlike the overload returning a new list, this does not copy a list, which is sizeable when
+     * CHIP_SYSTEM_CONFIG_TIMER_LIST_USE_HEAP is enabled.
+     */
+    void ExtractEarlier(Clock::Timestamp t, TimerList & expired);
+
     /**
      * Remove all timers.
      */
-    void Clear() { mEarliestTimer = nullptr; }
+    void Clear()
+    {
+        mEarliestTimer = nullptr;
+#if CHIP_SYSTEM_CONFIG_TIMER_LIST_USE_HEAP
+        memset(mBuckets, 0, sizeof(mBuckets));
+#endif // CHIP_SYSTEM_CONFIG_TIMER_LIST_USE_HEAP
+    }
+
+    /**
+     * Find the earliest timer with the given properties, if present.
+     *
+     * @return  The timer, or nullptr if the list contains no matching timer.
+     */
+    Node * Find(TimerCompleteCallback aOnComplete, void * aAppState) const;
 
     /**
      * Find the timer with the given properties, if present, and return its remaining time
@@ -186,6 +229,18 @@ public:
     Clock::Timeout GetRemainingTime(TimerCompleteCallback aOnComplete, void * aAppState);
 
 private:
+#if CHIP_SYSTEM_CONFIG_TIMER_LIST_USE_HEAP
+    static bool IsOrderedBefore(const Node * a, const Node * b);
+    static Node * Meld(Node * a, Node * b);
+    static Node * MergePairs(Node * first);
+    static size_t BucketIndex(TimerCompleteCallback aOnComplete, void * aAppState);
+    bool Contains(const Node * node) const;
+
+    Node * mBuckets[CHIP_SYSTEM_CONFIG_TIMER_LIST_HASH_BUCKETS] = {};
+    uint64_t mNextSequence                                      = 0;
+#endif // CHIP_SYSTEM_CONFIG_TIMER_LIST_USE_HEAP
+
+    // When the list is a heap, this is its root.
     Node * mEarliestTimer;
 };
 
@@ -27,11 +27,15 @@
 #include <stdint.h>
 #include <string.h>
 
+#include <memory>
+#include <vector>
+
 #include <pw_unit_test/framework.h>
 
 #include <lib/core/ErrorStr.h>
 #include <lib/core/StringBuilderAdapters.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
 #include <lib/support/tests/ExtraPwTestMacros.h>
 #include <system/RAIIMockClock.h>
 #include <system/SystemConfig.h>
@@ -537,6 +541,10 @@ TEST_F(TestSystemTimer, CheckTimerPool)
         list.Add(timer.timer);
     }
     TimerList early = list.ExtractEarlier(200_ms); // list: (1 0 2 3) → (2 3) returns: (1 0)
+    // Removing a timer from a list it is not in, like the system layers do for expired timers, changes neither list.
+    EXPECT_EQ(list.Remove(testTimer[0].timer), testTimer[2].timer);
+    EXPECT_EQ(list.Remove(testTimer[1].timer), testTimer[2].timer);
+    EXPECT_EQ(early.Remove(testTimer[3].timer), testTimer[1].timer);
     EXPECT_EQ(list.PopEarliest(), testTimer[2].timer);
     EXPECT_EQ(list.PopEarliest(), testTimer[3].timer);
     EXPECT_EQ(list.PopEarliest(), nullptr);
@@ -565,6 +573,102 @@ TEST_F(TestSystemTimer, CheckTimerPool)
     EXPECT_TRUE(SYSTEM_STATS_TEST_HIGH_WATER_MARK(Stats::kSystemLayer_NumTimers, 4));
 }
 
+// Exercise TimerList with many pending timers: ordering (including timers sharing an expiration time, which must fire in
+// the order they were added), removal by node and by callback, and extraction. Also logs how long the operations take.
+TEST_F(TestSystemTimer, CheckTimerListStress)
+{
+    using Timer = TimerList::Node;
+    const TimerCompleteCallback kOnComplete = [](Layer *, void *) {};
+
+    constexpr size_t kNumTimers = 10000;
+    std::vector<std::unique_ptr<Timer>> timers;
+    std::vector<size_t> order(kNumTimers);
+    timers.reserve(kNumTimers);
+
+    // Coarse expiration times so that many timers share the same one.
+    uint32_t seed = 12345;
+    for (size_t i = 0; i < kNumTimers; i++)
+    {
+        seed     = seed * 1103515245u + 12345u;
+        order[i] = i;
+        timers.push_back(std::make_unique<Timer>(mLayer, Clock::Timestamp((seed >> 16) % 1000), kOnComplete, &order[i]));
+    }
+
+    TimerList list;
+    Clock::Microseconds64 start = SystemClock().GetMonotonicMicroseconds64();
+    for (auto & timer : timers)
+    {
+        list.Add(timer.get());
+    }
+    Clock::Microseconds64 added = SystemClock().GetMonotonicMicroseconds64();
+
+    // Remove every third timer, alternating between removal by node and by callback.
+    for (size_t i = 0; i < kNumTimers; i += 3)
+    {
+        if (i % 2 == 0)
+        {
+            list.Remove(timers[i].get());
+        }
+        else
+        {
+            EXPECT_EQ(list.Remove(kOnComplete, &order[i]), timers[i].get());
+        }
+    }
+    Clock::Microseconds64 removed = SystemClock().GetMonotonicMicroseconds64();
+
+    TimerList early;
+    list.ExtractEarlier(Clock::Timestamp(500), early);
+
+    // Expired timers are not in `list` anymore: removing them from it must leave both lists intact.
+    for (size_t i = 1; i < kNumTimers; i += 3)
+    {
+        if (timers[i]->AwakenTime() < Clock::Timestamp(500))
+        {
+            list.Remove(timers[i].get());
+        }
+    }
+
+    size_t count       = 0;
+    const Timer * last = nullptr;
+    for (TimerList * current : { &early, &list })
+    {
+        Timer * timer;
+        while ((timer = current->PopEarliest()) != nullptr)
+        {
+            size_t index = *static_cast<size_t *>(timer->GetCallback().GetAppState());
+            EXPECT_NE(index % 3, 0u);
+            EXPECT_EQ(current == &early, timer->AwakenTime() < Clock::Timestamp(500));
+            if (last != nullptr)
+            {
+                EXPECT_TRUE(last->AwakenTime() <= timer->AwakenTime());
+                if (last->AwakenTime() == timer->AwakenTime())
+                {
+                    EXPECT_LT(*static_cast<size_t *>(last->GetCallback().GetAppState()), index);
+                }
+            }
+            last = timer;
+            count++;
+        }
+    }
+    Clock::Microseconds64 popped = SystemClock().GetMonotonicMicroseconds64();
+    EXPECT_EQ(count, kNumTimers - (kNumTimers + 2) / 3);
+
+    ChipLogProgress(Test, "TimerList with %u timers: add %u us, remove %u us, extract+pop %u us",
+                    static_cast<unsigned>(kNumTimers), static_cast<unsigned>((added - start).count()),
+                    static_cast<unsigned>((removed - added).count()), static_cast<unsigned>((popped - removed).count()));
+
+    // With several matching timers, lookups by callback find the earliest one.
+    Timer later(mLayer, Clock::Timestamp(200), kOnComplete, &order[0]);
+    Timer sooner(mLayer, Clock::Timestamp(100), kOnComplete, &order[0]);
+    list.Add(&later);
+    list.Add(&sooner);
+    EXPECT_EQ(list.Find(kOnComplete, &order[1]), nullptr);
+    EXPECT_EQ(list.Find(kOnComplete, &order[0]), &sooner);
+    EXPECT_EQ(list.Remove(kOnComplete, &order[0]), &sooner);
+    EXPECT_EQ(list.Remove(kOnComplete, &order[0]), &later);
+    EXPECT_TRUE(list.Empty());
+}
+
 TEST_F(TestSystemTimer, ExtendTimerToTest)
 {
     if (!LayerEvents<LayerImpl>::HasServiceEvents())
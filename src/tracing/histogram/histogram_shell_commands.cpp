@@ -0,0 +1,94 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <tracing/histogram/histogram_shell_commands.h>
+
+#include <lib/shell/Engine.h>
+#include <lib/shell/SubShellCommand.h>
+#include <lib/support/CodeUtils.h>
+
+#include <inttypes.h>
+
+namespace chip {
+namespace Tracing {
+namespace Histogram {
+
+namespace {
+
+using Shell::streamer_get;
+using Shell::streamer_printf;
+
+HistogramBackend * sBackend = nullptr;
+
+class PrintingSummaryCallback : public HistogramBackend::SummaryCallback
+{
+public:
+    void OnSummary(const MetricSummary & summary) override
+    {
+        streamer_printf(streamer_get(),
+                        "%s: count=%" PRIu32 " errors=%" PRIu32 " min=%" PRIu32 " p50=%" PRIu32 " p90=%" PRIu32 " p99=%" PRIu32
+                        " max=%" PRIu32 " mean=%" PRIu32 "\r\n",
+                        summary.key, summary.count, summary.errorCount, summary.min, summary.p50, summary.p90, summary.p99,
+                        summary.max, summary.mean);
+    }
+};
+
+CHIP_ERROR MetricsDumpHandler(int argc, char ** argv)
+{
+    VerifyOrReturnError(argc <= 1, CHIP_ERROR_INVALID_ARGUMENT);
+
+    PrintingSummaryCallback callback;
+    if (argc == 0)
+    {
+        sBackend->ForEachSummary(callback);
+        return CHIP_NO_ERROR;
+    }
+
+    MetricSummary summary;
+    ReturnErrorOnFailure(sBackend->GetSummary(argv[0], summary));
+    callback.OnSummary(summary);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR MetricsResetHandler(int argc, char ** argv)
+{
+    sBackend->Reset();
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+void RegisterShellCommands(HistogramBackend & backend)
+{
+    sBackend = &backend;
+
+    static constexpr Shell::Command subCommands[] = {
+        { &MetricsDumpHandler, "dump",
+          "Print counts and percentiles of all metrics, or of the given one. Durations are in microseconds. Usage: dump [<key>]" },
+        { &MetricsResetHandler, "reset", "Forget all metrics" },
+    };
+
+    static constexpr Shell::Command metricsCommand = { &Shell::SubShellCommand<MATTER_ARRAY_SIZE(subCommands), subCommands>,
+                                                       "metrics", "Metric histogram commands" };
+
+    Shell::Engine::Root().RegisterCommands(&metricsCommand, 1);
+}
+
+} // namespace Histogram
+} // namespace Tracing
+} // namespace chip
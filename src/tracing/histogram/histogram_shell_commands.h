@@ -0,0 +1,35 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <tracing/histogram/histogram_tracing.h>
+
+namespace chip {
+namespace Tracing {
+namespace Histogram {
+
+/// Registers the "metrics" shell command, operating on the given backend:
+///    metrics dump [<key>]   prints counts and percentiles of all or one metric
+///    metrics reset          forgets all metrics
+///
+/// The backend MUST outlive the shell.
+void RegisterShellCommands(HistogramBackend & backend);
+
+} // namespace Histogram
+} // namespace Tracing
+} // namespace chip
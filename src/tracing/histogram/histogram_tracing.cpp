@@ -0,0 +1,212 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <tracing/histogram/histogram_tracing.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <inttypes.h>
+#include <string.h>
+
+namespace chip {
+namespace Tracing {
+namespace Histogram {
+
+namespace {
+
+class LoggingSummaryCallback : public HistogramBackend::SummaryCallback
+{
+public:
+    void OnSummary(const MetricSummary & summary) override
+    {
+        ChipLogProgress(Automation,
+                        "Metric %s: count=%" PRIu32 " errors=%" PRIu32 " min=%" PRIu32 " p50=%" PRIu32 " p90=%" PRIu32
+                        " p99=%" PRIu32 " max=%" PRIu32 " mean=%" PRIu32,
+                        summary.key, summary.count, summary.errorCount, summary.min, summary.p50, summary.p90, summary.p99,
+                        summary.max, summary.mean);
+    }
+};
+
+} // namespace
+
+HistogramBackend::HistogramBackend()
+{
+    SuccessOrDie(System::Mutex::Init(mLock));
+}
+
+HistogramBackend::Metric * HistogramBackend::FindMetric(const char * key)
+{
+    for (size_t i = 0; i < mMetricCount; i++)
+    {
+        // Keys are usually the same constant, but the same string may be at different addresses.
+        if (mMetrics[i].key == key || strcmp(mMetrics[i].key, key) == 0)
+        {
+            return &mMetrics[i];
+        }
+    }
+    return nullptr;
+}
+
+HistogramBackend::Metric * HistogramBackend::FindOrAddMetric(const char * key)
+{
+    Metric * metric = FindMetric(key);
+    VerifyOrReturnValue(metric == nullptr, metric);
+    VerifyOrReturnValue(mMetricCount < kMaxMetrics, nullptr);
+
+    metric      = &mMetrics[mMetricCount++];
+    metric->key = key;
+    return metric;
+}
+
+void HistogramBackend::LogMetricEvent(const MetricEvent & event)
+{
+    VerifyOrReturn(event.key() != nullptr);
+
+    const System::Clock::Microseconds64 now = System::SystemClock().GetMonotonicMicroseconds64();
+
+    std::lock_guard<System::Mutex> lock(mLock);
+
+    Metric * metric = FindOrAddMetric(event.key());
+    VerifyOrReturn(metric != nullptr);
+
+    switch (event.type())
+    {
+    case MetricEvent::Type::kBeginEvent:
+        OnBegin(*metric, now);
+        break;
+    case MetricEvent::Type::kEndEvent:
+        OnEnd(*metric, event, now);
+        break;
+    case MetricEvent::Type::kInstantEvent:
+        OnInstant(*metric, event);
+        break;
+    }
+}
+
+void HistogramBackend::OnBegin(Metric & metric, System::Clock::Microseconds64 now)
+{
+    if (metric.pendingBeginCount == kMaxPendingBegins)
+    {
+        // Forget the oldest begin, it most likely never ended.
+        memmove(&metric.pendingBegins[0], &metric.pendingBegins[1], sizeof(metric.pendingBegins[0]) * (kMaxPendingBegins - 1));
+        metric.pendingBeginCount--;
+    }
+
+    metric.pendingBegins[metric.pendingBeginCount++] = now;
+}
+
+void HistogramBackend::OnEnd(Metric & metric, const MetricEvent & event, System::Clock::Microseconds64 now)
+{
+    // An end without begin cannot be measured (e.g. the backend was registered in between).
+    VerifyOrReturn(metric.pendingBeginCount > 0);
+    const System::Clock::Microseconds64 begin = metric.pendingBegins[--metric.pendingBeginCount];
+
+    if (event.ValueType() == MetricEvent::Value::Type::kChipErrorCode && event.ValueErrorCode() != 0)
+    {
+        metric.errorCount++;
+        return;
+    }
+
+    const uint64_t duration = (now - begin).count();
+    metric.histogram.Record(duration > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(duration));
+}
+
+void HistogramBackend::OnInstant(Metric & metric, const MetricEvent & event)
+{
+    switch (event.ValueType())
+    {
+    case MetricEvent::Value::Type::kUInt32:
+        metric.histogram.Record(event.ValueUInt32());
+        break;
+    case MetricEvent::Value::Type::kInt32:
+        if (event.ValueInt32() >= 0)
+        {
+            metric.histogram.Record(static_cast<uint32_t>(event.ValueInt32()));
+        }
+        break;
+    case MetricEvent::Value::Type::kChipErrorCode:
+        if (event.ValueErrorCode() != 0)
+        {
+            metric.errorCount++;
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+MetricSummary HistogramBackend::Summarize(const Metric & metric)
+{
+    MetricSummary summary;
+    summary.key        = metric.key;
+    summary.count      = metric.histogram.Count();
+    summary.errorCount = metric.errorCount;
+    summary.min        = metric.histogram.Min();
+    summary.p50        = metric.histogram.Percentile(50);
+    summary.p90        = metric.histogram.Percentile(90);
+    summary.p99        = metric.histogram.Percentile(99);
+    summary.max        = metric.histogram.Max();
+    summary.mean       = metric.histogram.Mean();
+    return summary;
+}
+
+void HistogramBackend::ForEachSummary(SummaryCallback & callback)
+{
+    std::lock_guard<System::Mutex> lock(mLock);
+
+    for (size_t i = 0; i < mMetricCount; i++)
+    {
+        callback.OnSummary(Summarize(mMetrics[i]));
+    }
+}
+
+CHIP_ERROR HistogramBackend::GetSummary(const char * key, MetricSummary & summary)
+{
+    std::lock_guard<System::Mutex> lock(mLock);
+
+    Metric * metric = FindMetric(key);
+    VerifyOrReturnError(metric != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+
+    summary = Summarize(*metric);
+    return CHIP_NO_ERROR;
+}
+
+void HistogramBackend::LogSummaries()
+{
+    LoggingSummaryCallback callback;
+    ForEachSummary(callback);
+}
+
+void HistogramBackend::Reset()
+{
+    std::lock_guard<System::Mutex> lock(mLock);
+
+    for (size_t i = 0; i < mMetricCount; i++)
+    {
+        mMetrics[i].key = nullptr;
+        mMetrics[i].histogram.Reset();
+        mMetrics[i].errorCount        = 0;
+        mMetrics[i].pendingBeginCount = 0;
+    }
+    mMetricCount = 0;
+}
+
+} // namespace Histogram
+} // namespace Tracing
+} // namespace chip
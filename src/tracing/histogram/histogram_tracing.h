@@ -0,0 +1,132 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <system/SystemClock.h>
+#include <system/SystemMutex.h>
+#include <tracing/backend.h>
+#include <tracing/histogram/log_linear_histogram.h>
+#include <tracing/metric_event.h>
+#include <tracing/metric_keys.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <mutex>
+
+namespace chip {
+namespace Tracing {
+namespace Histogram {
+
+/// Aggregated statistics of a single metric key.
+struct MetricSummary
+{
+    MetricKey key;
+    uint32_t count;      // number of samples in the histogram
+    uint32_t errorCount; // end/instant events carrying a non-success error code
+    uint32_t min;
+    uint32_t p50;
+    uint32_t p90;
+    uint32_t p99;
+    uint32_t max;
+    uint32_t mean;
+};
+
+/// A Backend that aggregates metric events into fixed size histograms, one per
+/// metric key, instead of keeping the events themselves.
+///
+/// Samples are:
+///   - for MATTER_LOG_METRIC_BEGIN/END pairs, the time between them, in
+///     microseconds. An end event is matched to the latest begin event of
+///     the same key, so nested or serialized operations are measured exactly
+///     while overlapping ones are approximated.
+///   - for instant events (MATTER_LOG_METRIC) carrying a positive integer,
+///     the value itself.
+///
+/// End and instant events carrying an error are only counted, so failures
+/// do not skew the latency percentiles.
+///
+/// Memory use is fixed: CHIP_CONFIG_TRACING_HISTOGRAM_MAX_METRICS keys are
+/// tracked, events of any further key are ignored.
+///
+/// THREAD SAFETY:
+///   All methods may be called from any thread.
+class HistogramBackend : public ::chip::Tracing::Backend
+{
+public:
+    static constexpr size_t kMaxMetrics       = CHIP_CONFIG_TRACING_HISTOGRAM_MAX_METRICS;
+    static constexpr size_t kMaxPendingBegins = CHIP_CONFIG_TRACING_HISTOGRAM_MAX_PENDING_BEGINS;
+
+    class SummaryCallback
+    {
+    public:
+        virtual ~SummaryCallback()                            = default;
+        virtual void OnSummary(const MetricSummary & summary) = 0;
+    };
+
+    HistogramBackend();
+
+    // Deleted copy constructor and assignment operator to prevent copying
+    HistogramBackend(const HistogramBackend &)             = delete;
+    HistogramBackend & operator=(const HistogramBackend &) = delete;
+
+    void LogMetricEvent(const MetricEvent & event) override;
+
+    /// Reports the summary of every metric key seen so far, in the order
+    /// they were first seen.
+    void ForEachSummary(SummaryCallback & callback);
+
+    /// Gets the summary of a single metric key.
+    ///
+    /// @return CHIP_ERROR_KEY_NOT_FOUND if no event of that key was seen.
+    CHIP_ERROR GetSummary(const char * key, MetricSummary & summary);
+
+    /// Logs the summary of every metric key, one line each.
+    void LogSummaries();
+
+    /// Forgets all metrics, including begin events not ended yet.
+    void Reset();
+
+private:
+    struct Metric
+    {
+        MetricKey key = nullptr;
+        LogLinearHistogram histogram;
+        uint32_t errorCount = 0;
+        System::Clock::Microseconds64 pendingBegins[kMaxPendingBegins];
+        size_t pendingBeginCount = 0;
+    };
+
+    Metric * FindMetric(const char * key);
+    Metric * FindOrAddMetric(const char * key);
+    static MetricSummary Summarize(const Metric & metric);
+
+    void OnBegin(Metric & metric, System::Clock::Microseconds64 now);
+    void OnEnd(Metric & metric, const MetricEvent & event, System::Clock::Microseconds64 now);
+    void OnInstant(Metric & metric, const MetricEvent & event);
+
+    System::Mutex mLock;
+    Metric mMetrics[kMaxMetrics];
+    size_t mMetricCount = 0;
+};
+
+} // namespace Histogram
+} // namespace Tracing
+} // namespace chip
@@ -0,0 +1,110 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <tracing/histogram/log_linear_histogram.h>
+
+#include <algorithm>
+#include <iterator>
+
+namespace chip {
+namespace Tracing {
+namespace Histogram {
+
+size_t LogLinearHistogram::BucketIndex(uint32_t value)
+{
+    if (value < kSubBucketCount)
+    {
+        return value;
+    }
+
+    // Index of the highest set bit, which is at least kSubBucketBits here.
+    unsigned exponent = kSubBucketBits;
+    while ((value >> exponent) > 1)
+    {
+        exponent++;
+    }
+
+    // The kSubBucketBits bits after the highest one select the sub bucket.
+    const uint32_t subBucket = (value >> (exponent - kSubBucketBits)) - kSubBucketCount;
+    return (exponent - kSubBucketBits + 1) * kSubBucketCount + subBucket;
+}
+
+uint32_t LogLinearHistogram::BucketUpperBound(size_t index)
+{
+    if (index < kSubBucketCount)
+    {
+        return static_cast<uint32_t>(index);
+    }
+
+    const unsigned shift    = static_cast<unsigned>(index / kSubBucketCount) - 1;
+    const uint64_t mantissa = kSubBucketCount + index % kSubBucketCount;
+    return static_cast<uint32_t>(((mantissa + 1) << shift) - 1);
+}
+
+void LogLinearHistogram::Record(uint32_t value)
+{
+    // Saturate rather than wrap, a full histogram is not worth losing the other statistics for.
+    uint32_t & bucket = mBuckets[BucketIndex(value)];
+    if (bucket == UINT32_MAX || mCount == UINT32_MAX)
+    {
+        return;
+    }
+
+    bucket++;
+    mCount++;
+    mSum += value;
+    mMin = std::min(mMin, value);
+    mMax = std::max(mMax, value);
+}
+
+void LogLinearHistogram::Reset()
+{
+    std::fill(std::begin(mBuckets), std::end(mBuckets), 0);
+    mCount = 0;
+    mMin   = UINT32_MAX;
+    mMax   = 0;
+    mSum   = 0;
+}
+
+uint32_t LogLinearHistogram::Percentile(uint8_t percent) const
+{
+    if (mCount == 0)
+    {
+        return 0;
+    }
+
+    // Rank of the requested value, rounded up: p50 of 3 values is the 2nd.
+    const uint64_t rank = std::max<uint64_t>((static_cast<uint64_t>(mCount) * std::min<uint8_t>(percent, 100) + 99) / 100, 1);
+
+    uint64_t seen = 0;
+    for (size_t i = 0; i < kBucketCount; i++)
+    {
+        seen += mBuckets[i];
+        if (seen >= rank)
+        {
+            // The bucket bound can be outside of what was actually recorded.
+            return std::max(mMin, std::min(mMax, BucketUpperBound(i)));
+        }
+    }
+
+    return mMax;
+}
+
+} // namespace Histogram
+} // namespace Tracing
+} // namespace chip
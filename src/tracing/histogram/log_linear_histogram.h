@@ -0,0 +1,69 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace Tracing {
+namespace Histogram {
+
+/// A fixed size histogram of uint32_t values.
+///
+/// Buckets are log-linear: values below kSubBucketCount each have their own
+/// bucket, larger values share buckets that are 1/kSubBucketCount of their
+/// power of two wide. Percentiles are therefore reported with a relative
+/// error below 1/kSubBucketCount (6.25%), whatever the magnitude of the values.
+class LogLinearHistogram
+{
+public:
+    static constexpr unsigned kSubBucketBits  = 4;
+    static constexpr uint32_t kSubBucketCount = 1u << kSubBucketBits;
+    static constexpr size_t kBucketCount      = (32 - kSubBucketBits + 1) * kSubBucketCount;
+
+    void Record(uint32_t value);
+    void Reset();
+
+    uint32_t Count() const { return mCount; }
+    uint32_t Min() const { return mCount > 0 ? mMin : 0; }
+    uint32_t Max() const { return mMax; }
+    uint32_t Mean() const { return mCount > 0 ? static_cast<uint32_t>(mSum / mCount) : 0; }
+
+    /// Returns the smallest value such that at least `percent` percent of the
+    /// recorded values are lower or equal, up to the bucket resolution.
+    ///
+    /// Returns 0 if nothing was recorded.
+    uint32_t Percentile(uint8_t percent) const;
+
+    static size_t BucketIndex(uint32_t value);
+
+    /// Largest value counted in the bucket at the given index.
+    static uint32_t BucketUpperBound(size_t index);
+
+private:
+    uint32_t mBuckets[kBucketCount] = {};
+    uint32_t mCount                 = 0;
+    uint32_t mMin                   = UINT32_MAX;
+    uint32_t mMax                   = 0;
+    uint64_t mSum                   = 0;
+};
+
+} // namespace Histogram
+} // namespace Tracing
+} // namespace chip
@@ -0,0 +1,196 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <system/SystemClock.h>
+#include <tracing/histogram/histogram_tracing.h>
+#include <tracing/histogram/log_linear_histogram.h>
+
+#include <cstdio>
+#include <memory>
+
+using namespace chip;
+using namespace chip::Tracing;
+using namespace chip::Tracing::Histogram;
+using namespace chip::System::Clock::Literals;
+
+namespace {
+
+constexpr MetricKey kTestMetric      = "test_metric";
+constexpr MetricKey kOtherTestMetric = "other_test_metric";
+
+TEST(TestLogLinearHistogram, BucketsAreContiguous)
+{
+    EXPECT_EQ(LogLinearHistogram::BucketIndex(0), 0u);
+    EXPECT_EQ(LogLinearHistogram::BucketIndex(UINT32_MAX), LogLinearHistogram::kBucketCount - 1);
+    EXPECT_EQ(LogLinearHistogram::BucketUpperBound(LogLinearHistogram::kBucketCount - 1), UINT32_MAX);
+
+    for (size_t i = 0; i + 1 < LogLinearHistogram::kBucketCount; i++)
+    {
+        const uint32_t upperBound = LogLinearHistogram::BucketUpperBound(i);
+        EXPECT_EQ(LogLinearHistogram::BucketIndex(upperBound), i);
+        EXPECT_EQ(LogLinearHistogram::BucketIndex(upperBound + 1), i + 1);
+    }
+}
+
+TEST(TestLogLinearHistogram, Percentiles)
+{
+    auto histogram = std::make_unique<LogLinearHistogram>();
+    EXPECT_EQ(histogram->Percentile(50), 0u);
+
+    for (uint32_t value = 1; value <= 1000; value++)
+    {
+        histogram->Record(value);
+    }
+
+    EXPECT_EQ(histogram->Count(), 1000u);
+    EXPECT_EQ(histogram->Min(), 1u);
+    EXPECT_EQ(histogram->Max(), 1000u);
+    EXPECT_EQ(histogram->Mean(), 500u);
+
+    // Reported values are bucket bounds, within 1/16th of the exact ones.
+    EXPECT_GE(histogram->Percentile(50), 500u);
+    EXPECT_LE(histogram->Percentile(50), 500u + 500u / 16);
+    EXPECT_GE(histogram->Percentile(99), 990u);
+    EXPECT_LE(histogram->Percentile(99), 1000u);
+    EXPECT_EQ(histogram->Percentile(100), 1000u);
+    EXPECT_EQ(histogram->Percentile(0), 1u);
+
+    histogram->Reset();
+    EXPECT_EQ(histogram->Count(), 0u);
+    EXPECT_EQ(histogram->Max(), 0u);
+}
+
+class TestHistogramTracing : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+        mRealClock = &System::SystemClock();
+        System::Clock::Internal::SetSystemClockForTesting(&mMockClock);
+    }
+
+    void TearDown() override { System::Clock::Internal::SetSystemClockForTesting(mRealClock); }
+
+protected:
+    System::Clock::ClockBase * mRealClock;
+    System::Clock::Internal::MockClock mMockClock;
+};
+
+TEST_F(TestHistogramTracing, MeasuresBeginEndPairs)
+{
+    auto backend = std::make_unique<HistogramBackend>();
+
+    for (uint32_t i = 1; i <= 10; i++)
+    {
+        backend->LogMetricEvent(MetricEvent(MetricEvent::Type::kBeginEvent, kTestMetric));
+        mMockClock.AdvanceMonotonic(System::Clock::Milliseconds64(i));
+        backend->LogMetricEvent(MetricEvent(MetricEvent::Type::kEndEvent, kTestMetric, CHIP_NO_ERROR));
+    }
+
+    // Failures are counted, but not measured.
+    backend->LogMetricEvent(MetricEvent(MetricEvent::Type::kBeginEvent, kTestMetric));
+    mMockClock.AdvanceMonotonic(1000_ms64);
+    backend->LogMetricEvent(MetricEvent(MetricEvent::Type::kEndEvent, kTestMetric, CHIP_ERROR_TIMEOUT));
+
+    // Ends without a begin are ignored.
+    backend->LogMetricEvent(MetricEvent(MetricEvent::Type::kEndEvent, kTestMetric, CHIP_NO_ERROR));
+
+    MetricSummary summary;
+    ASSERT_EQ(backend->GetSummary(kTestMetric, summary), CHIP_NO_ERROR);
+    EXPECT_STREQ(summary.key, kTestMetric);
+    EXPECT_EQ(summary.count, 10u);
+    EXPECT_EQ(summary.errorCount, 1u);
+    EXPECT_EQ(summary.min, 1000u);
+    EXPECT_EQ(summary.max, 10000u);
+    EXPECT_GE(summary.p50, 5000u);
+    EXPECT_LE(summary.p50, 6000u);
+    EXPECT_EQ(summary.p99, 10000u);
+
+    EXPECT_EQ(backend->GetSummary(kOtherTestMetric, summary), CHIP_ERROR_KEY_NOT_FOUND);
+}
+
+TEST_F(TestHistogramTracing, MatchesNestedBegins)
+{
+    auto backend = std::make_unique<HistogramBackend>();
+
+    backend->LogMetricEvent(MetricEvent(MetricEvent::Type::kBeginEvent, kTestMetric));
+    mMockClock.AdvanceMonotonic(10_ms64);
+    backend->LogMetricEvent(MetricEvent(MetricEvent::Type::kBeginEvent, kTestMetric));
+    mMockClock.AdvanceMonotonic(1_ms64);
+    backend->LogMetricEvent(MetricEvent(MetricEvent::Type::kEndEvent, kTestMetric, CHIP_NO_ERROR));
+    backend->LogMetricEvent(MetricEvent(MetricEvent::Type::kEndEvent, kTestMetric, CHIP_NO_ERROR));
+
+    MetricSummary summary;
+    ASSERT_EQ(backend->GetSummary(kTestMetric, summary), CHIP_NO_ERROR);
+    EXPECT_EQ(summary.count, 2u);
+    EXPECT_EQ(summary.min, 1000u);
+    EXPECT_EQ(summary.max, 11000u);
+}
+
+TEST_F(TestHistogramTracing, RecordsInstantValues)
+{
+    auto backend = std::make_unique<HistogramBackend>();
+
+    backend->LogMetricEvent(MetricEvent(MetricEvent::Type::kInstantEvent, kTestMetric, uint32_t(3)));
+    backend->LogMetricEvent(MetricEvent(MetricEvent::Type::kInstantEvent, kTestMetric, int32_t(5)));
+    backend->LogMetricEvent(MetricEvent(MetricEvent::Type::kInstantEvent, kTestMetric, int32_t(-1)));
+    backend->LogMetricEvent(MetricEvent(MetricEvent::Type::kInstantEvent, kTestMetric, CHIP_ERROR_INTERNAL));
+    backend->LogMetricEvent(MetricEvent(MetricEvent::Type::kInstantEvent, kOtherTestMetric, uint32_t(7)));
+
+    MetricSummary summary;
+    ASSERT_EQ(backend->GetSummary(kTestMetric, summary), CHIP_NO_ERROR);
+    EXPECT_EQ(summary.count, 2u);
+    EXPECT_EQ(summary.errorCount, 1u);
+    EXPECT_EQ(summary.min, 3u);
+    EXPECT_EQ(summary.max, 5u);
+
+    class CountingCallback : public HistogramBackend::SummaryCallback
+    {
+    public:
+        void OnSummary(const MetricSummary &) override { mCount++; }
+        int mCount = 0;
+    } callback;
+
+    backend->ForEachSummary(callback);
+    EXPECT_EQ(callback.mCount, 2);
+
+    backend->Reset();
+    EXPECT_EQ(backend->GetSummary(kTestMetric, summary), CHIP_ERROR_KEY_NOT_FOUND);
+}
+
+TEST_F(TestHistogramTracing, IgnoresMetricsBeyondCapacity)
+{
+    auto backend = std::make_unique<HistogramBackend>();
+
+    static char keys[HistogramBackend::kMaxMetrics + 1][8];
+    for (size_t i = 0; i <= HistogramBackend::kMaxMetrics; i++)
+    {
+        snprintf(keys[i], sizeof(keys[i]), "key%u", static_cast<unsigned>(i));
+        backend->LogMetricEvent(MetricEvent(MetricEvent::Type::kInstantEvent, keys[i], uint32_t(1)));
+    }
+
+    MetricSummary summary;
+    EXPECT_EQ(backend->GetSummary(keys[0], summary), CHIP_NO_ERROR);
+    EXPECT_EQ(backend->GetSummary(keys[HistogramBackend::kMaxMetrics - 1], summary), CHIP_NO_ERROR);
+    EXPECT_EQ(backend->GetSummary(keys[HistogramBackend::kMaxMetrics], summary), CHIP_ERROR_KEY_NOT_FOUND);
+}
+
+} // namespace
@@ -0,0 +1,339 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <tracing/json/async_json_tracing.h>
+
+#include <lib/support/CodeUtils.h>
+#include <tracing/json/json_records.h>
+
+#include <json/json.h>
+
+#include <algorithm>
+
+namespace chip {
+namespace Tracing {
+namespace Json {
+
+namespace {
+
+std::atomic<uint64_t> gNextBackendId{ 1 };
+
+} // namespace
+
+bool AsyncJsonBackend::EventRing::Push(const Event & event)
+{
+    const size_t head = mHead.load(std::memory_order_relaxed);
+    if (head - mTail.load(std::memory_order_acquire) >= mCapacity)
+    {
+        mDroppedCount.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    mEvents[head % mCapacity] = event;
+    mHead.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+bool AsyncJsonBackend::EventRing::Pop(Event & event)
+{
+    const size_t tail = mTail.load(std::memory_order_relaxed);
+    VerifyOrReturnValue(tail != mHead.load(std::memory_order_acquire), false);
+
+    event = mEvents[tail % mCapacity];
+    mTail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+uint64_t AsyncJsonBackend::EventRing::TakeUnreportedDroppedCount()
+{
+    const uint64_t dropped = DroppedCount();
+    const uint64_t result  = dropped - mReportedDroppedCount;
+    mReportedDroppedCount  = dropped;
+    return result;
+}
+
+AsyncJsonBackend::AsyncJsonBackend(size_t eventsPerThread) :
+    mEventsPerThread(std::max<size_t>(eventsPerThread, 1)), mId(gNextBackendId.fetch_add(1))
+{}
+
+AsyncJsonBackend::~AsyncJsonBackend()
+{
+    StopWriter();
+    CloseFile();
+}
+
+CHIP_ERROR AsyncJsonBackend::OpenFile(const char * path)
+{
+    std::lock_guard<std::mutex> lock(mOutputLock);
+    Drain();
+    return mOutput.OpenFile(path);
+}
+
+void AsyncJsonBackend::CloseFile()
+{
+    std::lock_guard<std::mutex> lock(mOutputLock);
+    Drain();
+    mOutput.CloseFile();
+}
+
+void AsyncJsonBackend::Flush()
+{
+    std::lock_guard<std::mutex> lock(mOutputLock);
+    Drain();
+}
+
+uint64_t AsyncJsonBackend::GetDroppedEventCount() const
+{
+    std::lock_guard<std::mutex> lock(mRingsLock);
+
+    uint64_t dropped = 0;
+    for (auto & ring : mRings)
+    {
+        dropped += ring.second->DroppedCount();
+    }
+    return dropped;
+}
+
+void AsyncJsonBackend::Open()
+{
+    std::lock_guard<std::mutex> lock(mWriterLock);
+    VerifyOrReturn(!mWriterThread.joinable());
+
+    mStopWriter   = false;
+    mWriterThread = std::thread(&AsyncJsonBackend::WriterMain, this);
+}
+
+void AsyncJsonBackend::Close()
+{
+    StopWriter();
+    CloseFile();
+}
+
+void AsyncJsonBackend::StopWriter()
+{
+    {
+        std::lock_guard<std::mutex> lock(mWriterLock);
+        mStopWriter = true;
+    }
+    mWriterCondition.notify_one();
+
+    if (mWriterThread.joinable())
+    {
+        mWriterThread.join();
+    }
+}
+
+void AsyncJsonBackend::WriterMain()
+{
+    std::unique_lock<std::mutex> lock(mWriterLock);
+    while (!mStopWriter)
+    {
+        mWriterCondition.wait_for(lock, kDrainInterval, [this] { return mStopWriter; });
+
+        lock.unlock();
+        Flush();
+        lock.lock();
+    }
+}
+
+AsyncJsonBackend::EventRing & AsyncJsonBackend::RingForCurrentThread()
+{
+    // Caches the ring of the last backend used on this thread, so that
+    // the lookup below only happens when switching between backends.
+    thread_local uint64_t tBackendId = 0;
+    thread_local EventRing * tRing   = nullptr;
+
+    if (tBackendId != mId)
+    {
+        const std::thread::id threadId = std::this_thread::get_id();
+
+        std::lock_guard<std::mutex> lock(mRingsLock);
+        auto it = std::find_if(mRings.begin(), mRings.end(), [&](const auto & ring) { return ring.first == threadId; });
+        if (it == mRings.end())
+        {
+            mRings.emplace_back(threadId, std::make_unique<EventRing>(mEventsPerThread));
+            it = mRings.end() - 1;
+        }
+
+        tBackendId = mId;
+        tRing      = it->second.get();
+    }
+
+    return *tRing;
+}
+
+template <typename T>
+void AsyncJsonBackend::Record(const T & record)
+{
+    Event event;
+    event.timestamp = System::SystemClock().GetMonotonicTimestamp();
+    event.data.Set<T>(record);
+
+    RingForCurrentThread().Push(event);
+}
+
+void AsyncJsonBackend::TraceBegin(const char * label, const char * group)
+{
+    Record(TraceRecord{ "TraceBegin", label, group });
+}
+
+void AsyncJsonBackend::TraceEnd(const char * label, const char * group)
+{
+    Record(TraceRecord{ "TraceEnd", label, group });
+}
+
+void AsyncJsonBackend::TraceInstant(const char * label, const char * group)
+{
+    Record(TraceRecord{ "TraceInstant", label, group });
+}
+
+void AsyncJsonBackend::TraceCounter(const char * label)
+{
+    Record(CounterRecord{ label });
+}
+
+void AsyncJsonBackend::LogMetricEvent(const MetricEvent & event)
+{
+    Record(event);
+}
+
+void AsyncJsonBackend::LogMessageSend(MessageSendInfo & info)
+{
+    Record(MessageSendRecord{ info.messageType, *info.payloadHeader, *info.packetHeader, info.payload.size(),
+                              info.messageTotalSize });
+}
+
+void AsyncJsonBackend::LogMessageReceived(MessageReceivedInfo & info)
+{
+    Record(MessageReceivedRecord{ info.messageType, *info.payloadHeader, *info.packetHeader, info.payload.size(),
+                                  info.messageTotalSize });
+}
+
+void AsyncJsonBackend::LogNodeLookup(NodeLookupInfo & info)
+{
+    Record(*info.request);
+}
+
+void AsyncJsonBackend::LogNodeDiscovered(NodeDiscoveredInfo & info)
+{
+    Record(NodeDiscoveredRecord{ info.type, *info.peerId, *info.result });
+}
+
+void AsyncJsonBackend::LogNodeDiscoveryFailed(NodeDiscoveryFailedInfo & info)
+{
+    Record(NodeDiscoveryFailedRecord{ *info.peerId, info.error });
+}
+
+void AsyncJsonBackend::Drain()
+{
+    {
+        std::lock_guard<std::mutex> lock(mRingsLock);
+        mDrainRings.clear();
+        for (auto & ring : mRings)
+        {
+            mDrainRings.push_back(ring.second.get());
+        }
+    }
+
+    uint64_t dropped = 0;
+    for (EventRing * ring : mDrainRings)
+    {
+        dropped += ring->TakeUnreportedDroppedCount();
+
+        // Bounded, so that a thread tracing faster than we write cannot keep us here forever.
+        Event event;
+        for (size_t i = 0; i < ring->Capacity() && ring->Pop(event); i++)
+        {
+            mPendingEvents.push_back(event);
+        }
+    }
+
+    // Each ring is already ordered, this interleaves the events of different threads.
+    std::stable_sort(mPendingEvents.begin(), mPendingEvents.end(),
+                     [](const Event & a, const Event & b) { return a.timestamp < b.timestamp; });
+
+    for (const Event & event : mPendingEvents)
+    {
+        OutputEvent(event);
+    }
+    mPendingEvents.clear();
+
+    if (dropped > 0)
+    {
+        ::Json::Value value;
+        value["event"] = "EventsDropped";
+        value["count"] = static_cast<::Json::Value::UInt64>(dropped);
+        mOutput.OutputRecord(value, System::SystemClock().GetMonotonicTimestamp());
+    }
+}
+
+void AsyncJsonBackend::OutputEvent(const Event & event)
+{
+    ::Json::Value value;
+
+    if (event.data.Is<TraceRecord>())
+    {
+        const auto & record = event.data.Get<TraceRecord>();
+        FillTraceRecord(value, record.event, record.label, record.group);
+    }
+    else if (event.data.Is<CounterRecord>())
+    {
+        const char * label = event.data.Get<CounterRecord>().label;
+        FillCounterRecord(value, label, ++mCounters[label]);
+    }
+    else if (event.data.Is<MetricEvent>())
+    {
+        FillMetricRecord(value, event.data.Get<MetricEvent>());
+    }
+    else if (event.data.Is<MessageSendRecord>())
+    {
+        const auto & record = event.data.Get<MessageSendRecord>();
+        FillMessageSendRecord(value, record.messageType, record.payloadHeader, record.packetHeader, record.payloadSize,
+                              record.messageTotalSize);
+    }
+    else if (event.data.Is<MessageReceivedRecord>())
+    {
+        const auto & record = event.data.Get<MessageReceivedRecord>();
+        FillMessageReceivedRecord(value, record.messageType, record.payloadHeader, record.packetHeader, record.payloadSize,
+                                  record.messageTotalSize);
+    }
+    else if (event.data.Is<AddressResolve::NodeLookupRequest>())
+    {
+        FillNodeLookupRecord(value, event.data.Get<AddressResolve::NodeLookupRequest>());
+    }
+    else if (event.data.Is<NodeDiscoveredRecord>())
+    {
+        const auto & record = event.data.Get<NodeDiscoveredRecord>();
+        FillNodeDiscoveredRecord(value, record.type, record.peerId, record.result);
+    }
+    else if (event.data.Is<NodeDiscoveryFailedRecord>())
+    {
+        const auto & record = event.data.Get<NodeDiscoveryFailedRecord>();
+        FillNodeDiscoveryFailedRecord(value, record.peerId, record.error);
+    }
+    else
+    {
+        return;
+    }
+
+    mOutput.OutputRecord(value, event.timestamp);
+}
+
+} // namespace Json
+} // namespace Tracing
+} // namespace chip
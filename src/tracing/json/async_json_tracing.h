@@ -0,0 +1,219 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <lib/address_resolve/TracingStructs.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/PeerId.h>
+#include <lib/support/Variant.h>
+#include <system/SystemClock.h>
+#include <tracing/backend.h>
+#include <tracing/json/json_tracing.h>
+#include <tracing/metric_event.h>
+#include <transport/TracingStructs.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace chip {
+namespace Tracing {
+namespace Json {
+
+/// A Backend producing the same output as JsonBackend, without serializing
+/// anything on the traced threads.
+///
+/// Traced events are copied as small binary records into a fixed size ring
+/// buffer owned by the tracing thread. A separate writer thread, running
+/// while the backend is registered, periodically drains all ring buffers,
+/// orders the records by time and writes them out through a JsonBackend.
+///
+/// If a ring buffer is full, new events of that thread are dropped and counted.
+/// The writer reports these as "EventsDropped" records.
+///
+/// DIFFERENCES FROM JsonBackend:
+///   - message payloads are not kept, so their hex/decoded contents are never
+///     output (only their size is).
+///   - labels and groups are kept as pointers, so they MUST be string
+///     literals (as used by the MATTER_TRACE_* macros).
+///
+/// THREAD SAFETY:
+///   Tracing methods are lock free, except for the first event traced on each
+///   thread, which registers the ring buffer of that thread.
+class AsyncJsonBackend : public ::chip::Tracing::Backend
+{
+public:
+    static constexpr size_t kDefaultEventsPerThread = 1024;
+
+    /// How long the writer thread waits between draining the ring buffers
+    static constexpr System::Clock::Milliseconds32 kDrainInterval = System::Clock::Milliseconds32(10);
+
+    explicit AsyncJsonBackend(size_t eventsPerThread = kDefaultEventsPerThread);
+    ~AsyncJsonBackend();
+
+    // Start tracing output to the given file
+    CHIP_ERROR OpenFile(const char * path);
+
+    // Close if an output file is open. Pending events are written out first.
+    void CloseFile();
+
+    /// Writes out all events traced so far, from the calling thread.
+    void Flush();
+
+    /// Total number of events dropped because the ring buffer of the tracing
+    /// thread was full.
+    uint64_t GetDroppedEventCount() const;
+
+    void Open() override;
+    void Close() override;
+
+    void TraceBegin(const char * label, const char * group) override;
+    void TraceEnd(const char * label, const char * group) override;
+    void TraceInstant(const char * label, const char * group) override;
+    void TraceCounter(const char * label) override;
+    void LogMessageSend(MessageSendInfo &) override;
+    void LogMessageReceived(MessageReceivedInfo &) override;
+    void LogNodeLookup(NodeLookupInfo &) override;
+    void LogNodeDiscovered(NodeDiscoveredInfo &) override;
+    void LogNodeDiscoveryFailed(NodeDiscoveryFailedInfo &) override;
+    void LogMetricEvent(const MetricEvent &) override;
+
+private:
+    struct TraceRecord
+    {
+        const char * event;
+        const char * label;
+        const char * group;
+    };
+
+    struct CounterRecord
+    {
+        const char * label;
+    };
+
+    struct MessageSendRecord
+    {
+        OutgoingMessageType messageType;
+        PayloadHeader payloadHeader;
+        PacketHeader packetHeader;
+        size_t payloadSize;
+        size_t messageTotalSize;
+    };
+
+    struct MessageReceivedRecord
+    {
+        IncomingMessageType messageType;
+        PayloadHeader payloadHeader;
+        PacketHeader packetHeader;
+        size_t payloadSize;
+        size_t messageTotalSize;
+    };
+
+    struct NodeDiscoveredRecord
+    {
+        DiscoveryInfoType type;
+        PeerId peerId;
+        AddressResolve::ResolveResult result;
+    };
+
+    struct NodeDiscoveryFailedRecord
+    {
+        PeerId peerId;
+        CHIP_ERROR error;
+    };
+
+    struct Event
+    {
+        System::Clock::Timestamp timestamp;
+        Variant<TraceRecord, CounterRecord, MetricEvent, MessageSendRecord, MessageReceivedRecord,
+                AddressResolve::NodeLookupRequest, NodeDiscoveredRecord, NodeDiscoveryFailedRecord>
+            data;
+    };
+
+    /// Single producer, single consumer ring buffer of events.
+    ///
+    /// Push is only called by the thread owning the ring, Pop only with
+    /// mOutputLock held.
+    class EventRing
+    {
+    public:
+        explicit EventRing(size_t capacity) : mEvents(new Event[capacity]), mCapacity(capacity) {}
+
+        bool Push(const Event & event);
+        bool Pop(Event & event);
+
+        size_t Capacity() const { return mCapacity; }
+        uint64_t DroppedCount() const { return mDroppedCount.load(std::memory_order_relaxed); }
+
+        /// Returns the number of events dropped since the last call. Consumer side only.
+        uint64_t TakeUnreportedDroppedCount();
+
+    private:
+        std::unique_ptr<Event[]> mEvents;
+        const size_t mCapacity;
+
+        // Indexes grow monotonically, slots are at index % mCapacity. Kept on
+        // separate cache lines as they are written by different threads.
+        alignas(64) std::atomic<size_t> mHead{ 0 }; // written by the producer
+        alignas(64) std::atomic<size_t> mTail{ 0 }; // written by the consumer
+
+        std::atomic<uint64_t> mDroppedCount{ 0 };
+        uint64_t mReportedDroppedCount = 0;
+    };
+
+    template <typename T>
+    void Record(const T & record);
+
+    EventRing & RingForCurrentThread();
+
+    void WriterMain();
+    void StopWriter();
+
+    /// Writes out the events of all rings. Requires mOutputLock.
+    void Drain();
+    void OutputEvent(const Event & event);
+
+    const size_t mEventsPerThread;
+
+    // Identifies this backend in the per-thread ring cache; never reused.
+    const uint64_t mId;
+
+    mutable std::mutex mRingsLock;
+    std::vector<std::pair<std::thread::id, std::unique_ptr<EventRing>>> mRings;
+
+    // Protects the output and all consumer side state below
+    std::mutex mOutputLock;
+    JsonBackend mOutput;
+    std::vector<EventRing *> mDrainRings;
+    std::vector<Event> mPendingEvents;
+    std::unordered_map<std::string, int> mCounters;
+
+    std::mutex mWriterLock;
+    std::condition_variable mWriterCondition;
+    std::thread mWriterThread;
+    bool mStopWriter = false;
+};
+
+} // namespace Json
+} // namespace Tracing
+} // namespace chip
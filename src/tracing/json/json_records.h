@@ -0,0 +1,63 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <lib/address_resolve/TracingStructs.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/PeerId.h>
+#include <lib/support/Span.h>
+#include <tracing/metric_event.h>
+#include <transport/TracingStructs.h>
+
+#include <stddef.h>
+
+namespace Json {
+class Value;
+}
+
+namespace chip {
+namespace Tracing {
+namespace Json {
+
+// Builders for the records output by the json tracing backends.
+//
+// All json backends build their records using these, so that the output
+// format does not depend on which backend produced a trace.
+
+/// TraceBegin/TraceEnd/TraceInstant records, `event` being one of these names.
+void FillTraceRecord(::Json::Value & value, const char * event, const char * label, const char * group);
+
+void FillCounterRecord(::Json::Value & value, const char * label, int count);
+void FillMetricRecord(::Json::Value & value, const MetricEvent & event);
+
+/// Message records only contain the payload size. FillPayloadContents adds
+/// the payload data itself, as configured by the log-json-buildconfig.
+void FillMessageSendRecord(::Json::Value & value, OutgoingMessageType messageType, const PayloadHeader & payloadHeader,
+                           const PacketHeader & packetHeader, size_t payloadSize, size_t messageTotalSize);
+void FillMessageReceivedRecord(::Json::Value & value, IncomingMessageType messageType, const PayloadHeader & payloadHeader,
+                               const PacketHeader & packetHeader, size_t payloadSize, size_t messageTotalSize);
+void FillPayloadContents(::Json::Value & value, ByteSpan payload, Protocols::Id protocolId, uint8_t messageType);
+
+void FillNodeLookupRecord(::Json::Value & value, const AddressResolve::NodeLookupRequest & request);
+void FillNodeDiscoveredRecord(::Json::Value & value, DiscoveryInfoType type, const PeerId & peerId,
+                              const AddressResolve::ResolveResult & result);
+void FillNodeDiscoveryFailedRecord(::Json::Value & value, const PeerId & peerId, CHIP_ERROR error);
+
+} // namespace Json
+} // namespace Tracing
+} // namespace chip
@@ -19,12 +19,10 @@
 #include <tracing/json/json_tracing.h>
 
 #include <lib/address_resolve/TracingStructs.h>
-#include <lib/core/ErrorStr.h>
-#include <lib/support/CHIPMem.h>
 #include <lib/support/ChunkSplitter.h>
 #include <lib/support/StringBuilder.h>
 #include <lib/support/StringSplitter.h>
-#include <log_json/log_json_build_config.h>
+#include <tracing/json/json_records.h>
 #include <tracing/metric_event.h>
 #include <transport/TracingStructs.h>
 
@@ -36,215 +34,12 @@
 #include <sstream>
 #include <string>
 
-#if MATTER_LOG_JSON_DECODE_HEX
-#include <lib/support/BytesToHex.h> // nogncheck
-#endif
-
-#if MATTER_LOG_JSON_DECODE_FULL
-#include <lib/format/protocol_decoder.h> // nogncheck
-#include <tlv/meta/clusters_meta.h>      // nogncheck
-#include <tlv/meta/protocols_meta.h>     // nogncheck
-#endif
-
 namespace chip {
 namespace Tracing {
 namespace Json {
 
-namespace {
-
 using chip::StringBuilder;
 
-#if MATTER_LOG_JSON_DECODE_FULL
-
-using namespace chip::Decoders;
-
-using PayloadDecoderType = chip::Decoders::PayloadDecoder<64, 2048>;
-
-/// Figures out a unique name within a json object.
-///
-/// Decoded keys may be duplicated, like list elements are denoted as "[]".
-/// The existing code does not attempt to encode lists and everything is an object,
-/// so this name builder attempts to find unique keys for elements inside a json.
-///
-/// In particular a repeated "Anonymous<>", "Anonymous<>", ... will become "Anonymous<0>", ...
-class UniqueNameBuilder
-{
-public:
-    UniqueNameBuilder(chip::StringBuilderBase & formatter) : mFormatter(formatter) {}
-    const char * c_str() const { return mFormatter.c_str(); }
-
-    // Figure out the next unique name in the given value
-    //
-    // After this returns, c_str() will return a name based on `baseName` that is
-    // not a key of `value` (unless on overflows, which are just logged)
-    void ComputeNextUniqueName(const char * baseName, ::Json::Value & value)
-    {
-        FirstName(baseName);
-        while (value.isMember(mFormatter.c_str()))
-        {
-            NextName(baseName);
-            if (!mFormatter.Fit())
-            {
-                ChipLogError(Automation, "Potential data loss: insufficient space for unique keys in json");
-                return;
-            }
-        }
-    }
-
-private:
-    void FirstName(const char * baseName)
-    {
-        if (strcmp(baseName, "Anonymous<>") == 0)
-        {
-            mFormatter.Reset().Add("Anonymous<0>");
-        }
-        else
-        {
-            mFormatter.Reset().Add(baseName);
-        }
-    }
-
-    void NextName(const char * baseName)
-    {
-        if (strcmp(baseName, "Anonymous<>") == 0)
-        {
-            mFormatter.Reset().Add("Anonymous<").Add(mUniqueIndex++).Add(">");
-        }
-        else
-        {
-            mFormatter.Reset().Add(baseName).Add("@").Add(mUniqueIndex++);
-        }
-    }
-
-    chip::StringBuilderBase & mFormatter;
-    int mUniqueIndex = 0;
-};
-
-// Gets the current value of the decoder until a NEST exit is returned
-::Json::Value GetPayload(PayloadDecoderType & decoder)
-{
-    ::Json::Value value;
-    PayloadEntry entry;
-    StringBuilder<128> formatter;
-    UniqueNameBuilder nameBuilder(formatter);
-
-    while (decoder.Next(entry))
-    {
-        switch (entry.GetType())
-        {
-        case PayloadEntry::IMPayloadType::kNestingEnter:
-            // PayloadEntry validity is only until any decoder calls are made,
-            // because the entry Name/Value may point into a shared Decoder buffer.
-            //
-            // As such entry.GetName() is only valid here and would not be valid once
-            // GetPayload() is called as GetPayload calls decoder.Next, which invalidates
-            // internal name and value buffers (makes them point to the next element).
-            //
-            // TLDR: name MUST be used and saved before GetPayload is executed.
-            nameBuilder.ComputeNextUniqueName(entry.GetName(), value);
-            value[nameBuilder.c_str()] = GetPayload(decoder);
-            break;
-        case PayloadEntry::IMPayloadType::kNestingExit:
-            return value;
-        case PayloadEntry::IMPayloadType::kAttribute:
-            value[formatter.Reset().AddFormat("ATTR(%u/%u)", entry.GetClusterId(), entry.GetAttributeId()).c_str()] =
-                "<NOT_DECODED>";
-            break;
-        case PayloadEntry::IMPayloadType::kCommand:
-            value[formatter.Reset().AddFormat("CMD(%u/%u)", entry.GetClusterId(), entry.GetCommandId()).c_str()] = "<NOT_DECODED>";
-            continue;
-        case PayloadEntry::IMPayloadType::kEvent:
-            value[formatter.Reset().AddFormat("EVNT(%u/%u)", entry.GetClusterId(), entry.GetEventId()).c_str()] = "<NOT_DECODED>";
-            continue;
-        default:
-            nameBuilder.ComputeNextUniqueName(entry.GetName(), value);
-            value[nameBuilder.c_str()] = entry.GetValueText();
-            break;
-        }
-    }
-    return value;
-}
-
-#endif
-
-void DecodePayloadHeader(::Json::Value & value, const PayloadHeader * payloadHeader)
-{
-
-    value["exchangeFlags"] = payloadHeader->GetExchangeFlags();
-    value["exchangeId"]    = payloadHeader->GetExchangeID();
-    value["protocolId"]    = payloadHeader->GetProtocolID().ToFullyQualifiedSpecForm();
-    value["messageType"]   = payloadHeader->GetMessageType();
-    value["initiator"]     = payloadHeader->IsInitiator();
-    value["needsAck"]      = payloadHeader->NeedsAck();
-
-    const Optional<uint32_t> & acknowledgedMessageCounter = payloadHeader->GetAckMessageCounter();
-    if (acknowledgedMessageCounter.HasValue())
-    {
-        value["ackMessageCounter"] = acknowledgedMessageCounter.Value();
-    }
-}
-
-void DecodePacketHeader(::Json::Value & value, const PacketHeader * packetHeader)
-{
-    value["msgCounter"]    = packetHeader->GetMessageCounter();
-    value["sessionId"]     = packetHeader->GetSessionId();
-    value["flags"]         = packetHeader->GetMessageFlags();
-    value["securityFlags"] = packetHeader->GetSecurityFlags();
-
-    {
-        const Optional<NodeId> & nodeId = packetHeader->GetSourceNodeId();
-        if (nodeId.HasValue())
-        {
-            value["sourceNodeId"] = nodeId.Value();
-        }
-    }
-
-    {
-        const Optional<NodeId> & nodeId = packetHeader->GetDestinationNodeId();
-        if (nodeId.HasValue())
-        {
-            value["destinationNodeId"] = nodeId.Value();
-        }
-    }
-
-    {
-        const Optional<GroupId> & groupId = packetHeader->GetDestinationGroupId();
-        if (groupId.HasValue())
-        {
-            value["groupId"] = groupId.Value();
-        }
-    }
-}
-
-void DecodePayloadData(::Json::Value & value, chip::ByteSpan payload, Protocols::Id protocolId, uint8_t messageType)
-{
-    value["size"] = static_cast<::Json::Value::UInt>(payload.size());
-
-#if MATTER_LOG_JSON_DECODE_HEX
-    char hex_buffer[4096];
-    if (chip::Encoding::BytesToUppercaseHexString(payload.data(), payload.size(), hex_buffer, sizeof(hex_buffer)) == CHIP_NO_ERROR)
-    {
-        value["hex"] = hex_buffer;
-    }
-#endif // MATTER_LOG_JSON_DECODE_HEX
-
-#if MATTER_LOG_JSON_DECODE_FULL
-
-    // As PayloadDecoder is quite large (large strings buffers), we place it in heap
-    auto decoder = chip::Platform::MakeUnique<PayloadDecoderType>(PayloadDecoderInitParams()
-                                                                      .SetProtocolDecodeTree(chip::TLVMeta::protocols_meta)
-                                                                      .SetClusterDecodeTree(chip::TLVMeta::clusters_meta)
-                                                                      .SetProtocol(protocolId)
-                                                                      .SetMessageType(messageType));
-
-    decoder->StartDecoding(payload);
-
-    value["decoded"] = GetPayload(*decoder);
-#endif // MATTER_LOG_JSON_DECODE_FULL
-}
-
-} // namespace
-
 JsonBackend::~JsonBackend()
 {
     CloseFile();
@@ -253,28 +48,21 @@ JsonBackend::~JsonBackend()
 void JsonBackend::TraceBegin(const char * label, const char * group)
 {
     ::Json::Value value;
-
-    value["event"] = "TraceBegin";
-    value["label"] = label;
-    value["group"] = group;
+    FillTraceRecord(value, "TraceBegin", label, group);
     OutputValue(value);
 }
 
 void JsonBackend::TraceEnd(const char * label, const char * group)
 {
     ::Json::Value value;
-    value["event"] = "TraceEnd";
-    value["label"] = label;
-    value["group"] = group;
+    FillTraceRecord(value, "TraceEnd", label, group);
     OutputValue(value);
 }
 
 void JsonBackend::TraceInstant(const char * label, const char * group)
 {
     ::Json::Value value;
-    value["event"] = "TraceInstant";
-    value["label"] = label;
-    value["group"] = group;
+    FillTraceRecord(value, "TraceInstant", label, group);
     OutputValue(value);
 }
 
@@ -290,9 +78,7 @@ void JsonBackend::TraceCounter(const char * label)
         mCounters[counterId]++;
     }
     ::Json::Value value;
-    value["event"] = "TraceCounter";
-    value["label"] = label;
-    value["count"] = mCounters[counterId];
+    FillCounterRecord(value, label, mCounters[counterId]);
 
     // Output the counter event
     OutputValue(value);
@@ -301,29 +87,7 @@ void JsonBackend::TraceCounter(const char * label)
 void JsonBackend::LogMetricEvent(const MetricEvent & event)
 {
     ::Json::Value value;
-
-    value["label"] = event.key();
-
-    using ValueType = MetricEvent::Value::Type;
-    switch (event.ValueType())
-    {
-    case ValueType::kInt32:
-        value["value"] = event.ValueInt32();
-        break;
-    case ValueType::kUInt32:
-        value["value"] = event.ValueUInt32();
-        break;
-    case ValueType::kChipErrorCode:
-        value["value"] = event.ValueErrorCode();
-        break;
-    case ValueType::kUndefined:
-        value["value"] = ::Json::Value();
-        break;
-    default:
-        value["value"] = "UNKNOWN";
-        break;
-    }
-
+    FillMetricRecord(value, event);
     OutputValue(value);
 }
 
@@ -331,25 +95,10 @@ void JsonBackend::LogMessageSend(MessageSendInfo & info)
 {
     ::Json::Value value;
 
-    value["event"] = "MessageSend";
-
-    switch (info.messageType)
-    {
-    case OutgoingMessageType::kGroupMessage:
-        value["messageType"] = "Group";
-        break;
-    case OutgoingMessageType::kSecureSession:
-        value["messageType"] = "Secure";
-        break;
-    case OutgoingMessageType::kUnauthenticated:
-        value["messageType"] = "Unauthenticated";
-        break;
-    }
-
-    DecodePayloadHeader(value["payloadHeader"], info.payloadHeader);
-    DecodePacketHeader(value["packetHeader"], info.packetHeader);
-    DecodePayloadData(value["payload"], info.payload, info.payloadHeader->GetProtocolID(), info.payloadHeader->GetMessageType());
-    value["messageTotalSize"] = static_cast<int>(info.messageTotalSize);
+    FillMessageSendRecord(value, info.messageType, *info.payloadHeader, *info.packetHeader, info.payload.size(),
+                          info.messageTotalSize);
+    FillPayloadContents(value["payload"], info.payload, info.payloadHeader->GetProtocolID(),
+                        info.payloadHeader->GetMessageType());
 
     OutputValue(value);
 }
@@ -358,25 +107,10 @@ void JsonBackend::LogMessageReceived(MessageReceivedInfo & info)
 {
     ::Json::Value value;
 
-    value["event"] = "MessageReceived";
-
-    switch (info.messageType)
-    {
-    case IncomingMessageType::kGroupMessage:
-        value["messageType"] = "Group";
-        break;
-    case IncomingMessageType::kSecureUnicast:
-        value["messageType"] = "Secure";
-        break;
-    case IncomingMessageType::kUnauthenticated:
-        value["messageType"] = "Unauthenticated";
-        break;
-    }
-
-    DecodePayloadHeader(value["payloadHeader"], info.payloadHeader);
-    DecodePacketHeader(value["packetHeader"], info.packetHeader);
-    DecodePayloadData(value["payload"], info.payload, info.payloadHeader->GetProtocolID(), info.payloadHeader->GetMessageType());
-    value["messageTotalSize"] = static_cast<int>(info.messageTotalSize);
+    FillMessageReceivedRecord(value, info.messageType, *info.payloadHeader, *info.packetHeader, info.payload.size(),
+                              info.messageTotalSize);
+    FillPayloadContents(value["payload"], info.payload, info.payloadHeader->GetProtocolID(),
+                        info.payloadHeader->GetMessageType());
 
     OutputValue(value);
 }
@@ -384,69 +118,21 @@ void JsonBackend::LogMessageReceived(MessageReceivedInfo & info)
 void JsonBackend::LogNodeLookup(NodeLookupInfo & info)
 {
     ::Json::Value value;
-
-    value["event"]                = "LogNodeLookup";
-    value["node_id"]              = info.request->GetPeerId().GetNodeId();
-    value["compressed_fabric_id"] = info.request->GetPeerId().GetCompressedFabricId();
-    value["min_lookup_time_ms"]   = info.request->GetMinLookupTime().count();
-    value["max_lookup_time_ms"]   = info.request->GetMaxLookupTime().count();
-
+    FillNodeLookupRecord(value, *info.request);
     OutputValue(value);
 }
 
 void JsonBackend::LogNodeDiscovered(NodeDiscoveredInfo & info)
 {
     ::Json::Value value;
-    value["event"] = "LogNodeDiscovered";
-
-    value["node_id"]              = info.peerId->GetNodeId();
-    value["compressed_fabric_id"] = info.peerId->GetCompressedFabricId();
-
-    switch (info.type)
-    {
-    case chip::Tracing::DiscoveryInfoType::kIntermediateResult:
-        value["type"] = "intermediate";
-        break;
-    case chip::Tracing::DiscoveryInfoType::kResolutionDone:
-        value["type"] = "done";
-        break;
-    case chip::Tracing::DiscoveryInfoType::kRetryDifferent:
-        value["type"] = "retry-different";
-        break;
-    }
-
-    {
-        ::Json::Value result;
-
-        char address_buff[chip::Transport::PeerAddress::kMaxToStringSize];
-
-        info.result->address.ToString(address_buff);
-
-        result["supports_tcp_client"] = info.result->supportsTcpClient;
-        result["supports_tcp_server"] = info.result->supportsTcpServer;
-        result["address"]             = address_buff;
-
-        result["mrp"]["idle_retransmit_timeout_ms"]   = info.result->mrpRemoteConfig.mIdleRetransTimeout.count();
-        result["mrp"]["active_retransmit_timeout_ms"] = info.result->mrpRemoteConfig.mActiveRetransTimeout.count();
-        result["mrp"]["active_threshold_time_ms"]     = info.result->mrpRemoteConfig.mActiveThresholdTime.count();
-
-        result["isICDOperatingAsLIT"] = info.result->isICDOperatingAsLIT;
-
-        value["result"] = result;
-    }
-
+    FillNodeDiscoveredRecord(value, info.type, *info.peerId, *info.result);
     OutputValue(value);
 }
 
 void JsonBackend::LogNodeDiscoveryFailed(NodeDiscoveryFailedInfo & info)
 {
     ::Json::Value value;
-
-    value["event"]                = "LogNodeDiscoveryFailed";
-    value["node_id"]              = info.peerId->GetNodeId();
-    value["compressed_fabric_id"] = info.peerId->GetCompressedFabricId();
-    value["error"]                = chip::ErrorStr(info.error);
-
+    FillNodeDiscoveryFailedRecord(value, *info.peerId, info.error);
     OutputValue(value);
 }
 
@@ -468,8 +154,10 @@ CHIP_ERROR JsonBackend::OpenFile(const char * path)
 
     std::error_code ec;
     std::filesystem::path filePath(path);
-    // Create directories if they don't exist
-    if (!std::filesystem::create_directories(filePath.remove_filename(), ec))
+    // Create directories if they don't exist. Note that create_directories returns
+    // false (without an error) when the directories already exist.
+    filePath.remove_filename();
+    if (!filePath.empty() && !std::filesystem::create_directories(filePath, ec) && ec)
     {
         return CHIP_ERROR_POSIX(ec.value());
     }
@@ -487,6 +175,11 @@ CHIP_ERROR JsonBackend::OpenFile(const char * path)
 }
 
 void JsonBackend::OutputValue(::Json::Value & value)
+{
+    OutputRecord(value, chip::System::SystemClock().GetMonotonicTimestamp());
+}
+
+void JsonBackend::OutputRecord(::Json::Value & value, System::Clock::Timestamp timestamp)
 {
     ::Json::StreamWriterBuilder builder;
     std::unique_ptr<::Json::StreamWriter> writer(builder.newStreamWriter());
@@ -501,7 +194,7 @@ void JsonBackend::OutputValue(::Json::Value & value)
         {
             mFirstRecord = false;
         }
-        value["time_ms"] = chip::System::SystemClock().GetMonotonicTimestamp().count();
+        value["time_ms"] = timestamp.count();
         writer->write(value, &mOutputFile);
         mOutputFile.flush();
     }
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <lib/core/CHIPError.h>
+#include <system/SystemClock.h>
 #include <tracing/backend.h>
 
 #include <fstream>
@@ -63,6 +64,13 @@ public:
     void LogMetricEvent(const MetricEvent &) override;
     void Close() override { CloseFile(); }
 
+    /// Writes a record built by one of the json_records.h builders, for an
+    /// event that happened at `timestamp`.
+    ///
+    /// Used by backends that serialize events after they were traced. NOT
+    /// thread safe with respect to the other methods of this class.
+    void OutputRecord(::Json::Value & value, System::Clock::Timestamp timestamp);
+
 private:
     /// Does the actual write of the value
     void OutputValue(::Json::Value & value);
@@ -0,0 +1,158 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <tracing/json/async_json_tracing.h>
+
+#include <json/json.h>
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace chip;
+using namespace chip::Tracing::Json;
+
+namespace {
+
+class TestAsyncJsonTracing : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+
+    void SetUp() override { mPath = "/tmp/chip_async_json_tracing_test_" + std::to_string(getpid()) + ".json"; }
+    void TearDown() override { std::remove(mPath.c_str()); }
+
+    ::Json::Value ReadTrace()
+    {
+        std::ifstream input(mPath);
+        ::Json::Value trace;
+        ::Json::CharReaderBuilder builder;
+        std::string errors;
+        EXPECT_TRUE(::Json::parseFromStream(builder, input, &trace, &errors));
+        return trace;
+    }
+
+protected:
+    std::string mPath;
+};
+
+TEST_F(TestAsyncJsonTracing, WritesEventsOfAllThreads)
+{
+    constexpr int kThreads         = 3;
+    constexpr int kEventsPerThread = 100;
+
+    AsyncJsonBackend backend;
+    ASSERT_EQ(backend.OpenFile(mPath.c_str()), CHIP_NO_ERROR);
+    backend.Open();
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < kThreads; i++)
+    {
+        threads.emplace_back([&backend] {
+            for (int j = 0; j < kEventsPerThread; j++)
+            {
+                backend.TraceBegin("Scope", "Test");
+                backend.TraceCounter("Counter");
+                backend.TraceEnd("Scope", "Test");
+            }
+        });
+    }
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    backend.Close();
+    EXPECT_EQ(backend.GetDroppedEventCount(), 0u);
+
+    ::Json::Value trace = ReadTrace();
+    ASSERT_TRUE(trace.isArray());
+    ASSERT_EQ(trace.size(), static_cast<::Json::ArrayIndex>(3 * kThreads * kEventsPerThread));
+
+    int begins  = 0;
+    int ends    = 0;
+    int counter = 0;
+    for (const auto & record : trace)
+    {
+        const std::string event = record["event"].asString();
+        if (event == "TraceBegin")
+        {
+            begins++;
+            EXPECT_EQ(record["label"].asString(), "Scope");
+            EXPECT_EQ(record["group"].asString(), "Test");
+        }
+        else if (event == "TraceEnd")
+        {
+            ends++;
+        }
+        else if (event == "TraceCounter")
+        {
+            // Counters are numbered as they are written out
+            EXPECT_EQ(record["count"].asInt(), ++counter);
+        }
+        EXPECT_TRUE(record.isMember("time_ms"));
+    }
+
+    EXPECT_EQ(begins, kThreads * kEventsPerThread);
+    EXPECT_EQ(ends, kThreads * kEventsPerThread);
+    EXPECT_EQ(counter, kThreads * kEventsPerThread);
+}
+
+TEST_F(TestAsyncJsonTracing, CountsDroppedEvents)
+{
+    constexpr ::Json::ArrayIndex kRingSize = 4;
+
+    // Not registered, so nothing drains the ring until flushed
+    AsyncJsonBackend backend(kRingSize);
+    ASSERT_EQ(backend.OpenFile(mPath.c_str()), CHIP_NO_ERROR);
+
+    for (int i = 0; i < 10; i++)
+    {
+        backend.TraceInstant("Instant", "Test");
+    }
+    EXPECT_EQ(backend.GetDroppedEventCount(), 6u);
+
+    // Once drained, there is room for new events again
+    backend.Flush();
+    backend.TraceInstant("Instant", "Test");
+    backend.CloseFile();
+    EXPECT_EQ(backend.GetDroppedEventCount(), 6u);
+
+    ::Json::Value trace = ReadTrace();
+    ASSERT_TRUE(trace.isArray());
+    ASSERT_EQ(trace.size(), kRingSize + 2);
+
+    for (::Json::ArrayIndex i = 0; i < kRingSize; i++)
+    {
+        EXPECT_EQ(trace[i]["event"].asString(), "TraceInstant");
+    }
+    EXPECT_EQ(trace[kRingSize]["event"].asString(), "EventsDropped");
+    EXPECT_EQ(trace[kRingSize]["count"].asUInt64(), 6u);
+    EXPECT_EQ(trace[kRingSize + 1]["event"].asString(), "TraceInstant");
+}
+
+} // namespace
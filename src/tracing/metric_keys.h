@@ -75,8 +75,14 @@ constexpr MetricKey kMetricDeviceCASESessionSigmaFinished = "core_dev_case_sessi
 // MRP Retry Counter
 constexpr MetricKey kMetricDeviceRMPRetryCount = "core_dev_rmp_retry_count";
 
+// MRP round trip, from the initial send of a reliable message to its ack, in milliseconds
+constexpr MetricKey kMetricDeviceRMPRoundTrip = "core_dev_rmp_round_trip_ms";
+
 // Subscription setup
 constexpr MetricKey kMetricDeviceSubscriptionSetup = "core_dev_subscription_setup";
 
+// Generation of a single report (read or subscription) by the reporting engine
+constexpr MetricKey kMetricDeviceReportGeneration = "core_dev_report_generation";
+
 } // namespace Tracing
 } // namespace chip
@@ -51,8 +51,8 @@ Optional<SessionHandle> SecureSessionTable::CreateNewSecureSessionForTest(Secure
         }
     }
 
-    SecureSession * result = mEntries.CreateObject(*this, secureSessionType, localSessionId, localNodeId, peerNodeId, peerCATs,
-                                                   peerSessionId, fabricIndex, config);
+    SecureSession * result = TrackSession(mEntries.CreateObject(*this, secureSessionType, localSessionId, localNodeId, peerNodeId,
+                                                                peerCATs, peerSessionId, fabricIndex, config));
     return result != nullptr ? MakeOptional<SessionHandle>(*result) : Optional<SessionHandle>::Missing();
 }
 
@@ -72,7 +72,7 @@ Optional<SessionHandle> SecureSessionTable::CreateNewSecureSession(SecureSession
     //
     if (mEntries.Allocated() < GetMaxSessionTableSize())
     {
-        allocated = mEntries.CreateObject(*this, secureSessionType, sessionId.Value());
+        allocated = TrackSession(mEntries.CreateObject(*this, secureSessionType, sessionId.Value()));
     }
     else
     {
@@ -215,7 +215,7 @@ SecureSession * SecureSessionTable::EvictAndAllocate(uint16_t localSessionId, Se
         if (newCount < prevCount)
         {
             ChipLogProgress(SecureChannel, "Successfully evicted a session!");
-            auto * retSession = mEntries.CreateObject(*this, secureSessionType, localSessionId);
+            auto * retSession = TrackSession(mEntries.CreateObject(*this, secureSessionType, localSessionId));
             VerifyOrDie(session != nullptr);
             return retSession;
         }
@@ -338,68 +338,93 @@ void SecureSessionTable::DefaultEvictionPolicy(EvictionPolicyContext & evictionC
 
 Optional<SessionHandle> SecureSessionTable::FindSecureSessionByLocalKey(uint16_t localSessionId)
 {
-    SecureSession * result = nullptr;
-    mEntries.ForEachActiveObject([&](auto session) {
-        if (session->GetLocalSessionId() == localSessionId)
-        {
-            result = session;
-            return Loop::Break;
-        }
-        return Loop::Continue;
-    });
+    SecureSession * result = mSessionIdIndex.Find(localSessionId);
     return result != nullptr ? MakeOptional<SessionHandle>(*result) : Optional<SessionHandle>::Missing();
 }
 
 Optional<uint16_t> SecureSessionTable::FindUnusedSessionId()
 {
-    uint16_t candidate_base = 0;
-    uint64_t candidate_mask = 0;
-    for (uint32_t i = 0; i <= kMaxSessionID; i += 64)
+    // At most CHIP_CONFIG_SECURE_SESSION_POOL_SIZE IDs are in use, so this only
+    // goes around the whole ID space if the index is somehow full.
+    uint16_t candidate = mNextSessionId;
+    for (uint32_t i = 0; i <= kMaxSessionID; i++, candidate++)
     {
-        // candidate_base is the base session ID we are searching from.
-        // We have a 64-bit mask anchored at this ID and iterate over the
-        // whole session table, setting bits in the mask for in-use IDs.
-        // If we can iterate through the entire session table and have
-        // any bits clear in the mask, we have available session IDs.
-        candidate_base = static_cast<uint16_t>(i + mNextSessionId);
-        candidate_mask = 0;
+        if (candidate != kUnsecuredSessionId && mSessionIdIndex.Find(candidate) == nullptr)
         {
-            uint16_t shift = static_cast<uint16_t>(kUnsecuredSessionId - candidate_base);
-            if (shift <= 63)
-            {
-                candidate_mask |= (1ULL << shift); // kUnsecuredSessionId is never available
-            }
+            return MakeOptional<uint16_t>(candidate);
         }
-        mEntries.ForEachActiveObject([&](auto session) {
-            uint16_t shift = static_cast<uint16_t>(session->GetLocalSessionId() - candidate_base);
-            if (shift <= 63)
-            {
-                candidate_mask |= (1ULL << shift);
-            }
-            if (candidate_mask == UINT64_MAX)
-            {
-                return Loop::Break; // No bits clear means this bucket is full.
-            }
-            return Loop::Continue;
-        });
-        if (candidate_mask != UINT64_MAX)
+    }
+
+    return NullOptional;
+}
+
+SecureSession * SecureSessionTable::TrackSession(SecureSession * session)
+{
+    VerifyOrReturnValue(session != nullptr, nullptr);
+    if (!mSessionIdIndex.Add(session))
+    {
+        mEntries.ReleaseObject(session);
+        return nullptr;
+    }
+    return session;
+}
+
+size_t SecureSessionTable::SessionIdIndex::Hash(uint16_t localSessionId)
+{
+    // Fibonacci hashing: session IDs are allocated sequentially, spread them out.
+    return static_cast<size_t>((static_cast<uint32_t>(localSessionId) * 2654435769u) >> (32 - kBits));
+}
+
+bool SecureSessionTable::SessionIdIndex::Add(SecureSession * session)
+{
+    // Always keep an empty slot, so that probing terminates.
+    VerifyOrReturnValue(mCount + 1 < kCapacity, false);
+
+    size_t slot = Hash(session->GetLocalSessionId());
+    while (mSlots[slot] != nullptr)
+    {
+        slot = (slot + 1) & (kCapacity - 1);
+    }
+    mSlots[slot] = session;
+    mCount++;
+    return true;
+}
+
+void SecureSessionTable::SessionIdIndex::Remove(const SecureSession * session)
+{
+    size_t hole = Hash(session->GetLocalSessionId());
+    while (mSlots[hole] != session)
+    {
+        VerifyOrReturn(mSlots[hole] != nullptr);
+        hole = (hole + 1) & (kCapacity - 1);
+    }
+
+    // Backward-shift deletion: move up any following session whose probe
+    // sequence went through the hole, so that lookups never stop short of it.
+    for (size_t i = (hole + 1) & (kCapacity - 1); mSlots[i] != nullptr; i = (i + 1) & (kCapacity - 1))
+    {
+        const size_t home = Hash(mSlots[i]->GetLocalSessionId());
+        if (((i - home) & (kCapacity - 1)) >= ((i - hole) & (kCapacity - 1)))
         {
-            break; // Any bit clear means we have an available ID in this bucket.
+            mSlots[hole] = mSlots[i];
+            hole         = i;
         }
     }
-    if (candidate_mask != UINT64_MAX)
+
+    mSlots[hole] = nullptr;
+    mCount--;
+}
+
+SecureSession * SecureSessionTable::SessionIdIndex::Find(uint16_t localSessionId) const
+{
+    for (size_t slot = Hash(localSessionId); mSlots[slot] != nullptr; slot = (slot + 1) & (kCapacity - 1))
     {
-        uint16_t offset = 0;
-        while (candidate_mask & 1)
+        if (mSlots[slot]->GetLocalSessionId() == localSessionId)
         {
-            candidate_mask >>= 1;
-            ++offset;
+            return mSlots[slot];
         }
-        uint16_t available = static_cast<uint16_t>(candidate_base + offset);
-        return MakeOptional<uint16_t>(available);
     }
-
-    return NullOptional;
+    return nullptr;
 }
 
 } // namespace Transport
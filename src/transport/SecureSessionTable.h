@@ -29,6 +29,31 @@ namespace Transport {
 inline constexpr uint16_t kMaxSessionID       = UINT16_MAX;
 inline constexpr uint16_t kUnsecuredSessionId = 0;
 
+namespace internal {
+
+// Smallest power of 2 keeping a session ID index for `sessionCount` sessions at most two-thirds full.
+constexpr size_t SessionIdIndexCapacity(size_t sessionCount)
+{
+    size_t capacity = 8;
+    while (capacity < sessionCount + sessionCount / 2 + 1)
+    {
+        capacity <<= 1;
+    }
+    return capacity;
+}
+
+constexpr unsigned Log2(size_t powerOfTwo)
+{
+    unsigned bits = 0;
+    while ((static_cast<size_t>(1) << bits) < powerOfTwo)
+    {
+        bits++;
+    }
+    return bits;
+}
+
+} // namespace internal
+
 /**
  * Handles a set of sessions.
  *
@@ -76,7 +101,11 @@ public:
     CHECK_RETURN_VALUE
     Optional<SessionHandle> CreateNewSecureSession(SecureSession::Type secureSessionType, ScopedNodeId sessionEvictionHint);
 
-    void ReleaseSession(SecureSession * session) { mEntries.ReleaseObject(session); }
+    void ReleaseSession(SecureSession * session)
+    {
+        mSessionIdIndex.Remove(session);
+        mEntries.ReleaseObject(session);
+    }
 
     template <typename Function>
     Loop ForEachSession(Function && function)
@@ -243,21 +272,53 @@ private:
     /**
      * Find an available session ID that is unused in the secure session table.
      *
-     * The search algorithm iterates over the session ID space in the outer loop
-     * and the session table in the inner loop to locate an available session ID
-     * from the starting mNextSessionId clue.
-     *
-     * The outer-loop considers 64 session IDs in each iteration to give a
-     * runtime complexity of O(CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE^2/64).  Speed up could be
-     * achieved with a sorted session table or additional storage.
+     * Session IDs are tried in order from the starting mNextSessionId clue,
+     * each one being looked up in the session ID index. Since at most
+     * CHIP_CONFIG_SECURE_SESSION_POOL_SIZE session IDs are in use, this takes
+     * at most as many lookups.
      *
      * @return an unused session ID if any is found, else NullOptional
      */
     CHECK_RETURN_VALUE
     Optional<uint16_t> FindUnusedSessionId();
 
+    /**
+     * Adds a newly created session to the session ID index. If that fails, the
+     * session is released.
+     *
+     * @return the session, or nullptr if it was not created or could not be indexed
+     */
+    SecureSession * TrackSession(SecureSession * session);
+
+    /**
+     * Maps local session IDs to the sessions using them, so that incoming
+     * messages find their session without walking the whole table.
+     *
+     * Open addressing with linear probing, sized for the table to be at most
+     * two-thirds full. Removals shift back the following entries of a probe run
+     * instead of leaving tombstones.
+     */
+    class SessionIdIndex
+    {
+    public:
+        // Returns false if the index is full.
+        bool Add(SecureSession * session);
+        void Remove(const SecureSession * session);
+        SecureSession * Find(uint16_t localSessionId) const;
+
+    private:
+        static constexpr size_t kCapacity = internal::SessionIdIndexCapacity(CHIP_CONFIG_SECURE_SESSION_POOL_SIZE);
+        static constexpr unsigned kBits   = internal::Log2(kCapacity);
+
+        static size_t Hash(uint16_t localSessionId);
+
+        SecureSession * mSlots[kCapacity] = {};
+        size_t mCount                     = 0;
+    };
+
     bool mRunningEvictionLogic = false;
     ObjectPool<SecureSession, CHIP_CONFIG_SECURE_SESSION_POOL_SIZE> mEntries;
+    SessionIdIndex mSessionIdIndex;
 
     size_t GetMaxSessionTableSize() const
     {
@@ -43,6 +43,7 @@ public:
     static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
 
     void ValidateSessionSorting();
+    void BenchmarkFindByLocalKey();
 
 private:
     struct SessionParameters
@@ -452,6 +453,106 @@ void TestSecureSessionTable::ValidateSessionSorting()
     }
 }
 
+TEST_F(TestSecureSessionTable, FindByLocalKey)
+{
+    auto sessionTable = Platform::MakeUnique<SecureSessionTable>();
+    ASSERT_NE(sessionTable.get(), nullptr);
+    sessionTable->Init();
+
+    // Pending sessions are released as soon as their last handle goes away.
+    Optional<SessionHandle> sessions[CHIP_CONFIG_SECURE_SESSION_POOL_SIZE];
+    uint16_t localSessionIds[CHIP_CONFIG_SECURE_SESSION_POOL_SIZE];
+    for (size_t i = 0; i < CHIP_CONFIG_SECURE_SESSION_POOL_SIZE; i++)
+    {
+        sessions[i] = sessionTable->CreateNewSecureSession(SecureSession::Type::kCASE, ScopedNodeId());
+        ASSERT_TRUE(sessions[i].HasValue());
+        localSessionIds[i] = sessions[i].Value()->AsSecureSession()->GetLocalSessionId();
+    }
+
+    for (size_t i = 0; i < CHIP_CONFIG_SECURE_SESSION_POOL_SIZE; i++)
+    {
+        auto found = sessionTable->FindSecureSessionByLocalKey(localSessionIds[i]);
+        ASSERT_TRUE(found.HasValue());
+        EXPECT_EQ(found.Value()->AsSecureSession(), sessions[i].Value()->AsSecureSession());
+    }
+    EXPECT_FALSE(sessionTable->FindSecureSessionByLocalKey(kUnsecuredSessionId).HasValue());
+
+    // Release every other session: the others must still be found, the released IDs must not.
+    for (size_t i = 0; i < CHIP_CONFIG_SECURE_SESSION_POOL_SIZE; i += 2)
+    {
+        sessions[i].ClearValue();
+        EXPECT_FALSE(sessionTable->FindSecureSessionByLocalKey(localSessionIds[i]).HasValue());
+    }
+    for (size_t i = 1; i < CHIP_CONFIG_SECURE_SESSION_POOL_SIZE; i += 2)
+    {
+        EXPECT_TRUE(sessionTable->FindSecureSessionByLocalKey(localSessionIds[i]).HasValue());
+    }
+
+    // New sessions must get IDs that are not in use.
+    auto session = sessionTable->CreateNewSecureSession(SecureSession::Type::kCASE, ScopedNodeId());
+    ASSERT_TRUE(session.HasValue());
+    uint16_t localSessionId = session.Value()->AsSecureSession()->GetLocalSessionId();
+    EXPECT_NE(localSessionId, kUnsecuredSessionId);
+    for (size_t i = 1; i < CHIP_CONFIG_SECURE_SESSION_POOL_SIZE; i += 2)
+    {
+        EXPECT_NE(localSessionIds[i], localSessionId);
+    }
+    EXPECT_TRUE(sessionTable->FindSecureSessionByLocalKey(localSessionId).HasValue());
+}
+
+void TestSecureSessionTable::BenchmarkFindByLocalKey()
+{
+    // Every received secure message looks up its session by local session ID.
+    constexpr uint32_t kLookups = 100000;
+
+    for (size_t tableSize : { 16u, 256u, 4096u })
+    {
+        if (tableSize > CHIP_CONFIG_SECURE_SESSION_POOL_SIZE)
+        {
+            ChipLogProgress(Test, "Skipping %u sessions: CHIP_CONFIG_SECURE_SESSION_POOL_SIZE is %u",
+                            static_cast<unsigned>(tableSize), static_cast<unsigned>(CHIP_CONFIG_SECURE_SESSION_POOL_SIZE));
+            continue;
+        }
+
+        auto sessionTable = Platform::MakeUnique<SecureSessionTable>();
+        ASSERT_NE(sessionTable.get(), nullptr);
+        sessionTable->Init();
+        sessionTable->SetMaxSessionTableSize(tableSize);
+
+        std::vector<SessionHandle> sessions;
+        std::vector<uint16_t> localSessionIds;
+        for (size_t i = 0; i < tableSize; i++)
+        {
+            auto session = sessionTable->CreateNewSecureSession(SecureSession::Type::kCASE, ScopedNodeId());
+            ASSERT_TRUE(session.HasValue());
+            localSessionIds.push_back(session.Value()->AsSecureSession()->GetLocalSessionId());
+            sessions.push_back(std::move(session.Value()));
+        }
+
+        uint32_t found                      = 0;
+        System::Clock::Microseconds64 start = System::SystemClock().GetMonotonicMicroseconds64();
+        for (uint32_t i = 0; i < kLookups; i++)
+        {
+            // Stride through the table so that lookups do not favour its first entries.
+            if (sessionTable->FindSecureSessionByLocalKey(localSessionIds[(i * 7919u) % tableSize]).HasValue())
+            {
+                found++;
+            }
+        }
+        System::Clock::Microseconds64 elapsed = System::SystemClock().GetMonotonicMicroseconds64() - start;
+        EXPECT_EQ(found, kLookups);
+
+        ChipLogProgress(Test, "%u sessions: %u lookups in %llu us", static_cast<unsigned>(tableSize), kLookups,
+                        static_cast<unsigned long long>(elapsed.count()));
+    }
+}
+
+TEST_F(TestSecureSessionTable, BenchmarkFindByLocalKey)
+{
+    // SetMaxSessionTableSize is private, see ValidateSessionSorting below.
+    BenchmarkFindByLocalKey();
+}
+
 TEST_F(TestSecureSessionTable, ValidateSessionSorting)
 {
     // This calls TestSecureSessionTable::ValidateSessionSorting instead of just doing the